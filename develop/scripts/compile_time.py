@@ -0,0 +1,139 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.abspath(os.path.join(SCRIPT_DIR, "..", ".."))
+
+HEADERS_DIR = os.path.join(ROOT_DIR, "headers")
+SINGLES_DIR = os.path.join(ROOT_DIR, "develop", "singles", "headers")
+
+DEFAULT_HEADERS = [
+    "vmath.hpp/vmath_fwd.hpp",
+    "vmath.hpp/vmath_vec.hpp",
+    "vmath.hpp/vmath_core.hpp",
+    "vmath.hpp/vmath_cast.hpp",
+    "vmath.hpp/vmath_hash.hpp",
+    "vmath.hpp/vmath_ext.hpp",
+    "vmath.hpp/vmath_all.hpp",
+]
+
+SINGLES_HEADERS = [
+    "vmath.hpp/vmath_core.hpp",
+    "vmath.hpp/vmath_all.hpp",
+]
+
+INSTANTIATE_BODY = """
+namespace
+{
+    using namespace vmath_hpp;
+
+    template < typename T, std::size_t Size >
+    void touch_vec(vec<T, Size>& v) {
+        v = v + v * v - v / (v + T{1});
+        v = min(max(v, v), v);
+        v = clamp(v, v, v);
+        v = v * dot(v, v);
+        if constexpr ( std::is_floating_point_v<T> ) {
+            v = normalize(v) * length(v);
+            v = lerp(v, v, T{0.5f});
+        }
+    }
+
+    template < typename T, std::size_t Size >
+    void touch_mat(mat<T, Size>& m) {
+        m = m * m + transpose(m);
+        m = m * determinant(m);
+        if constexpr ( std::is_floating_point_v<T> ) {
+            m = inverse(m);
+        }
+    }
+
+    template < typename T >
+    void touch_all() {
+        vec<T, 2> v2; vec<T, 3> v3; vec<T, 4> v4;
+        mat<T, 2> m2; mat<T, 3> m3; mat<T, 4> m4;
+        touch_vec(v2); touch_vec(v3); touch_vec(v4);
+        touch_mat(m2); touch_mat(m3); touch_mat(m4);
+    }
+}
+
+void touch() {
+    touch_all<int>();
+    touch_all<float>();
+    touch_all<double>();
+}
+"""
+
+
+def MakeSource(includes, body):
+    lines = ["#include <{}>".format(include) for include in includes]
+    return "\n".join(lines) + "\n" + body
+
+
+def MeasureOnce(compiler, flags, sourcePath):
+    command = [compiler] + flags + [sourcePath]
+    startTime = time.perf_counter()
+    subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+    return (time.perf_counter() - startTime) * 1000.0
+
+
+def Measure(compiler, flags, source, runs):
+    with tempfile.TemporaryDirectory() as tempDir:
+        sourcePath = os.path.join(tempDir, "tu.cpp")
+        objectPath = os.path.join(tempDir, "tu.o")
+
+        with open(sourcePath, "w") as sourceStream:
+            sourceStream.write(source)
+
+        flags = flags + ["-o", objectPath]
+        MeasureOnce(compiler, flags, sourcePath)  # warm up the file cache
+
+        return statistics.median(
+            MeasureOnce(compiler, flags, sourcePath) for _ in range(runs))
+
+
+def Main():
+    parser = argparse.ArgumentParser(
+        description="Measures the per translation unit cost of including vmath.hpp headers")
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--std", default="c++17")
+    parser.add_argument("--runs", type=int, default=5)
+    parser.add_argument("--flags", default="-O2", help="extra compiler flags")
+    parser.add_argument("headers", nargs="*", default=DEFAULT_HEADERS,
+                        help="headers to measure, relative to the include directory")
+    args = parser.parse_args()
+
+    baseFlags = ["-std={}".format(args.std)] + args.flags.split()
+
+    scenarios = [("<empty>", HEADERS_DIR, [], "")]
+    for header in args.headers:
+        scenarios.append((header, HEADERS_DIR, [header], ""))
+    for header in SINGLES_HEADERS:
+        scenarios.append(("<singles> " + header, SINGLES_DIR, [header], ""))
+    scenarios.append(("<instantiate>", HEADERS_DIR, ["vmath.hpp/vmath_all.hpp"], INSTANTIATE_BODY))
+
+    print("{:<40} {:>12} {:>12}".format("scenario", "parse, ms", "compile, ms"))
+
+    for name, includeDir, includes, body in scenarios:
+        flags = baseFlags + ["-I{}".format(includeDir)]
+        source = MakeSource(includes, body)
+
+        parseTime = Measure(args.cxx, flags + ["-fsyntax-only"], source, args.runs) \
+            if "msvc" not in args.cxx else 0.0
+        compileTime = Measure(args.cxx, flags + ["-c"], source, args.runs)
+
+        print("{:<40} {:>12.1f} {:>12.1f}".format(name, parseTime, compileTime))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(Main())
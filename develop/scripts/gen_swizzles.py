@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import itertools
+import os
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.abspath(os.path.join(SCRIPT_DIR, "..", ".."))
+
+OUTPUT_PATH = os.path.join(ROOT_DIR, "headers", "vmath.hpp", "vmath_swizzle.hpp")
+
+COMPONENTS = "xyzw"
+
+HEADER = """/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+// generated by develop/scripts/gen_swizzles.py, do not edit
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_vec.hpp"
+#include "vmath_vec_fun.hpp"
+
+//
+// Named Swizzles
+//
+
+namespace vmath_hpp::swizzles
+{"""
+
+FOOTER = """}
+"""
+
+FUNCTION = """    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, {count}> {name}(const vec<T, Size>& xs) {{ return swizzle<{indices}>(xs); }}"""
+
+def main():
+    functions = []
+    for count in range(2, 5):
+        for combo in itertools.product(range(len(COMPONENTS)), repeat=count):
+            functions.append(FUNCTION.format(
+                count=count,
+                name="".join(COMPONENTS[i] for i in combo),
+                indices=", ".join(str(i) for i in combo)))
+    with open(OUTPUT_PATH, "w", newline="\n") as f:
+        f.write(HEADER + "\n" + "\n\n".join(functions) + "\n" + FOOTER)
+
+if __name__ == "__main__":
+    main()
@@ -6,14 +6,19 @@
 
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
-#include <stdexcept>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -32,12 +37,455 @@
 #ifdef VMATH_HPP_NO_EXCEPTIONS
 #  define VMATH_HPP_THROW(...) std::abort()
 #else
+#  include <stdexcept>
 #  define VMATH_HPP_THROW(...) throw __VA_ARGS__
 #endif
 
 #define VMATH_HPP_THROW_IF(pred, ...)\
     ( (pred) ? VMATH_HPP_THROW(__VA_ARGS__) : (void)0 )
 
+// included by vmath_fwd.hpp, must not depend on the rest of the library,
+// everything below is compiled out unless VMATH_HPP_INSTRUMENT or VMATH_HPP_CHECKED is defined
+
+#if defined(VMATH_HPP_INSTRUMENT) || defined(VMATH_HPP_CHECKED)
+#  include <atomic>
+#  include <cstddef>
+#  include <cstdint>
+#  include <cstdio>
+#endif
+
+#if defined(VMATH_HPP_INSTRUMENT)
+#  include <chrono>
+#  include <mutex>
+#endif
+
+#if defined(VMATH_HPP_CHECKED)
+#  include <cmath>
+#  include <type_traits>
+#endif
+
+#if defined(VMATH_HPP_INSTRUMENT) || defined(VMATH_HPP_CHECKED)
+#  if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#    define VMATH_HPP_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#  else
+#    error "VMATH_HPP_INSTRUMENT and VMATH_HPP_CHECKED require __builtin_is_constant_evaluated"
+#  endif
+#endif
+
+#if defined(VMATH_HPP_INSTRUMENT)
+#  define VMATH_HPP_INSTRUMENT_CALL(id, flops)\
+    ( VMATH_HPP_IS_CONSTANT_EVALUATED() ? (void)0 :\
+        ::vmath_hpp::instrument::impl::record(::vmath_hpp::instrument::function::id, (flops)) )
+#else
+#  define VMATH_HPP_INSTRUMENT_CALL(id, flops) (void)0
+#endif
+
+#if defined(VMATH_HPP_CHECKED)
+#  define VMATH_HPP_CHECK_RESULT(name, ...)\
+    ::vmath_hpp::checked::impl::check_result(name, __FILE__, __LINE__, __VA_ARGS__)
+#else
+#  define VMATH_HPP_CHECK_RESULT(name, ...) (__VA_ARGS__)
+#endif
+
+#if defined(VMATH_HPP_INSTRUMENT)
+
+//
+// Instrumentation
+//
+
+namespace vmath_hpp::instrument
+{
+    enum class function : unsigned char {
+        mat_mul,
+        determinant,
+        inverse,
+        normalize,
+        qua_mul,
+        vec_qua_mul,
+        qua_inverse,
+        nlerp,
+        slerp,
+        rotate,
+        qrotate,
+        look_at,
+        count,
+    };
+
+    inline constexpr std::size_t function_count = static_cast<std::size_t>(function::count);
+
+    struct counter {
+        std::uint64_t calls{};
+        std::uint64_t flops{};
+    };
+
+    // user_data is passed through unchanged, the callbacks may be called from any thread
+    struct hooks {
+        void (*on_call)(function f, std::uint64_t flops, void* user_data){};
+        void (*on_zone)(const char* name, std::uint64_t begin_ns, std::uint64_t end_ns, void* user_data){};
+        void* user_data{};
+    };
+}
+
+namespace vmath_hpp::instrument::impl
+{
+    inline thread_local counter thread_counters[function_count]{};
+
+    inline std::atomic<const hooks*> installed_hooks{nullptr};
+    inline std::atomic<unsigned> zone_sample_rate{0};
+
+    [[nodiscard]] inline std::uint64_t now_ns() noexcept {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
+
+    [[nodiscard]] inline unsigned thread_index() noexcept {
+        static std::atomic<unsigned> next_index{0};
+        static thread_local const unsigned index = next_index.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+
+    inline void record(function f, std::uint64_t flops) noexcept {
+        counter& c = thread_counters[static_cast<std::size_t>(f)];
+        c.calls += 1;
+        c.flops += flops;
+
+        if ( const hooks* h = installed_hooks.load(std::memory_order_acquire); h && h->on_call ) {
+            h->on_call(f, flops, h->user_data);
+        }
+    }
+}
+
+namespace vmath_hpp::instrument
+{
+    // function_name
+
+    [[nodiscard]] inline const char* function_name(function f) noexcept {
+        constexpr const char* names[function_count] = {
+            "mat * mat",
+            "determinant",
+            "inverse",
+            "normalize",
+            "qua * qua",
+            "vec * qua",
+            "inverse(qua)",
+            "nlerp",
+            "slerp",
+            "rotate",
+            "qrotate",
+            "look_at",
+        };
+        return names[static_cast<std::size_t>(f)];
+    }
+
+    // thread_counter
+
+    [[nodiscard]] inline counter thread_counter(function f) noexcept {
+        return impl::thread_counters[static_cast<std::size_t>(f)];
+    }
+
+    // reset_thread_counters
+
+    inline void reset_thread_counters() noexcept {
+        for ( counter& c : impl::thread_counters ) {
+            c = counter{};
+        }
+    }
+
+    // dump_thread_counters
+
+    inline void dump_thread_counters(std::FILE* out) {
+        for ( std::size_t i = 0; i < function_count; ++i ) {
+            if ( const counter& c = impl::thread_counters[i]; c.calls > 0 ) {
+                std::fprintf(out, "%-14s %12llu calls %14llu flops\n",
+                    function_name(static_cast<function>(i)),
+                    static_cast<unsigned long long>(c.calls),
+                    static_cast<unsigned long long>(c.flops));
+            }
+        }
+    }
+
+    // set_hooks
+
+    inline void set_hooks(const hooks* h) noexcept {
+        // the hooks must outlive the installation, pass nullptr to remove them
+        impl::installed_hooks.store(h, std::memory_order_release);
+    }
+
+    // set_zone_sample_rate
+
+    inline void set_zone_sample_rate(unsigned rate) noexcept {
+        // 0 disables zone timers, N times every Nth zone entered on each thread
+        impl::zone_sample_rate.store(rate, std::memory_order_relaxed);
+    }
+
+    // zone
+
+    class zone final {
+    public:
+        explicit zone(const char* name) noexcept
+        : name_{name} {
+            static thread_local unsigned entered{0};
+            const unsigned rate = impl::zone_sample_rate.load(std::memory_order_relaxed);
+            if ( rate > 0 && ++entered % rate == 0 ) {
+                begin_ns_ = impl::now_ns();
+            }
+        }
+
+        ~zone() noexcept {
+            if ( begin_ns_ == 0 ) {
+                return;
+            }
+            if ( const hooks* h = impl::installed_hooks.load(std::memory_order_acquire); h && h->on_zone ) {
+                h->on_zone(name_, begin_ns_, impl::now_ns(), h->user_data);
+            }
+        }
+
+        zone(const zone&) = delete;
+        zone& operator=(const zone&) = delete;
+    private:
+        const char* name_{};
+        std::uint64_t begin_ns_{};
+    };
+
+    // trace_writer
+
+    class trace_writer final {
+    public:
+        // writes the Chrome trace event format, loadable by Perfetto and chrome://tracing
+        explicit trace_writer(std::FILE* out)
+        : out_{out} {
+            std::fputs("{\"traceEvents\":[", out_);
+        }
+
+        ~trace_writer() {
+            const hooks* self = &hooks_;
+            impl::installed_hooks.compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+            std::fputs("\n]}\n", out_);
+            std::fflush(out_);
+        }
+
+        trace_writer(const trace_writer&) = delete;
+        trace_writer& operator=(const trace_writer&) = delete;
+
+        [[nodiscard]] const hooks& as_hooks() const noexcept {
+            return hooks_;
+        }
+
+        [[nodiscard]] std::uint64_t event_count() const {
+            const std::lock_guard<std::mutex> guard{mutex_};
+            return event_count_;
+        }
+    private:
+        static void on_call(function f, std::uint64_t flops, void* user_data) {
+            auto* self = static_cast<trace_writer*>(user_data);
+            const std::lock_guard<std::mutex> guard{self->mutex_};
+            self->begin_event_();
+            std::fprintf(self->out_,
+                R"({"name":"%s","cat":"vmath","ph":"i","s":"t","ts":%.3f,"pid":1,"tid":%u,"args":{"flops":%llu}})",
+                function_name(f),
+                static_cast<double>(impl::now_ns()) / 1000.0,
+                impl::thread_index(),
+                static_cast<unsigned long long>(flops));
+        }
+
+        static void on_zone(const char* name, std::uint64_t begin_ns, std::uint64_t end_ns, void* user_data) {
+            auto* self = static_cast<trace_writer*>(user_data);
+            const std::lock_guard<std::mutex> guard{self->mutex_};
+            self->begin_event_();
+            std::fputs(R"({"name":")", self->out_);
+            for ( const char* c = name; *c; ++c ) {
+                if ( *c == '"' || *c == '\\' ) {
+                    std::fputc('\\', self->out_);
+                }
+                std::fputc(*c, self->out_);
+            }
+            std::fprintf(self->out_,
+                R"(","cat":"zone","ph":"X","ts":%.3f,"dur":%.3f,"pid":1,"tid":%u})",
+                static_cast<double>(begin_ns) / 1000.0,
+                static_cast<double>(end_ns - begin_ns) / 1000.0,
+                impl::thread_index());
+        }
+
+        void begin_event_() {
+            std::fputs(event_count_ > 0 ? ",\n" : "\n", out_);
+            event_count_ += 1;
+        }
+    private:
+        hooks hooks_{&on_call, &on_zone, this};
+        mutable std::mutex mutex_;
+        std::FILE* out_{};
+        std::uint64_t event_count_{};
+    };
+}
+
+#endif
+
+#if defined(VMATH_HPP_CHECKED)
+
+//
+// Checked Results
+//
+
+namespace vmath_hpp::checked
+{
+    enum class issue : unsigned {
+        nan,
+        infinity,
+    };
+
+    struct report {
+        const char* function{};
+        const char* file{};
+        unsigned line{};
+        const char* scope{};
+        issue what{};
+        unsigned component{};
+    };
+
+    // on_issue is called for every invalid result on the thread that produced it
+    struct handler {
+        void (*on_issue)(const report& r, void* user_data){};
+        void* user_data{};
+    };
+}
+
+namespace vmath_hpp::checked::impl
+{
+    inline thread_local const char* thread_scope{};
+
+    inline thread_local report thread_first_issue{};
+    inline thread_local std::uint64_t thread_issue_count{};
+    inline thread_local std::uint64_t thread_denormal_count{};
+
+    inline std::atomic<const handler*> installed_handler{nullptr};
+
+    template < typename T, typename = void >
+    struct has_components : std::false_type {};
+
+    template < typename T >
+    struct has_components<T, std::void_t<decltype(T::size)>> : std::true_type {};
+
+    struct scan_state {
+        unsigned component{};
+        unsigned bad_component{};
+        bool bad{};
+        issue what{};
+    };
+
+    template < typename T >
+    void scan(const T& value, scan_state& state) noexcept {
+        if constexpr ( std::is_floating_point_v<T> ) {
+            const int category = std::fpclassify(value);
+            if ( category == FP_SUBNORMAL ) {
+                thread_denormal_count += 1;
+            } else if ( !state.bad && (category == FP_NAN || category == FP_INFINITE) ) {
+                state.bad = true;
+                state.bad_component = state.component;
+                state.what = category == FP_NAN ? issue::nan : issue::infinity;
+            }
+            state.component += 1;
+        } else if constexpr ( has_components<T>::value ) {
+            // vec, mat and qua, the matrix components are counted row by row
+            for ( std::size_t i = 0; i < T::size; ++i ) {
+                scan(value[i], state);
+            }
+        } else {
+            // integers and user-defined component types can't be invalid
+            state.component += 1;
+        }
+    }
+
+    inline void report_issue(const report& r) {
+        thread_issue_count += 1;
+        if ( thread_issue_count == 1 ) {
+            thread_first_issue = r;
+        }
+
+        if ( const handler* h = installed_handler.load(std::memory_order_acquire); h && h->on_issue ) {
+            h->on_issue(r, h->user_data);
+        } else if ( thread_issue_count == 1 ) {
+            std::fprintf(stderr, "%s:%u: vmath.hpp: %s in %s, component %u (scope: %s)\n",
+                r.file,
+                r.line,
+                r.what == issue::nan ? "nan" : "infinity",
+                r.function,
+                r.component,
+                r.scope ? r.scope : "none");
+        }
+    }
+
+    template < typename V >
+    constexpr V check_result(const char* function, const char* file, unsigned line, V value) {
+        if ( !VMATH_HPP_IS_CONSTANT_EVALUATED() ) {
+            scan_state state{};
+            scan(value, state);
+            if ( state.bad ) {
+                report_issue({function, file, line, thread_scope, state.what, state.bad_component});
+            }
+        }
+        return value;
+    }
+}
+
+namespace vmath_hpp::checked
+{
+    // set_handler
+
+    inline void set_handler(const handler* h) noexcept {
+        // the handler must outlive the installation, pass nullptr to print
+        // the first issue of each thread to stderr instead
+        impl::installed_handler.store(h, std::memory_order_release);
+    }
+
+    // thread_first_issue
+
+    [[nodiscard]] inline const report* thread_first_issue() noexcept {
+        return impl::thread_issue_count > 0 ? &impl::thread_first_issue : nullptr;
+    }
+
+    // thread_issue_count
+
+    [[nodiscard]] inline std::uint64_t thread_issue_count() noexcept {
+        return impl::thread_issue_count;
+    }
+
+    // thread_denormal_count
+
+    [[nodiscard]] inline std::uint64_t thread_denormal_count() noexcept {
+        return impl::thread_denormal_count;
+    }
+
+    // reset_thread_issues
+
+    inline void reset_thread_issues() noexcept {
+        impl::thread_first_issue = report{};
+        impl::thread_issue_count = 0;
+        impl::thread_denormal_count = 0;
+    }
+
+    // scope
+
+    class scope final {
+    public:
+        // names the reports of the current thread until destroyed, scopes nest
+        explicit scope(const char* name) noexcept
+        : previous_{impl::thread_scope} {
+            impl::thread_scope = name;
+        }
+
+        ~scope() noexcept {
+            impl::thread_scope = previous_;
+        }
+
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+    private:
+        const char* previous_{};
+    };
+}
+
+#endif
+
 namespace vmath_hpp
 {
     struct no_init_t { explicit no_init_t() = default; };
@@ -81,7 +529,7 @@ namespace vmath_hpp
 
 namespace vmath_hpp
 {
-    template < typename T, std::size_t Size >
+    template < typename T, std::size_t Rows, std::size_t Cols = Rows >
     class mat;
 
     using bmat2 = mat<bool, 2>;
@@ -103,6 +551,41 @@ namespace vmath_hpp
     using dmat2 = mat<double, 2>;
     using dmat3 = mat<double, 3>;
     using dmat4 = mat<double, 4>;
+
+    using bmat2x3 = mat<bool, 2, 3>;
+    using bmat2x4 = mat<bool, 2, 4>;
+    using bmat3x2 = mat<bool, 3, 2>;
+    using bmat3x4 = mat<bool, 3, 4>;
+    using bmat4x2 = mat<bool, 4, 2>;
+    using bmat4x3 = mat<bool, 4, 3>;
+
+    using imat2x3 = mat<int, 2, 3>;
+    using imat2x4 = mat<int, 2, 4>;
+    using imat3x2 = mat<int, 3, 2>;
+    using imat3x4 = mat<int, 3, 4>;
+    using imat4x2 = mat<int, 4, 2>;
+    using imat4x3 = mat<int, 4, 3>;
+
+    using umat2x3 = mat<unsigned, 2, 3>;
+    using umat2x4 = mat<unsigned, 2, 4>;
+    using umat3x2 = mat<unsigned, 3, 2>;
+    using umat3x4 = mat<unsigned, 3, 4>;
+    using umat4x2 = mat<unsigned, 4, 2>;
+    using umat4x3 = mat<unsigned, 4, 3>;
+
+    using fmat2x3 = mat<float, 2, 3>;
+    using fmat2x4 = mat<float, 2, 4>;
+    using fmat3x2 = mat<float, 3, 2>;
+    using fmat3x4 = mat<float, 3, 4>;
+    using fmat4x2 = mat<float, 4, 2>;
+    using fmat4x3 = mat<float, 4, 3>;
+
+    using dmat2x3 = mat<double, 2, 3>;
+    using dmat2x4 = mat<double, 2, 4>;
+    using dmat3x2 = mat<double, 3, 2>;
+    using dmat3x4 = mat<double, 3, 4>;
+    using dmat4x2 = mat<double, 4, 2>;
+    using dmat4x3 = mat<double, 4, 3>;
 }
 
 namespace vmath_hpp
@@ -118,6 +601,24 @@ namespace vmath_hpp
 // Common Functions
 //
 
+namespace vmath_hpp::impl
+{
+    // the unchecked forms are for the functions built on top of them,
+    // only the outermost public call checks its result
+
+    template < typename T >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    T lerp_impl(T x, T y, T a) noexcept {
+        return x * (T{1} - a) + y * a;
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    T lerp_impl(T x, T y, T x_a, T y_a) noexcept {
+        return x * x_a + y * y_a;
+    }
+}
+
 namespace vmath_hpp
 {
     template < typename T >
@@ -223,13 +724,13 @@ namespace vmath_hpp
     template < typename T >
     [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
     constexpr lerp(T x, T y, T a) noexcept {
-        return x * (T{1} - a) + y * a;
+        return VMATH_HPP_CHECK_RESULT("lerp", impl::lerp_impl(x, y, a));
     }
 
     template < typename T >
     [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
     constexpr lerp(T x, T y, T x_a, T y_a) noexcept {
-        return x * x_a + y * y_a;
+        return VMATH_HPP_CHECK_RESULT("lerp", impl::lerp_impl(x, y, x_a, y_a));
     }
 
     template < typename T >
@@ -403,6 +904,31 @@ namespace vmath_hpp
     constexpr rsqrt(T x) noexcept {
         return rcp(sqrt(x));
     }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    fast_rsqrt(T x) noexcept {
+        if constexpr ( std::is_same_v<T, float> && std::numeric_limits<float>::is_iec559 ) {
+            /// REFERENCE:
+            /// http://www.lomont.org/papers/2003/InvSqrt.pdf
+
+            std::uint32_t i{};
+            std::memcpy(&i, &x, sizeof(x));
+            i = 0x5f375a86u - (i >> 1);
+
+            float y{};
+            std::memcpy(&y, &i, sizeof(y));
+
+            // two newton steps, about 5e-6 relative error and no division,
+            // zero gives a large finite value instead of infinity
+            const float half_x = x * 0.5f;
+            y = y * (1.5f - half_x * y * y);
+            y = y * (1.5f - half_x * y * y);
+            return y;
+        } else {
+            return rsqrt(x);
+        }
+    }
 }
 
 //
@@ -567,7 +1093,50 @@ namespace vmath_hpp
 namespace vmath_hpp::detail
 {
     template < typename T, std::size_t Size >
-    class vec_base;
+    class vec_base {
+        static_assert(Size > 1, "vec size must be greater than one");
+    public:
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        T components[Size];
+    public:
+        constexpr vec_base()
+        : vec_base{zero_init} {}
+
+        constexpr vec_base(no_init_t) {}
+        constexpr vec_base(zero_init_t): vec_base{T{0}} {}
+        constexpr vec_base(unit_init_t): vec_base{T{1}} {}
+
+        constexpr explicit vec_base(T v)
+        : vec_base(std::make_index_sequence<Size>{}, [v](std::size_t){ return v; }) {}
+
+        template < typename... Ts, std::enable_if_t<
+            (sizeof...(Ts) == Size) &&
+            (... && std::is_convertible_v<Ts, T>)
+        , int> = 0 >
+        constexpr vec_base(Ts... xs)
+        : components{static_cast<T>(xs)...} {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr vec_base(const vec_base<U, Size>& other)
+        : vec_base(std::make_index_sequence<Size>{}, [&other](std::size_t i){ return other[i]; }) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        // NOLINTNEXTLINE(*-pointer-arithmetic)
+        constexpr explicit vec_base(const U* p)
+        : vec_base(std::make_index_sequence<Size>{}, [p](std::size_t i){ return p[i]; }) {}
+
+        [[nodiscard]] constexpr T& operator[](std::size_t index) noexcept {
+            return components[index];
+        }
+
+        [[nodiscard]] constexpr const T& operator[](std::size_t index) const noexcept {
+            return components[index];
+        }
+    private:
+        template < std::size_t... Is, typename F >
+        constexpr vec_base(std::index_sequence<Is...>, F&& f)
+        : components{static_cast<T>(f(Is))...} {}
+    };
 
     template < typename T >
     class vec_base<T, 2> {
@@ -822,6 +1391,14 @@ namespace vmath_hpp
     template < typename T >
     vec(T, const vec<T, 3>&) -> vec<T, 4>;
 
+    // vecN
+
+    template < typename T, typename... Ts, std::enable_if_t<
+        (sizeof...(Ts) > 3) &&
+        (... && std::is_same_v<T, Ts>)
+    , int> = 0 >
+    vec(T, Ts...) -> vec<T, 1 + sizeof...(Ts)>;
+
     // swap
 
     template < typename T, std::size_t Size >
@@ -831,6 +1408,22 @@ namespace vmath_hpp
     }
 }
 
+namespace vmath_hpp::detail
+{
+    // data(), the pointer constructors and the blob serialization rely on the
+    // components being tightly packed in a trivially copyable standard-layout object
+
+    template < typename T, std::size_t Size >
+    inline constexpr bool is_packed_vec_v =
+        std::is_standard_layout_v<vec<T, Size>> &&
+        std::is_trivially_copyable_v<vec<T, Size>> &&
+        sizeof(vec<T, Size>) == sizeof(T) * Size;
+
+    static_assert(is_packed_vec_v<float, 2> && is_packed_vec_v<float, 3> && is_packed_vec_v<float, 4>);
+    static_assert(is_packed_vec_v<double, 2> && is_packed_vec_v<double, 3> && is_packed_vec_v<double, 4>);
+    static_assert(is_packed_vec_v<int, 2> && is_packed_vec_v<int, 3> && is_packed_vec_v<int, 4>);
+}
+
 namespace vmath_hpp::detail::impl
 {
     template < typename A, std::size_t Size, typename F, std::size_t... Is >
@@ -1419,6 +2012,21 @@ namespace vmath_hpp
 // Common Functions
 //
 
+namespace vmath_hpp::impl
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, Size> lerp_impl(const vec<T, Size>& xs, const vec<T, Size>& ys, T a) {
+        return map_join([a](T x, T y) { return lerp_impl(x, y, a); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, Size> lerp_impl(const vec<T, Size>& xs, const vec<T, Size>& ys, T x_a, T y_a) {
+        return map_join([x_a, y_a](T x, T y) { return lerp_impl(x, y, x_a, y_a); }, xs, ys);
+    }
+}
+
 namespace vmath_hpp
 {
     template < typename T, std::size_t Size >
@@ -1557,12 +2165,12 @@ namespace vmath_hpp
 
     template < typename T, std::size_t Size >
     [[nodiscard]] constexpr vec<T, Size> lerp(const vec<T, Size>& xs, const vec<T, Size>& ys, T a) {
-        return map_join([a](T x, T y) { return lerp(x, y, a); }, xs, ys);
+        return VMATH_HPP_CHECK_RESULT("lerp", impl::lerp_impl(xs, ys, a));
     }
 
     template < typename T, std::size_t Size >
     [[nodiscard]] constexpr vec<T, Size> lerp(const vec<T, Size>& xs, const vec<T, Size>& ys, T x_a, T y_a) {
-        return map_join([x_a, y_a](T x, T y) { return lerp(x, y, x_a, y_a); }, xs, ys);
+        return VMATH_HPP_CHECK_RESULT("lerp", impl::lerp_impl(xs, ys, x_a, y_a));
     }
 
     template < typename T, std::size_t Size >
@@ -1571,7 +2179,7 @@ namespace vmath_hpp
         const vec<T, Size>& ys,
         const vec<T, Size>& as)
     {
-        return map_join([](T x, T y, T a) { return lerp(x, y, a); }, xs, ys, as);
+        return VMATH_HPP_CHECK_RESULT("lerp", map_join([](T x, T y, T a) { return impl::lerp_impl(x, y, a); }, xs, ys, as));
     }
 
     template < typename T, std::size_t Size >
@@ -1581,7 +2189,7 @@ namespace vmath_hpp
         const vec<T, Size>& xs_a,
         const vec<T, Size>& ys_a)
     {
-        return map_join([](T x, T y, T x_a, T y_a) { return lerp(x, y, x_a, y_a); }, xs, ys, xs_a, ys_a);
+        return VMATH_HPP_CHECK_RESULT("lerp", map_join([](T x, T y, T x_a, T y_a) { return impl::lerp_impl(x, y, x_a, y_a); }, xs, ys, xs_a, ys_a));
     }
 
     template < typename T, std::size_t Size >
@@ -1740,6 +2348,21 @@ namespace vmath_hpp
     }
 }
 
+//
+// Swizzle
+//
+
+namespace vmath_hpp
+{
+    template < std::size_t... Is, typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, sizeof...(Is)> swizzle(const vec<T, Size>& xs) {
+        static_assert(((Is < Size) && ...), "swizzle index out of range");
+        // constant indices: the component switch folds away at -O1 and above
+        return { xs[Is]... };
+    }
+}
+
 //
 // Geometric Functions
 //
@@ -1791,31 +2414,64 @@ namespace vmath_hpp
     template < typename T, typename U
              , typename V = decltype(std::declval<T>() * std::declval<U>()) >
     [[nodiscard]] constexpr vec<V, 3> cross(const vec<T, 3>& xs, const vec<U, 3>& ys) {
-        return {
-            xs.y * ys.z - xs.z * ys.y,
-            xs.z * ys.x - xs.x * ys.z,
-            xs.x * ys.y - xs.y * ys.x};
+        return
+            swizzle<1, 2, 0>(xs) * swizzle<2, 0, 1>(ys) -
+            swizzle<2, 0, 1>(xs) * swizzle<1, 2, 0>(ys);
     }
 
+}
+
+namespace vmath_hpp::impl
+{
     template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr vec<T, Size> normalize(const vec<T, Size>& xs) {
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, Size> normalize_impl(const vec<T, Size>& xs) {
         return xs * rlength(xs);
     }
+}
 
+namespace vmath_hpp
+{
     template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr vec<T, Size> faceforward(const vec<T, Size>& n, const vec<T, Size>& i, const vec<T, Size>& nref) {
-        return dot(nref, i) < T{0} ? n : -n;
+    [[nodiscard]] constexpr vec<T, Size> normalize(const vec<T, Size>& xs) {
+        VMATH_HPP_INSTRUMENT_CALL(normalize, 3 * Size);
+        return VMATH_HPP_CHECK_RESULT("normalize", impl::normalize_impl(xs));
     }
 
     template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr vec<T, Size> reflect(const vec<T, Size>& i, const vec<T, Size>& n) {
-        return i - T{2} * dot(n, i) * n;
+    [[nodiscard]] constexpr vec<T, Size> normalize_or(const vec<T, Size>& xs, const vec<T, Size>& fallback) {
+        // both sides are computed and selected, loops over it still vectorize
+        const T l2 = dot(xs, xs);
+        const bool valid = l2 >= std::numeric_limits<T>::min();
+        const vec<T, Size> ns = xs * rsqrt(valid ? l2 : T{1});
+        return valid ? ns : fallback;
     }
 
     template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr vec<T, Size> refract(const vec<T, Size>& i, const vec<T, Size>& n, T eta) {
-        const T d = dot(n, i);
-        const T k = T{1} - sqr(eta) * (T{1} - sqr(d));
+    [[nodiscard]] vec<T, Size> normalize_fast(const vec<T, Size>& xs) {
+        return xs * fast_rsqrt(dot(xs, xs));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr std::pair<vec<T, Size>, T> normalize_length(const vec<T, Size>& xs) {
+        const T l = length(xs);
+        return {xs * rcp(l), l};
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> faceforward(const vec<T, Size>& n, const vec<T, Size>& i, const vec<T, Size>& nref) {
+        return dot(nref, i) < T{0} ? n : -n;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> reflect(const vec<T, Size>& i, const vec<T, Size>& n) {
+        return i - T{2} * dot(n, i) * n;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> refract(const vec<T, Size>& i, const vec<T, Size>& n, T eta) {
+        const T d = dot(n, i);
+        const T k = T{1} - sqr(eta) * (T{1} - sqr(d));
         return k < T{0} ? vec<T, Size>{T{0}} : (eta * i - (eta * d + sqrt(k)) * n);
     }
 }
@@ -1906,11 +2562,111 @@ namespace vmath_hpp
 
 namespace vmath_hpp::detail
 {
-    template < typename T, std::size_t Size >
-    class mat_base;
+    // a shape conversion either truncates both sizes or extends both sizes
+
+    template < std::size_t Rows, std::size_t Cols, std::size_t FromRows, std::size_t FromCols >
+    inline constexpr bool is_mat_reshape_v =
+        (Rows != FromRows || Cols != FromCols) &&
+        ((Rows <= FromRows && Cols <= FromCols) || (Rows >= FromRows && Cols >= FromCols));
+
+    template < typename T, std::size_t Cols, typename U, std::size_t FromRows, std::size_t FromCols >
+    [[nodiscard]] constexpr vec<T, Cols> mat_reshape_row(
+        const vec<U, FromCols> (&rows)[FromRows], // NOLINT(*-avoid-c-arrays)
+        std::size_t i)
+    {
+        // the common part is copied, the rest is taken from the identity
+        vec<T, Cols> r{zero_init};
+        for ( std::size_t j = 0; j < Cols; ++j ) {
+            if ( i < FromRows && j < FromCols ) {
+                r[j] = static_cast<T>(rows[i][j]);
+            } else if ( i == j ) {
+                r[j] = T{1};
+            }
+        }
+        return r;
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols = Rows >
+    class mat_base {
+        static_assert(Rows > 1 && Cols > 1, "mat sizes must be greater than one");
+    public:
+        using row_type = vec<T, Cols>;
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        row_type rows[Rows];
+    public:
+        constexpr mat_base()
+        : mat_base(identity_init) {}
+
+        constexpr mat_base(no_init_t)
+        : mat_base(std::make_index_sequence<Rows>{}, [](std::size_t){ return row_type{no_init}; }) {}
+
+        constexpr mat_base(zero_init_t)
+        : mat_base(std::make_index_sequence<Rows>{}, [](std::size_t){ return row_type{zero_init}; }) {}
+
+        constexpr mat_base(unit_init_t)
+        : mat_base(std::make_index_sequence<Rows>{}, [](std::size_t){ return row_type{unit_init}; }) {}
+
+        constexpr mat_base(identity_init_t): mat_base{T{1}} {}
+
+        constexpr explicit mat_base(T d)
+        : mat_base(std::make_index_sequence<Rows>{}, [d](std::size_t i){
+            row_type r{zero_init};
+            if ( i < Cols ) {
+                r[i] = d;
+            }
+            return r;
+        }) {}
+
+        // the diagonal has min(Rows, Cols) components
+        constexpr explicit mat_base(const vec<T, (Rows < Cols ? Rows : Cols)>& d)
+        : mat_base(std::make_index_sequence<Rows>{}, [&d](std::size_t i){
+            row_type r{zero_init};
+            if ( i < Cols ) {
+                r[i] = d[i];
+            }
+            return r;
+        }) {}
+
+        template < typename... Ts, std::enable_if_t<
+            (sizeof...(Ts) == Rows * Cols) &&
+            (... && std::is_convertible_v<Ts, T>)
+        , int> = 0 >
+        constexpr mat_base(Ts... xs)
+        : mat_base(std::make_index_sequence<Rows>{}, [xs...](std::size_t i){
+            // NOLINTNEXTLINE(*-avoid-c-arrays)
+            const T ms[]{static_cast<T>(xs)...};
+            return row_type{ms + i * Cols};
+        }) {}
+
+        template < typename... Rs, std::enable_if_t<
+            (sizeof...(Rs) == Rows) &&
+            (... && std::is_same_v<Rs, row_type>)
+        , int> = 0 >
+        constexpr mat_base(const Rs&... rs)
+        : rows{rs...} {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr mat_base(const mat_base<U, Rows, Cols>& other)
+        : mat_base(std::make_index_sequence<Rows>{}, [&other](std::size_t i){ return row_type{other.rows[i]}; }) {}
+
+        template < typename U, std::size_t FromRows, std::size_t FromCols, std::enable_if_t<
+            std::is_convertible_v<U, T> &&
+            is_mat_reshape_v<Rows, Cols, FromRows, FromCols>
+        , int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, FromRows, FromCols>& other)
+        : mat_base(std::make_index_sequence<Rows>{}, [&other](std::size_t i){ return mat_reshape_row<T, Cols>(other.rows, i); }) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit mat_base(const U* p)
+        : mat_base(std::make_index_sequence<Rows>{}, [p](std::size_t i){ return row_type{p + i * Cols}; }) {}
+    private:
+        template < std::size_t... Is, typename F >
+        constexpr mat_base(std::index_sequence<Is...>, F&& f)
+        : rows{f(Is)...} {}
+    };
 
     template < typename T >
-    class mat_base<T, 2> {
+    class mat_base<T, 2, 2> {
     public:
         using row_type = vec<T, 2>;
         // NOLINTNEXTLINE(*-avoid-c-arrays)
@@ -1961,6 +2717,14 @@ namespace vmath_hpp::detail
             row_type{other.rows[0]},
             row_type{other.rows[1]}) {}
 
+        template < typename U, std::size_t FromRows, std::size_t FromCols, std::enable_if_t<
+            std::is_convertible_v<U, T> && FromRows != FromCols &&
+            is_mat_reshape_v<2, 2, FromRows, FromCols>
+        , int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, FromRows, FromCols>& other): mat_base(
+            mat_reshape_row<T, 2>(other.rows, 0),
+            mat_reshape_row<T, 2>(other.rows, 1)) {}
+
         template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
         constexpr explicit mat_base(const U* p): mat_base(
             row_type{p + 0u * row_type::size},
@@ -1968,7 +2732,7 @@ namespace vmath_hpp::detail
     };
 
     template < typename T >
-    class mat_base<T, 3> {
+    class mat_base<T, 3, 3> {
     public:
         using row_type = vec<T, 3>;
         // NOLINTNEXTLINE(*-avoid-c-arrays)
@@ -2035,6 +2799,15 @@ namespace vmath_hpp::detail
             row_type{other.rows[1]},
             row_type{other.rows[2]}) {}
 
+        template < typename U, std::size_t FromRows, std::size_t FromCols, std::enable_if_t<
+            std::is_convertible_v<U, T> && FromRows != FromCols &&
+            is_mat_reshape_v<3, 3, FromRows, FromCols>
+        , int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, FromRows, FromCols>& other): mat_base(
+            mat_reshape_row<T, 3>(other.rows, 0),
+            mat_reshape_row<T, 3>(other.rows, 1),
+            mat_reshape_row<T, 3>(other.rows, 2)) {}
+
         template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
         constexpr explicit mat_base(const U* p): mat_base(
             row_type{p + 0u * row_type::size},
@@ -2043,7 +2816,7 @@ namespace vmath_hpp::detail
     };
 
     template < typename T >
-    class mat_base<T, 4> {
+    class mat_base<T, 4, 4> {
     public:
         using row_type = vec<T, 4>;
         // NOLINTNEXTLINE(*-avoid-c-arrays)
@@ -2119,6 +2892,16 @@ namespace vmath_hpp::detail
             row_type{other.rows[2], T{0}},
             row_type{T{0}, T{0}, T{0}, T{1}}) {}
 
+        template < typename U, std::size_t FromRows, std::size_t FromCols, std::enable_if_t<
+            std::is_convertible_v<U, T> && FromRows != FromCols &&
+            is_mat_reshape_v<4, 4, FromRows, FromCols>
+        , int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, FromRows, FromCols>& other): mat_base(
+            mat_reshape_row<T, 4>(other.rows, 0),
+            mat_reshape_row<T, 4>(other.rows, 1),
+            mat_reshape_row<T, 4>(other.rows, 2),
+            mat_reshape_row<T, 4>(other.rows, 3)) {}
+
         template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
         constexpr explicit mat_base(const U* p): mat_base(
             row_type{p + 0u * row_type::size},
@@ -2130,14 +2913,15 @@ namespace vmath_hpp::detail
 
 namespace vmath_hpp
 {
-    template < typename T, std::size_t Size >
-    class mat final : public detail::mat_base<T, Size> {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    class mat final : public detail::mat_base<T, Rows, Cols> {
     public:
         using self_type = mat;
-        using base_type = detail::mat_base<T, Size>;
+        using base_type = detail::mat_base<T, Rows, Cols>;
         using component_type = T;
 
-        using row_type = vec<T, Size>;
+        using row_type = vec<T, Cols>;
+        using column_type = vec<T, Rows>;
 
         using pointer = row_type*;
         using const_pointer = const row_type*;
@@ -2150,14 +2934,14 @@ namespace vmath_hpp
         using reverse_iterator = std::reverse_iterator<iterator>;
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-        static inline constexpr std::size_t size = Size;
+        static inline constexpr std::size_t size = Rows;
     public:
         using base_type::mat_base;
         using base_type::rows;
 
         // NOLINTNEXTLINE(*-noexcept-swap)
         void swap(mat& other) noexcept(std::is_nothrow_swappable_v<T>) {
-            for ( std::size_t i = 0; i < Size; ++i ) {
+            for ( std::size_t i = 0; i < Rows; ++i ) {
                 using std::swap;
                 swap(rows[i], other.rows[i]);
             }
@@ -2165,8 +2949,8 @@ namespace vmath_hpp
 
         [[nodiscard]] iterator begin() noexcept { return iterator(data()); }
         [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(data()); }
-        [[nodiscard]] iterator end() noexcept { return iterator(data() + Size); }
-        [[nodiscard]] const_iterator end() const noexcept { return const_iterator(data() + Size); }
+        [[nodiscard]] iterator end() noexcept { return iterator(data() + Rows); }
+        [[nodiscard]] const_iterator end() const noexcept { return const_iterator(data() + Rows); }
 
         [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
         [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
@@ -2247,97 +3031,119 @@ namespace vmath_hpp
     template < typename T >
     mat(std::initializer_list<T>, std::initializer_list<T>, std::initializer_list<T>, std::initializer_list<T>) -> mat<T, 4>;
 
+    // matRxC
+
+    template < typename T, std::size_t Cols, typename... Rs, std::enable_if_t<
+        (... && std::is_same_v<vec<T, Cols>, Rs>)
+    , int> = 0 >
+    mat(const vec<T, Cols>&, const Rs&...) -> mat<T, 1 + sizeof...(Rs), Cols>;
+
     // swap
 
-    template < typename T, std::size_t Size >
+    template < typename T, std::size_t Rows, std::size_t Cols >
     // NOLINTNEXTLINE(*-noexcept-swap)
-    void swap(mat<T, Size>& l, mat<T, Size>& r) noexcept(noexcept(l.swap(r))) {
+    void swap(mat<T, Rows, Cols>& l, mat<T, Rows, Cols>& r) noexcept(noexcept(l.swap(r))) {
         l.swap(r);
     }
 }
 
+namespace vmath_hpp::detail
+{
+    // the rows are packed vectors, so the matrix is a packed row-major array
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    inline constexpr bool is_packed_mat_v =
+        std::is_standard_layout_v<mat<T, Rows, Cols>> &&
+        std::is_trivially_copyable_v<mat<T, Rows, Cols>> &&
+        sizeof(mat<T, Rows, Cols>) == sizeof(T) * Rows * Cols;
+
+    static_assert(is_packed_mat_v<float, 2, 2> && is_packed_mat_v<float, 3, 3> && is_packed_mat_v<float, 4, 4>);
+    static_assert(is_packed_mat_v<double, 2, 2> && is_packed_mat_v<double, 3, 3> && is_packed_mat_v<double, 4, 4>);
+    static_assert(is_packed_mat_v<float, 3, 4> && is_packed_mat_v<int, 4, 4>);
+}
+
 namespace vmath_hpp::detail::impl
 {
-    template < typename A, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto map_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const mat<A, Size>& a,
+        const mat<A, Rows, Cols>& a,
         std::index_sequence<Is...>)
     {
         return mat{ f(a[Is])... };
     }
 
-    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto map_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const mat<A, Size>& a,
-        const mat<B, Size>& b,
+        const mat<A, Rows, Cols>& a,
+        const mat<B, Rows, Cols>& b,
         std::index_sequence<Is...>)
     {
         return mat{ f(a[Is], b[Is])... };
     }
 
-    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto fold_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
         A init,
-        const mat<B, Size>& b,
+        const mat<B, Rows, Cols>& b,
         std::index_sequence<Is...>)
     {
         return ((init = f(std::move(init), b[Is])), ...);
     }
 
-    template < typename A, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto fold1_and_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const mat<A, Size>& a,
+        const mat<A, Rows, Cols>& a,
         std::index_sequence<Is...>)
     {
         return (... && f(a[Is]));
     }
 
-    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto fold1_and_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const mat<A, Size>& a,
-        const mat<B, Size>& b,
+        const mat<A, Rows, Cols>& a,
+        const mat<B, Rows, Cols>& b,
         std::index_sequence<Is...>)
     {
         return (... && f(a[Is], b[Is]));
     }
 
-    template < typename A, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto fold1_or_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const mat<A, Size>& a,
+        const mat<A, Rows, Cols>& a,
         std::index_sequence<Is...>)
     {
         return (... || f(a[Is]));
     }
 
-    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto fold1_or_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const mat<A, Size>& a,
-        const mat<B, Size>& b,
+        const mat<A, Rows, Cols>& a,
+        const mat<B, Rows, Cols>& b,
         std::index_sequence<Is...>)
     {
         return (... || f(a[Is], b[Is]));
     }
 
-    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto fold1_plus_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const vec<A, Size>& a,
-        const mat<B, Size>& b,
+        const vec<A, Rows>& a,
+        const mat<B, Rows, Cols>& b,
         std::index_sequence<Is...>)
     {
         return (... + f(a[Is], b[Is]));
@@ -2346,52 +3152,52 @@ namespace vmath_hpp::detail::impl
 
 namespace vmath_hpp::detail
 {
-    template < typename A, std::size_t Size, typename F >
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto map_join(F&& f, const mat<A, Size>& a) {
-        return impl::map_join_impl(std::forward<F>(f), a, std::make_index_sequence<Size>{});
+    auto map_join(F&& f, const mat<A, Rows, Cols>& a) {
+        return impl::map_join_impl(std::forward<F>(f), a, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, typename B, std::size_t Size, typename F >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto map_join(F&& f, const mat<A, Size>& a, const mat<B, Size>& b) {
-        return impl::map_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Size>{});
+    auto map_join(F&& f, const mat<A, Rows, Cols>& a, const mat<B, Rows, Cols>& b) {
+        return impl::map_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, typename B, std::size_t Size, typename F >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto fold_join(F&& f, A init, const mat<B, Size>& b) {
-        return impl::fold_join_impl(std::forward<F>(f), std::move(init), b, std::make_index_sequence<Size>{});
+    auto fold_join(F&& f, A init, const mat<B, Rows, Cols>& b) {
+        return impl::fold_join_impl(std::forward<F>(f), std::move(init), b, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, std::size_t Size, typename F >
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto fold1_and_join(F&& f, const mat<A, Size>& a) {
-        return impl::fold1_and_join_impl(std::forward<F>(f), a, std::make_index_sequence<Size>{});
+    auto fold1_and_join(F&& f, const mat<A, Rows, Cols>& a) {
+        return impl::fold1_and_join_impl(std::forward<F>(f), a, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, typename B, std::size_t Size, typename F >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto fold1_and_join(F&& f, const mat<A, Size>& a, const mat<B, Size>& b) {
-        return impl::fold1_and_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Size>{});
+    auto fold1_and_join(F&& f, const mat<A, Rows, Cols>& a, const mat<B, Rows, Cols>& b) {
+        return impl::fold1_and_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, std::size_t Size, typename F >
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto fold1_or_join(F&& f, const mat<A, Size>& a) {
-        return impl::fold1_or_join_impl(std::forward<F>(f), a, std::make_index_sequence<Size>{});
+    auto fold1_or_join(F&& f, const mat<A, Rows, Cols>& a) {
+        return impl::fold1_or_join_impl(std::forward<F>(f), a, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, typename B, std::size_t Size, typename F >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto fold1_or_join(F&& f, const mat<A, Size>& a, const mat<B, Size>& b) {
-        return impl::fold1_or_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Size>{});
+    auto fold1_or_join(F&& f, const mat<A, Rows, Cols>& a, const mat<B, Rows, Cols>& b) {
+        return impl::fold1_or_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, typename B, std::size_t Size, typename F >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto fold1_plus_join(F&& f, const vec<A, Size>& a, const mat<B, Size>& b) {
-        return impl::fold1_plus_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Size>{});
+    auto fold1_plus_join(F&& f, const vec<A, Rows>& a, const mat<B, Rows, Cols>& b) {
+        return impl::fold1_plus_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Rows>{});
     }
 }
 
@@ -2399,152 +3205,164 @@ namespace vmath_hpp::detail
 // Operators
 //
 
+namespace vmath_hpp::impl
+{
+    // unchecked vec * mat, for the operators built on top of it
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto mul_impl(const vec<T, Rows>& xs, const mat<U, Rows, Cols>& ys) {
+        return fold1_plus_join([](T x, const vec<U, Cols>& y){ return x * y; }, xs, ys);
+    }
+}
+
 namespace vmath_hpp
 {
     // +operator
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator+(const mat<T, Size>& xs) {
-        return map_join([](const vec<T, Size>& x){ return +x; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator+(const mat<T, Rows, Cols>& xs) {
+        return map_join([](const vec<T, Cols>& x){ return +x; }, xs);
     }
 
     // -operator
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator-(const mat<T, Size>& xs) {
-        return map_join([](const vec<T, Size>& x){ return -x; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator-(const mat<T, Rows, Cols>& xs) {
+        return map_join([](const vec<T, Cols>& x){ return -x; }, xs);
     }
 
     // ~operator
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator~(const mat<T, Size>& xs) {
-        return map_join([](const vec<T, Size>& x){ return ~x; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator~(const mat<T, Rows, Cols>& xs) {
+        return map_join([](const vec<T, Cols>& x){ return ~x; }, xs);
     }
 
     // !operator
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator!(const mat<T, Size>& xs) {
-        return map_join([](const vec<T, Size>& x){ return !x; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator!(const mat<T, Rows, Cols>& xs) {
+        return map_join([](const vec<T, Cols>& x){ return !x; }, xs);
     }
 
     // ++operator
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator++(mat<T, Size>& xs) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator++(mat<T, Rows, Cols>& xs) {
         return (xs = xs + T{1});
     }
 
     // --operator
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator--(mat<T, Size>& xs) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator--(mat<T, Rows, Cols>& xs) {
         return (xs = xs - T{1});
     }
 
     // operator++
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size> operator++(mat<T, Size>& xs, int) {
-        mat<T, Size> ys = xs;
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols> operator++(mat<T, Rows, Cols>& xs, int) {
+        mat<T, Rows, Cols> ys = xs;
         ++xs;
         return ys;
     }
 
     // operator--
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size> operator--(mat<T, Size>& xs, int) {
-        mat<T, Size> ys = xs;
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols> operator--(mat<T, Rows, Cols>& xs, int) {
+        mat<T, Rows, Cols> ys = xs;
         --xs;
         return ys;
     }
 
     // operator+
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator+(const mat<T, Size>& xs, U y) {
-        return map_join([y](const vec<T, Size>& x){ return x + y; }, xs);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator+(const mat<T, Rows, Cols>& xs, U y) {
+        return map_join([y](const vec<T, Cols>& x){ return x + y; }, xs);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator+(T x, const mat<U, Size>& ys) {
-        return map_join([x](const vec<U, Size>& y){ return x + y; }, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator+(T x, const mat<U, Rows, Cols>& ys) {
+        return map_join([x](const vec<U, Cols>& y){ return x + y; }, ys);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator+(const mat<T, Size>& xs, const mat<U, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<U, Size>& y){ return x + y; }, xs, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator+(const mat<T, Rows, Cols>& xs, const mat<U, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<U, Cols>& y){ return x + y; }, xs, ys);
     }
 
     // operator+=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator+=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator+=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs + y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator+=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator+=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs + ys));
     }
 
     // operator-
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator-(const mat<T, Size>& xs, U y) {
-        return map_join([y](const vec<T, Size>& x){ return x - y; }, xs);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator-(const mat<T, Rows, Cols>& xs, U y) {
+        return map_join([y](const vec<T, Cols>& x){ return x - y; }, xs);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator-(T x, const mat<U, Size>& ys) {
-        return map_join([x](const vec<U, Size>& y){ return x - y; }, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator-(T x, const mat<U, Rows, Cols>& ys) {
+        return map_join([x](const vec<U, Cols>& y){ return x - y; }, ys);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator-(const mat<T, Size>& xs, const mat<U, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<U, Size>& y){ return x - y; }, xs, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator-(const mat<T, Rows, Cols>& xs, const mat<U, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<U, Cols>& y){ return x - y; }, xs, ys);
     }
 
     // operator-=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator-=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator-=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs - y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator-=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator-=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs - ys));
     }
 
     // operator*
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator*(const mat<T, Size>& xs, U y) {
-        return map_join([y](const vec<T, Size>& x){ return x * y; }, xs);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator*(const mat<T, Rows, Cols>& xs, U y) {
+        return map_join([y](const vec<T, Cols>& x){ return x * y; }, xs);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator*(T x, const mat<U, Size>& ys) {
-        return map_join([x](const vec<U, Size>& y){ return x * y; }, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator*(T x, const mat<U, Rows, Cols>& ys) {
+        return map_join([x](const vec<U, Cols>& y){ return x * y; }, ys);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator*(const vec<T, Size>& xs, const mat<U, Size>& ys) {
-        return fold1_plus_join([](T x, const vec<U, Size>& y){ return x * y; }, xs, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator*(const vec<T, Rows>& xs, const mat<U, Rows, Cols>& ys) {
+        return VMATH_HPP_CHECK_RESULT("vec * mat", impl::mul_impl(xs, ys));
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator*(const mat<T, Size>& xs, const mat<U, Size>& ys) {
-        return map_join([&ys](const vec<T, Size>& x){ return x * ys; }, xs);
+    template < typename T, typename U, std::size_t Rows, std::size_t Size, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator*(const mat<T, Rows, Size>& xs, const mat<U, Size, Cols>& ys) {
+        VMATH_HPP_INSTRUMENT_CALL(mat_mul, Rows * Cols * (2 * Size - 1));
+        return VMATH_HPP_CHECK_RESULT("mat * mat", map_join([&ys](const vec<T, Size>& x){ return impl::mul_impl(x, ys); }, xs));
     }
 
     // operator*=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator*=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator*=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs * y));
     }
 
@@ -2553,228 +3371,228 @@ namespace vmath_hpp
         return (xs = (xs * ys));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator*=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator*=(mat<T, Rows, Cols>& xs, const mat<T, Cols>& ys) {
         return (xs = (xs * ys));
     }
 
     // operator/
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator/(const mat<T, Size>& xs, U y) {
-        return map_join([y](const vec<T, Size>& x){ return x / y; }, xs);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator/(const mat<T, Rows, Cols>& xs, U y) {
+        return map_join([y](const vec<T, Cols>& x){ return x / y; }, xs);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator/(T x, const mat<U, Size>& ys) {
-        return map_join([x](const vec<U, Size>& y){ return x / y; }, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator/(T x, const mat<U, Rows, Cols>& ys) {
+        return map_join([x](const vec<U, Cols>& y){ return x / y; }, ys);
     }
 
     // operator/=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator/=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator/=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs / y));
     }
 
     // operator&
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator&(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x & y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x & y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator&(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x & y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x & y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator&(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x & y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x & y; }, xs, ys);
     }
 
     // operator&=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator&=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator&=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs & y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator&=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator&=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs & ys));
     }
 
     // operator|
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator|(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x | y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator|(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x | y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator|(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x | y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator|(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x | y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator|(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x | y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator|(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x | y; }, xs, ys);
     }
 
     // operator|=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator|=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator|=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs | y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator|=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator|=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs | ys));
     }
 
     // operator^
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator^(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x ^ y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator^(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x ^ y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator^(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x ^ y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator^(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x ^ y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator^(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x ^ y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator^(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x ^ y; }, xs, ys);
     }
 
     // operator^=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator^=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator^=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs ^ y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator^=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator^=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs ^ ys));
     }
 
     // operator<<
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator<<(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x << y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator<<(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x << y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator<<(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x << y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator<<(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x << y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator<<(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x << y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator<<(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x << y; }, xs, ys);
     }
 
     // operator<<=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator<<=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator<<=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs << y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator<<=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator<<=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs << ys));
     }
 
     // operator>>
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator>>(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x >> y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator>>(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x >> y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator>>(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x >> y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator>>(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x >> y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator>>(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x >> y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator>>(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x >> y; }, xs, ys);
     }
 
     // operator>>=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator>>=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator>>=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs >> y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator>>=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator>>=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs >> ys));
     }
 
     // operator&&
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator&&(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x && y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&&(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x && y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator&&(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x && y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&&(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x && y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator&&(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x && y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&&(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x && y; }, xs, ys);
     }
 
     // operator||
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator||(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x || y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator||(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x || y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator||(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x || y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator||(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x || y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator||(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x || y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator||(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x || y; }, xs, ys);
     }
 
     // operator==
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr bool operator==(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return fold1_and_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x == y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr bool operator==(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return fold1_and_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x == y; }, xs, ys);
     }
 
     // operator!=
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr bool operator!=(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return fold1_or_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x != y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr bool operator!=(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return fold1_or_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x != y; }, xs, ys);
     }
 
     // operator<
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr bool operator<(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        for ( std::size_t i = 0; i < Size; ++i ) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr bool operator<(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        for ( std::size_t i = 0; i < Rows; ++i ) {
             if ( xs[i] < ys[i] ) {
                 return true;
             }
@@ -2792,81 +3610,81 @@ namespace vmath_hpp
 
 namespace vmath_hpp
 {
-    template < typename T, std::size_t Size
-             , typename U = decltype(any(std::declval<vec<T, Size>>())) >
-    [[nodiscard]] constexpr U any(const mat<T, Size>& xs) {
-        return fold1_or_join([](const vec<T, Size>& x){ return any(x); }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = decltype(any(std::declval<vec<T, Cols>>())) >
+    [[nodiscard]] constexpr U any(const mat<T, Rows, Cols>& xs) {
+        return fold1_or_join([](const vec<T, Cols>& x){ return any(x); }, xs);
     }
 
-    template < typename T, std::size_t Size
-             , typename U = decltype(all(std::declval<vec<T, Size>>())) >
-    [[nodiscard]] constexpr U all(const mat<T, Size>& xs) {
-        return fold1_and_join([](const vec<T, Size>& x){ return all(x); }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = decltype(all(std::declval<vec<T, Cols>>())) >
+    [[nodiscard]] constexpr U all(const mat<T, Rows, Cols>& xs) {
+        return fold1_and_join([](const vec<T, Cols>& x){ return all(x); }, xs);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(approx(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> approx(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return approx(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> approx(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return approx(x, y); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(approx(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>(),
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>(),
                  std::declval<T>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> approx(const mat<T, Size>& xs, const mat<T, Size>& ys, T epsilon) {
-        return map_join([epsilon](const vec<T, Size>& x, const vec<T, Size>& y){ return approx(x, y, epsilon); }, xs, ys);
+    [[nodiscard]] constexpr mat<U, Rows, Cols> approx(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys, T epsilon) {
+        return map_join([epsilon](const vec<T, Cols>& x, const vec<T, Cols>& y){ return approx(x, y, epsilon); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(less(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> less(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return less(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> less(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return less(x, y); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(less_equal(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> less_equal(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return less_equal(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> less_equal(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return less_equal(x, y); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(greater(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> greater(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return greater(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> greater(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return greater(x, y); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(greater_equal(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> greater_equal(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return greater_equal(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> greater_equal(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return greater_equal(x, y); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(equal_to(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> equal_to(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return equal_to(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> equal_to(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return equal_to(x, y); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(not_equal_to(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> not_equal_to(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return not_equal_to(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> not_equal_to(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return not_equal_to(x, y); }, xs, ys);
     }
 }
 
@@ -2916,6 +3734,91 @@ namespace vmath_hpp
             d, h, l, p};
     }
 
+    namespace impl
+    {
+        template < typename T, std::size_t Rows, std::size_t Cols, std::size_t... Is >
+        [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+        vec<T, Rows> transpose_column_impl(const mat<T, Rows, Cols>& m, std::size_t index, std::index_sequence<Is...>) {
+            return { m[Is][index]... };
+        }
+
+        template < typename T, std::size_t Rows, std::size_t Cols, std::size_t... Is >
+        [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+        mat<T, Cols, Rows> transpose_impl(const mat<T, Rows, Cols>& m, std::index_sequence<Is...>) {
+            return { transpose_column_impl(m, Is, std::make_index_sequence<Rows>{})... };
+        }
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr mat<T, Cols, Rows> transpose(const mat<T, Rows, Cols>& m) {
+        return impl::transpose_impl(m, std::make_index_sequence<Cols>{});
+    }
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename T >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    mat<T, 4> adjugate_4(const mat<T, 4>& _m) {
+        /// REFERENCE:
+        /// https://www.geometrictools.com/Documentation/LaplaceExpansionTheorem.pdf
+
+        // NOLINTNEXTLINE(*-isolate-declaration)
+        const T a = _m[0][0], b = _m[0][1], c = _m[0][2], d = _m[0][3],
+                e = _m[1][0], f = _m[1][1], g = _m[1][2], h = _m[1][3],
+                i = _m[2][0], j = _m[2][1], k = _m[2][2], l = _m[2][3],
+                m = _m[3][0], n = _m[3][1], o = _m[3][2], p = _m[3][3];
+
+        // the 2x2 minors of the upper and the lower row pairs,
+        // every cofactor and the determinant are built from these twelve
+
+        const T s0 = a * f - b * e;
+        const T s1 = a * g - c * e;
+        const T s2 = a * h - d * e;
+        const T s3 = b * g - c * f;
+        const T s4 = b * h - d * f;
+        const T s5 = c * h - d * g;
+
+        const T c0 = i * n - j * m;
+        const T c1 = i * o - k * m;
+        const T c2 = i * p - l * m;
+        const T c3 = j * o - k * n;
+        const T c4 = j * p - l * n;
+        const T c5 = k * p - l * o;
+
+        return {
+            f * c5 - g * c4 + h * c3,
+            c * c4 - b * c5 - d * c3,
+            n * s5 - o * s4 + p * s3,
+            k * s4 - j * s5 - l * s3,
+            g * c2 - e * c5 - h * c1,
+            a * c5 - c * c2 + d * c1,
+            o * s2 - m * s5 - p * s1,
+            i * s5 - k * s2 + l * s1,
+            e * c4 - f * c2 + h * c0,
+            b * c2 - a * c4 - d * c0,
+            m * s4 - n * s2 + p * s0,
+            j * s2 - i * s4 - l * s0,
+            f * c1 - e * c3 - g * c0,
+            a * c3 - b * c1 + c * c0,
+            n * s1 - m * s3 - o * s0,
+            i * s3 - j * s1 + k * s0};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    T determinant_from_adjugate_4(const mat<T, 4>& m, const mat<T, 4>& adj) {
+        // the first row expansion, its cofactors are the first column of the adjugate
+        return
+            m[0][0] * adj[0][0] +
+            m[0][1] * adj[1][0] +
+            m[0][2] * adj[2][0] +
+            m[0][3] * adj[3][0];
+    }
+}
+
+namespace vmath_hpp
+{
     //
     // adjugate
     //
@@ -2951,29 +3854,8 @@ namespace vmath_hpp
     }
 
     template < typename T >
-    [[nodiscard]] constexpr mat<T, 4> adjugate(const mat<T, 4>& _m) {
-        // NOLINTNEXTLINE(*-isolate-declaration)
-        const T a = _m[0][0], b = _m[0][1], c = _m[0][2], d = _m[0][3],
-                e = _m[1][0], f = _m[1][1], g = _m[1][2], h = _m[1][3],
-                i = _m[2][0], j = _m[2][1], k = _m[2][2], l = _m[2][3],
-                m = _m[3][0], n = _m[3][1], o = _m[3][2], p = _m[3][3];
-        return {
-            f * (k * p - l * o) + g * (l * n - j * p) + h * (j * o - k * n),
-            j * (c * p - d * o) + k * (d * n - b * p) + l * (b * o - c * n),
-            n * (c * h - d * g) + o * (d * f - b * h) + p * (b * g - c * f),
-            b * (h * k - g * l) + c * (f * l - h * j) + d * (g * j - f * k),
-            g * (i * p - l * m) + h * (k * m - i * o) + e * (l * o - k * p),
-            k * (a * p - d * m) + l * (c * m - a * o) + i * (d * o - c * p),
-            o * (a * h - d * e) + p * (c * e - a * g) + m * (d * g - c * h),
-            c * (h * i - e * l) + d * (e * k - g * i) + a * (g * l - h * k),
-            h * (i * n - j * m) + e * (j * p - l * n) + f * (l * m - i * p),
-            l * (a * n - b * m) + i * (b * p - d * n) + j * (d * m - a * p),
-            p * (a * f - b * e) + m * (b * h - d * f) + n * (d * e - a * h),
-            d * (f * i - e * j) + a * (h * j - f * l) + b * (e * l - h * i),
-            e * (k * n - j * o) + f * (i * o - k * m) + g * (j * m - i * n),
-            i * (c * n - b * o) + j * (a * o - c * m) + k * (b * m - a * n),
-            m * (c * f - b * g) + n * (a * g - c * e) + o * (b * e - a * f),
-            a * (f * k - g * j) + b * (g * i - e * k) + c * (e * j - f * i)};
+    [[nodiscard]] constexpr mat<T, 4> adjugate(const mat<T, 4>& m) {
+        return impl::adjugate_4(m);
     }
 
     //
@@ -2982,6 +3864,8 @@ namespace vmath_hpp
 
     template < typename T >
     [[nodiscard]] constexpr T determinant(const mat<T, 2>& _m) {
+        VMATH_HPP_INSTRUMENT_CALL(determinant, 3);
+
         // NOLINTNEXTLINE(*-isolate-declaration)
         const T a = _m[0][0], b = _m[0][1],
                 c = _m[1][0], d = _m[1][1];
@@ -2991,6 +3875,8 @@ namespace vmath_hpp
 
     template < typename T >
     [[nodiscard]] constexpr T determinant(const mat<T, 3>& _m) {
+        VMATH_HPP_INSTRUMENT_CALL(determinant, 14);
+
         // NOLINTNEXTLINE(*-isolate-declaration)
         const T a = _m[0][0], b = _m[0][1], c = _m[0][2],
                 d = _m[1][0], e = _m[1][1], f = _m[1][2],
@@ -3003,16 +3889,20 @@ namespace vmath_hpp
 
     template < typename T >
     [[nodiscard]] constexpr T determinant(const mat<T, 4>& _m) {
+        VMATH_HPP_INSTRUMENT_CALL(determinant, 47);
+
         // NOLINTNEXTLINE(*-isolate-declaration)
         const T a = _m[0][0], b = _m[0][1], c = _m[0][2], d = _m[0][3],
                 e = _m[1][0], f = _m[1][1], g = _m[1][2], h = _m[1][3],
                 i = _m[2][0], j = _m[2][1], k = _m[2][2], l = _m[2][3],
                 m = _m[3][0], n = _m[3][1], o = _m[3][2], p = _m[3][3];
         return
-            + a * (f * (k * p - l * o) - (j * (g * p - h * o)) + (n * (g * l - h * k)))
-            - b * (e * (k * p - l * o) - (i * (g * p - h * o)) + (m * (g * l - h * k)))
-            + c * (e * (j * p - l * n) - (i * (f * p - h * n)) + (m * (f * l - h * j)))
-            - d * (e * (j * o - k * n) - (i * (f * o - g * n)) + (m * (f * k - g * j)));
+            + (a * f - b * e) * (k * p - l * o)
+            - (a * g - c * e) * (j * p - l * n)
+            + (a * h - d * e) * (j * o - k * n)
+            + (b * g - c * f) * (i * p - l * m)
+            - (b * h - d * f) * (i * o - k * m)
+            + (c * h - d * g) * (i * n - j * m);
     }
 
     //
@@ -3021,41 +3911,212 @@ namespace vmath_hpp
 
     template < typename T, std::size_t Size >
     [[nodiscard]] constexpr mat<T, Size> inverse(const mat<T, Size>& m) {
-        return adjugate(m) * rcp(determinant(m));
+        if constexpr ( Size == 4 ) {
+            VMATH_HPP_INSTRUMENT_CALL(inverse, 140);
+            const mat<T, 4> adj = adjugate(m);
+            return VMATH_HPP_CHECK_RESULT("inverse", adj * rcp(impl::determinant_from_adjugate_4(m, adj)));
+        } else {
+            VMATH_HPP_INSTRUMENT_CALL(inverse, Size * Size * (Size * Size - 1) + 1);
+            return VMATH_HPP_CHECK_RESULT("inverse", adjugate(m) * rcp(determinant(m)));
+        }
     }
-}
 
-namespace vmath_hpp::detail
-{
-    template < typename T >
-    class qua_base {
-    public:
-        vec<T, 3> v{no_init};
-        T s;
-    public:
-        constexpr qua_base()
-        : qua_base(identity_init) {}
+    //
+    // inverse_determinant
+    //
 
-        constexpr qua_base(no_init_t) {}
-        constexpr qua_base(zero_init_t) : qua_base{zero_init, T{0}} {}
-        constexpr qua_base(identity_init_t) : qua_base{zero_init, T{1}} {}
+    template < typename T, std::size_t Size >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, std::pair<mat<T, Size>, T>>
+    constexpr inverse_determinant(const mat<T, Size>& m) {
+        // a singular matrix, or one whose inverse would overflow,
+        // gets a zero inverse and a zero determinant
+        const mat<T, Size> adj = adjugate(m);
+        const T det = [&m, &adj](){
+            if constexpr ( Size == 4 ) {
+                return impl::determinant_from_adjugate_4(m, adj);
+            } else {
+                return determinant(m);
+            }
+        }();
+        // rcp(det) <= max without dividing by zero, which isn't a constant expression
+        const bool regular = abs(det) >= rcp(std::numeric_limits<T>::max());
+        return {adj * (regular ? rcp(det) : T{0}), regular ? det : T{0}};
+    }
 
-        constexpr qua_base(T vx, T vy, T vz, T s): v{vx, vy, vz}, s{s} {}
-        constexpr qua_base(const vec<T, 3>& v, T s): v{v}, s{s} {}
-        constexpr explicit qua_base(const vec<T, 4>& vs): v{vs[0], vs[1], vs[2]}, s{vs[3]} {}
+    //
+    // mul_chain
+    //
 
-        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
-        constexpr qua_base(const qua_base<U>& other): qua_base(other.v, other.s) {}
+    template < typename X, typename... Xs >
+    [[nodiscard]] constexpr auto mul_chain(const X& x, const Xs&... xs) {
+        // vectors are rows and can only start a chain, so the left fold always
+        // turns it into a sequence of cheap vector-matrix products
+        return (x * ... * xs);
+    }
 
-        template < typename U, std::enable_if_t<std::is_convertible_v<T, U>, int> = 0 >
-        constexpr explicit operator vec<U, 4>() const { return vec<U, 4>(v, s); }
+    //
+    // symmetric_eigen
+    //
 
-        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
-        // NOLINTNEXTLINE(*-pointer-arithmetic)
-        constexpr explicit qua_base(const U* p): qua_base(p[0], p[1], p[2], p[3]) {}
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr std::pair<vec<T, Size>, mat<T, Size>> symmetric_eigen(const mat<T, Size>& m) {
+        /// REFERENCE:
+        /// https://en.wikipedia.org/wiki/Jacobi_eigenvalue_algorithm
+
+        mat<T, Size> a = m;
+        mat<T, Size> v = identity_init;
+
+        // cyclic Jacobi converges quadratically, a fixed sweep count is enough for small matrices;
+        // a zero off-diagonal element selects the identity rotation instead of skipping it,
+        // so every matrix runs the same instructions and a batch of them can be vectorized
+        for ( unsigned sweep = 0; sweep < 6; ++sweep ) {
+            for ( std::size_t p = 0; p + 1 < Size; ++p ) {
+                for ( std::size_t q = p + 1; q < Size; ++q ) {
+                    const T apq = a[p][q];
+                    const bool zero = apq == T{0};
+
+                    const T theta = (a[q][q] - a[p][p]) * rcp(T{2} * (zero ? T{1} : apq));
+                    const T t = zero ? T{0} : copysign(rcp(abs(theta) + sqrt(sqr(theta) + T{1})), theta);
+                    const T c = rsqrt(sqr(t) + T{1});
+                    const T s = t * c;
+
+                    a[p][p] -= t * apq;
+                    a[q][q] += t * apq;
+                    a[p][q] = a[q][p] = T{0};
+
+                    for ( std::size_t r = 0; r < Size; ++r ) {
+                        if ( r == p || r == q ) {
+                            continue;
+                        }
+                        const T arp = a[r][p];
+                        const T arq = a[r][q];
+                        a[r][p] = a[p][r] = c * arp - s * arq;
+                        a[r][q] = a[q][r] = s * arp + c * arq;
+                    }
+
+                    for ( std::size_t i = 0; i < Size; ++i ) {
+                        const T vip = v[i][p];
+                        const T viq = v[i][q];
+                        v[i][p] = c * vip - s * viq;
+                        v[i][q] = s * vip + c * viq;
+                    }
+                }
+            }
+        }
 
-        [[nodiscard]] constexpr T& operator[](std::size_t index) noexcept {
-            switch ( index ) {
+        vec<T, Size> d{no_init};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            d[i] = a[i][i];
+        }
+
+        // sort eigenvalues in descending order with a sorting network:
+        // the compare-exchange pairs are fixed and each one selects instead of swapping
+        for ( std::size_t i = 0; i + 1 < Size; ++i ) {
+            for ( std::size_t j = i + 1; j < Size; ++j ) {
+                const bool swap = d[i] < d[j];
+                const T di = d[i];
+                const T dj = d[j];
+                d[i] = swap ? dj : di;
+                d[j] = swap ? di : dj;
+                for ( std::size_t k = 0; k < Size; ++k ) {
+                    const T vki = v[k][i];
+                    const T vkj = v[k][j];
+                    v[k][i] = swap ? vkj : vki;
+                    v[k][j] = swap ? vki : vkj;
+                }
+            }
+        }
+
+        return {d, v};
+    }
+
+    //
+    // svd
+    //
+
+    template < typename T >
+    [[nodiscard]] constexpr std::tuple<mat<T, 3>, vec<T, 3>, mat<T, 3>> svd(const mat<T, 3>& m) {
+        /// REFERENCE:
+        /// https://pages.cs.wisc.edu/~sifakis/papers/SVD_TR1690.pdf
+
+        auto [eigenvalues, v] = symmetric_eigen(transpose(m) * m);
+        (void)eigenvalues;
+
+        // make V a proper rotation
+        const T flip = determinant(v) < T{0} ? T{-1} : T{1};
+        v[0][2] *= flip;
+        v[1][2] *= flip;
+        v[2][2] *= flip;
+
+        // columns of M * V are U columns scaled by the singular values
+        const mat<T, 3> bt = transpose(m * v);
+        const T tolerance = std::numeric_limits<T>::epsilon() * length2(bt[0]);
+
+        const vec<T, 3> u0 = length2(bt[0]) > T{0}
+            ? bt[0] * rlength(bt[0])
+            : vec<T, 3>{T{1}, T{0}, T{0}};
+
+        const vec<T, 3> u1_raw = bt[1] - dot(bt[1], u0) * u0;
+        const vec<T, 3> u1 = length2(u1_raw) > tolerance
+            ? u1_raw * rlength(u1_raw)
+            : normalize(abs(u0[0]) < T{0.9f}
+                ? cross(u0, vec<T, 3>{T{1}, T{0}, T{0}})
+                : cross(u0, vec<T, 3>{T{0}, T{1}, T{0}}));
+
+        const vec<T, 3> u2 = cross(u0, u1);
+
+        // the last singular value carries the sign of the determinant
+        const vec<T, 3> s{dot(bt[0], u0), dot(bt[1], u1), dot(bt[2], u2)};
+
+        return {transpose(mat<T, 3>{u0, u1, u2}), s, v};
+    }
+
+    //
+    // polar
+    //
+
+    template < typename T >
+    [[nodiscard]] constexpr std::pair<mat<T, 3>, mat<T, 3>> polar(const mat<T, 3>& m) {
+        /// REFERENCE:
+        /// https://en.wikipedia.org/wiki/Polar_decomposition
+
+        const auto [u, s, v] = svd(m);
+        const mat<T, 3> vt = transpose(v);
+        return {u * vt, v * mat<T, 3>{s} * vt};
+    }
+}
+
+namespace vmath_hpp::detail
+{
+    template < typename T >
+    class qua_base {
+    public:
+        vec<T, 3> v{no_init};
+        T s;
+    public:
+        constexpr qua_base()
+        : qua_base(identity_init) {}
+
+        constexpr qua_base(no_init_t) {}
+        constexpr qua_base(zero_init_t) : qua_base{zero_init, T{0}} {}
+        constexpr qua_base(identity_init_t) : qua_base{zero_init, T{1}} {}
+
+        constexpr qua_base(T vx, T vy, T vz, T s): v{vx, vy, vz}, s{s} {}
+        constexpr qua_base(const vec<T, 3>& v, T s): v{v}, s{s} {}
+        constexpr explicit qua_base(const vec<T, 4>& vs): v{vs[0], vs[1], vs[2]}, s{vs[3]} {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr qua_base(const qua_base<U>& other): qua_base(other.v, other.s) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<T, U>, int> = 0 >
+        constexpr explicit operator vec<U, 4>() const { return vec<U, 4>(v, s); }
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        // NOLINTNEXTLINE(*-pointer-arithmetic)
+        constexpr explicit qua_base(const U* p): qua_base(p[0], p[1], p[2], p[3]) {}
+
+        [[nodiscard]] constexpr T& operator[](std::size_t index) noexcept {
+            switch ( index ) {
             default:
             case 0: return v.x;
             case 1: return v.y;
@@ -3177,6 +4238,19 @@ namespace vmath_hpp
     }
 }
 
+namespace vmath_hpp::detail
+{
+    // the imaginary part is followed by the real one: x, y, z, w
+
+    template < typename T >
+    inline constexpr bool is_packed_qua_v =
+        std::is_standard_layout_v<qua<T>> &&
+        std::is_trivially_copyable_v<qua<T>> &&
+        sizeof(qua<T>) == sizeof(T) * 4;
+
+    static_assert(is_packed_qua_v<float> && is_packed_qua_v<double>);
+}
+
 namespace vmath_hpp::detail
 {
     template < typename A, typename F >
@@ -3257,6 +4331,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://www.euclideanspace.com/maths/algebra/realNormedAlgebra/quaternions/transforms/
 
+        VMATH_HPP_INSTRUMENT_CALL(vec_qua_mul, 30);
+
         const vec qv2 = cross(ys.v, xs) * T{2};
         return xs + qv2 * ys.s + cross(ys.v, qv2);
     }
@@ -3266,6 +4342,7 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://www.euclideanspace.com/maths/algebra/realNormedAlgebra/quaternions/arithmetic/
 
+        VMATH_HPP_INSTRUMENT_CALL(qua_mul, 27);
         return qua{
             cross(ys.v, xs.v) + ys.s * xs.v + xs.s * ys.v,
             ys.s * xs.s - dot(ys.v, xs.v)};
@@ -3347,9 +4424,11 @@ namespace vmath_hpp
 
     template < typename T >
     [[nodiscard]] constexpr qua<T> nlerp(const qua<T>& unit_xs, const qua<T>& unit_ys, T a) {
+        VMATH_HPP_INSTRUMENT_CALL(nlerp, 22);
+
         const T xs_scale = T{1} - a;
         const T ys_scale = a * sign(dot(unit_xs, unit_ys));
-        return normalize(lerp(unit_xs, unit_ys, xs_scale, ys_scale));
+        return VMATH_HPP_CHECK_RESULT("nlerp", qua(impl::normalize_impl(impl::lerp_impl(vec{unit_xs}, vec{unit_ys}, xs_scale, ys_scale))));
     }
 
     template < typename T >
@@ -3357,22 +4436,24 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://www.euclideanspace.com/maths/algebra/realNormedAlgebra/quaternions/slerp/
 
+        VMATH_HPP_INSTRUMENT_CALL(slerp, 30);
+
         const T raw_cos_theta = dot(unit_xs, unit_ys);
         const T raw_cos_theta_sign = sign(raw_cos_theta);
 
         // half degree linear threshold: cos((pi / 180) * 0.25)
         if ( const T cos_theta = raw_cos_theta * raw_cos_theta_sign; cos_theta < T{0.99999f} ) {
             const T theta = acos(cos_theta);
-            const T rsin_theta = rsqrt(T{1} - sqr(cos_theta));
+            const T rsin_theta = rsqrt((T{1} - cos_theta) * (T{1} + cos_theta));
             const T xs_scale = sin((T{1} - a) * theta) * rsin_theta;
             const T ys_scale = sin(a * theta) * raw_cos_theta_sign * rsin_theta;
-            return lerp(unit_xs, unit_ys, xs_scale, ys_scale);
+            return VMATH_HPP_CHECK_RESULT("slerp", qua(impl::lerp_impl(vec{unit_xs}, vec{unit_ys}, xs_scale, ys_scale)));
         }
 
         // use linear interpolation for small angles
         const T xs_scale = T{1} - a;
         const T ys_scale = a * raw_cos_theta_sign;
-        return normalize(lerp(unit_xs, unit_ys, xs_scale, ys_scale));
+        return VMATH_HPP_CHECK_RESULT("slerp", qua(impl::normalize_impl(impl::lerp_impl(vec{unit_xs}, vec{unit_ys}, xs_scale, ys_scale))));
     }
 }
 
@@ -3523,7 +4604,38 @@ namespace vmath_hpp
 
     template < typename T >
     [[nodiscard]] constexpr qua<T> inverse(const qua<T>& q) {
-        return conjugate(q) * rlength2(q);
+        VMATH_HPP_INSTRUMENT_CALL(qua_inverse, 15);
+        return VMATH_HPP_CHECK_RESULT("inverse(qua)", conjugate(q) * rlength2(q));
+    }
+}
+
+//
+// Cast
+//
+
+namespace vmath_hpp
+{
+    template < typename To, typename From >
+    [[nodiscard]] std::enable_if_t<
+        std::is_arithmetic_v<To> && std::is_arithmetic_v<From>
+    , To>
+    constexpr cast_to(From x) noexcept {
+        return static_cast<To>(x);
+    }
+
+    template < typename To, typename From, std::size_t Size >
+    [[nodiscard]] constexpr vec<To, Size> cast_to(const vec<From, Size>& v) {
+        return map_join([](From x){ return cast_to<To>(x); }, v);
+    }
+
+    template < typename To, typename From, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr mat<To, Rows, Cols> cast_to(const mat<From, Rows, Cols>& m) {
+        return map_join([](const vec<From, Cols>& v){ return cast_to<To>(v); }, m);
+    }
+
+    template < typename To, typename From >
+    [[nodiscard]] constexpr qua<To> cast_to(const qua<From>& q) {
+        return map_join([](From x){ return cast_to<To>(x); }, q);
     }
 }
 
@@ -3569,89 +4681,6 @@ namespace vmath_hpp
     template < typename T > inline constexpr qua<T> qidentity{identity_init};
 }
 
-//
-// Hash
-//
-
-namespace vmath_hpp::detail
-{
-    struct hash_combiner {
-        template < typename T >
-        [[nodiscard]] std::size_t operator()(std::size_t seed, const T& x) const noexcept {
-            return (seed ^= std::hash<T>{}(x) + 0x9e3779b9 + (seed << 6) + ( seed >> 2));
-        }
-    };
-
-    template < typename T, std::size_t Size >
-    [[nodiscard]] std::size_t hash(const vec<T, Size>& v) noexcept {
-        return fold_join(hash_combiner{}, std::size_t{}, v);
-    }
-
-    template < typename T, std::size_t Size >
-    [[nodiscard]] std::size_t hash(const mat<T, Size>& m) noexcept {
-        return fold_join(hash_combiner{}, std::size_t{}, m);
-    }
-
-    template < typename T >
-    [[nodiscard]] std::size_t hash(const qua<T>& q) noexcept {
-        return fold_join(hash_combiner{}, std::size_t{}, q);
-    }
-}
-
-namespace std
-{
-    template < typename T, size_t Size >
-    struct hash<vmath_hpp::vec<T, Size>> {
-        size_t operator()(const vmath_hpp::vec<T, Size>& v) const noexcept {
-            return vmath_hpp::detail::hash(v);
-        }
-    };
-
-    template < typename T, size_t Size >
-    struct hash<vmath_hpp::mat<T, Size>> {
-        size_t operator()(const vmath_hpp::mat<T, Size>& m) const noexcept {
-            return vmath_hpp::detail::hash(m);
-        }
-    };
-
-    template < typename T >
-    struct hash<vmath_hpp::qua<T>> {
-        size_t operator()(const vmath_hpp::qua<T>& q) const noexcept {
-            return vmath_hpp::detail::hash(q);
-        }
-    };
-}
-
-//
-// Cast
-//
-
-namespace vmath_hpp
-{
-    template < typename To, typename From >
-    [[nodiscard]] std::enable_if_t<
-        std::is_arithmetic_v<To> && std::is_arithmetic_v<From>
-    , To>
-    constexpr cast_to(From x) noexcept {
-        return static_cast<To>(x);
-    }
-
-    template < typename To, typename From, std::size_t Size >
-    [[nodiscard]] constexpr vec<To, Size> cast_to(const vec<From, Size>& v) {
-        return map_join([](From x){ return cast_to<To>(x); }, v);
-    }
-
-    template < typename To, typename From, std::size_t Size >
-    [[nodiscard]] constexpr mat<To, Size> cast_to(const mat<From, Size>& m) {
-        return map_join([](const vec<From, Size>& v){ return cast_to<To>(v); }, m);
-    }
-
-    template < typename To, typename From >
-    [[nodiscard]] constexpr qua<To> cast_to(const qua<From>& q) {
-        return map_join([](From x){ return cast_to<To>(x); }, q);
-    }
-}
-
 //
 // Access
 //
@@ -3674,13 +4703,13 @@ namespace vmath_hpp
 
     // row
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr vec<T, Size> row(const mat<T, Size>& m, std::size_t index) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr vec<T, Cols> row(const mat<T, Rows, Cols>& m, std::size_t index) {
         return m.rows[index];
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr mat<T, Size> row(const mat<T, Size>& m, std::size_t index, const vec<T, Size>& row) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr mat<T, Rows, Cols> row(const mat<T, Rows, Cols>& m, std::size_t index, const vec<T, Cols>& row) {
         mat mm = m;
         mm[index] = row;
         return mm;
@@ -3690,27 +4719,27 @@ namespace vmath_hpp
 
     namespace impl
     {
-        template < typename T, std::size_t Size, std::size_t... Is >
+        template < typename T, std::size_t Rows, std::size_t Cols, std::size_t... Is >
         [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-        vec<T, Size> column_impl(const mat<T, Size>& m, std::size_t index, std::index_sequence<Is...>) {
+        vec<T, Rows> column_impl(const mat<T, Rows, Cols>& m, std::size_t index, std::index_sequence<Is...>) {
             return { m[Is][index]... };
         }
 
-        template < typename T, std::size_t Size, std::size_t... Is >
+        template < typename T, std::size_t Rows, std::size_t Cols, std::size_t... Is >
         [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-        mat<T, Size> column_impl(const mat<T, Size>& m, std::size_t index, const vec<T, Size>& column, std::index_sequence<Is...>) {
+        mat<T, Rows, Cols> column_impl(const mat<T, Rows, Cols>& m, std::size_t index, const vec<T, Rows>& column, std::index_sequence<Is...>) {
             return { component(m[Is], index, column[Is])... };
         }
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr vec<T, Size> column(const mat<T, Size>& m, std::size_t index) {
-        return impl::column_impl(m, index, std::make_index_sequence<Size>{});
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr vec<T, Rows> column(const mat<T, Rows, Cols>& m, std::size_t index) {
+        return impl::column_impl(m, index, std::make_index_sequence<Rows>{});
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr mat<T, Size> column(const mat<T, Size>& m, std::size_t index, const vec<T, Size>& column) {
-        return impl::column_impl(m, index, column, std::make_index_sequence<Size>{});
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr mat<T, Rows, Cols> column(const mat<T, Rows, Cols>& m, std::size_t index, const vec<T, Rows>& column) {
+        return impl::column_impl(m, index, column, std::make_index_sequence<Rows>{});
     }
 
     // diagonal
@@ -3769,6 +4798,84 @@ namespace vmath_hpp
 // Matrix Transform 3D
 //
 
+namespace vmath_hpp::impl
+{
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 3> qua_to_mat3(const qua<T>& q) {
+        /// REFERENCE:
+        /// http://www.euclideanspace.com/maths/geometry/rotations/conversions/quaternionToMatrix/
+
+        // v * qua_to_mat3(q) is v * q for any quaternion, it's a rotation only for unit ones
+
+        const auto [qv, qs] = q;
+
+        const T x2 = qv.x * T{2};
+        const T y2 = qv.y * T{2};
+        const T z2 = qv.z * T{2};
+
+        const T sx2 = qs * x2;
+        const T sy2 = qs * y2;
+        const T sz2 = qs * z2;
+
+        const T xx2 = qv.x * x2;
+        const T xy2 = qv.x * y2;
+        const T xz2 = qv.x * z2;
+
+        const T yy2 = qv.y * y2;
+        const T yz2 = qv.y * z2;
+        const T zz2 = qv.z * z2;
+
+        return {
+            { T{1} - (yy2 + zz2), (xy2 + sz2),        (xz2 - sy2)        },
+            { (xy2 - sz2),        T{1} - (xx2 + zz2), (yz2 + sx2)        },
+            { (xz2 + sy2),        (yz2 - sx2),        T{1} - (xx2 + yy2) }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr bool decompose_axis(vec<T, 3>& row, T s) {
+        // an axis shorter than the smallest normal number has no direction,
+        // it's zeroed instead of being normalized to nans, a nan stays a nan
+        const bool degenerate = abs(s) < std::numeric_limits<T>::min();
+        row = degenerate ? vec<T, 3>{T{0}} : row * rcp(s);
+        return !degenerate;
+    }
+
+    template < typename T >
+    constexpr void decompose_complete(mat<T, 3>& r, const bool (&valid)[3]) {
+        // the rows of zero scale axes are rebuilt from the other rows,
+        // the rotation stays orthonormal, without any axes it's the identity
+        const int count = int{valid[0]} + int{valid[1]} + int{valid[2]};
+
+        if ( count == 3 ) {
+            return;
+        }
+
+        if ( count == 0 ) {
+            r = mat<T, 3>{identity_init};
+            return;
+        }
+
+        std::size_t missing = valid[0] ? (valid[1] ? 2 : 1) : 0;
+
+        if ( count == 1 ) {
+            // the unit axis least aligned with the row, orthogonalized against it
+            const std::size_t k = valid[0] ? 0 : (valid[1] ? 1 : 2);
+            const vec<T, 3> v = r[k];
+            const vec<T, 3> av = abs(v);
+            const std::size_t e = av.x <= av.y && av.x <= av.z ? 0 : (av.y <= av.z ? 1 : 2);
+
+            vec<T, 3> u = -v[e] * v;
+            u[e] += T{1};
+
+            r[(k + 1) % 3] = normalize(u);
+            missing = (k + 2) % 3;
+        }
+
+        // x = y * z, y = z * x and z = x * y keep the determinant positive
+        r[missing] = cross(r[(missing + 1) % 3], r[(missing + 2) % 3]);
+    }
+}
+
 namespace vmath_hpp
 {
     // trs
@@ -3801,6 +4908,64 @@ namespace vmath_hpp
         return trs(t, rotate(r), s);
     }
 
+    // decompose
+
+    template < typename T >
+    [[nodiscard]] constexpr std::tuple<vec<T, 3>, qua<T>, vec<T, 3>> decompose(const mat<T, 4>& m) {
+        /// REFERENCE:
+        /// Spencer W. Thomas, "Decomposing a Matrix into Simple Transformations", Graphics Gems II
+
+        vec<T, 3> row0{m[0]};
+        vec<T, 3> row1{m[1]};
+        vec<T, 3> row2{m[2]};
+
+        // Gram-Schmidt orthonormalization, the shear part is discarded
+        vec<T, 3> s{no_init};
+        bool valid[3]{};
+
+        s.x = length(row0);
+        valid[0] = impl::decompose_axis(row0, s.x);
+
+        row1 -= dot(row0, row1) * row0;
+        s.y = length(row1);
+        valid[1] = impl::decompose_axis(row1, s.y);
+
+        row2 -= dot(row0, row2) * row0 + dot(row1, row2) * row1;
+        s.z = length(row2);
+        valid[2] = impl::decompose_axis(row2, s.z);
+
+        mat<T, 3> r{row0, row1, row2};
+        impl::decompose_complete(r, valid);
+
+        // a negative determinant means a reflection, move it to the x scale
+        if ( dot(r[0], cross(r[1], r[2])) < T{0} ) {
+            s.x = -s.x;
+            r[0] = -r[0];
+        }
+
+        return {vec<T, 3>{m[3]}, qrotate(r), s};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr std::tuple<vec<T, 3>, qua<T>, vec<T, 3>> decompose_fast(const mat<T, 4>& m) {
+        // assumes the matrix has no shear, rows are scaled rotation axes
+
+        const mat<T, 3> rs{m};
+        vec<T, 3> s{length(rs[0]), length(rs[1]), length(rs[2])};
+
+        // a negative determinant means a reflection, move it to the x scale
+        s.x = copysign(s.x, determinant(rs));
+
+        mat<T, 3> r{rs};
+        bool valid[3]{};
+        valid[0] = impl::decompose_axis(r[0], s.x);
+        valid[1] = impl::decompose_axis(r[1], s.y);
+        valid[2] = impl::decompose_axis(r[2], s.z);
+        impl::decompose_complete(r, valid);
+
+        return {vec<T, 3>{m[3]}, qrotate(r), s};
+    }
+
     // translate
 
     template < typename T >
@@ -3819,32 +4984,9 @@ namespace vmath_hpp
 
     template < typename T >
     [[nodiscard]] constexpr mat<T, 3> rotate(const qua<T>& q) {
-        /// REFERENCE:
-        /// http://www.euclideanspace.com/maths/geometry/rotations/conversions/quaternionToMatrix/
-
-        const auto [qv, qs] = normalize(q);
-
-        const T x2 = qv.x * T{2};
-        const T y2 = qv.y * T{2};
-        const T z2 = qv.z * T{2};
-
-        const T sx2 = qs * x2;
-        const T sy2 = qs * y2;
-        const T sz2 = qs * z2;
-
-        const T xx2 = qv.x * x2;
-        const T xy2 = qv.x * y2;
-        const T xz2 = qv.x * z2;
-
-        const T yy2 = qv.y * y2;
-        const T yz2 = qv.y * z2;
-        const T zz2 = qv.z * z2;
-
-        return {
-            { T{1} - (yy2 + zz2), (xy2 + sz2),        (xz2 - sy2)        },
-            { (xy2 - sz2),        T{1} - (xx2 + zz2), (yz2 + sx2)        },
-            { (xz2 + sy2),        (yz2 - sx2),        T{1} - (xx2 + yy2) }};
-    }
+        VMATH_HPP_INSTRUMENT_CALL(rotate, 24);
+        return impl::qua_to_mat3(normalize(q));
+    }
 
     template < typename T >
     [[nodiscard]] constexpr mat<T, 4> rotate4(const qua<T>& q) {
@@ -3856,6 +4998,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://www.euclideanspace.com/maths/geometry/rotations/conversions/angleToMatrix/
 
+        VMATH_HPP_INSTRUMENT_CALL(rotate, 26);
+
         const auto [s, c] = sincos(angle);
         const auto [x, y, z] = normalize(axis);
 
@@ -3976,6 +5120,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// https://www.euclideanspace.com/maths/algebra/vectors/lookat/
 
+        VMATH_HPP_INSTRUMENT_CALL(look_at, 18);
+
         const vec az = normalize(dir);
         const vec ax = normalize(cross(up, az));
         const vec ay = cross(az, ax);
@@ -3995,6 +5141,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// https://www.euclideanspace.com/maths/algebra/vectors/lookat/
 
+        VMATH_HPP_INSTRUMENT_CALL(look_at, 39);
+
         const vec az = normalize(at - eye);
         const vec ax = normalize(cross(up, az));
         const vec ay = cross(az, ax);
@@ -4018,6 +5166,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// https://www.euclideanspace.com/maths/algebra/vectors/lookat/
 
+        VMATH_HPP_INSTRUMENT_CALL(look_at, 18);
+
         const vec az = normalize(-dir);
         const vec ax = normalize(cross(up, az));
         const vec ay = cross(az, ax);
@@ -4037,6 +5187,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// https://www.euclideanspace.com/maths/algebra/vectors/lookat/
 
+        VMATH_HPP_INSTRUMENT_CALL(look_at, 39);
+
         const vec az = normalize(eye - at);
         const vec ax = normalize(cross(up, az));
         const vec ay = cross(az, ax);
@@ -4328,6 +5480,285 @@ namespace vmath_hpp
             { T{0}, T{0},  sz,  -T{1} },
             { T{0}, T{0},  tz,   T{0} }};
     }
+
+    // perspective_fov_infinite_reversed
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_fov_infinite_reversed_lh(T fovy, T aspect, T znear) {
+        /// REFERENCE:
+        /// https://developer.nvidia.com/content/depth-precision-visualized
+
+        // the near plane maps to 1 and the infinity to 0, so the float
+        // exponents follow the hyperbolic depth and the precision is even
+
+        const T sy = rcp(tan(fovy * T{0.5f}));
+        const T sx = sy * rcp(aspect);
+
+        return {
+            {  sx,  T{0},  T{0},  T{0} },
+            { T{0},  sy,   T{0},  T{0} },
+            { T{0}, T{0},  T{0},  T{1} },
+            { T{0}, T{0}, znear,  T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_fov_infinite_reversed_rh(T fovy, T aspect, T znear) {
+        /// REFERENCE:
+        /// https://developer.nvidia.com/content/depth-precision-visualized
+
+        const T sy = rcp(tan(fovy * T{0.5f}));
+        const T sx = sy * rcp(aspect);
+
+        return {
+            {  sx,  T{0},  T{0},  T{0} },
+            { T{0},  sy,   T{0},  T{0} },
+            { T{0}, T{0},  T{0}, -T{1} },
+            { T{0}, T{0}, znear,  T{0} }};
+    }
+
+    // perspective_reversed
+
+    // reversed depth: znear maps to 1 and zfar to 0, the float exponents
+    // follow the hyperbolic depth and the far precision isn't lost
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_reversed_lh(T width, T height, T znear, T zfar) {
+        const T sx = T{2} * znear * rcp(width);
+        const T sy = T{2} * znear * rcp(height);
+        const T sz = znear * rcp(znear - zfar);
+        const T tz = (znear * zfar) * rcp(zfar - znear);
+
+        return {
+            {  sx,  T{0}, T{0}, T{0} },
+            { T{0},  sy,  T{0}, T{0} },
+            { T{0}, T{0},  sz,  T{1} },
+            { T{0}, T{0},  tz,  T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_reversed_rh(T width, T height, T znear, T zfar) {
+        const T sx = T{2} * znear * rcp(width);
+        const T sy = T{2} * znear * rcp(height);
+        const T sz = znear * rcp(zfar - znear);
+        const T tz = (znear * zfar) * rcp(zfar - znear);
+
+        return {
+            {  sx,  T{0}, T{0},  T{0} },
+            { T{0},  sy,  T{0},  T{0} },
+            { T{0}, T{0},  sz,  -T{1} },
+            { T{0}, T{0},  tz,   T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_reversed_lh(T left, T right, T bottom, T top, T znear, T zfar) {
+        const T znear2 = T{2} * znear;
+        const T rwidth = rcp(right - left);
+        const T rheight = rcp(top - bottom);
+        const T sz = znear * rcp(znear - zfar);
+        const T tz = (znear * zfar) * rcp(zfar - znear);
+
+        return {
+            { znear2 * rwidth,          T{0},                      T{0}, T{0} },
+            { T{0},                     znear2 * rheight,          T{0}, T{0} },
+            { -(left + right) * rwidth, -(top + bottom) * rheight, sz,   T{1} },
+            { T{0},                     T{0},                      tz,   T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_reversed_rh(T left, T right, T bottom, T top, T znear, T zfar) {
+        const T znear2 = T{2} * znear;
+        const T rwidth = rcp(right - left);
+        const T rheight = rcp(top - bottom);
+        const T sz = znear * rcp(zfar - znear);
+        const T tz = (znear * zfar) * rcp(zfar - znear);
+
+        return {
+            { znear2 * rwidth,         T{0},                     T{0},  T{0} },
+            { T{0},                    znear2 * rheight,         T{0},  T{0} },
+            { (left + right) * rwidth, (top + bottom) * rheight, sz,   -T{1} },
+            { T{0},                    T{0},                     tz,    T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_fov_reversed_lh(T fovy, T aspect, T znear, T zfar) {
+        const T sy = rcp(tan(fovy * T{0.5f}));
+        const T sx = sy * rcp(aspect);
+        const T sz = znear * rcp(znear - zfar);
+        const T tz = (znear * zfar) * rcp(zfar - znear);
+
+        return {
+            {  sx,  T{0}, T{0}, T{0} },
+            { T{0},  sy,  T{0}, T{0} },
+            { T{0}, T{0},  sz,  T{1} },
+            { T{0}, T{0},  tz,  T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_fov_reversed_rh(T fovy, T aspect, T znear, T zfar) {
+        const T sy = rcp(tan(fovy * T{0.5f}));
+        const T sx = sy * rcp(aspect);
+        const T sz = znear * rcp(zfar - znear);
+        const T tz = (znear * zfar) * rcp(zfar - znear);
+
+        return {
+            {  sx,  T{0}, T{0},  T{0} },
+            { T{0},  sy,  T{0},  T{0} },
+            { T{0}, T{0},  sz,  -T{1} },
+            { T{0}, T{0},  tz,   T{0} }};
+    }
+
+    // perspective_infinite
+
+    // the limits of the standard matrices as zfar goes to infinity
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_lh(T width, T height, T znear) {
+        const T sx = T{2} * znear * rcp(width);
+        const T sy = T{2} * znear * rcp(height);
+
+        return {
+            {  sx,  T{0},   T{0}, T{0} },
+            { T{0},  sy,    T{0}, T{0} },
+            { T{0}, T{0},   T{1}, T{1} },
+            { T{0}, T{0}, -znear, T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_rh(T width, T height, T znear) {
+        const T sx = T{2} * znear * rcp(width);
+        const T sy = T{2} * znear * rcp(height);
+
+        return {
+            {  sx,  T{0},   T{0},  T{0} },
+            { T{0},  sy,    T{0},  T{0} },
+            { T{0}, T{0},  -T{1}, -T{1} },
+            { T{0}, T{0}, -znear,  T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_lh(T left, T right, T bottom, T top, T znear) {
+        const T znear2 = T{2} * znear;
+        const T rwidth = rcp(right - left);
+        const T rheight = rcp(top - bottom);
+
+        return {
+            { znear2 * rwidth,          T{0},                      T{0},   T{0} },
+            { T{0},                     znear2 * rheight,          T{0},   T{0} },
+            { -(left + right) * rwidth, -(top + bottom) * rheight, T{1},   T{1} },
+            { T{0},                     T{0},                      -znear, T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_rh(T left, T right, T bottom, T top, T znear) {
+        const T znear2 = T{2} * znear;
+        const T rwidth = rcp(right - left);
+        const T rheight = rcp(top - bottom);
+
+        return {
+            { znear2 * rwidth,         T{0},                     T{0},    T{0} },
+            { T{0},                    znear2 * rheight,         T{0},    T{0} },
+            { (left + right) * rwidth, (top + bottom) * rheight, -T{1},  -T{1} },
+            { T{0},                    T{0},                     -znear,  T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_fov_infinite_lh(T fovy, T aspect, T znear) {
+        const T sy = rcp(tan(fovy * T{0.5f}));
+        const T sx = sy * rcp(aspect);
+
+        return {
+            {  sx,  T{0},   T{0}, T{0} },
+            { T{0},  sy,    T{0}, T{0} },
+            { T{0}, T{0},   T{1}, T{1} },
+            { T{0}, T{0}, -znear, T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_fov_infinite_rh(T fovy, T aspect, T znear) {
+        const T sy = rcp(tan(fovy * T{0.5f}));
+        const T sx = sy * rcp(aspect);
+
+        return {
+            {  sx,  T{0},   T{0},  T{0} },
+            { T{0},  sy,    T{0},  T{0} },
+            { T{0}, T{0},  -T{1}, -T{1} },
+            { T{0}, T{0}, -znear,  T{0} }};
+    }
+
+    // perspective_infinite_reversed
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_reversed_lh(T width, T height, T znear) {
+        const T sx = T{2} * znear * rcp(width);
+        const T sy = T{2} * znear * rcp(height);
+
+        return {
+            {  sx,  T{0},  T{0}, T{0} },
+            { T{0},  sy,   T{0}, T{0} },
+            { T{0}, T{0},  T{0}, T{1} },
+            { T{0}, T{0}, znear, T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_reversed_rh(T width, T height, T znear) {
+        const T sx = T{2} * znear * rcp(width);
+        const T sy = T{2} * znear * rcp(height);
+
+        return {
+            {  sx,  T{0},  T{0},  T{0} },
+            { T{0},  sy,   T{0},  T{0} },
+            { T{0}, T{0},  T{0}, -T{1} },
+            { T{0}, T{0}, znear,  T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_reversed_lh(T left, T right, T bottom, T top, T znear) {
+        const T znear2 = T{2} * znear;
+        const T rwidth = rcp(right - left);
+        const T rheight = rcp(top - bottom);
+
+        return {
+            { znear2 * rwidth,          T{0},                      T{0},  T{0} },
+            { T{0},                     znear2 * rheight,          T{0},  T{0} },
+            { -(left + right) * rwidth, -(top + bottom) * rheight, T{0},  T{1} },
+            { T{0},                     T{0},                      znear, T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_reversed_rh(T left, T right, T bottom, T top, T znear) {
+        const T znear2 = T{2} * znear;
+        const T rwidth = rcp(right - left);
+        const T rheight = rcp(top - bottom);
+
+        return {
+            { znear2 * rwidth,         T{0},                     T{0},   T{0} },
+            { T{0},                    znear2 * rheight,         T{0},   T{0} },
+            { (left + right) * rwidth, (top + bottom) * rheight, T{0},  -T{1} },
+            { T{0},                    T{0},                     znear,  T{0} }};
+    }
+
+    // inverse_perspective
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> inverse_perspective(const mat<T, 4>& m) {
+        // any of the perspective matrices above has the form
+        //   [ sx  0  0  0 ]
+        //   [  0 sy  0  0 ]
+        //   [ cx cy sz  w ]
+        //   [  0  0 tz  0 ]
+        // so the inverse is a few reciprocals instead of the general inverse
+
+        const T rsx = rcp(m[0][0]);
+        const T rsy = rcp(m[1][1]);
+        const T rtz = rcp(m[3][2]);
+        const T rw = rcp(m[2][3]);
+
+        return {
+            { rsx,                  T{0},                 T{0}, T{0}              },
+            { T{0},                 rsy,                  T{0}, T{0}              },
+            { T{0},                 T{0},                 T{0}, rtz               },
+            { -m[2][0] * rw * rsx,  -m[2][1] * rw * rsy,  rw,   -m[2][2] * rw * rtz }};
+    }
 }
 
 //
@@ -4341,7 +5772,9 @@ namespace vmath_hpp
     template < typename T, std::size_t Size >
     [[nodiscard]] constexpr T angle(const vec<T, Size>& x, const vec<T, Size>& y) {
         const T rs = rsqrt(length2(x) * length2(y));
-        return acos(clamp(dot(x, y) * rs, -T{1}, T{1}));
+        // checked before the clamp, it would hide the nan of zero vectors
+        const T cos_angle = VMATH_HPP_CHECK_RESULT("angle", dot(x, y) * rs);
+        return acos(clamp(cos_angle, -T{1}, T{1}));
     }
 
     // rotate
@@ -4384,6 +5817,37 @@ namespace vmath_hpp
     [[nodiscard]] constexpr vec<T, Size> perpendicular(const vec<T, Size>& v, const vec<T, Size>& normal) {
         return v - project(v, normal);
     }
+
+    // unproject
+
+    template < typename T >
+    [[nodiscard]] constexpr vec<T, 3> unproject(const vec<T, 3>& ndc, const mat<T, 4>& inv_view_proj) {
+        // ndc is the clip space point after the division by w, depth in [0, 1]
+        const vec<T, 4> p = vec<T, 4>{ndc, T{1}} * inv_view_proj;
+        return vec<T, 3>{p.x, p.y, p.z} * rcp(p.w);
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> window_to_ndc(const vec<T, 4>& viewport) {
+        // the viewport is (x, y, width, height) with the origin
+        // in the top left corner and the y axis pointing down
+        const T sx = T{2} * rcp(viewport.z);
+        const T sy = T{2} * rcp(viewport.w);
+        return {
+            { sx,                         T{0},                      T{0}, T{0} },
+            { T{0},                       -sy,                       T{0}, T{0} },
+            { T{0},                       T{0},                      T{1}, T{0} },
+            { -viewport.x * sx - T{1},    viewport.y * sy + T{1},    T{0}, T{1} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr vec<T, 3> unproject(const vec<T, 3>& window, const mat<T, 4>& inv_view_proj, const vec<T, 4>& viewport) {
+        const vec<T, 3> ndc{
+            T{2} * (window.x - viewport.x) * rcp(viewport.z) - T{1},
+            T{1} - T{2} * (window.y - viewport.y) * rcp(viewport.w),
+            window.z};
+        return unproject(ndc, inv_view_proj);
+    }
 }
 
 //
@@ -4399,6 +5863,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://www.euclideanspace.com/maths/geometry/rotations/conversions/matrixToQuaternion/
 
+        VMATH_HPP_INSTRUMENT_CALL(qrotate, 30);
+
         auto xyzw = T{0.5f} * sqrt(max(T{0}, vec{
             T{1} + m[0][0] - m[1][1] - m[2][2],
             T{1} - m[0][0] + m[1][1] - m[2][2],
@@ -4417,6 +5883,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://lolengine.net/blog/2014/02/24/quaternion-from-two-vectors-final
 
+        VMATH_HPP_INSTRUMENT_CALL(qrotate, 25);
+
         const T n = sqrt(length2(from) * length2(to));
         const T s = dot(from, to) + n;
 
@@ -4434,6 +5902,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://www.euclideanspace.com/maths/geometry/rotations/conversions/angleToQuaternion/
 
+        VMATH_HPP_INSTRUMENT_CALL(qrotate, 6);
+
         const auto [s, c] = sincos(angle * T{0.5f});
         const auto [x, y, z] = normalize(axis);
 
@@ -4482,3 +5952,6007 @@ namespace vmath_hpp
         return qrotate(look_at_rh(dir, up));
     }
 }
+
+//
+// Morton Codes
+//
+
+namespace vmath_hpp::detail
+{
+    template < typename Key >
+    inline constexpr bool is_morton_key_v =
+        std::is_same_v<Key, std::uint32_t> ||
+        std::is_same_v<Key, std::uint64_t>;
+
+    template < typename Key >
+    [[nodiscard]] constexpr Key morton_spread2(Key x) noexcept {
+        if constexpr ( sizeof(Key) == sizeof(std::uint32_t) ) {
+            x &= Key{0x0000FFFF};
+            x = (x | (x << 8)) & Key{0x00FF00FF};
+            x = (x | (x << 4)) & Key{0x0F0F0F0F};
+            x = (x | (x << 2)) & Key{0x33333333};
+            x = (x | (x << 1)) & Key{0x55555555};
+        } else {
+            x &= Key{0x00000000FFFFFFFF};
+            x = (x | (x << 16)) & Key{0x0000FFFF0000FFFF};
+            x = (x | (x << 8)) & Key{0x00FF00FF00FF00FF};
+            x = (x | (x << 4)) & Key{0x0F0F0F0F0F0F0F0F};
+            x = (x | (x << 2)) & Key{0x3333333333333333};
+            x = (x | (x << 1)) & Key{0x5555555555555555};
+        }
+        return x;
+    }
+
+    template < typename Key >
+    [[nodiscard]] constexpr Key morton_compact2(Key x) noexcept {
+        if constexpr ( sizeof(Key) == sizeof(std::uint32_t) ) {
+            x &= Key{0x55555555};
+            x = (x ^ (x >> 1)) & Key{0x33333333};
+            x = (x ^ (x >> 2)) & Key{0x0F0F0F0F};
+            x = (x ^ (x >> 4)) & Key{0x00FF00FF};
+            x = (x ^ (x >> 8)) & Key{0x0000FFFF};
+        } else {
+            x &= Key{0x5555555555555555};
+            x = (x ^ (x >> 1)) & Key{0x3333333333333333};
+            x = (x ^ (x >> 2)) & Key{0x0F0F0F0F0F0F0F0F};
+            x = (x ^ (x >> 4)) & Key{0x00FF00FF00FF00FF};
+            x = (x ^ (x >> 8)) & Key{0x0000FFFF0000FFFF};
+            x = (x ^ (x >> 16)) & Key{0x00000000FFFFFFFF};
+        }
+        return x;
+    }
+
+    template < typename Key >
+    [[nodiscard]] constexpr Key morton_spread3(Key x) noexcept {
+        if constexpr ( sizeof(Key) == sizeof(std::uint32_t) ) {
+            x &= Key{0x000003FF};
+            x = (x | (x << 16)) & Key{0x030000FF};
+            x = (x | (x << 8)) & Key{0x0300F00F};
+            x = (x | (x << 4)) & Key{0x030C30C3};
+            x = (x | (x << 2)) & Key{0x09249249};
+        } else {
+            x &= Key{0x00000000001FFFFF};
+            x = (x | (x << 32)) & Key{0x001F00000000FFFF};
+            x = (x | (x << 16)) & Key{0x001F0000FF0000FF};
+            x = (x | (x << 8)) & Key{0x100F00F00F00F00F};
+            x = (x | (x << 4)) & Key{0x10C30C30C30C30C3};
+            x = (x | (x << 2)) & Key{0x1249249249249249};
+        }
+        return x;
+    }
+
+    template < typename Key >
+    [[nodiscard]] constexpr Key morton_compact3(Key x) noexcept {
+        if constexpr ( sizeof(Key) == sizeof(std::uint32_t) ) {
+            x &= Key{0x09249249};
+            x = (x ^ (x >> 2)) & Key{0x030C30C3};
+            x = (x ^ (x >> 4)) & Key{0x0300F00F};
+            x = (x ^ (x >> 8)) & Key{0xFF0000FF};
+            x = (x ^ (x >> 16)) & Key{0x000003FF};
+        } else {
+            x &= Key{0x1249249249249249};
+            x = (x ^ (x >> 2)) & Key{0x10C30C30C30C30C3};
+            x = (x ^ (x >> 4)) & Key{0x100F00F00F00F00F};
+            x = (x ^ (x >> 8)) & Key{0x001F0000FF0000FF};
+            x = (x ^ (x >> 16)) & Key{0x001F00000000FFFF};
+            x = (x ^ (x >> 32)) & Key{0x00000000001FFFFF};
+        }
+        return x;
+    }
+}
+
+namespace vmath_hpp
+{
+    // morton_encode
+
+    template < typename Key = std::uint32_t, typename T >
+    [[nodiscard]] std::enable_if_t<
+        detail::is_morton_key_v<Key> && std::is_unsigned_v<T>
+    , Key>
+    constexpr morton_encode(const vec<T, 2>& v) noexcept {
+        /// REFERENCE:
+        /// https://fgiesen.wordpress.com/2009/12/13/decoding-morton-codes/
+
+        return
+            (detail::morton_spread2(static_cast<Key>(v.x)) << 0) |
+            (detail::morton_spread2(static_cast<Key>(v.y)) << 1);
+    }
+
+    template < typename Key = std::uint32_t, typename T >
+    [[nodiscard]] std::enable_if_t<
+        detail::is_morton_key_v<Key> && std::is_unsigned_v<T>
+    , Key>
+    constexpr morton_encode(const vec<T, 3>& v) noexcept {
+        /// REFERENCE:
+        /// https://fgiesen.wordpress.com/2009/12/13/decoding-morton-codes/
+
+        return
+            (detail::morton_spread3(static_cast<Key>(v.x)) << 0) |
+            (detail::morton_spread3(static_cast<Key>(v.y)) << 1) |
+            (detail::morton_spread3(static_cast<Key>(v.z)) << 2);
+    }
+
+    // morton_decode
+
+    template < std::size_t Size, typename Key >
+    [[nodiscard]] std::enable_if_t<
+        detail::is_morton_key_v<Key> && Size == 2
+    , vec<unsigned, 2>>
+    constexpr morton_decode(Key key) noexcept {
+        return {
+            static_cast<unsigned>(detail::morton_compact2(key >> 0)),
+            static_cast<unsigned>(detail::morton_compact2(key >> 1))};
+    }
+
+    template < std::size_t Size, typename Key >
+    [[nodiscard]] std::enable_if_t<
+        detail::is_morton_key_v<Key> && Size == 3
+    , vec<unsigned, 3>>
+    constexpr morton_decode(Key key) noexcept {
+        return {
+            static_cast<unsigned>(detail::morton_compact3(key >> 0)),
+            static_cast<unsigned>(detail::morton_compact3(key >> 1)),
+            static_cast<unsigned>(detail::morton_compact3(key >> 2))};
+    }
+
+    // quantize
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<unsigned, Size> quantize(
+        const vec<T, Size>& v,
+        const vec<T, Size>& min_v,
+        const vec<T, Size>& max_v,
+        unsigned bits)
+    {
+        // float can't represent the top cells of grids finer than 24 bits,
+        // so the grid is computed in double, bits is clamped to the width of
+        // unsigned and a zero extent maps to the first cell
+
+        using W = std::conditional_t<(sizeof(T) < sizeof(double)), double, T>;
+        constexpr unsigned max_bits = std::numeric_limits<unsigned>::digits;
+
+        const unsigned grid_bits = bits < max_bits ? bits : max_bits;
+        const W scale = grid_bits > 0
+            ? static_cast<W>(std::numeric_limits<unsigned>::max() >> (max_bits - grid_bits))
+            : W{0};
+
+        vec<unsigned, Size> r{zero_init};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            const W extent = static_cast<W>(max_v[i]) - static_cast<W>(min_v[i]);
+            const W t = extent > W{0}
+                ? saturate((static_cast<W>(v[i]) - static_cast<W>(min_v[i])) * rcp(extent))
+                : W{0};
+            // the value is non-negative, the conversion truncates it like floor
+            // would, and unlike std::floor it's constexpr before C++23
+            r[i] = static_cast<unsigned>(t * scale + W{0.5f});
+        }
+        return r;
+    }
+}
+
+//
+// Batch Multiplication
+//
+
+namespace vmath_hpp
+{
+    // multiply
+
+    template < typename InputIt, typename OutputIt, typename T, std::size_t Rows, std::size_t Cols >
+    constexpr OutputIt multiply(InputIt first, InputIt last, const mat<T, Rows, Cols>& m, OutputIt d_first) {
+        // local copy: the output range may alias the matrix, and it lets the rows stay in registers
+        const mat<T, Rows, Cols> mm = m;
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = *first * mm;
+        }
+        return d_first;
+    }
+
+    template < typename InputIt, typename OutputIt, typename T, std::size_t Rows, std::size_t Cols >
+    constexpr OutputIt multiply(const mat<T, Rows, Cols>& m, InputIt first, InputIt last, OutputIt d_first) {
+        const mat<T, Rows, Cols> mm = m;
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = mm * *first;
+        }
+        return d_first;
+    }
+
+    template < typename InputIt1, typename InputIt2, typename OutputIt >
+    constexpr OutputIt multiply(InputIt1 first1, InputIt1 last1, InputIt2 first2, OutputIt d_first) {
+        for ( ; first1 != last1; ++first1, ++first2, ++d_first ) {
+            *d_first = *first1 * *first2;
+        }
+        return d_first;
+    }
+}
+
+//
+// Batch Normalization
+//
+
+namespace vmath_hpp
+{
+    // normalize
+
+    template < typename InputIt, typename OutputIt >
+    constexpr OutputIt normalize(InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = normalize(*first);
+        }
+        return d_first;
+    }
+
+    // normalize_or
+
+    template < typename InputIt, typename OutputIt, typename T, std::size_t Size >
+    constexpr OutputIt normalize_or(InputIt first, InputIt last, const vec<T, Size>& fallback, OutputIt d_first) {
+        const vec<T, Size> ff = fallback;
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = normalize_or(*first, ff);
+        }
+        return d_first;
+    }
+
+    // normalize_fast
+
+    template < typename InputIt, typename OutputIt >
+    OutputIt normalize_fast(InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = normalize_fast(*first);
+        }
+        return d_first;
+    }
+
+    // normalize_length
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2 >
+    constexpr std::pair<OutputIt1, OutputIt2> normalize_length(InputIt first, InputIt last, OutputIt1 d_first, OutputIt2 l_first) {
+        for ( ; first != last; ++first, ++d_first, ++l_first ) {
+            const auto [n, l] = normalize_length(*first);
+            *d_first = n;
+            *l_first = l;
+        }
+        return {d_first, l_first};
+    }
+
+    // normalize_or_soa
+
+    template < typename T, std::size_t Size >
+    constexpr void normalize_or_soa(T* const (&components)[Size], std::size_t n, const vec<T, Size>& fallback) {
+        // in place, components[c][i] is the component c of the vector i
+        const vec<T, Size> ff = fallback;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            T l2{0};
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                l2 += components[c][i] * components[c][i];
+            }
+
+            const bool valid = l2 >= std::numeric_limits<T>::min();
+            const T s = rsqrt(valid ? l2 : T{1});
+
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                const T nc = components[c][i] * s;
+                components[c][i] = valid ? nc : ff[c];
+            }
+        }
+    }
+}
+
+//
+// Batch Inversion
+//
+
+namespace vmath_hpp
+{
+    // determinant
+
+    template < typename InputIt, typename OutputIt >
+    constexpr OutputIt determinant(InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = determinant(*first);
+        }
+        return d_first;
+    }
+
+    // inverse
+
+    template < typename InputIt, typename OutputIt >
+    constexpr OutputIt inverse(InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = inverse(*first);
+        }
+        return d_first;
+    }
+
+    // inverse_determinant
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2 >
+    constexpr std::pair<OutputIt1, OutputIt2> inverse_determinant(InputIt first, InputIt last, OutputIt1 d_first, OutputIt2 det_first) {
+        for ( ; first != last; ++first, ++d_first, ++det_first ) {
+            const auto [inv, det] = inverse_determinant(*first);
+            *d_first = inv;
+            *det_first = det;
+        }
+        return {d_first, det_first};
+    }
+}
+
+//
+// Batch Decomposition
+//
+
+namespace vmath_hpp
+{
+    // decompose
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2, typename OutputIt3 >
+    constexpr std::tuple<OutputIt1, OutputIt2, OutputIt3> decompose(InputIt first, InputIt last, OutputIt1 t_first, OutputIt2 r_first, OutputIt3 s_first) {
+        for ( ; first != last; ++first, ++t_first, ++r_first, ++s_first ) {
+            const auto [t, r, s] = decompose(*first);
+            *t_first = t;
+            *r_first = r;
+            *s_first = s;
+        }
+        return {t_first, r_first, s_first};
+    }
+
+    // decompose_fast
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2, typename OutputIt3 >
+    constexpr std::tuple<OutputIt1, OutputIt2, OutputIt3> decompose_fast(InputIt first, InputIt last, OutputIt1 t_first, OutputIt2 r_first, OutputIt3 s_first) {
+        for ( ; first != last; ++first, ++t_first, ++r_first, ++s_first ) {
+            const auto [t, r, s] = decompose_fast(*first);
+            *t_first = t;
+            *r_first = r;
+            *s_first = s;
+        }
+        return {t_first, r_first, s_first};
+    }
+
+    // symmetric_eigen
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2 >
+    constexpr std::pair<OutputIt1, OutputIt2> symmetric_eigen(InputIt first, InputIt last, OutputIt1 d_first, OutputIt2 v_first) {
+        for ( ; first != last; ++first, ++d_first, ++v_first ) {
+            const auto [d, v] = symmetric_eigen(*first);
+            *d_first = d;
+            *v_first = v;
+        }
+        return {d_first, v_first};
+    }
+
+    // svd
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2, typename OutputIt3 >
+    constexpr std::tuple<OutputIt1, OutputIt2, OutputIt3> svd(InputIt first, InputIt last, OutputIt1 u_first, OutputIt2 s_first, OutputIt3 v_first) {
+        for ( ; first != last; ++first, ++u_first, ++s_first, ++v_first ) {
+            const auto [u, s, v] = svd(*first);
+            *u_first = u;
+            *s_first = s;
+            *v_first = v;
+        }
+        return {u_first, s_first, v_first};
+    }
+
+    // polar
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2 >
+    constexpr std::pair<OutputIt1, OutputIt2> polar(InputIt first, InputIt last, OutputIt1 r_first, OutputIt2 s_first) {
+        for ( ; first != last; ++first, ++r_first, ++s_first ) {
+            const auto [r, s] = polar(*first);
+            *r_first = r;
+            *s_first = s;
+        }
+        return {r_first, s_first};
+    }
+}
+
+//
+// Batch Quaternions
+//
+
+namespace vmath_hpp
+{
+    // rotate
+
+    template < typename InputIt, typename OutputIt, typename T >
+    constexpr OutputIt rotate(InputIt first, InputIt last, const qua<T>& q, OutputIt d_first) {
+        // *d_first = *first * q through the matrix of q, converted once: v * m is half the work of v * q
+        const mat<T, 3> m = impl::qua_to_mat3(q);
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = *first * m;
+        }
+        return d_first;
+    }
+
+    template < typename InputIt1, typename InputIt2, typename OutputIt >
+    constexpr OutputIt rotate(InputIt1 first, InputIt1 last, InputIt2 q_first, OutputIt d_first) {
+        // a quaternion per vector, no conversion would pay for itself
+        for ( ; first != last; ++first, ++q_first, ++d_first ) {
+            *d_first = *first * *q_first;
+        }
+        return d_first;
+    }
+
+    // conjugate
+
+    template < typename InputIt, typename OutputIt >
+    constexpr OutputIt conjugate(InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = conjugate(*first);
+        }
+        return d_first;
+    }
+}
+
+//
+// Batch Cameras
+//
+
+namespace vmath_hpp
+{
+    // look_at
+
+    template < typename InputIt1, typename InputIt2, typename InputIt3, typename OutputIt >
+    constexpr OutputIt look_at_lh(InputIt1 eye_first, InputIt1 eye_last, InputIt2 at_first, InputIt3 up_first, OutputIt d_first) {
+        for ( ; eye_first != eye_last; ++eye_first, ++at_first, ++up_first, ++d_first ) {
+            *d_first = look_at_lh(*eye_first, *at_first, *up_first);
+        }
+        return d_first;
+    }
+
+    template < typename InputIt1, typename InputIt2, typename InputIt3, typename OutputIt >
+    constexpr OutputIt look_at_rh(InputIt1 eye_first, InputIt1 eye_last, InputIt2 at_first, InputIt3 up_first, OutputIt d_first) {
+        for ( ; eye_first != eye_last; ++eye_first, ++at_first, ++up_first, ++d_first ) {
+            *d_first = look_at_rh(*eye_first, *at_first, *up_first);
+        }
+        return d_first;
+    }
+
+    // perspective_fov
+
+    template < typename InputIt1, typename InputIt2, typename OutputIt, typename T >
+    constexpr OutputIt perspective_fov_lh(InputIt1 fovy_first, InputIt1 fovy_last, InputIt2 aspect_first, T znear, T zfar, OutputIt d_first) {
+        for ( ; fovy_first != fovy_last; ++fovy_first, ++aspect_first, ++d_first ) {
+            *d_first = perspective_fov_lh(*fovy_first, *aspect_first, znear, zfar);
+        }
+        return d_first;
+    }
+
+    template < typename InputIt1, typename InputIt2, typename OutputIt, typename T >
+    constexpr OutputIt perspective_fov_rh(InputIt1 fovy_first, InputIt1 fovy_last, InputIt2 aspect_first, T znear, T zfar, OutputIt d_first) {
+        for ( ; fovy_first != fovy_last; ++fovy_first, ++aspect_first, ++d_first ) {
+            *d_first = perspective_fov_rh(*fovy_first, *aspect_first, znear, zfar);
+        }
+        return d_first;
+    }
+
+    // perspective_fov_infinite_reversed
+
+    template < typename InputIt1, typename InputIt2, typename OutputIt, typename T >
+    constexpr OutputIt perspective_fov_infinite_reversed_lh(InputIt1 fovy_first, InputIt1 fovy_last, InputIt2 aspect_first, T znear, OutputIt d_first) {
+        for ( ; fovy_first != fovy_last; ++fovy_first, ++aspect_first, ++d_first ) {
+            *d_first = perspective_fov_infinite_reversed_lh(*fovy_first, *aspect_first, znear);
+        }
+        return d_first;
+    }
+
+    template < typename InputIt1, typename InputIt2, typename OutputIt, typename T >
+    constexpr OutputIt perspective_fov_infinite_reversed_rh(InputIt1 fovy_first, InputIt1 fovy_last, InputIt2 aspect_first, T znear, OutputIt d_first) {
+        for ( ; fovy_first != fovy_last; ++fovy_first, ++aspect_first, ++d_first ) {
+            *d_first = perspective_fov_infinite_reversed_rh(*fovy_first, *aspect_first, znear);
+        }
+        return d_first;
+    }
+
+    // unproject
+
+    template < typename InputIt, typename OutputIt, typename T >
+    constexpr OutputIt unproject(InputIt first, InputIt last, const mat<T, 4>& inv_view_proj, OutputIt d_first) {
+        const mat<T, 4> mm = inv_view_proj;
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = unproject(*first, mm);
+        }
+        return d_first;
+    }
+
+    template < typename InputIt, typename OutputIt, typename T >
+    constexpr OutputIt unproject(InputIt first, InputIt last, const mat<T, 4>& inv_view_proj, const vec<T, 4>& viewport, OutputIt d_first) {
+        // the viewport mapping is folded into the matrix once
+        const mat<T, 4> mm = window_to_ndc(viewport) * inv_view_proj;
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = unproject(*first, mm);
+        }
+        return d_first;
+    }
+}
+
+//
+// Batch Reductions
+//
+
+namespace vmath_hpp
+{
+    enum class summation : unsigned char {
+        naive,
+        pairwise,
+        kahan,
+        neumaier,
+    };
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename V >
+    [[nodiscard]] constexpr V reduce_zero() noexcept {
+        if constexpr ( std::is_arithmetic_v<V> ) {
+            return V{0};
+        } else {
+            return V{zero_init};
+        }
+    }
+
+    template < typename T >
+    constexpr std::enable_if_t<std::is_arithmetic_v<T>, void>
+    neumaier_add(T& sum, T& c, T x) noexcept {
+        const T t = sum + x;
+        c += abs(sum) >= abs(x) ? (sum - t) + x : (x - t) + sum;
+        sum = t;
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr void neumaier_add(vec<T, Size>& sum, vec<T, Size>& c, const vec<T, Size>& x) noexcept {
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            neumaier_add(sum[i], c[i], x[i]);
+        }
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr void neumaier_add(mat<T, Rows, Cols>& sum, mat<T, Rows, Cols>& c, const mat<T, Rows, Cols>& x) noexcept {
+        for ( std::size_t i = 0; i < Rows; ++i ) {
+            neumaier_add(sum[i], c[i], x[i]);
+        }
+    }
+
+    template < typename V, typename InputIt, typename F >
+    [[nodiscard]] constexpr V reduce(InputIt first, InputIt last, F&& f, summation mode) {
+        switch ( mode ) {
+            case summation::pairwise: {
+                /// REFERENCE:
+                /// https://en.wikipedia.org/wiki/Pairwise_summation
+                // plain sums of short blocks merged like a binary counter:
+                // the inner loop stays branchless, one pass, O(log n) error growth
+                constexpr std::size_t block_size = 32;
+                V partials[64]{};
+                std::size_t blocks = 0;
+                while ( first != last ) {
+                    V b = reduce_zero<V>();
+                    for ( std::size_t i = 0; i < block_size && first != last; ++i, ++first ) {
+                        b += f(*first);
+                    }
+                    std::size_t level = 0;
+                    for ( ; (blocks >> level) & 1u; ++level ) {
+                        b = partials[level] + b;
+                    }
+                    partials[level] = b;
+                    ++blocks;
+                }
+                V s = reduce_zero<V>();
+                for ( std::size_t level = 0; (blocks >> level) != 0; ++level ) {
+                    if ( (blocks >> level) & 1u ) {
+                        s = partials[level] + s;
+                    }
+                }
+                return s;
+            }
+            case summation::kahan: {
+                /// REFERENCE:
+                /// https://en.wikipedia.org/wiki/Kahan_summation_algorithm
+                V s = reduce_zero<V>();
+                V c = reduce_zero<V>();
+                for ( ; first != last; ++first ) {
+                    const V y = f(*first) - c;
+                    const V t = s + y;
+                    c = (t - s) - y;
+                    s = t;
+                }
+                return s;
+            }
+            case summation::neumaier: {
+                V s = reduce_zero<V>();
+                V c = reduce_zero<V>();
+                for ( ; first != last; ++first ) {
+                    neumaier_add(s, c, f(*first));
+                }
+                return s + c;
+            }
+            case summation::naive:
+                break;
+        }
+        V s = reduce_zero<V>();
+        for ( ; first != last; ++first ) {
+            s += f(*first);
+        }
+        return s;
+    }
+}
+
+namespace vmath_hpp
+{
+    // sum
+
+    template < typename InputIt
+             , typename V = typename std::iterator_traits<InputIt>::value_type >
+    [[nodiscard]] constexpr V sum(InputIt first, InputIt last, summation mode = summation::pairwise) {
+        return impl::reduce<V>(first, last, [](const V& x){ return x; }, mode);
+    }
+
+    // dot
+
+    template < typename InputIt1, typename InputIt2
+             , typename V = decltype(dot(*std::declval<InputIt1>(), *std::declval<InputIt2>())) >
+    [[nodiscard]] constexpr V dot(InputIt1 first1, InputIt1 last1, InputIt2 first2, summation mode = summation::pairwise) {
+        return impl::reduce<V>(first1, last1, [&first2](const auto& x){ return dot(x, *first2++); }, mode);
+    }
+
+    // length
+
+    template < typename InputIt
+             , typename V = decltype(length2(*std::declval<InputIt>())) >
+    [[nodiscard]] constexpr V length(InputIt first, InputIt last, summation mode = summation::pairwise) {
+        return sqrt(length2(first, last, mode));
+    }
+
+    // length2
+
+    template < typename InputIt
+             , typename V = decltype(length2(*std::declval<InputIt>())) >
+    [[nodiscard]] constexpr V length2(InputIt first, InputIt last, summation mode = summation::pairwise) {
+        return impl::reduce<V>(first, last, [](const auto& x){ return length2(x); }, mode);
+    }
+
+    // centroid
+
+    template < typename InputIt
+             , typename T = typename std::iterator_traits<InputIt>::value_type::component_type
+             , std::size_t Size = std::iterator_traits<InputIt>::value_type::size >
+    [[nodiscard]] constexpr vec<T, Size> centroid(InputIt first, InputIt last, summation mode = summation::pairwise) {
+        std::size_t count = 0;
+        const vec<T, Size> s = impl::reduce<vec<T, Size>>(first, last, [&count](const vec<T, Size>& x){
+            ++count;
+            return x;
+        }, mode);
+        return count > 0 ? s / static_cast<T>(count) : s;
+    }
+
+    // covariance
+
+    template < typename ForwardIt
+             , typename T = typename std::iterator_traits<ForwardIt>::value_type::component_type
+             , std::size_t Size = std::iterator_traits<ForwardIt>::value_type::size >
+    [[nodiscard]] constexpr mat<T, Size> covariance(ForwardIt first, ForwardIt last, summation mode = summation::pairwise) {
+        // population covariance, two passes: the mean is subtracted first to avoid cancellation
+        const vec<T, Size> mean = centroid(first, last, mode);
+        std::size_t count = 0;
+        const mat<T, Size> s = impl::reduce<mat<T, Size>>(first, last, [&count, &mean](const vec<T, Size>& x){
+            ++count;
+            const vec<T, Size> d = x - mean;
+            mat<T, Size> m{zero_init};
+            for ( std::size_t i = 0; i < Size; ++i ) {
+                m[i] = d * d[i];
+            }
+            return m;
+        }, mode);
+        return count > 0 ? s / static_cast<T>(count) : s;
+    }
+}
+
+//
+// Byte Order
+//
+
+namespace vmath_hpp
+{
+    enum class byte_order : unsigned {
+        little,
+        big,
+    };
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    inline constexpr byte_order native_byte_order = byte_order::big;
+#else
+    inline constexpr byte_order native_byte_order = byte_order::little;
+#endif
+}
+
+namespace vmath_hpp::impl
+{
+    template < std::size_t Size >
+    struct blob_uint;
+
+    template <> struct blob_uint<1> { using type = std::uint8_t; };
+    template <> struct blob_uint<2> { using type = std::uint16_t; };
+    template <> struct blob_uint<4> { using type = std::uint32_t; };
+    template <> struct blob_uint<8> { using type = std::uint64_t; };
+
+    template < typename U >
+    [[nodiscard]] VMATH_HPP_FORCE_INLINE U byteswap(U x) noexcept {
+        if constexpr ( sizeof(U) == 1 ) {
+            return x;
+        } else {
+        #if defined(__clang__) || defined(__GNUC__)
+            if constexpr ( sizeof(U) == 2 ) {
+                return __builtin_bswap16(x);
+            } else if constexpr ( sizeof(U) == 4 ) {
+                return __builtin_bswap32(x);
+            } else {
+                return __builtin_bswap64(x);
+            }
+        #else
+            U r{0};
+            for ( std::size_t i = 0; i < sizeof(U); ++i, x >>= 8 ) {
+                r = static_cast<U>((r << 8) | (x & 0xFFu));
+            }
+            return r;
+        #endif
+        }
+    }
+
+    template < std::size_t ComponentSize >
+    void copy_byteswapped(void* dst, const void* src, std::size_t components) noexcept {
+        // memcpy per component: the source is often a mapped file with no alignment guarantees
+        using U = typename blob_uint<ComponentSize>::type;
+        unsigned char* d = static_cast<unsigned char*>(dst);
+        const unsigned char* s = static_cast<const unsigned char*>(src);
+        for ( std::size_t i = 0; i < components; ++i ) {
+            U u;
+            std::memcpy(&u, s + i * sizeof(U), sizeof(U));
+            u = byteswap(u);
+            std::memcpy(d + i * sizeof(U), &u, sizeof(U));
+        }
+    }
+
+    inline void store_u64(unsigned char* dst, std::uint64_t x, byte_order order) noexcept {
+        for ( std::size_t i = 0; i < 8; ++i ) {
+            const std::size_t shift = order == byte_order::little ? i * 8 : (7 - i) * 8;
+            dst[i] = static_cast<unsigned char>((x >> shift) & 0xFFu);
+        }
+    }
+
+    [[nodiscard]] inline std::uint64_t load_u64(const unsigned char* src, byte_order order) noexcept {
+        std::uint64_t x{0};
+        for ( std::size_t i = 0; i < 8; ++i ) {
+            const std::size_t shift = order == byte_order::little ? i * 8 : (7 - i) * 8;
+            x |= std::uint64_t{src[i]} << shift;
+        }
+        return x;
+    }
+}
+
+//
+// Blob Traits
+//
+
+namespace vmath_hpp::impl
+{
+    template < typename V >
+    struct blob_shape {
+        static constexpr bool valid = false;
+    };
+
+    template < typename T, std::size_t Size >
+    struct blob_shape<vec<T, Size>> {
+        static constexpr bool valid = true;
+        using component_type = T;
+        static constexpr unsigned char kind = 'v';
+        static constexpr std::size_t rows = 1;
+        static constexpr std::size_t cols = Size;
+    };
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    struct blob_shape<mat<T, Rows, Cols>> {
+        static constexpr bool valid = true;
+        using component_type = T;
+        static constexpr unsigned char kind = 'm';
+        static constexpr std::size_t rows = Rows;
+        static constexpr std::size_t cols = Cols;
+    };
+
+    template < typename T >
+    struct blob_shape<qua<T>> {
+        static constexpr bool valid = true;
+        using component_type = T;
+        static constexpr unsigned char kind = 'q';
+        static constexpr std::size_t rows = 1;
+        static constexpr std::size_t cols = 4;
+    };
+
+    template < typename V, bool = blob_shape<V>::valid >
+    struct is_blittable : std::false_type {};
+
+    template < typename V >
+    struct is_blittable<V, true> {
+        using T = typename blob_shape<V>::component_type;
+        static constexpr bool value =
+            std::is_arithmetic_v<T> &&
+            !std::is_same_v<T, bool> &&
+            (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8) &&
+            std::is_standard_layout_v<V> &&
+            std::is_trivially_copyable_v<V> &&
+            sizeof(V) == sizeof(T) * blob_shape<V>::rows * blob_shape<V>::cols;
+    };
+
+    template < typename V >
+    [[nodiscard]] constexpr unsigned char blob_component_kind() noexcept {
+        using T = typename blob_shape<V>::component_type;
+        if constexpr ( std::is_floating_point_v<T> ) {
+            return 'f';
+        } else if constexpr ( std::is_signed_v<T> ) {
+            return 'i';
+        } else {
+            return 'u';
+        }
+    }
+}
+
+namespace vmath_hpp
+{
+    // vectors, matrices and quaternions of arithmetic components that
+    // can be written and mapped as raw bytes, see the layout notes
+    // at the end of vmath_vec.hpp, vmath_mat.hpp and vmath_qua.hpp
+
+    template < typename V >
+    inline constexpr bool is_blittable_v = impl::is_blittable<V>::value;
+}
+
+//
+// Blob Serialization
+//
+
+namespace vmath_hpp
+{
+    // layout of the 32 byte header, the payload follows it:
+    //
+    // [0..4)   magic "VMTH"
+    // [4]      version
+    // [5]      byte order of the payload and the count (0 - little, 1 - big)
+    // [6]      shape ('v', 'm' or 'q')
+    // [7]      component kind ('f', 'i' or 'u')
+    // [8]      component size in bytes
+    // [9]      rows
+    // [10]     columns
+    // [16..24) element count
+    // the rest is reserved and written as zeros
+
+    inline constexpr std::size_t blob_header_size = 32;
+    inline constexpr unsigned char blob_version = 1;
+
+    enum class blob_error : unsigned {
+        none,
+        truncated,
+        bad_magic,
+        bad_version,
+        type_mismatch,
+    };
+
+    template < typename V >
+    [[nodiscard]] constexpr std::size_t blob_size(std::size_t count) noexcept {
+        static_assert(is_blittable_v<V>);
+        return blob_header_size + count * sizeof(V);
+    }
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename V >
+    void write_blob_header(unsigned char* dst, std::size_t count, byte_order order) noexcept {
+        using T = typename blob_shape<V>::component_type;
+        std::memset(dst, 0, blob_header_size);
+        std::memcpy(dst, "VMTH", 4);
+        dst[4] = blob_version;
+        dst[5] = static_cast<unsigned char>(order);
+        dst[6] = blob_shape<V>::kind;
+        dst[7] = blob_component_kind<V>();
+        dst[8] = static_cast<unsigned char>(sizeof(T));
+        dst[9] = static_cast<unsigned char>(blob_shape<V>::rows);
+        dst[10] = static_cast<unsigned char>(blob_shape<V>::cols);
+        store_u64(dst + 16, static_cast<std::uint64_t>(count), order);
+    }
+
+    template < typename V >
+    void copy_blob_payload(void* dst, const void* src, std::size_t count, bool swap) noexcept {
+        using T = typename blob_shape<V>::component_type;
+        if ( swap ) {
+            copy_byteswapped<sizeof(T)>(dst, src, count * (sizeof(V) / sizeof(T)));
+        } else if ( count > 0 ) {
+            std::memcpy(dst, src, count * sizeof(V));
+        }
+    }
+}
+
+namespace vmath_hpp
+{
+    // view_blob
+
+    template < typename V >
+    class blob_view final {
+    public:
+        static_assert(is_blittable_v<V>);
+
+        using value_type = V;
+        using component_type = typename impl::blob_shape<V>::component_type;
+
+        blob_view() = default;
+
+        blob_view(blob_error error)
+        : error_{error} {}
+
+        blob_view(const unsigned char* payload, std::size_t size, byte_order order)
+        : payload_{payload}
+        , size_{size}
+        , order_{order} {}
+
+        [[nodiscard]] blob_error error() const noexcept { return error_; }
+        [[nodiscard]] bool valid() const noexcept { return error_ == blob_error::none; }
+        explicit operator bool() const noexcept { return valid(); }
+
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        [[nodiscard]] byte_order order() const noexcept { return order_; }
+        [[nodiscard]] bool needs_swap() const noexcept { return order_ != native_byte_order; }
+
+        // the mapped elements themselves, nullptr when they can't be used
+        // in place: the payload has a foreign byte order or is misaligned
+
+        [[nodiscard]] const V* data() const noexcept {
+            const bool aligned = reinterpret_cast<std::uintptr_t>(payload_) % alignof(V) == 0;
+            return valid() && !needs_swap() && aligned
+                ? reinterpret_cast<const V*>(payload_)
+                : nullptr;
+        }
+
+        // always available, swaps on access when needed
+
+        [[nodiscard]] V operator[](std::size_t index) const noexcept {
+            V v{no_init};
+            impl::copy_blob_payload<V>(&v, payload_ + index * sizeof(V), 1, needs_swap());
+            return v;
+        }
+
+        V* copy_to(V* d_first) const noexcept {
+            impl::copy_blob_payload<V>(d_first, payload_, size_, needs_swap());
+            return d_first + size_;
+        }
+    private:
+        const unsigned char* payload_{};
+        std::size_t size_{};
+        byte_order order_{native_byte_order};
+        blob_error error_{blob_error::none};
+    };
+
+    template < typename V >
+    [[nodiscard]] blob_view<V> view_blob(const void* bytes, std::size_t size) noexcept {
+        using T = typename impl::blob_shape<V>::component_type;
+        const unsigned char* b = static_cast<const unsigned char*>(bytes);
+
+        if ( size < blob_header_size ) {
+            return blob_error::truncated;
+        }
+
+        if ( std::memcmp(b, "VMTH", 4) != 0 || b[5] > 1 ) {
+            return blob_error::bad_magic;
+        }
+
+        if ( b[4] != blob_version ) {
+            return blob_error::bad_version;
+        }
+
+        if ( b[6] != impl::blob_shape<V>::kind
+            || b[7] != impl::blob_component_kind<V>()
+            || b[8] != sizeof(T)
+            || b[9] != impl::blob_shape<V>::rows
+            || b[10] != impl::blob_shape<V>::cols )
+        {
+            return blob_error::type_mismatch;
+        }
+
+        const byte_order order = static_cast<byte_order>(b[5]);
+        const std::uint64_t count = impl::load_u64(b + 16, order);
+
+        if ( count > (size - blob_header_size) / sizeof(V) ) {
+            return blob_error::truncated;
+        }
+
+        return {b + blob_header_size, static_cast<std::size_t>(count), order};
+    }
+
+    // make_blob_native
+
+    template < typename V >
+    blob_view<V> make_blob_native(void* bytes, std::size_t size) noexcept {
+        // swaps a writable mapping in place once instead of on every access
+        unsigned char* b = static_cast<unsigned char*>(bytes);
+        const blob_view<V> view = view_blob<V>(b, size);
+        if ( !view.valid() || !view.needs_swap() ) {
+            return view;
+        }
+        unsigned char* payload = b + blob_header_size;
+        impl::copy_blob_payload<V>(payload, payload, view.size(), true);
+        impl::write_blob_header<V>(b, view.size(), native_byte_order);
+        return {payload, view.size(), native_byte_order};
+    }
+
+    // write_blob
+
+    template < typename V >
+    std::size_t write_blob(void* dst, const V* xs, std::size_t count, byte_order order = native_byte_order) noexcept {
+        // dst must hold blob_size<V>(count) bytes, returns the number of bytes written
+        static_assert(is_blittable_v<V>);
+        unsigned char* d = static_cast<unsigned char*>(dst);
+        impl::write_blob_header<V>(d, count, order);
+        impl::copy_blob_payload<V>(d + blob_header_size, xs, count, order != native_byte_order);
+        return blob_size<V>(count);
+    }
+
+    template < typename V >
+    [[nodiscard]] bool write_blob(std::FILE* file, const V* xs, std::size_t count, byte_order order = native_byte_order) noexcept {
+        static_assert(is_blittable_v<V>);
+
+        unsigned char header[blob_header_size];
+        impl::write_blob_header<V>(header, count, order);
+        if ( std::fwrite(header, 1, blob_header_size, file) != blob_header_size ) {
+            return false;
+        }
+
+        if ( order == native_byte_order ) {
+            return std::fwrite(xs, sizeof(V), count, file) == count;
+        }
+
+        // foreign byte order: swap through a small stack buffer
+        constexpr std::size_t chunk_size = 4096 / sizeof(V) > 0 ? 4096 / sizeof(V) : 1;
+        alignas(V) unsigned char chunk[chunk_size * sizeof(V)];
+        for ( std::size_t i = 0; i < count; i += chunk_size ) {
+            const std::size_t n = count - i < chunk_size ? count - i : chunk_size;
+            impl::copy_blob_payload<V>(chunk, xs + i, n, true);
+            if ( std::fwrite(chunk, sizeof(V), n, file) != n ) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+//
+// Bounding Volumes
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    class aabb final {
+    public:
+        using self_type = aabb;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+    public:
+        // empty box: merging anything into it gives the bounds of that thing
+        vec_type min{std::numeric_limits<T>::max()};
+        vec_type max{std::numeric_limits<T>::lowest()};
+    public:
+        constexpr aabb() = default;
+
+        constexpr aabb(const vec_type& lower, const vec_type& upper)
+        : min{lower}
+        , max{upper} {}
+    };
+
+    template < typename T, std::size_t Size >
+    class sphere final {
+    public:
+        using self_type = sphere;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+    public:
+        // empty sphere has a negative radius
+        vec_type center{zero_init};
+        T radius{-1};
+    public:
+        constexpr sphere() = default;
+
+        constexpr sphere(const vec_type& c, T r)
+        : center{c}
+        , radius{r} {}
+    };
+
+    template < typename T, std::size_t Size >
+    class obb final {
+    public:
+        using self_type = obb;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+        using mat_type = mat<T, Size>;
+    public:
+        // the rows of axes are the unit box axes in world space
+        vec_type center{zero_init};
+        mat_type axes{identity_init};
+        vec_type half_extents{zero_init};
+    public:
+        constexpr obb() = default;
+
+        constexpr obb(const vec_type& c, const mat_type& a, const vec_type& h)
+        : center{c}
+        , axes{a}
+        , half_extents{h} {}
+    };
+}
+
+namespace vmath_hpp
+{
+    using faabb2 = aabb<float, 2>;
+    using faabb3 = aabb<float, 3>;
+    using daabb2 = aabb<double, 2>;
+    using daabb3 = aabb<double, 3>;
+
+    using fsphere2 = sphere<float, 2>;
+    using fsphere3 = sphere<float, 3>;
+    using dsphere2 = sphere<double, 2>;
+    using dsphere3 = sphere<double, 3>;
+
+    using fobb2 = obb<float, 2>;
+    using fobb3 = obb<float, 3>;
+    using dobb2 = obb<double, 2>;
+    using dobb3 = obb<double, 3>;
+}
+
+//
+// AABB Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool empty(const aabb<T, Size>& b) {
+        return any(greater(b.min, b.max));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> center(const aabb<T, Size>& b) {
+        return (b.min + b.max) / T{2};
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> extent(const aabb<T, Size>& b) {
+        return b.max - b.min;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool contains(const aabb<T, Size>& b, const vec<T, Size>& p) {
+        return all(greater_equal(p, b.min)) && all(less_equal(p, b.max));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr aabb<T, Size> merge(const aabb<T, Size>& b, const vec<T, Size>& p) {
+        return {min(b.min, p), max(b.max, p)};
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr aabb<T, Size> merge(const aabb<T, Size>& a, const aabb<T, Size>& b) {
+        return {min(a.min, b.min), max(a.max, b.max)};
+    }
+
+    template < typename InputIt
+             , typename T = typename std::iterator_traits<InputIt>::value_type::component_type
+             , std::size_t Size = std::iterator_traits<InputIt>::value_type::size >
+    [[nodiscard]] constexpr aabb<T, Size> compute_aabb(InputIt first, InputIt last) {
+        // plain min/max accumulators, the loop body is branchless and vectorizes
+        vec<T, Size> lower{std::numeric_limits<T>::max()};
+        vec<T, Size> upper{std::numeric_limits<T>::lowest()};
+        for ( ; first != last; ++first ) {
+            const vec<T, Size>& p = *first;
+            lower = min(lower, p);
+            upper = max(upper, p);
+        }
+        return {lower, upper};
+    }
+}
+
+//
+// Sphere Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool empty(const sphere<T, Size>& s) {
+        return s.radius < T{0};
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool contains(const sphere<T, Size>& s, const vec<T, Size>& p) {
+        return length2(p - s.center) <= s.radius * s.radius;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr sphere<T, Size> merge(const sphere<T, Size>& s, const vec<T, Size>& p) {
+        if ( empty(s) ) {
+            return {p, T{0}};
+        }
+
+        const vec<T, Size> d = p - s.center;
+        const T d2 = length2(d);
+        if ( d2 <= s.radius * s.radius ) {
+            return s;
+        }
+
+        const T dist = sqrt(d2);
+        const T radius = (s.radius + dist) * T{0.5};
+        return {s.center + d * ((radius - s.radius) / dist), radius};
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr sphere<T, Size> merge(const sphere<T, Size>& a, const sphere<T, Size>& b) {
+        if ( empty(a) ) {
+            return b;
+        }
+
+        if ( empty(b) ) {
+            return a;
+        }
+
+        const vec<T, Size> d = b.center - a.center;
+        const T dist = length(d);
+        if ( dist + b.radius <= a.radius ) {
+            return a;
+        }
+
+        if ( dist + a.radius <= b.radius ) {
+            return b;
+        }
+
+        const T radius = (dist + a.radius + b.radius) * T{0.5};
+        return {a.center + d * ((radius - a.radius) / dist), radius};
+    }
+
+    template < typename ForwardIt
+             , typename T = typename std::iterator_traits<ForwardIt>::value_type::component_type
+             , std::size_t Size = std::iterator_traits<ForwardIt>::value_type::size >
+    [[nodiscard]] constexpr sphere<T, Size> compute_sphere_ritter(ForwardIt first, ForwardIt last) {
+        /// REFERENCE:
+        /// Jack Ritter, An Efficient Bounding Sphere (Graphics Gems, 1990)
+
+        if ( first == last ) {
+            return {};
+        }
+
+        const auto farthest = [first, last](const vec<T, Size>& from){
+            vec<T, Size> r = *first;
+            T r2 = length2(r - from);
+            for ( ForwardIt iter = first; iter != last; ++iter ) {
+                const T d2 = length2(*iter - from);
+                if ( d2 > r2 ) {
+                    r = *iter;
+                    r2 = d2;
+                }
+            }
+            return r;
+        };
+
+        const vec<T, Size> y = farthest(*first);
+        const vec<T, Size> z = farthest(y);
+
+        sphere<T, Size> s{(y + z) * T{0.5}, distance(y, z) * T{0.5}};
+        for ( ; first != last; ++first ) {
+            s = merge(s, *first);
+        }
+        return s;
+    }
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename T >
+    [[nodiscard]] constexpr bool epos_contains(const sphere<T, 3>& s, const vec<T, 3>& p) {
+        // tolerate the rounding of the circumsphere computations
+        const T eps = T{16} * std::numeric_limits<T>::epsilon();
+        return length2(p - s.center) <= s.radius * s.radius * (T{1} + eps);
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr sphere<T, 3> epos_diameter_sphere(const vec<T, 3>& a, const vec<T, 3>& b) {
+        return {(a + b) * T{0.5}, distance(a, b) * T{0.5}};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr sphere<T, 3> epos_support_sphere(const vec<T, 3>* ps, std::size_t n) {
+        const T eps = std::numeric_limits<T>::epsilon();
+
+        if ( n == 0 ) {
+            return {};
+        }
+
+        if ( n == 1 ) {
+            return {ps[0], T{0}};
+        }
+
+        if ( n == 2 ) {
+            return epos_diameter_sphere(ps[0], ps[1]);
+        }
+
+        if ( n == 3 ) {
+            const vec<T, 3> ab = ps[1] - ps[0];
+            const vec<T, 3> ac = ps[2] - ps[0];
+            const vec<T, 3> nn = cross(ab, ac);
+            const T nn2 = length2(nn);
+
+            if ( nn2 <= eps * length2(ab) * length2(ac) ) {
+                // collinear: the farthest pair spans the sphere
+                sphere<T, 3> s = epos_diameter_sphere(ps[0], ps[1]);
+                s = merge(s, epos_diameter_sphere(ps[0], ps[2]));
+                return merge(s, epos_diameter_sphere(ps[1], ps[2]));
+            }
+
+            const vec<T, 3> o = (cross(nn, ab) * length2(ac) + cross(ac, nn) * length2(ab)) / (T{2} * nn2);
+            return {ps[0] + o, length(o)};
+        }
+
+        const vec<T, 3> u = ps[1] - ps[0];
+        const vec<T, 3> v = ps[2] - ps[0];
+        const vec<T, 3> w = ps[3] - ps[0];
+        const T det = dot(u, cross(v, w));
+
+        if ( abs(det) <= eps * length(u) * length(v) * length(w) ) {
+            // coplanar: the fourth point is already on the circle of the others
+            return merge(epos_support_sphere(ps, 3), ps[3]);
+        }
+
+        const vec<T, 3> o = (
+            cross(v, w) * length2(u) +
+            cross(w, u) * length2(v) +
+            cross(u, v) * length2(w)) / (T{2} * det);
+        return {ps[0] + o, length(o)};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr sphere<T, 3> epos_welzl(const vec<T, 3>* ps, std::size_t n, vec<T, 3>* support, std::size_t ns) {
+        /// REFERENCE:
+        /// Emo Welzl, Smallest enclosing disks (balls and ellipsoids), 1991
+
+        if ( n == 0 || ns == 4 ) {
+            return epos_support_sphere(support, ns);
+        }
+
+        const sphere<T, 3> s = epos_welzl(ps, n - 1, support, ns);
+        if ( !empty(s) && epos_contains(s, ps[n - 1]) ) {
+            return s;
+        }
+
+        support[ns] = ps[n - 1];
+        return epos_welzl(ps, n - 1, support, ns + 1);
+    }
+}
+
+namespace vmath_hpp
+{
+    template < typename ForwardIt
+             , typename T = typename std::iterator_traits<ForwardIt>::value_type::component_type
+             , std::size_t Size = std::iterator_traits<ForwardIt>::value_type::size >
+    [[nodiscard]] constexpr std::enable_if_t<Size == 3, sphere<T, Size>>
+    compute_sphere_epos(ForwardIt first, ForwardIt last) {
+        /// REFERENCE:
+        /// Thomas Larsson, Fast and Tight Fitting Bounding Spheres (SIGRAD 2008)
+
+        // EPOS-14: the extremal points along 7 directions, the exact
+        // minimum sphere of them and a Ritter pass over all points
+
+        if ( first == last ) {
+            return {};
+        }
+
+        constexpr std::size_t dir_count = 7;
+        const vec<T, 3> dirs[dir_count]{
+            {T{1}, T{0}, T{0}},
+            {T{0}, T{1}, T{0}},
+            {T{0}, T{0}, T{1}},
+            {T{1}, T{1}, T{1}},
+            {T{1}, T{1}, T{-1}},
+            {T{1}, T{-1}, T{1}},
+            {T{1}, T{-1}, T{-1}}};
+
+        vec<T, 3> extremes[dir_count * 2]{};
+        T projs[dir_count * 2]{};
+
+        for ( std::size_t i = 0; i < dir_count; ++i ) {
+            extremes[i * 2 + 0] = *first;
+            extremes[i * 2 + 1] = *first;
+            projs[i * 2 + 0] = dot(dirs[i], *first);
+            projs[i * 2 + 1] = projs[i * 2 + 0];
+        }
+
+        for ( ForwardIt iter = first; iter != last; ++iter ) {
+            const vec<T, 3>& p = *iter;
+            for ( std::size_t i = 0; i < dir_count; ++i ) {
+                const T d = dot(dirs[i], p);
+                if ( d < projs[i * 2 + 0] ) {
+                    projs[i * 2 + 0] = d;
+                    extremes[i * 2 + 0] = p;
+                }
+                if ( d > projs[i * 2 + 1] ) {
+                    projs[i * 2 + 1] = d;
+                    extremes[i * 2 + 1] = p;
+                }
+            }
+        }
+
+        vec<T, 3> support[4]{};
+        sphere<T, 3> s = impl::epos_welzl(extremes, dir_count * 2, support, 0);
+
+        for ( ; first != last; ++first ) {
+            s = merge(s, *first);
+        }
+        return s;
+    }
+}
+
+//
+// OBB Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool contains(const obb<T, Size>& b, const vec<T, Size>& p) {
+        const vec<T, Size> d = p - b.center;
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            if ( abs(dot(d, b.axes[i])) > b.half_extents[i] ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template < typename ForwardIt
+             , typename T = typename std::iterator_traits<ForwardIt>::value_type::component_type
+             , std::size_t Size = std::iterator_traits<ForwardIt>::value_type::size >
+    [[nodiscard]] constexpr obb<T, Size> compute_obb_pca(ForwardIt first, ForwardIt last) {
+        // the box axes are the eigenvectors of the covariance matrix of the points
+
+        if ( first == last ) {
+            return {};
+        }
+
+        // the eigenvectors are the columns, the box axes are rows
+        mat<T, Size> axes = transpose(symmetric_eigen(covariance(first, last)).second);
+
+        if constexpr ( Size == 3 ) {
+            if ( dot(cross(axes[0], axes[1]), axes[2]) < T{0} ) {
+                axes[2] = -axes[2];
+            }
+        }
+
+        vec<T, Size> lower{std::numeric_limits<T>::max()};
+        vec<T, Size> upper{std::numeric_limits<T>::lowest()};
+        for ( ; first != last; ++first ) {
+            vec<T, Size> local{no_init};
+            for ( std::size_t i = 0; i < Size; ++i ) {
+                local[i] = dot(*first, axes[i]);
+            }
+            lower = min(lower, local);
+            upper = max(upper, local);
+        }
+
+        return {
+            ((lower + upper) * T{0.5}) * axes,
+            axes,
+            (upper - lower) * T{0.5}};
+    }
+}
+
+#if defined(__has_include)
+#  if __has_include(<charconv>)
+#    define VMATH_HPP_CHARCONV
+#    include <charconv>
+#  endif
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+
+#if defined(__cpp_lib_format)
+#  include <format>
+#endif
+
+// <charconv> first shipped with gcc 8, without it
+// to_chars and from_chars are compiled out
+
+#if defined(VMATH_HPP_CHARCONV)
+
+//
+// Chars
+//
+
+namespace vmath_hpp::impl
+{
+    // floating-point std::to_chars and std::from_chars came later than the integral ones,
+    // __cpp_lib_to_chars is defined only by the standard libraries that have both
+
+#if defined(__cpp_lib_to_chars)
+    inline constexpr bool has_float_charconv = true;
+#else
+    inline constexpr bool has_float_charconv = false;
+#endif
+
+    template < typename T >
+    inline constexpr bool is_charconv_v =
+        (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+        (std::is_floating_point_v<T> && has_float_charconv);
+
+    [[nodiscard]] constexpr bool is_chars_space(char c) noexcept {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    [[nodiscard]] constexpr const char* skip_chars_separator(const char* first, const char* last) noexcept {
+        // whitespace with at most one comma
+        for ( ; first != last && is_chars_space(*first); ++first ) {}
+        if ( first != last && *first == ',' ) {
+            for ( ++first; first != last && is_chars_space(*first); ++first ) {}
+        }
+        return first;
+    }
+
+    template < typename T >
+    std::to_chars_result to_chars_n(char* first, char* last, const T* xs, std::size_t n, char separator) noexcept {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            if ( i > 0 ) {
+                if ( first == last ) {
+                    return {last, std::errc::value_too_large};
+                }
+                *first++ = separator;
+            }
+            const std::to_chars_result r = std::to_chars(first, last, xs[i]);
+            if ( r.ec != std::errc{} ) {
+                return r;
+            }
+            first = r.ptr;
+        }
+        return {first, std::errc{}};
+    }
+
+    template < typename T >
+    std::from_chars_result from_chars_n(const char* first, const char* last, T* xs, std::size_t n) noexcept {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            if ( i > 0 ) {
+                first = skip_chars_separator(first, last);
+            }
+            const std::from_chars_result r = std::from_chars(first, last, xs[i]);
+            if ( r.ec != std::errc{} ) {
+                return r;
+            }
+            first = r.ptr;
+        }
+        return {first, std::errc{}};
+    }
+}
+
+namespace vmath_hpp
+{
+    // the text form is the components in memory order (row-major for matrices, x, y, z, w
+    // for quaternions) joined by the separator, every number is the shortest one that
+    // round-trips, nothing depends on the locale and nothing allocates
+
+    // to_chars
+
+    template < typename T, std::size_t Size >
+    std::enable_if_t<impl::is_charconv_v<T>, std::to_chars_result>
+    to_chars(char* first, char* last, const vec<T, Size>& v, char separator = ' ') noexcept {
+        return impl::to_chars_n(first, last, v.data(), Size, separator);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    std::enable_if_t<impl::is_charconv_v<T>, std::to_chars_result>
+    to_chars(char* first, char* last, const mat<T, Rows, Cols>& m, char separator = ' ') noexcept {
+        for ( std::size_t i = 0; i < Rows; ++i ) {
+            if ( i > 0 ) {
+                if ( first == last ) {
+                    return {last, std::errc::value_too_large};
+                }
+                *first++ = separator;
+            }
+            const std::to_chars_result r = impl::to_chars_n(first, last, m[i].data(), Cols, separator);
+            if ( r.ec != std::errc{} ) {
+                return r;
+            }
+            first = r.ptr;
+        }
+        return {first, std::errc{}};
+    }
+
+    template < typename T >
+    std::enable_if_t<impl::is_charconv_v<T>, std::to_chars_result>
+    to_chars(char* first, char* last, const qua<T>& q, char separator = ' ') noexcept {
+        return impl::to_chars_n(first, last, q.data(), 4, separator);
+    }
+
+    // from_chars
+
+    template < typename T, std::size_t Size >
+    std::enable_if_t<impl::is_charconv_v<T>, std::from_chars_result>
+    from_chars(const char* first, const char* last, vec<T, Size>& v) noexcept {
+        // components are separated by whitespace and at most one comma,
+        // the output is left untouched when the parsing fails
+        vec<T, Size> t{no_init};
+        const std::from_chars_result r = impl::from_chars_n(first, last, t.data(), Size);
+        if ( r.ec == std::errc{} ) {
+            v = t;
+        }
+        return r;
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    std::enable_if_t<impl::is_charconv_v<T>, std::from_chars_result>
+    from_chars(const char* first, const char* last, mat<T, Rows, Cols>& m) noexcept {
+        mat<T, Rows, Cols> t{no_init};
+        for ( std::size_t i = 0; i < Rows; ++i ) {
+            if ( i > 0 ) {
+                first = impl::skip_chars_separator(first, last);
+            }
+            const std::from_chars_result r = impl::from_chars_n(first, last, t[i].data(), Cols);
+            if ( r.ec != std::errc{} ) {
+                return r;
+            }
+            first = r.ptr;
+        }
+        m = t;
+        return {first, std::errc{}};
+    }
+
+    template < typename T >
+    std::enable_if_t<impl::is_charconv_v<T>, std::from_chars_result>
+    from_chars(const char* first, const char* last, qua<T>& q) noexcept {
+        qua<T> t{no_init};
+        const std::from_chars_result r = impl::from_chars_n(first, last, t.data(), 4);
+        if ( r.ec == std::errc{} ) {
+            q = t;
+        }
+        return r;
+    }
+}
+
+//
+// Batch Chars
+//
+
+namespace vmath_hpp
+{
+    // to_chars
+
+    template < typename InputIt
+             , typename V = typename std::iterator_traits<InputIt>::value_type >
+    std::to_chars_result to_chars(char* first, char* last, InputIt x_first, InputIt x_last, char separator = ' ', char delimiter = '\n') noexcept {
+        // every element is followed by the delimiter, on overflow the result
+        // points to the end of the last element that was written completely
+        char* done = first;
+        for ( ; x_first != x_last; ++x_first ) {
+            const std::to_chars_result r = to_chars(done, last, *x_first, separator);
+            if ( r.ec != std::errc{} || r.ptr == last ) {
+                return {done, std::errc::value_too_large};
+            }
+            *r.ptr = delimiter;
+            done = r.ptr + 1;
+        }
+        return {done, std::errc{}};
+    }
+
+    // from_chars
+
+    template < typename ForwardIt
+             , typename V = typename std::iterator_traits<ForwardIt>::value_type >
+    std::pair<std::from_chars_result, ForwardIt> from_chars(const char* first, const char* last, ForwardIt d_first, ForwardIt d_last) noexcept {
+        // stops at the end of the output range or of the text, elements are
+        // separated like components: whitespace and at most one comma
+        for ( ; d_first != d_last; ++d_first ) {
+            const char* next = impl::skip_chars_separator(first, last);
+            if ( next == last ) {
+                break;
+            }
+            const std::from_chars_result r = from_chars(next, last, *d_first);
+            if ( r.ec != std::errc{} ) {
+                return {r, d_first};
+            }
+            first = r.ptr;
+        }
+        return {{first, std::errc{}}, d_first};
+    }
+}
+
+#endif
+
+//
+// Formatters
+//
+
+namespace vmath_hpp::impl
+{
+    template < typename Formatter, typename T, typename FormatContext >
+    void format_n(const Formatter& f, const T* xs, std::size_t n, bool separate, FormatContext& ctx) {
+        // every component is formatted with the user's format spec
+        for ( std::size_t i = 0; i < n; ++i ) {
+            if ( separate || i > 0 ) {
+                auto out = ctx.out();
+                *out++ = ' ';
+                ctx.advance_to(out);
+            }
+            ctx.advance_to(f.format(xs[i], ctx));
+        }
+    }
+}
+
+#if defined(__cpp_lib_format)
+namespace std
+{
+    template < typename T, size_t Size >
+    struct formatter<vmath_hpp::vec<T, Size>, char> : formatter<T, char> {
+        template < typename FormatContext >
+        auto format(const vmath_hpp::vec<T, Size>& v, FormatContext& ctx) const {
+            vmath_hpp::impl::format_n(static_cast<const formatter<T, char>&>(*this), v.data(), Size, false, ctx);
+            return ctx.out();
+        }
+    };
+
+    template < typename T, size_t Rows, size_t Cols >
+    struct formatter<vmath_hpp::mat<T, Rows, Cols>, char> : formatter<T, char> {
+        template < typename FormatContext >
+        auto format(const vmath_hpp::mat<T, Rows, Cols>& m, FormatContext& ctx) const {
+            for ( size_t i = 0; i < Rows; ++i ) {
+                vmath_hpp::impl::format_n(static_cast<const formatter<T, char>&>(*this), m[i].data(), Cols, i > 0, ctx);
+            }
+            return ctx.out();
+        }
+    };
+
+    template < typename T >
+    struct formatter<vmath_hpp::qua<T>, char> : formatter<T, char> {
+        template < typename FormatContext >
+        auto format(const vmath_hpp::qua<T>& q, FormatContext& ctx) const {
+            vmath_hpp::impl::format_n(static_cast<const formatter<T, char>&>(*this), q.data(), 4, false, ctx);
+            return ctx.out();
+        }
+    };
+}
+#endif
+
+//
+// Cubic Curves
+//
+
+namespace vmath_hpp
+{
+    // hermite
+
+    template < typename V, typename T >
+    [[nodiscard]] constexpr std::enable_if_t<std::is_floating_point_v<T>, V>
+    hermite(const V& p0, const V& m0, const V& p1, const V& m1, T t) {
+        const T t2 = t * t;
+        const T t3 = t2 * t;
+        return
+            p0 * (T{2} * t3 - T{3} * t2 + T{1}) +
+            m0 * (t3 - T{2} * t2 + t) +
+            p1 * (T{3} * t2 - T{2} * t3) +
+            m1 * (t3 - t2);
+    }
+
+    // catmull_rom
+
+    template < typename V, typename T >
+    [[nodiscard]] constexpr std::enable_if_t<std::is_floating_point_v<T>, V>
+    catmull_rom(const V& p0, const V& p1, const V& p2, const V& p3, T t) {
+        return hermite(p1, (p2 - p0) * T{0.5}, p2, (p3 - p1) * T{0.5}, t);
+    }
+
+    // bezier
+
+    template < typename V, typename T >
+    [[nodiscard]] constexpr std::enable_if_t<std::is_floating_point_v<T>, V>
+    bezier(const V& p0, const V& p1, const V& p2, const V& p3, T t) {
+        const T s = T{1} - t;
+        return
+            p0 * (s * s * s) +
+            p1 * (T{3} * s * s * t) +
+            p2 * (T{3} * s * t * t) +
+            p3 * (t * t * t);
+    }
+}
+
+//
+// Quaternion Curves
+//
+
+namespace vmath_hpp::impl
+{
+    template < typename T >
+    [[nodiscard]] constexpr vec<T, 3> unit_qua_log(const qua<T>& unit_q) {
+        const T vl = length(unit_q.v);
+        return vl > T{0} ? unit_q.v * (atan2(vl, unit_q.s) / vl) : vec<T, 3>{zero_init};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> unit_qua_exp(const vec<T, 3>& w) {
+        const T wl = length(w);
+        return wl > T{0} ? qua<T>{w * (sin(wl) / wl), cos(wl)} : qua<T>{identity_init};
+    }
+}
+
+namespace vmath_hpp
+{
+    // squad_control
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> squad_control(const qua<T>& unit_q0, const qua<T>& unit_q1, const qua<T>& unit_q2) {
+        /// REFERENCE:
+        /// Ken Shoemake, Animating rotation with quaternion curves (SIGGRAPH 1985)
+
+        // neighbours are moved to the hemisphere of q1 to take the short arcs
+        const qua<T> q0 = dot(unit_q0, unit_q1) < T{0} ? -unit_q0 : unit_q0;
+        const qua<T> q2 = dot(unit_q2, unit_q1) < T{0} ? -unit_q2 : unit_q2;
+
+        // a * b applies a first, so q1^-1 * q is written as q * inverse(q1)
+        const qua<T> iq1 = conjugate(unit_q1);
+        const vec<T, 3> l0 = impl::unit_qua_log(q0 * iq1);
+        const vec<T, 3> l2 = impl::unit_qua_log(q2 * iq1);
+        return impl::unit_qua_exp((l0 + l2) * T{-0.25}) * unit_q1;
+    }
+
+    // squad
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> squad(
+        const qua<T>& unit_q1,
+        const qua<T>& unit_q2,
+        const qua<T>& unit_s1,
+        const qua<T>& unit_s2,
+        T t)
+    {
+        return slerp(
+            slerp(unit_q1, unit_q2, t),
+            slerp(unit_s1, unit_s2, t),
+            T{2} * t * (T{1} - t));
+    }
+}
+
+//
+// Key Search
+//
+
+namespace vmath_hpp
+{
+    // find_key
+
+    template < typename RandomIt, typename T >
+    [[nodiscard]] constexpr std::size_t find_key(RandomIt first, RandomIt last, T time) {
+        // index of the segment [first[i], first[i + 1]) containing the time,
+        // clamped to the first and the last segments
+        const auto size = static_cast<std::size_t>(last - first);
+        if ( size < 2 ) {
+            return 0;
+        }
+
+        std::size_t lo = 0;
+        std::size_t hi = size - 1;
+        while ( hi - lo > 1 ) {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if ( time < first[static_cast<std::ptrdiff_t>(mid)] ) {
+                hi = mid;
+            } else {
+                lo = mid;
+            }
+        }
+        return lo;
+    }
+
+    // key_cursor
+
+    class key_cursor final {
+    public:
+        constexpr key_cursor() = default;
+        constexpr explicit key_cursor(std::size_t index)
+        : index_{index} {}
+
+        [[nodiscard]] constexpr std::size_t index() const noexcept {
+            return index_;
+        }
+
+        template < typename RandomIt, typename T >
+        constexpr std::size_t seek(RandomIt first, RandomIt last, T time) {
+            // playback usually stays in the same segment or steps to the next one
+            const auto size = static_cast<std::size_t>(last - first);
+            if ( size < 2 ) {
+                return index_ = 0;
+            }
+
+            if ( index_ + 1 < size ) {
+                if ( in_segment_(first, size, index_, time) ) {
+                    return index_;
+                }
+                if ( index_ + 2 < size && in_segment_(first, size, index_ + 1, time) ) {
+                    return ++index_;
+                }
+            }
+
+            return index_ = find_key(first, last, time);
+        }
+    private:
+        template < typename RandomIt, typename T >
+        [[nodiscard]] static constexpr bool in_segment_(RandomIt first, std::size_t size, std::size_t index, T time) {
+            return (index == 0 || !(time < first[static_cast<std::ptrdiff_t>(index)]))
+                && (index + 2 == size || time < first[static_cast<std::ptrdiff_t>(index + 1)]);
+        }
+    private:
+        std::size_t index_{0};
+    };
+}
+
+//
+// Key Sampling
+//
+
+namespace vmath_hpp
+{
+    enum class interpolation : unsigned char {
+        step,
+        linear,
+        cubic,
+    };
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename T >
+    struct curve_segment final {
+        std::size_t keys[4]{};
+        T weights[4]{};
+        T t{0};
+    };
+
+    template < typename TimeIt, typename T >
+    [[nodiscard]] constexpr curve_segment<T> make_curve_segment(TimeIt times, std::size_t size, std::size_t index, T time) {
+        curve_segment<T> s;
+
+        if ( size < 2 ) {
+            // a single key: every mode returns it
+            s.weights[1] = T{1};
+            return s;
+        }
+
+        const std::size_t i0 = index > 0 ? index - 1 : index;
+        const std::size_t i1 = index;
+        const std::size_t i2 = index + 1;
+        const std::size_t i3 = index + 2 < size ? index + 2 : index + 1;
+
+        const T t0 = times[static_cast<std::ptrdiff_t>(i0)];
+        const T t1 = times[static_cast<std::ptrdiff_t>(i1)];
+        const T t2 = times[static_cast<std::ptrdiff_t>(i2)];
+        const T t3 = times[static_cast<std::ptrdiff_t>(i3)];
+
+        const T h = t2 - t1;
+        const T t = h > T{0} ? saturate((time - t1) / h) : T{1};
+
+        // non-uniform Catmull-Rom: m1 = (p2 - p0) * s1 and m2 = (p3 - p1) * s2,
+        // the hermite basis is then folded into one weight per key
+        const T s1 = t2 > t0 ? h / (t2 - t0) : T{0};
+        const T s2 = t3 > t1 ? h / (t3 - t1) : T{0};
+
+        const T tt = t * t;
+        const T ttt = tt * t;
+        const T h00 = T{2} * ttt - T{3} * tt + T{1};
+        const T h10 = ttt - T{2} * tt + t;
+        const T h01 = T{3} * tt - T{2} * ttt;
+        const T h11 = ttt - tt;
+
+        s.keys[0] = i0;
+        s.keys[1] = i1;
+        s.keys[2] = i2;
+        s.keys[3] = i3;
+
+        s.weights[0] = -h10 * s1;
+        s.weights[1] = h00 - h11 * s2;
+        s.weights[2] = h10 * s1 + h01;
+        s.weights[3] = h11 * s2;
+
+        s.t = t;
+        return s;
+    }
+
+    template < typename V, typename T >
+    [[nodiscard]] constexpr V curve_sample(
+        const curve_segment<T>& s,
+        const V& p0, const V& p1, const V& p2, const V& p3,
+        interpolation mode)
+    {
+        switch ( mode ) {
+            case interpolation::step:
+                return s.t < T{1} ? p1 : p2;
+            case interpolation::linear:
+                return lerp(p1, p2, s.t);
+            case interpolation::cubic:
+                break;
+        }
+        return p0 * s.weights[0] + p1 * s.weights[1] + p2 * s.weights[2] + p3 * s.weights[3];
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> curve_sample(
+        const curve_segment<T>& s,
+        const qua<T>& p0, const qua<T>& p1, const qua<T>& p2, const qua<T>& p3,
+        interpolation mode)
+    {
+        switch ( mode ) {
+            case interpolation::step:
+                return s.t < T{1} ? p1 : p2;
+            case interpolation::linear:
+                return slerp(p1, p2, s.t);
+            case interpolation::cubic:
+                break;
+        }
+        const qua<T> q2 = dot(p1, p2) < T{0} ? -p2 : p2;
+        return squad(p1, q2, squad_control(p0, p1, q2), squad_control(p1, q2, p3), s.t);
+    }
+}
+
+namespace vmath_hpp
+{
+    // sample
+
+    template < typename TimeIt, typename ValueIt, typename T
+             , typename V = typename std::iterator_traits<ValueIt>::value_type >
+    [[nodiscard]] constexpr V sample(
+        TimeIt t_first, TimeIt t_last, ValueIt v_first, T time,
+        key_cursor& cursor, interpolation mode = interpolation::linear)
+    {
+        // precondition: the key times are sorted and the track is not empty
+        const auto size = static_cast<std::size_t>(t_last - t_first);
+        const impl::curve_segment<T> s = impl::make_curve_segment(
+            t_first, size, cursor.seek(t_first, t_last, time), time);
+        return impl::curve_sample(s,
+            v_first[static_cast<std::ptrdiff_t>(s.keys[0])],
+            v_first[static_cast<std::ptrdiff_t>(s.keys[1])],
+            v_first[static_cast<std::ptrdiff_t>(s.keys[2])],
+            v_first[static_cast<std::ptrdiff_t>(s.keys[3])],
+            mode);
+    }
+
+    template < typename TimeIt, typename ValueIt, typename T
+             , typename V = typename std::iterator_traits<ValueIt>::value_type >
+    [[nodiscard]] constexpr V sample(
+        TimeIt t_first, TimeIt t_last, ValueIt v_first, T time,
+        interpolation mode = interpolation::linear)
+    {
+        key_cursor cursor;
+        return sample(t_first, t_last, v_first, time, cursor, mode);
+    }
+
+    // sample_tracks
+
+    template < typename TimeIt, typename ValueIt, typename OutputIt, typename T >
+    constexpr OutputIt sample_tracks(
+        TimeIt t_first, TimeIt t_last, ValueIt v_first, std::size_t track_count, T time,
+        OutputIt d_first, key_cursor& cursor, interpolation mode = interpolation::linear)
+    {
+        // tracks sharing key times, values are stored key by key: v_first[key * track_count + track],
+        // the segment and its weights are computed once for all tracks
+        const auto size = static_cast<std::size_t>(t_last - t_first);
+        const impl::curve_segment<T> s = impl::make_curve_segment(
+            t_first, size, cursor.seek(t_first, t_last, time), time);
+
+        const ValueIt k0 = v_first + static_cast<std::ptrdiff_t>(s.keys[0] * track_count);
+        const ValueIt k1 = v_first + static_cast<std::ptrdiff_t>(s.keys[1] * track_count);
+        const ValueIt k2 = v_first + static_cast<std::ptrdiff_t>(s.keys[2] * track_count);
+        const ValueIt k3 = v_first + static_cast<std::ptrdiff_t>(s.keys[3] * track_count);
+
+        for ( std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(track_count); ++i, ++d_first ) {
+            *d_first = impl::curve_sample(s, k0[i], k1[i], k2[i], k3[i], mode);
+        }
+        return d_first;
+    }
+
+    template < typename TimeIt, typename ValueIt, typename OutputIt, typename T >
+    constexpr OutputIt sample_tracks(
+        TimeIt t_first, TimeIt t_last, ValueIt v_first, std::size_t track_count, T time,
+        OutputIt d_first, interpolation mode = interpolation::linear)
+    {
+        key_cursor cursor;
+        return sample_tracks(t_first, t_last, v_first, track_count, time, d_first, cursor, mode);
+    }
+}
+
+#if (defined(__clang__) || defined(__GNUC__)) && (defined(__x86_64__) || defined(__i386__))
+#  define VMATH_HPP_DISPATCH_X86
+#  define VMATH_HPP_TARGET_AVX2 __attribute__((__target__("avx2,fma")))
+#  define VMATH_HPP_TARGET_AVX512 __attribute__((__target__("avx512f,avx512vl,avx2,fma")))
+#endif
+
+#if defined(VMATH_HPP_DISPATCH_X86) && defined(__x86_64__)
+#  define VMATH_HPP_DISPATCH_BMI2
+#  define VMATH_HPP_TARGET_BMI2 __attribute__((__target__("bmi2")))
+#endif
+
+// the variants with fma would fuse multiplies and adds and round differently,
+// contraction is turned off so every level gives the same bits: clang decides it
+// per expression and gets a pragma in every kernel, gcc decides it per function
+// after inlining and gets the option for every function of the kernels section.
+// the pragmas cover only the code of the kernels, so the kernels use no library
+// function that multiplies and adds unless it's forced inline: an out of line
+// one is compiled with the options of the translation unit and may be fused.
+// msvc has no runtime dispatch, every call runs the same baseline kernel
+
+#if defined(__clang__)
+#  define VMATH_HPP_NO_CONTRACT _Pragma("clang fp contract(off)")
+#else
+#  define VMATH_HPP_NO_CONTRACT
+#endif
+
+//
+// Runtime Dispatch
+//
+
+namespace vmath_hpp
+{
+    // baseline is whatever the translation unit is compiled for
+    enum class simd_level : unsigned char {
+        baseline,
+        avx2,
+        avx512,
+    };
+}
+
+namespace vmath_hpp::impl
+{
+    [[nodiscard]] inline simd_level detect_simd_level() noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") ) {
+            return simd_level::avx512;
+        }
+        if ( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ) {
+            return simd_level::avx2;
+        }
+    #endif
+        return simd_level::baseline;
+    }
+
+    [[nodiscard]] inline simd_level clamp_simd_level(simd_level level, simd_level supported) noexcept {
+        return level < supported ? level : supported;
+    }
+
+    [[nodiscard]] inline simd_level startup_simd_level(simd_level supported) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        // VMATH_HPP_SIMD=baseline|avx2|avx512 lowers the level, e.g. for testing
+        if ( const char* env = std::getenv("VMATH_HPP_SIMD") ) {
+            const std::string_view name{env};
+            if ( name == "baseline" ) {
+                return simd_level::baseline;
+            }
+            if ( name == "avx2" ) {
+                return clamp_simd_level(simd_level::avx2, supported);
+            }
+        }
+    #endif
+        return supported;
+    }
+
+    // -1 when not forced
+    inline std::atomic<int> forced_simd_level{-1};
+}
+
+namespace vmath_hpp
+{
+    [[nodiscard]] inline simd_level supported_simd_level() noexcept {
+        static const simd_level level = impl::detect_simd_level();
+        return level;
+    }
+
+    [[nodiscard]] inline simd_level current_simd_level() noexcept {
+        if ( const int forced = impl::forced_simd_level.load(std::memory_order_relaxed); forced >= 0 ) {
+            return static_cast<simd_level>(forced);
+        }
+        static const simd_level level = impl::startup_simd_level(supported_simd_level());
+        return level;
+    }
+
+    inline void force_simd_level(simd_level level) noexcept {
+        const simd_level clamped = impl::clamp_simd_level(level, supported_simd_level());
+        impl::forced_simd_level.store(static_cast<int>(clamped), std::memory_order_relaxed);
+    }
+
+    inline void reset_simd_level() noexcept {
+        impl::forced_simd_level.store(-1, std::memory_order_relaxed);
+    }
+}
+
+//
+// Dispatched Kernels
+//
+
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC push_options
+#  pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace vmath_hpp::impl
+{
+    // the kernels are plain loops, every variant is the same code
+    // compiled for a different instruction set and auto-vectorized
+
+    template < typename T, std::size_t Size >
+    VMATH_HPP_FORCE_INLINE
+    void multiply_n_kernel(const vec<T, Size>* xs, std::size_t n, const mat<T, Size>& m, vec<T, Size>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        const mat<T, Size> mm = m;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            out[i] = mul_impl(xs[i], mm);
+        }
+    }
+
+    template < typename T, std::size_t Size >
+    VMATH_HPP_FORCE_INLINE
+    void multiply_n_kernel(const mat<T, Size>* xs, std::size_t n, const mat<T, Size>& m, mat<T, Size>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        const mat<T, Size> mm = m;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            const mat<T, Size> x = xs[i];
+            for ( std::size_t r = 0; r < Size; ++r ) {
+                out[i][r] = mul_impl(x[r], mm);
+            }
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    T dot_n_kernel(const T* xs, const T* ys, std::size_t n) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        // fixed lanes and no contraction: the result doesn't depend on the instruction set
+        constexpr std::size_t lanes = 16;
+        T acc[lanes]{};
+        std::size_t i = 0;
+        for ( ; i + lanes <= n; i += lanes ) {
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                acc[j] += xs[i + j] * ys[i + j];
+            }
+        }
+        for ( std::size_t j = 0; i < n; ++i, ++j ) {
+            acc[j] += xs[i] * ys[i];
+        }
+        T r{0};
+        for ( std::size_t j = 0; j < lanes; ++j ) {
+            r += acc[j];
+        }
+        return r;
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void inverse_n_kernel(const mat<T, 4>* xs, std::size_t n, mat<T, 4>* out, T* dets) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        // one matrix at a time, up to avx2 this is faster than the blocked kernel,
+        // the transposition into lanes costs more than the wider loop wins back
+        for ( std::size_t i = 0; i < n; ++i ) {
+            const mat<T, 4> m = xs[i];
+            const mat<T, 4> adj = adjugate_4(m);
+            const T det = determinant_from_adjugate_4(m, adj);
+            const T inv_det = rcp(det);
+            if ( abs(inv_det) <= std::numeric_limits<T>::max() ) {
+                out[i] = adj * inv_det;
+                if ( dets ) {
+                    dets[i] = det;
+                }
+            } else {
+                out[i] = mat<T, 4>{zero_init};
+                if ( dets ) {
+                    dets[i] = T{0};
+                }
+            }
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void inverse_n_blocked_kernel(const mat<T, 4>* xs, std::size_t n, mat<T, 4>* out, T* dets) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        // blocks of matrices are transposed into local arrays, one array per element,
+        // so the inversion loop has no aliasing to check and runs over whole registers
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T ms[16][lanes];
+            if ( w == lanes ) {
+                for ( std::size_t j = 0; j < lanes; ++j ) {
+                    for ( std::size_t e = 0; e < 16; ++e ) {
+                        ms[e][j] = xs[i + j][e / 4][e % 4];
+                    }
+                }
+            } else {
+                // the tail block is padded with identities
+                for ( std::size_t j = 0; j < lanes; ++j ) {
+                    const mat<T, 4> m = j < w ? xs[i + j] : mat<T, 4>{};
+                    for ( std::size_t e = 0; e < 16; ++e ) {
+                        ms[e][j] = m[e / 4][e % 4];
+                    }
+                }
+            }
+
+            T rs[16][lanes];
+            T ds[lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const mat<T, 4> m{
+                    ms[ 0][j], ms[ 1][j], ms[ 2][j], ms[ 3][j],
+                    ms[ 4][j], ms[ 5][j], ms[ 6][j], ms[ 7][j],
+                    ms[ 8][j], ms[ 9][j], ms[10][j], ms[11][j],
+                    ms[12][j], ms[13][j], ms[14][j], ms[15][j]};
+                const mat<T, 4> adj = adjugate_4(m);
+                const T det = determinant_from_adjugate_4(m, adj);
+
+                // the division has to be unconditional, a guarded one
+                // stays a branch and the loop isn't vectorized
+                const T inv_det = rcp(det);
+                const bool regular = abs(inv_det) <= std::numeric_limits<T>::max();
+                const T scale = regular ? inv_det : T{0};
+                for ( std::size_t e = 0; e < 16; ++e ) {
+                    rs[e][j] = adj[e / 4][e % 4] * scale;
+                }
+                ds[j] = regular ? det : T{0};
+            }
+
+            for ( std::size_t j = 0; j < w; ++j ) {
+                for ( std::size_t e = 0; e < 16; ++e ) {
+                    out[i + j][e / 4][e % 4] = rs[e][j];
+                }
+            }
+            if ( dets ) {
+                for ( std::size_t j = 0; j < w; ++j ) {
+                    dets[i + j] = ds[j];
+                }
+            }
+        }
+    }
+
+    template < typename T, std::size_t Lanes >
+    VMATH_HPP_FORCE_INLINE
+    void store_lanes_4(const T (&xs)[16][Lanes], std::size_t n, mat<T, 4>* out) noexcept {
+        // transposes the first n lanes back to matrices, whole rows at a time
+        if ( !out ) {
+            return;
+        }
+        for ( std::size_t j = 0; j < n; ++j ) {
+            out[j] = mat<T, 4>{
+                xs[ 0][j], xs[ 1][j], xs[ 2][j], xs[ 3][j],
+                xs[ 4][j], xs[ 5][j], xs[ 6][j], xs[ 7][j],
+                xs[ 8][j], xs[ 9][j], xs[10][j], xs[11][j],
+                xs[12][j], xs[13][j], xs[14][j], xs[15][j]};
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void cameras_n_kernel(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n,
+        T hand, T sz, T tz,
+        mat<T, 4>* views, mat<T, 4>* projs, mat<T, 4>* view_projs) noexcept
+    {
+        VMATH_HPP_NO_CONTRACT
+        // the same matrices as look_at and perspective_fov, the handedness only flips
+        // the forward axis and the w row, the depth row is the same for every camera
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            // the tail block is padded with a valid camera
+            T ex[lanes], ey[lanes], ez[lanes];
+            T fx[lanes], fy[lanes], fz[lanes];
+            T ux[lanes], uy[lanes], uz[lanes];
+            T ts[lanes], rs[lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const bool live = j < w;
+                const vec<T, 3> e = live ? eyes[i + j] : vec<T, 3>{T{0}};
+                const vec<T, 3> f = live ? ats[i + j] - e : vec<T, 3>{T{0}, T{0}, T{1}};
+                const vec<T, 3> u = live ? ups[i + j] : vec<T, 3>{T{0}, T{1}, T{0}};
+                ex[j] = e.x; ey[j] = e.y; ez[j] = e.z;
+                fx[j] = f.x * hand; fy[j] = f.y * hand; fz[j] = f.z * hand;
+                ux[j] = u.x; uy[j] = u.y; uz[j] = u.z;
+                ts[j] = live ? fovys[i + j] : T{1};
+                rs[j] = live ? aspects[i + j] : T{1};
+            }
+
+            // libm calls and the square roots keep their error handling branches,
+            // so they get their own short loops and the others are vectorized
+
+            T ls[lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                ts[j] = tan(ts[j] * T{0.5f});
+                ls[j] = sqrt(fx[j] * fx[j] + fy[j] * fy[j] + fz[j] * fz[j]);
+            }
+
+            T zx[lanes], zy[lanes], zz[lanes];
+            T xx[lanes], xy[lanes], xz[lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const T rl = rcp(ls[j]);
+                zx[j] = fx[j] * rl;
+                zy[j] = fy[j] * rl;
+                zz[j] = fz[j] * rl;
+                xx[j] = uy[j] * zz[j] - uz[j] * zy[j];
+                xy[j] = uz[j] * zx[j] - ux[j] * zz[j];
+                xz[j] = ux[j] * zy[j] - uy[j] * zx[j];
+            }
+
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                ls[j] = sqrt(xx[j] * xx[j] + xy[j] * xy[j] + xz[j] * xz[j]);
+            }
+
+            T vs[16][lanes];
+            T ps[16][lanes];
+            T vps[16][lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const T rl = rcp(ls[j]);
+                const T ax = xx[j] * rl;
+                const T ay = xy[j] * rl;
+                const T az = xz[j] * rl;
+                const T bx = zy[j] * az - zz[j] * ay;
+                const T by = zz[j] * ax - zx[j] * az;
+                const T bz = zx[j] * ay - zy[j] * ax;
+                const T dx = -(ax * ex[j] + ay * ey[j] + az * ez[j]);
+                const T dy = -(bx * ex[j] + by * ey[j] + bz * ez[j]);
+                const T dz = -(zx[j] * ex[j] + zy[j] * ey[j] + zz[j] * ez[j]);
+
+                vs[ 0][j] = ax; vs[ 1][j] = bx; vs[ 2][j] = zx[j]; vs[ 3][j] = T{0};
+                vs[ 4][j] = ay; vs[ 5][j] = by; vs[ 6][j] = zy[j]; vs[ 7][j] = T{0};
+                vs[ 8][j] = az; vs[ 9][j] = bz; vs[10][j] = zz[j]; vs[11][j] = T{0};
+                vs[12][j] = dx; vs[13][j] = dy; vs[14][j] = dz;    vs[15][j] = T{1};
+
+                const T sy = rcp(ts[j]);
+                const T sx = sy * rcp(rs[j]);
+
+                ps[ 0][j] = sx;   ps[ 1][j] = T{0}; ps[ 2][j] = T{0}; ps[ 3][j] = T{0};
+                ps[ 4][j] = T{0}; ps[ 5][j] = sy;   ps[ 6][j] = T{0}; ps[ 7][j] = T{0};
+                ps[ 8][j] = T{0}; ps[ 9][j] = T{0}; ps[10][j] = sz;   ps[11][j] = hand;
+                ps[12][j] = T{0}; ps[13][j] = T{0}; ps[14][j] = tz;   ps[15][j] = T{0};
+
+                // the projection is sparse, a row of view * proj
+                // is (a * sx, b * sy, c * sz + d * tz, c * hand)
+                vps[ 0][j] = ax * sx; vps[ 1][j] = bx * sy; vps[ 2][j] = zx[j] * sz; vps[ 3][j] = zx[j] * hand;
+                vps[ 4][j] = ay * sx; vps[ 5][j] = by * sy; vps[ 6][j] = zy[j] * sz; vps[ 7][j] = zy[j] * hand;
+                vps[ 8][j] = az * sx; vps[ 9][j] = bz * sy; vps[10][j] = zz[j] * sz; vps[11][j] = zz[j] * hand;
+                vps[12][j] = dx * sx; vps[13][j] = dy * sy; vps[14][j] = dz * sz + tz; vps[15][j] = dz * hand;
+            }
+
+            store_lanes_4(vs, w, views ? views + i : nullptr);
+            store_lanes_4(ps, w, projs ? projs + i : nullptr);
+            store_lanes_4(vps, w, view_projs ? view_projs + i : nullptr);
+        }
+    }
+
+    template < typename T, std::size_t Lanes >
+    VMATH_HPP_FORCE_INLINE
+    void load_lanes(const vec<T, 3>* xs, std::size_t n, const vec<T, 3>& pad, T (&ps)[3][Lanes]) noexcept {
+        // transposes the first n lanes from vectors, the rest is padded, a whole
+        // block gets its own branch-free loop, the guarded one isn't vectorized
+        if ( n == Lanes ) {
+            for ( std::size_t j = 0; j < Lanes; ++j ) {
+                ps[0][j] = xs[j].x;
+                ps[1][j] = xs[j].y;
+                ps[2][j] = xs[j].z;
+            }
+        } else {
+            for ( std::size_t j = 0; j < Lanes; ++j ) {
+                const vec<T, 3> p = j < n ? xs[j] : pad;
+                ps[0][j] = p.x;
+                ps[1][j] = p.y;
+                ps[2][j] = p.z;
+            }
+        }
+    }
+
+    template < typename T, std::size_t Lanes >
+    VMATH_HPP_FORCE_INLINE
+    void load_lanes(const qua<T>* qs, std::size_t n, const qua<T>& pad, T (&ps)[4][Lanes]) noexcept {
+        if ( n == Lanes ) {
+            for ( std::size_t j = 0; j < Lanes; ++j ) {
+                ps[0][j] = qs[j].v.x;
+                ps[1][j] = qs[j].v.y;
+                ps[2][j] = qs[j].v.z;
+                ps[3][j] = qs[j].s;
+            }
+        } else {
+            for ( std::size_t j = 0; j < Lanes; ++j ) {
+                const qua<T> q = j < n ? qs[j] : pad;
+                ps[0][j] = q.v.x;
+                ps[1][j] = q.v.y;
+                ps[2][j] = q.v.z;
+                ps[3][j] = q.s;
+            }
+        }
+    }
+
+    template < typename T, std::size_t Lanes >
+    VMATH_HPP_FORCE_INLINE
+    void store_lanes(const T (&rs)[3][Lanes], std::size_t n, vec<T, 3>* out) noexcept {
+        if ( n == Lanes ) {
+            for ( std::size_t j = 0; j < Lanes; ++j ) {
+                out[j] = vec<T, 3>{rs[0][j], rs[1][j], rs[2][j]};
+            }
+        } else {
+            for ( std::size_t j = 0; j < n; ++j ) {
+                out[j] = vec<T, 3>{rs[0][j], rs[1][j], rs[2][j]};
+            }
+        }
+    }
+
+    template < typename T, std::size_t Lanes >
+    VMATH_HPP_FORCE_INLINE
+    void store_lanes(const T (&rs)[4][Lanes], std::size_t n, qua<T>* out) noexcept {
+        if ( n == Lanes ) {
+            for ( std::size_t j = 0; j < Lanes; ++j ) {
+                out[j] = qua<T>{rs[0][j], rs[1][j], rs[2][j], rs[3][j]};
+            }
+        } else {
+            for ( std::size_t j = 0; j < n; ++j ) {
+                out[j] = qua<T>{rs[0][j], rs[1][j], rs[2][j], rs[3][j]};
+            }
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void unproject_n_kernel(const vec<T, 3>* xs, std::size_t n, const mat<T, 4>& m, vec<T, 3>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        // blocks are loaded into local arrays first, so out may be xs
+        constexpr std::size_t lanes = 16;
+        const mat<T, 4> mm = m;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T ps[3][lanes];
+            load_lanes(xs + i, w, vec<T, 3>{T{0}}, ps);
+
+            T rs[3][lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const vec<T, 4> p = ps[0][j] * mm[0] + ps[1][j] * mm[1] + ps[2][j] * mm[2] + mm[3];
+                const T rw = rcp(p.w);
+                rs[0][j] = p.x * rw;
+                rs[1][j] = p.y * rw;
+                rs[2][j] = p.z * rw;
+            }
+
+            store_lanes(rs, w, out + i);
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void rotate_n_kernel(const vec<T, 3>* xs, std::size_t n, const mat<T, 3>& m, vec<T, 3>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        // one rotation for the whole range, already converted to a matrix
+        constexpr std::size_t lanes = 16;
+        const mat<T, 3> mm = m;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T ps[3][lanes];
+            load_lanes(xs + i, w, vec<T, 3>{T{0}}, ps);
+
+            T rs[3][lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const vec<T, 3> p = ps[0][j] * mm[0] + ps[1][j] * mm[1] + ps[2][j] * mm[2];
+                rs[0][j] = p.x;
+                rs[1][j] = p.y;
+                rs[2][j] = p.z;
+            }
+
+            store_lanes(rs, w, out + i);
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void rotate_n_kernel(const vec<T, 3>* xs, const qua<T>* qs, std::size_t n, vec<T, 3>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        // a rotation per vector, v * q in lanes: no matrix would pay for itself
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T ps[3][lanes];
+            T qs4[4][lanes];
+            load_lanes(xs + i, w, vec<T, 3>{T{0}}, ps);
+            load_lanes(qs + i, w, qua<T>{}, qs4);
+
+            T rs[3][lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                // the crosses are written out, an out of line cross may be fused
+                const T qx = qs4[0][j];
+                const T qy = qs4[1][j];
+                const T qz = qs4[2][j];
+                const T tx = (qy * ps[2][j] - qz * ps[1][j]) * T{2};
+                const T ty = (qz * ps[0][j] - qx * ps[2][j]) * T{2};
+                const T tz = (qx * ps[1][j] - qy * ps[0][j]) * T{2};
+                rs[0][j] = ps[0][j] + tx * qs4[3][j] + (qy * tz - qz * ty);
+                rs[1][j] = ps[1][j] + ty * qs4[3][j] + (qz * tx - qx * tz);
+                rs[2][j] = ps[2][j] + tz * qs4[3][j] + (qx * ty - qy * tx);
+            }
+
+            store_lanes(rs, w, out + i);
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void multiply_n_kernel(const qua<T>* xs, const qua<T>* ys, std::size_t n, qua<T>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T as[4][lanes];
+            T bs[4][lanes];
+            load_lanes(xs + i, w, qua<T>{}, as);
+            load_lanes(ys + i, w, qua<T>{}, bs);
+
+            T rs[4][lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                // the same operations in the same order as qua * qua:
+                // cross(ys.v, xs.v) + ys.s * xs.v + xs.s * ys.v, ys.s * xs.s - dot(ys.v, xs.v)
+                const T cx = bs[1][j] * as[2][j] - bs[2][j] * as[1][j];
+                const T cy = bs[2][j] * as[0][j] - bs[0][j] * as[2][j];
+                const T cz = bs[0][j] * as[1][j] - bs[1][j] * as[0][j];
+                rs[0][j] = cx + bs[3][j] * as[0][j] + as[3][j] * bs[0][j];
+                rs[1][j] = cy + bs[3][j] * as[1][j] + as[3][j] * bs[1][j];
+                rs[2][j] = cz + bs[3][j] * as[2][j] + as[3][j] * bs[2][j];
+                rs[3][j] = bs[3][j] * as[3][j] - (bs[0][j] * as[0][j] + bs[1][j] * as[1][j] + bs[2][j] * as[2][j]);
+            }
+
+            store_lanes(rs, w, out + i);
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void conjugate_n_kernel(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            out[i] = conjugate(qs[i]);
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void inverse_n_kernel(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T ps[4][lanes];
+            load_lanes(qs + i, w, qua<T>{}, ps);
+
+            T rs[4][lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const T rl2 = rcp(ps[0][j] * ps[0][j] + ps[1][j] * ps[1][j] + ps[2][j] * ps[2][j] + ps[3][j] * ps[3][j]);
+                rs[0][j] = -ps[0][j] * rl2;
+                rs[1][j] = -ps[1][j] * rl2;
+                rs[2][j] = -ps[2][j] * rl2;
+                rs[3][j] = ps[3][j] * rl2;
+            }
+
+            store_lanes(rs, w, out + i);
+        }
+    }
+
+#if defined(VMATH_HPP_DISPATCH_X86)
+    template < typename X, typename T, std::size_t Size >
+    VMATH_HPP_TARGET_AVX2
+    void multiply_n_avx2(const X* xs, std::size_t n, const mat<T, Size>& m, X* out) noexcept {
+        multiply_n_kernel(xs, n, m, out);
+    }
+
+    template < typename X, typename T, std::size_t Size >
+    VMATH_HPP_TARGET_AVX512
+    void multiply_n_avx512(const X* xs, std::size_t n, const mat<T, Size>& m, X* out) noexcept {
+        multiply_n_kernel(xs, n, m, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void inverse_n_avx512(const mat<T, 4>* xs, std::size_t n, mat<T, 4>* out, T* dets) noexcept {
+        inverse_n_blocked_kernel(xs, n, out, dets);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    T dot_n_avx2(const T* xs, const T* ys, std::size_t n) noexcept {
+        return dot_n_kernel(xs, ys, n);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    T dot_n_avx512(const T* xs, const T* ys, std::size_t n) noexcept {
+        return dot_n_kernel(xs, ys, n);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void unproject_n_avx2(const vec<T, 3>* xs, std::size_t n, const mat<T, 4>& m, vec<T, 3>* out) noexcept {
+        unproject_n_kernel(xs, n, m, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void unproject_n_avx512(const vec<T, 3>* xs, std::size_t n, const mat<T, 4>& m, vec<T, 3>* out) noexcept {
+        unproject_n_kernel(xs, n, m, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void rotate_n_avx2(const vec<T, 3>* xs, std::size_t n, const mat<T, 3>& m, vec<T, 3>* out) noexcept {
+        rotate_n_kernel(xs, n, m, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void rotate_n_avx512(const vec<T, 3>* xs, std::size_t n, const mat<T, 3>& m, vec<T, 3>* out) noexcept {
+        rotate_n_kernel(xs, n, m, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void rotate_n_avx2(const vec<T, 3>* xs, const qua<T>* qs, std::size_t n, vec<T, 3>* out) noexcept {
+        rotate_n_kernel(xs, qs, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void rotate_n_avx512(const vec<T, 3>* xs, const qua<T>* qs, std::size_t n, vec<T, 3>* out) noexcept {
+        rotate_n_kernel(xs, qs, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void multiply_n_avx2(const qua<T>* xs, const qua<T>* ys, std::size_t n, qua<T>* out) noexcept {
+        multiply_n_kernel(xs, ys, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void multiply_n_avx512(const qua<T>* xs, const qua<T>* ys, std::size_t n, qua<T>* out) noexcept {
+        multiply_n_kernel(xs, ys, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void conjugate_n_avx2(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+        conjugate_n_kernel(qs, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void conjugate_n_avx512(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+        conjugate_n_kernel(qs, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void inverse_n_avx2(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+        inverse_n_kernel(qs, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void inverse_n_avx512(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+        inverse_n_kernel(qs, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void cameras_n_avx2(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n,
+        T hand, T sz, T tz,
+        mat<T, 4>* views, mat<T, 4>* projs, mat<T, 4>* view_projs) noexcept
+    {
+        cameras_n_kernel(eyes, ats, ups, fovys, aspects, n, hand, sz, tz, views, projs, view_projs);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void cameras_n_avx512(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n,
+        T hand, T sz, T tz,
+        mat<T, 4>* views, mat<T, 4>* projs, mat<T, 4>* view_projs) noexcept
+    {
+        cameras_n_kernel(eyes, ats, ups, fovys, aspects, n, hand, sz, tz, views, projs, view_projs);
+    }
+#endif
+}
+
+namespace vmath_hpp
+{
+    // multiply_n
+
+    template < typename T, std::size_t Size >
+    void multiply_n(const vec<T, Size>* xs, std::size_t n, const mat<T, Size>& m, vec<T, Size>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::multiply_n_avx512(xs, n, m, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::multiply_n_avx2(xs, n, m, out);
+        }
+    #endif
+        return impl::multiply_n_kernel(xs, n, m, out);
+    }
+
+    template < typename T, std::size_t Size >
+    void multiply_n(const mat<T, Size>* xs, std::size_t n, const mat<T, Size>& m, mat<T, Size>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::multiply_n_avx512(xs, n, m, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::multiply_n_avx2(xs, n, m, out);
+        }
+    #endif
+        return impl::multiply_n_kernel(xs, n, m, out);
+    }
+
+    // inverse_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    inverse_n(const mat<T, 4>* xs, std::size_t n, mat<T, 4>* out, T* dets = nullptr) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::inverse_n_avx512(xs, n, out, dets);
+        }
+    #endif
+        return impl::inverse_n_kernel(xs, n, out, dets);
+    }
+
+    // unproject_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    unproject_n(const vec<T, 3>* xs, std::size_t n, const mat<T, 4>& inv_view_proj, vec<T, 3>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::unproject_n_avx512(xs, n, inv_view_proj, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::unproject_n_avx2(xs, n, inv_view_proj, out);
+        }
+    #endif
+        return impl::unproject_n_kernel(xs, n, inv_view_proj, out);
+    }
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    unproject_n(const vec<T, 3>* xs, std::size_t n, const mat<T, 4>& inv_view_proj, const vec<T, 4>& viewport, vec<T, 3>* out) noexcept {
+        unproject_n(xs, n, window_to_ndc(viewport) * inv_view_proj, out);
+    }
+
+    // multiply_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    multiply_n(const qua<T>* xs, const qua<T>* ys, std::size_t n, qua<T>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::multiply_n_avx512(xs, ys, n, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::multiply_n_avx2(xs, ys, n, out);
+        }
+    #endif
+        return impl::multiply_n_kernel(xs, ys, n, out);
+    }
+
+    // conjugate_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    conjugate_n(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::conjugate_n_avx512(qs, n, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::conjugate_n_avx2(qs, n, out);
+        }
+    #endif
+        return impl::conjugate_n_kernel(qs, n, out);
+    }
+
+    // inverse_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    inverse_n(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::inverse_n_avx512(qs, n, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::inverse_n_avx2(qs, n, out);
+        }
+    #endif
+        return impl::inverse_n_kernel(qs, n, out);
+    }
+
+    // rotate_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    rotate_n(const vec<T, 3>* xs, const qua<T>* qs, std::size_t n, vec<T, 3>* out) noexcept {
+        // out[i] = xs[i] * qs[i]
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::rotate_n_avx512(xs, qs, n, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::rotate_n_avx2(xs, qs, n, out);
+        }
+    #endif
+        return impl::rotate_n_kernel(xs, qs, n, out);
+    }
+
+    // dot_n
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    dot_n(const T* xs, const T* ys, std::size_t n) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::dot_n_avx512(xs, ys, n);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::dot_n_avx2(xs, ys, n);
+        }
+    #endif
+        return impl::dot_n_kernel(xs, ys, n);
+    }
+}
+
+namespace vmath_hpp::impl
+{
+    // keeps T deduced from the inputs, so null outputs can be passed as nullptr
+
+    template < typename X >
+    struct nondeduced { using type = X; };
+
+    template < typename X >
+    using nondeduced_t = typename nondeduced<X>::type;
+}
+
+namespace vmath_hpp::impl
+{
+    // cameras_n
+
+    template < typename T >
+    void cameras_n(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n,
+        T hand, T sz, T tz,
+        mat<T, 4>* views, mat<T, 4>* projs, mat<T, 4>* view_projs) noexcept
+    {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return cameras_n_avx512(eyes, ats, ups, fovys, aspects, n, hand, sz, tz, views, projs, view_projs);
+        }
+        if ( level == simd_level::avx2 ) {
+            return cameras_n_avx2(eyes, ats, ups, fovys, aspects, n, hand, sz, tz, views, projs, view_projs);
+        }
+    #endif
+        return cameras_n_kernel(eyes, ats, ups, fovys, aspects, n, hand, sz, tz, views, projs, view_projs);
+    }
+}
+
+namespace vmath_hpp
+{
+    // cameras_lh_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    cameras_lh_n(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n, T znear, T zfar,
+        impl::nondeduced_t<mat<T, 4>>* views,
+        impl::nondeduced_t<mat<T, 4>>* projs = nullptr,
+        impl::nondeduced_t<mat<T, 4>>* view_projs = nullptr) noexcept
+    {
+        // look_at_lh and perspective_fov_lh in one pass, any output may be null
+        const T sz = zfar * rcp(zfar - znear);
+        const T tz = (znear * zfar) * rcp(znear - zfar);
+        impl::cameras_n(eyes, ats, ups, fovys, aspects, n, T{1}, sz, tz, views, projs, view_projs);
+    }
+
+    // cameras_rh_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    cameras_rh_n(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n, T znear, T zfar,
+        impl::nondeduced_t<mat<T, 4>>* views,
+        impl::nondeduced_t<mat<T, 4>>* projs = nullptr,
+        impl::nondeduced_t<mat<T, 4>>* view_projs = nullptr) noexcept
+    {
+        const T sz = zfar * rcp(znear - zfar);
+        const T tz = (znear * zfar) * rcp(znear - zfar);
+        impl::cameras_n(eyes, ats, ups, fovys, aspects, n, -T{1}, sz, tz, views, projs, view_projs);
+    }
+
+    // cameras_infinite_reversed_lh_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    cameras_infinite_reversed_lh_n(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n, T znear,
+        impl::nondeduced_t<mat<T, 4>>* views,
+        impl::nondeduced_t<mat<T, 4>>* projs = nullptr,
+        impl::nondeduced_t<mat<T, 4>>* view_projs = nullptr) noexcept
+    {
+        // look_at_lh and perspective_fov_infinite_reversed_lh
+        impl::cameras_n(eyes, ats, ups, fovys, aspects, n, T{1}, T{0}, znear, views, projs, view_projs);
+    }
+
+    // cameras_infinite_reversed_rh_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    cameras_infinite_reversed_rh_n(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n, T znear,
+        impl::nondeduced_t<mat<T, 4>>* views,
+        impl::nondeduced_t<mat<T, 4>>* projs = nullptr,
+        impl::nondeduced_t<mat<T, 4>>* view_projs = nullptr) noexcept
+    {
+        impl::cameras_n(eyes, ats, ups, fovys, aspects, n, -T{1}, T{0}, znear, views, projs, view_projs);
+    }
+}
+
+namespace vmath_hpp::impl
+{
+    // a group shorter than this is rotated per vector, a longer one
+    // is worth converting its quaternion to a matrix first
+    inline constexpr std::size_t rotate_n_matrix_threshold = 16;
+
+    template < typename T >
+    void rotate_n(const vec<T, 3>* xs, std::size_t n, const mat<T, 3>& m, vec<T, 3>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return rotate_n_avx512(xs, n, m, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return rotate_n_avx2(xs, n, m, out);
+        }
+    #endif
+        return rotate_n_kernel(xs, n, m, out);
+    }
+}
+
+namespace vmath_hpp
+{
+    // rotate_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    rotate_n(const vec<T, 3>* xs, std::size_t n, const qua<T>& q, vec<T, 3>* out) noexcept {
+        // out[i] = xs[i] * q, the same result as the matrix of q
+        if ( n < impl::rotate_n_matrix_threshold ) {
+            for ( std::size_t i = 0; i < n; ++i ) {
+                out[i] = xs[i] * q;
+            }
+            return;
+        }
+        impl::rotate_n(xs, n, impl::qua_to_mat3(q), out);
+    }
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    rotate_n(const vec<T, 3>* xs, std::size_t n, const qua<T>* qs, std::size_t group, vec<T, 3>* out) noexcept {
+        // out[i] = xs[i] * qs[i / group], e.g. every instance of a mesh rotated by its own quaternion,
+        // long groups go through a matrix per quaternion, short ones are rotated in lanes
+        if ( group == 0 ) {
+            return;
+        }
+
+        if ( group >= impl::rotate_n_matrix_threshold ) {
+            for ( std::size_t i = 0; i < n; i += group, ++qs ) {
+                const std::size_t w = n - i < group ? n - i : group;
+                impl::rotate_n(xs + i, w, impl::qua_to_mat3(*qs), out + i);
+            }
+            return;
+        }
+
+        if ( group == 1 ) {
+            return rotate_n(xs, qs, n, out);
+        }
+
+        // short groups: quaternions are repeated into a local block
+        constexpr std::size_t block = 256;
+        qua<T> rs[block];
+        for ( std::size_t i = 0; i < n; i += block ) {
+            const std::size_t w = n - i < block ? n - i : block;
+            for ( std::size_t j = 0; j < w; ++j ) {
+                rs[j] = qs[(i + j) / group];
+            }
+            rotate_n(xs + i, rs, w, out + i);
+        }
+    }
+}
+
+//
+// Morton Kernels
+//
+
+namespace vmath_hpp::impl
+{
+    template < typename Key, std::size_t Size >
+    inline constexpr Key morton_mask_v = Size == 2
+        ? static_cast<Key>(0x5555555555555555u)
+        : sizeof(Key) == sizeof(std::uint32_t)
+            ? static_cast<Key>(0x09249249u)
+            : static_cast<Key>(0x1249249249249249u);
+
+    template < typename Key, typename T, std::size_t Size >
+    void morton_encode_n_kernel(const vec<T, Size>* xs, std::size_t n, Key* out) noexcept {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            out[i] = morton_encode<Key>(xs[i]);
+        }
+    }
+
+    template < typename Key, std::size_t Size >
+    void morton_decode_n_kernel(const Key* keys, std::size_t n, vec<unsigned, Size>* out) noexcept {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            out[i] = morton_decode<Size>(keys[i]);
+        }
+    }
+
+#if defined(VMATH_HPP_DISPATCH_BMI2)
+    [[nodiscard]] inline bool supports_bmi2() noexcept {
+        static const bool supported = (__builtin_cpu_init(), __builtin_cpu_supports("bmi2"));
+        return supported;
+    }
+
+    template < typename Key >
+    [[nodiscard]] VMATH_HPP_TARGET_BMI2
+    inline Key pdep(Key x, Key mask) noexcept {
+        if constexpr ( sizeof(Key) == sizeof(std::uint32_t) ) {
+            return static_cast<Key>(__builtin_ia32_pdep_si(x, mask));
+        } else {
+            return static_cast<Key>(__builtin_ia32_pdep_di(x, mask));
+        }
+    }
+
+    template < typename Key >
+    [[nodiscard]] VMATH_HPP_TARGET_BMI2
+    inline Key pext(Key x, Key mask) noexcept {
+        if constexpr ( sizeof(Key) == sizeof(std::uint32_t) ) {
+            return static_cast<Key>(__builtin_ia32_pext_si(x, mask));
+        } else {
+            return static_cast<Key>(__builtin_ia32_pext_di(x, mask));
+        }
+    }
+
+    template < typename Key, typename T, std::size_t Size >
+    VMATH_HPP_TARGET_BMI2
+    void morton_encode_n_bmi2(const vec<T, Size>* xs, std::size_t n, Key* out) noexcept {
+        // pdep deposits the low bits of every component into its interleaved positions
+        constexpr Key mask = morton_mask_v<Key, Size>;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            Key key{0};
+            for ( std::size_t j = 0; j < Size; ++j ) {
+                key |= pdep(static_cast<Key>(xs[i][j]), static_cast<Key>(mask << j));
+            }
+            out[i] = key;
+        }
+    }
+
+    template < typename Key, std::size_t Size >
+    VMATH_HPP_TARGET_BMI2
+    void morton_decode_n_bmi2(const Key* keys, std::size_t n, vec<unsigned, Size>* out) noexcept {
+        constexpr Key mask = morton_mask_v<Key, Size>;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            vec<unsigned, Size> v{no_init};
+            for ( std::size_t j = 0; j < Size; ++j ) {
+                v[j] = static_cast<unsigned>(pext(keys[i], static_cast<Key>(mask << j)));
+            }
+            out[i] = v;
+        }
+    }
+#endif
+}
+
+namespace vmath_hpp
+{
+    // morton_encode_n
+
+    template < typename Key, typename T, std::size_t Size >
+    std::enable_if_t<detail::is_morton_key_v<Key> && std::is_unsigned_v<T> && (Size == 2 || Size == 3), void>
+    morton_encode_n(const vec<T, Size>* xs, std::size_t n, Key* out) noexcept {
+        // the same keys as morton_encode, with pdep from the avx2 level on,
+        // a forced baseline level takes the portable path
+    #if defined(VMATH_HPP_DISPATCH_BMI2)
+        if ( current_simd_level() != simd_level::baseline && impl::supports_bmi2() ) {
+            return impl::morton_encode_n_bmi2(xs, n, out);
+        }
+    #endif
+        return impl::morton_encode_n_kernel(xs, n, out);
+    }
+
+    // morton_decode_n
+
+    template < typename Key, std::size_t Size >
+    std::enable_if_t<detail::is_morton_key_v<Key> && (Size == 2 || Size == 3), void>
+    morton_decode_n(const Key* keys, std::size_t n, vec<unsigned, Size>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_BMI2)
+        if ( current_simd_level() != simd_level::baseline && impl::supports_bmi2() ) {
+            return impl::morton_decode_n_bmi2(keys, n, out);
+        }
+    #endif
+        return impl::morton_decode_n_kernel(keys, n, out);
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC pop_options
+#endif
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#  define VMATH_HPP_FENV_SSE
+#  include <xmmintrin.h>
+#elif defined(__aarch64__) && (defined(__clang__) || defined(__GNUC__))
+#  define VMATH_HPP_FENV_AARCH64
+#endif
+
+//
+// Floating-point Environment
+//
+
+namespace vmath_hpp::impl
+{
+#if defined(VMATH_HPP_FENV_SSE)
+    // MXCSR: flush-to-zero (bit 15) and denormals-are-zero (bit 6)
+    inline constexpr std::uint64_t ftz_daz_bits = 0x8040;
+
+    [[nodiscard]] inline std::uint64_t read_fp_control() noexcept {
+        return _mm_getcsr();
+    }
+
+    inline void write_fp_control(std::uint64_t bits) noexcept {
+        _mm_setcsr(static_cast<unsigned>(bits));
+    }
+#elif defined(VMATH_HPP_FENV_AARCH64)
+    // FPCR: flush-to-zero (bit 24), covers both inputs and outputs
+    inline constexpr std::uint64_t ftz_daz_bits = 0x1000000;
+
+    [[nodiscard]] inline std::uint64_t read_fp_control() noexcept {
+        std::uint64_t bits{};
+        __asm__ __volatile__("mrs %0, fpcr" : "=r"(bits));
+        return bits;
+    }
+
+    inline void write_fp_control(std::uint64_t bits) noexcept {
+        __asm__ __volatile__("msr fpcr, %0" : : "r"(bits));
+    }
+#else
+    inline constexpr std::uint64_t ftz_daz_bits = 0;
+
+    [[nodiscard]] inline std::uint64_t read_fp_control() noexcept {
+        return 0;
+    }
+
+    inline void write_fp_control(std::uint64_t) noexcept {}
+#endif
+}
+
+namespace vmath_hpp
+{
+    // ftz_supported
+
+    [[nodiscard]] constexpr bool ftz_supported() noexcept {
+        return impl::ftz_daz_bits != 0;
+    }
+
+    // ftz_enabled
+
+    [[nodiscard]] inline bool ftz_enabled() noexcept {
+        return ftz_supported()
+            && (impl::read_fp_control() & impl::ftz_daz_bits) == impl::ftz_daz_bits;
+    }
+
+    // ftz_guard
+
+    class ftz_guard final {
+    public:
+        // flushes denormal inputs and results to zero on the current thread until destroyed,
+        // doesn't affect constant evaluation and code compiled for the x87 unit
+        ftz_guard() noexcept
+        : saved_{impl::read_fp_control()} {
+            impl::write_fp_control(saved_ | impl::ftz_daz_bits);
+        }
+
+        ~ftz_guard() noexcept {
+            impl::write_fp_control(saved_);
+        }
+
+        ftz_guard(const ftz_guard&) = delete;
+        ftz_guard& operator=(const ftz_guard&) = delete;
+    private:
+        std::uint64_t saved_{};
+    };
+}
+
+//
+// Primitives
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    class plane final {
+    public:
+        using self_type = plane;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+    public:
+        // the points p with dot(normal, p) == offset, the normal is unit
+        vec_type normal{zero_init};
+        T offset{0};
+    public:
+        constexpr plane() = default;
+
+        constexpr plane(const vec_type& n, T o)
+        : normal{n}
+        , offset{o} {}
+    };
+
+    template < typename T, std::size_t Size >
+    class segment final {
+    public:
+        using self_type = segment;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+    public:
+        vec_type a{zero_init};
+        vec_type b{zero_init};
+    public:
+        constexpr segment() = default;
+
+        constexpr segment(const vec_type& p, const vec_type& q)
+        : a{p}
+        , b{q} {}
+    };
+
+    template < typename T, std::size_t Size >
+    class capsule final {
+    public:
+        using self_type = capsule;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+    public:
+        // the points within radius of the segment [a, b]
+        vec_type a{zero_init};
+        vec_type b{zero_init};
+        T radius{0};
+    public:
+        constexpr capsule() = default;
+
+        constexpr capsule(const vec_type& p, const vec_type& q, T r)
+        : a{p}
+        , b{q}
+        , radius{r} {}
+    };
+
+    template < typename T, std::size_t Size >
+    class triangle final {
+    public:
+        using self_type = triangle;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+    public:
+        vec_type a{zero_init};
+        vec_type b{zero_init};
+        vec_type c{zero_init};
+    public:
+        constexpr triangle() = default;
+
+        constexpr triangle(const vec_type& p, const vec_type& q, const vec_type& r)
+        : a{p}
+        , b{q}
+        , c{r} {}
+    };
+}
+
+namespace vmath_hpp
+{
+    using fplane2 = plane<float, 2>;
+    using fplane3 = plane<float, 3>;
+    using dplane2 = plane<double, 2>;
+    using dplane3 = plane<double, 3>;
+
+    using fsegment2 = segment<float, 2>;
+    using fsegment3 = segment<float, 3>;
+    using dsegment2 = segment<double, 2>;
+    using dsegment3 = segment<double, 3>;
+
+    using fcapsule2 = capsule<float, 2>;
+    using fcapsule3 = capsule<float, 3>;
+    using dcapsule2 = capsule<double, 2>;
+    using dcapsule3 = capsule<double, 3>;
+
+    using ftriangle2 = triangle<float, 2>;
+    using ftriangle3 = triangle<float, 3>;
+    using dtriangle2 = triangle<double, 2>;
+    using dtriangle3 = triangle<double, 3>;
+}
+
+namespace vmath_hpp
+{
+    // plane_from_points
+
+    template < typename T >
+    [[nodiscard]] constexpr plane<T, 3> plane_from_points(const vec<T, 3>& a, const vec<T, 3>& b, const vec<T, 3>& c) {
+        // counter-clockwise points look at the normal
+        const vec<T, 3> n = normalize(cross(b - a, c - a));
+        return {n, dot(n, a)};
+    }
+}
+
+//
+// Closest Points
+//
+
+namespace vmath_hpp::impl
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T segment_parameter(const vec<T, Size>& a, const vec<T, Size>& b, const vec<T, Size>& p) {
+        const vec<T, Size> ab = b - a;
+        const T l2 = dot(ab, ab);
+        return l2 > T{0} ? clamp(dot(p - a, ab) / l2, T{0}, T{1}) : T{0};
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> clamp_to_sphere(const vec<T, Size>& c, T r, const vec<T, Size>& p) {
+        const vec<T, Size> d = p - c;
+        const T l2 = dot(d, d);
+        return l2 > sqr(r) ? c + d * (r * rsqrt(l2)) : p;
+    }
+}
+
+namespace vmath_hpp
+{
+    // closest_point
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const plane<T, Size>& pl, const vec<T, Size>& p) {
+        return p - pl.normal * (dot(pl.normal, p) - pl.offset);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const segment<T, Size>& s, const vec<T, Size>& p) {
+        return s.a + (s.b - s.a) * impl::segment_parameter(s.a, s.b, p);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const triangle<T, Size>& t, const vec<T, Size>& p) {
+        /// REFERENCE:
+        /// Christer Ericson, "Real-Time Collision Detection", 5.1.5
+
+        const vec<T, Size> ab = t.b - t.a;
+        const vec<T, Size> ac = t.c - t.a;
+
+        const vec<T, Size> ap = p - t.a;
+        const T d1 = dot(ab, ap);
+        const T d2 = dot(ac, ap);
+        if ( d1 <= T{0} && d2 <= T{0} ) {
+            return t.a;
+        }
+
+        const vec<T, Size> bp = p - t.b;
+        const T d3 = dot(ab, bp);
+        const T d4 = dot(ac, bp);
+        if ( d3 >= T{0} && d4 <= d3 ) {
+            return t.b;
+        }
+
+        const T vc = d1 * d4 - d3 * d2;
+        if ( vc <= T{0} && d1 >= T{0} && d3 <= T{0} ) {
+            return t.a + ab * (d1 / (d1 - d3));
+        }
+
+        const vec<T, Size> cp = p - t.c;
+        const T d5 = dot(ab, cp);
+        const T d6 = dot(ac, cp);
+        if ( d6 >= T{0} && d5 <= d6 ) {
+            return t.c;
+        }
+
+        const T vb = d5 * d2 - d1 * d6;
+        if ( vb <= T{0} && d2 >= T{0} && d6 <= T{0} ) {
+            return t.a + ac * (d2 / (d2 - d6));
+        }
+
+        const T va = d3 * d6 - d5 * d4;
+        if ( va <= T{0} && (d4 - d3) >= T{0} && (d5 - d6) >= T{0} ) {
+            return t.b + (t.c - t.b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+        }
+
+        const T denom = rcp(va + vb + vc);
+        return t.a + ab * (vb * denom) + ac * (vc * denom);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const sphere<T, Size>& s, const vec<T, Size>& p) {
+        return impl::clamp_to_sphere(s.center, s.radius, p);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const capsule<T, Size>& c, const vec<T, Size>& p) {
+        const vec<T, Size> q = c.a + (c.b - c.a) * impl::segment_parameter(c.a, c.b, p);
+        return impl::clamp_to_sphere(q, c.radius, p);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const aabb<T, Size>& b, const vec<T, Size>& p) {
+        return clamp(p, b.min, b.max);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const obb<T, Size>& b, const vec<T, Size>& p) {
+        const vec<T, Size> d = p - b.center;
+        vec<T, Size> q = b.center;
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            q += b.axes[i] * clamp(dot(d, b.axes[i]), -b.half_extents[i], b.half_extents[i]);
+        }
+        return q;
+    }
+
+    // closest_points
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr std::pair<vec<T, Size>, vec<T, Size>> closest_points(const segment<T, Size>& s1, const segment<T, Size>& s2) {
+        /// REFERENCE:
+        /// Christer Ericson, "Real-Time Collision Detection", 5.1.9
+
+        const vec<T, Size> d1 = s1.b - s1.a;
+        const vec<T, Size> d2 = s2.b - s2.a;
+        const vec<T, Size> r = s1.a - s2.a;
+
+        const T a = dot(d1, d1);
+        const T e = dot(d2, d2);
+        const T f = dot(d2, r);
+
+        T s{0};
+        T t{0};
+
+        if ( a <= T{0} && e <= T{0} ) {
+            // both segments are points
+        } else if ( a <= T{0} ) {
+            t = clamp(f / e, T{0}, T{1});
+        } else {
+            const T c = dot(d1, r);
+            if ( e <= T{0} ) {
+                s = clamp(-c / a, T{0}, T{1});
+            } else {
+                const T b = dot(d1, d2);
+                const T denom = a * e - b * b;
+
+                // parallel segments: any s works, pick the start of the first one
+                s = denom > T{0} ? clamp((b * f - c * e) / denom, T{0}, T{1}) : T{0};
+                t = (b * s + f) / e;
+
+                if ( t < T{0} ) {
+                    t = T{0};
+                    s = clamp(-c / a, T{0}, T{1});
+                } else if ( t > T{1} ) {
+                    t = T{1};
+                    s = clamp((b - c) / a, T{0}, T{1});
+                }
+            }
+        }
+
+        return {s1.a + d1 * s, s2.a + d2 * t};
+    }
+}
+
+//
+// Distances
+//
+
+namespace vmath_hpp
+{
+    // signed_distance
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T signed_distance(const plane<T, Size>& pl, const vec<T, Size>& p) {
+        return dot(pl.normal, p) - pl.offset;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T signed_distance(const sphere<T, Size>& s, const vec<T, Size>& p) {
+        return distance(s.center, p) - s.radius;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T signed_distance(const capsule<T, Size>& c, const vec<T, Size>& p) {
+        return distance(c.a + (c.b - c.a) * impl::segment_parameter(c.a, c.b, p), p) - c.radius;
+    }
+
+    // distance
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const plane<T, Size>& pl, const vec<T, Size>& p) {
+        return abs(signed_distance(pl, p));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const segment<T, Size>& s, const vec<T, Size>& p) {
+        return distance(closest_point(s, p), p);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const triangle<T, Size>& t, const vec<T, Size>& p) {
+        return distance(closest_point(t, p), p);
+    }
+
+    // zero inside the solid primitives
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const sphere<T, Size>& s, const vec<T, Size>& p) {
+        return max(signed_distance(s, p), T{0});
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const capsule<T, Size>& c, const vec<T, Size>& p) {
+        return max(signed_distance(c, p), T{0});
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const aabb<T, Size>& b, const vec<T, Size>& p) {
+        return distance(closest_point(b, p), p);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const obb<T, Size>& b, const vec<T, Size>& p) {
+        return distance(closest_point(b, p), p);
+    }
+}
+
+//
+// Overlaps
+//
+
+namespace vmath_hpp
+{
+    // overlaps
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool overlaps(const sphere<T, Size>& a, const sphere<T, Size>& b) {
+        return distance2(a.center, b.center) <= sqr(a.radius + b.radius);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool overlaps(const aabb<T, Size>& a, const aabb<T, Size>& b) {
+        return all(less_equal(a.min, b.max)) && all(less_equal(b.min, a.max));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool overlaps(const capsule<T, Size>& a, const capsule<T, Size>& b) {
+        const auto [pa, pb] = closest_points(segment<T, Size>{a.a, a.b}, segment<T, Size>{b.a, b.b});
+        return distance2(pa, pb) <= sqr(a.radius + b.radius);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr std::enable_if_t<Size == 2 || Size == 3, bool>
+    overlaps(const obb<T, Size>& a, const obb<T, Size>& b) {
+        /// REFERENCE:
+        /// Christer Ericson, "Real-Time Collision Detection", 4.4.1
+
+        // b in the frame of a, the epsilon keeps near parallel edges
+        // from producing a null cross product axis that separates anything
+        mat<T, Size> r{no_init};
+        mat<T, Size> abs_r{no_init};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            for ( std::size_t j = 0; j < Size; ++j ) {
+                r[i][j] = dot(a.axes[i], b.axes[j]);
+                abs_r[i][j] = abs(r[i][j]) + std::numeric_limits<T>::epsilon();
+            }
+        }
+
+        vec<T, Size> t{no_init};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            t[i] = dot(b.center - a.center, a.axes[i]);
+        }
+
+        const vec<T, Size>& ea = a.half_extents;
+        const vec<T, Size>& eb = b.half_extents;
+
+        // the axes of a
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            if ( abs(t[i]) > ea[i] + dot(eb, abs_r[i]) ) {
+                return false;
+            }
+        }
+
+        // the axes of b
+        for ( std::size_t j = 0; j < Size; ++j ) {
+            T ra{0};
+            T tl{0};
+            for ( std::size_t i = 0; i < Size; ++i ) {
+                ra += ea[i] * abs_r[i][j];
+                tl += t[i] * r[i][j];
+            }
+            if ( abs(tl) > ra + eb[j] ) {
+                return false;
+            }
+        }
+
+        // the cross products of the axes of a and b
+        if constexpr ( Size == 3 ) {
+            for ( std::size_t i = 0; i < 3; ++i ) {
+                const std::size_t i1 = (i + 1) % 3;
+                const std::size_t i2 = (i + 2) % 3;
+                for ( std::size_t j = 0; j < 3; ++j ) {
+                    const std::size_t j1 = (j + 1) % 3;
+                    const std::size_t j2 = (j + 2) % 3;
+                    const T ra = ea[i1] * abs_r[i2][j] + ea[i2] * abs_r[i1][j];
+                    const T rb = eb[j1] * abs_r[i][j2] + eb[j2] * abs_r[i][j1];
+                    if ( abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > ra + rb ) {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+//
+// Batch Queries
+//
+
+namespace vmath_hpp
+{
+    // overlaps
+
+    template < typename Q, typename InputIt, typename OutputIt >
+    constexpr OutputIt overlaps(const Q& query, InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = overlaps(query, *first);
+        }
+        return d_first;
+    }
+
+    // distance
+
+    template < typename InputIt, typename OutputIt, typename T, std::size_t Size >
+    constexpr OutputIt distance(const vec<T, Size>& p, InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = distance(*first, p);
+        }
+        return d_first;
+    }
+
+    // closest_point
+
+    template < typename InputIt, typename OutputIt, typename T, std::size_t Size >
+    constexpr OutputIt closest_point(const vec<T, Size>& p, InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = closest_point(*first, p);
+        }
+        return d_first;
+    }
+
+    // structure of arrays: components[c][i] is the component c of the primitive i,
+    // the loops have no branches and no gathers, so they vectorize
+
+    // signed_distance_soa
+
+    template < typename T, std::size_t Size >
+    constexpr void signed_distance_soa(
+        const vec<T, Size>& p,
+        const T* const (&normals)[Size], const T* offsets, std::size_t n,
+        T* out)
+    {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            T d = -offsets[i];
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                d += normals[c][i] * p[c];
+            }
+            out[i] = d;
+        }
+    }
+
+    // overlaps_soa
+
+    template < typename T, std::size_t Size >
+    constexpr void overlaps_soa(
+        const sphere<T, Size>& query,
+        const T* const (&centers)[Size], const T* radii, std::size_t n,
+        bool* out)
+    {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            T d2{0};
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                d2 += sqr(centers[c][i] - query.center[c]);
+            }
+            out[i] = d2 <= sqr(radii[i] + query.radius);
+        }
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr void overlaps_soa(
+        const aabb<T, Size>& query,
+        const T* const (&mins)[Size], const T* const (&maxs)[Size], std::size_t n,
+        bool* out)
+    {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            bool o = true;
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                o = o & (mins[c][i] <= query.max[c]) & (query.min[c] <= maxs[c][i]);
+            }
+            out[i] = o;
+        }
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr void overlaps_soa(
+        const capsule<T, Size>& query,
+        const T* const (&as)[Size], const T* const (&bs)[Size], const T* radii, std::size_t n,
+        bool* out)
+    {
+        // closest_points of the segments in blocks of lanes, the branches are turned
+        // into selects and every lane computes all the cases, the same operations as overlaps
+        const vec<T, Size> d1v = query.b - query.a;
+        const T a = dot(d1v, d1v);
+        const T a_safe = a > T{0} ? a : T{1};
+
+        // plain arrays, the switch of vec<T, 3>::operator[] isn't hoisted out of the loops
+        T p1[Size];
+        T d1[Size];
+        for ( std::size_t c = 0; c < Size; ++c ) {
+            p1[c] = query.a[c];
+            d1[c] = d1v[c];
+        }
+
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T d2[Size][lanes];
+            T r[Size][lanes];
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                for ( std::size_t l = 0; l < w; ++l ) {
+                    d2[c][l] = bs[c][i + l] - as[c][i + l];
+                    r[c][l] = p1[c] - as[c][i + l];
+                }
+            }
+
+            T e[lanes];
+            T f[lanes];
+            T b[lanes];
+            T cc[lanes];
+            for ( std::size_t l = 0; l < w; ++l ) {
+                e[l] = d2[0][l] * d2[0][l];
+                f[l] = d2[0][l] * r[0][l];
+                b[l] = d1[0] * d2[0][l];
+                cc[l] = d1[0] * r[0][l];
+            }
+            for ( std::size_t c = 1; c < Size; ++c ) {
+                for ( std::size_t l = 0; l < w; ++l ) {
+                    e[l] += d2[c][l] * d2[c][l];
+                    f[l] += d2[c][l] * r[c][l];
+                    b[l] += d1[c] * d2[c][l];
+                    cc[l] += d1[c] * r[c][l];
+                }
+            }
+
+            T ss[lanes];
+            T ts[lanes];
+            for ( std::size_t l = 0; l < w; ++l ) {
+                // the divisors of the cases a lane doesn't select are replaced by ones
+                const bool e_positive = e[l] > T{0};
+                const T e_safe = e_positive ? e[l] : T{1};
+                const T denom = a * e[l] - b[l] * b[l];
+                const T denom_safe = denom > T{0} ? denom : T{1};
+
+                // all the comparisons are made unconditionally, a conditional
+                // one is a branch, it may raise an exception on a nan
+                const T q0 = clamp((b[l] * f[l] - cc[l] * e[l]) / denom_safe, T{0}, T{1});
+                const T s0 = denom > T{0} ? q0 : T{0};
+                const T t0 = (b[l] * s0 + f[l]) / e_safe;
+                const T s_lo = clamp(-cc[l] / a_safe, T{0}, T{1});
+                const T s_hi = clamp((b[l] - cc[l]) / a_safe, T{0}, T{1});
+                const T t_a = clamp(f[l] / e_safe, T{0}, T{1});
+                const bool t_below = t0 < T{0};
+                const bool t_above = t0 > T{1};
+
+                T s = t_below ? s_lo : (t_above ? s_hi : s0);
+                T t = t_below ? T{0} : (t_above ? T{1} : t0);
+
+                // one of the segments is a point
+                s = e_positive ? s : s_lo;
+                t = e_positive ? t : T{0};
+                ss[l] = a > T{0} ? s : T{0};
+                ts[l] = a > T{0} ? t : (e_positive ? t_a : T{0});
+            }
+
+            T dist2[lanes];
+            for ( std::size_t l = 0; l < w; ++l ) {
+                const T d = p1[0] + d1[0] * ss[l] - (as[0][i + l] + d2[0][l] * ts[l]);
+                dist2[l] = d * d;
+            }
+            for ( std::size_t c = 1; c < Size; ++c ) {
+                for ( std::size_t l = 0; l < w; ++l ) {
+                    const T d = p1[c] + d1[c] * ss[l] - (as[c][i + l] + d2[c][l] * ts[l]);
+                    dist2[l] += d * d;
+                }
+            }
+
+            for ( std::size_t l = 0; l < w; ++l ) {
+                out[i + l] = dist2[l] <= sqr(query.radius + radii[i + l]);
+            }
+        }
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr std::enable_if_t<Size == 2 || Size == 3, void> overlaps_soa(
+        const obb<T, Size>& query,
+        const T* const (&centers)[Size], const T* const (&axes)[Size][Size], const T* const (&half_extents)[Size], std::size_t n,
+        bool* out)
+    {
+        // axes[r][c][i] is the component c of the axis r of the box i, the separating
+        // axes are tested in blocks of lanes without an early exit, the same operations as overlaps
+
+        // plain arrays, the switch of vec<T, 3>::operator[] isn't hoisted out of the loops
+        T aa[Size][Size];
+        T ea[Size];
+        T ca[Size];
+        for ( std::size_t k = 0; k < Size; ++k ) {
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                aa[k][c] = query.axes[k][c];
+            }
+            ea[k] = query.half_extents[k];
+            ca[k] = query.center[k];
+        }
+
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            // the box in the frame of the query
+            T r[Size][Size][lanes];
+            T abs_r[Size][Size][lanes];
+            for ( std::size_t k = 0; k < Size; ++k ) {
+                for ( std::size_t j = 0; j < Size; ++j ) {
+                    for ( std::size_t l = 0; l < w; ++l ) {
+                        T d = aa[k][0] * axes[j][0][i + l];
+                        for ( std::size_t c = 1; c < Size; ++c ) {
+                            d += aa[k][c] * axes[j][c][i + l];
+                        }
+                        r[k][j][l] = d;
+                        abs_r[k][j][l] = abs(d) + std::numeric_limits<T>::epsilon();
+                    }
+                }
+            }
+
+            T t[Size][lanes];
+            for ( std::size_t k = 0; k < Size; ++k ) {
+                for ( std::size_t l = 0; l < w; ++l ) {
+                    T d = (centers[0][i + l] - ca[0]) * aa[k][0];
+                    for ( std::size_t c = 1; c < Size; ++c ) {
+                        d += (centers[c][i + l] - ca[c]) * aa[k][c];
+                    }
+                    t[k][l] = d;
+                }
+            }
+
+            // ints, loops over bools aren't vectorized
+            int o[lanes];
+            for ( std::size_t l = 0; l < w; ++l ) {
+                o[l] = 1;
+            }
+
+            // the axes of the query
+            for ( std::size_t k = 0; k < Size; ++k ) {
+                for ( std::size_t l = 0; l < w; ++l ) {
+                    T rb = half_extents[0][i + l] * abs_r[k][0][l];
+                    for ( std::size_t j = 1; j < Size; ++j ) {
+                        rb += half_extents[j][i + l] * abs_r[k][j][l];
+                    }
+                    o[l] = o[l] & !(abs(t[k][l]) > ea[k] + rb);
+                }
+            }
+
+            // the axes of the box
+            for ( std::size_t j = 0; j < Size; ++j ) {
+                for ( std::size_t l = 0; l < w; ++l ) {
+                    T ra{0};
+                    T tl{0};
+                    for ( std::size_t k = 0; k < Size; ++k ) {
+                        ra += ea[k] * abs_r[k][j][l];
+                        tl += t[k][l] * r[k][j][l];
+                    }
+                    o[l] = o[l] & !(abs(tl) > ra + half_extents[j][i + l]);
+                }
+            }
+
+            // the cross products of the axes
+            if constexpr ( Size == 3 ) {
+                for ( std::size_t k = 0; k < 3; ++k ) {
+                    const std::size_t k1 = (k + 1) % 3;
+                    const std::size_t k2 = (k + 2) % 3;
+                    for ( std::size_t j = 0; j < 3; ++j ) {
+                        const std::size_t j1 = (j + 1) % 3;
+                        const std::size_t j2 = (j + 2) % 3;
+                        for ( std::size_t l = 0; l < w; ++l ) {
+                            const T ra = ea[k1] * abs_r[k2][j][l] + ea[k2] * abs_r[k1][j][l];
+                            const T rb = half_extents[j1][i + l] * abs_r[k][j2][l] + half_extents[j2][i + l] * abs_r[k][j1][l];
+                            o[l] = o[l] & !(abs(t[k2][l] * r[k1][j][l] - t[k1][l] * r[k2][j][l]) > ra + rb);
+                        }
+                    }
+                }
+            }
+
+            for ( std::size_t l = 0; l < w; ++l ) {
+                out[i + l] = o[l] != 0;
+            }
+        }
+    }
+}
+
+//
+// Hash
+//
+
+namespace vmath_hpp::detail
+{
+    struct hash_combiner {
+        template < typename T >
+        [[nodiscard]] std::size_t operator()(std::size_t seed, const T& x) const noexcept {
+            return (seed ^= std::hash<T>{}(x) + 0x9e3779b9 + (seed << 6) + ( seed >> 2));
+        }
+    };
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] std::size_t hash(const vec<T, Size>& v) noexcept {
+        return fold_join(hash_combiner{}, std::size_t{}, v);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] std::size_t hash(const mat<T, Rows, Cols>& m) noexcept {
+        return fold_join(hash_combiner{}, std::size_t{}, m);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::size_t hash(const qua<T>& q) noexcept {
+        return fold_join(hash_combiner{}, std::size_t{}, q);
+    }
+}
+
+namespace std
+{
+    template < typename T, size_t Size >
+    struct hash<vmath_hpp::vec<T, Size>> {
+        size_t operator()(const vmath_hpp::vec<T, Size>& v) const noexcept {
+            return vmath_hpp::detail::hash(v);
+        }
+    };
+
+    template < typename T, size_t Rows, size_t Cols >
+    struct hash<vmath_hpp::mat<T, Rows, Cols>> {
+        size_t operator()(const vmath_hpp::mat<T, Rows, Cols>& m) const noexcept {
+            return vmath_hpp::detail::hash(m);
+        }
+    };
+
+    template < typename T >
+    struct hash<vmath_hpp::qua<T>> {
+        size_t operator()(const vmath_hpp::qua<T>& q) const noexcept {
+            return vmath_hpp::detail::hash(q);
+        }
+    };
+}
+
+//
+// Random Engines
+//
+
+namespace vmath_hpp
+{
+    class philox4x32 final {
+    public:
+        using result_type = std::uint32_t;
+        using block_type = vec<std::uint32_t, 4>;
+        using key_type = vec<std::uint32_t, 2>;
+    public:
+        constexpr philox4x32() = default;
+
+        constexpr explicit philox4x32(std::uint64_t seed, std::uint64_t stream = 0)
+        : key_{
+            static_cast<std::uint32_t>(seed),
+            static_cast<std::uint32_t>(seed >> 32)}
+        , counter_{
+            0u,
+            0u,
+            static_cast<std::uint32_t>(stream),
+            static_cast<std::uint32_t>(stream >> 32)} {}
+
+        [[nodiscard]] static constexpr result_type min() noexcept {
+            return std::numeric_limits<result_type>::min();
+        }
+
+        [[nodiscard]] static constexpr result_type max() noexcept {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        [[nodiscard]] constexpr result_type operator()() noexcept {
+            if ( index_ == block_type::size ) {
+                block_ = next_block();
+                index_ = 0;
+            }
+            return block_[index_++];
+        }
+
+        [[nodiscard]] constexpr block_type next_block() noexcept {
+            const block_type block = generate(counter_, key_);
+            counter_.x += 1u;
+            counter_.y += counter_.x == 0u ? 1u : 0u;
+            return block;
+        }
+
+        constexpr void discard(unsigned long long z) noexcept {
+            for ( ; z > 0; --z ) {
+                (void)(*this)();
+            }
+        }
+
+        [[nodiscard]] static constexpr block_type generate(block_type counter, key_type key) noexcept {
+            /// REFERENCE:
+            /// https://www.thesalmons.org/john/random123/papers/random123sc11.pdf
+
+            for ( unsigned round = 0; round < 10; ++round ) {
+                if ( round > 0 ) {
+                    key.x += 0x9E3779B9u;
+                    key.y += 0xBB67AE85u;
+                }
+
+                const std::uint64_t p0 = std::uint64_t{0xD2511F53u} * counter.x;
+                const std::uint64_t p1 = std::uint64_t{0xCD9E8D57u} * counter.z;
+
+                counter = {
+                    static_cast<std::uint32_t>(p1 >> 32) ^ counter.y ^ key.x,
+                    static_cast<std::uint32_t>(p1),
+                    static_cast<std::uint32_t>(p0 >> 32) ^ counter.w ^ key.y,
+                    static_cast<std::uint32_t>(p0)};
+            }
+
+            return counter;
+        }
+    private:
+        key_type key_{zero_init};
+        block_type counter_{zero_init};
+        block_type block_{zero_init};
+        std::size_t index_{block_type::size};
+    };
+}
+
+//
+// Random Distributions
+//
+
+namespace vmath_hpp::detail
+{
+    template < typename T, typename G >
+    [[nodiscard]] constexpr T random_canonical(G& g) {
+        static_assert(
+            G::min() == 0u && G::max() == 0xFFFFFFFFu,
+            "random generator must produce 32 random bits");
+
+        if constexpr ( std::is_same_v<T, float> ) {
+            const auto bits = static_cast<std::uint32_t>(g()) >> 8;
+            return static_cast<T>(bits) * T{0x1.0p-24f};
+        } else {
+            const auto hi = static_cast<std::uint64_t>(g()) >> 5;
+            const auto lo = static_cast<std::uint64_t>(g()) >> 6;
+            return static_cast<T>((hi << 26) | lo) * T{0x1.0p-53};
+        }
+    }
+
+    template < typename T >
+    inline constexpr T random_two_pi = T(6.283185307179586476925286766559);
+
+    // the samples from canonical numbers, shared by the single and the batch versions
+
+    template < typename T >
+    [[nodiscard]] constexpr vec<T, 2> random_on_circle_from(T u0) {
+        const auto [s, c] = sincos(u0 * random_two_pi<T>);
+        return {c, s};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr vec<T, 3> random_on_sphere_from(T u0, T u1) {
+        /// REFERENCE:
+        /// https://mathworld.wolfram.com/SpherePointPicking.html
+
+        const T z = u0 * T{2} - T{1};
+        const T r = sqrt(max(T{0}, T{1} - sqr(z)));
+        const auto [s, c] = sincos(u1 * random_two_pi<T>);
+        return {r * c, r * s, z};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> random_rotation_from(T u0, T u1, T u2) {
+        /// REFERENCE:
+        /// Ken Shoemake, "Uniform random rotations", Graphics Gems III
+
+        const T r0 = sqrt(T{1} - u0);
+        const T r1 = sqrt(u0);
+
+        const auto [s0, c0] = sincos(u1 * random_two_pi<T>);
+        const auto [s1, c1] = sincos(u2 * random_two_pi<T>);
+
+        return {r0 * s0, r0 * c0, r1 * s1, r1 * c1};
+    }
+
+    template < typename T, std::size_t N >
+    constexpr void random_canonical_blocks(philox4x32& g, T (&us)[N]) {
+        // whole engine blocks in the order operator() returns their numbers,
+        // so the samples are the ones of the single versions from a block boundary
+        if constexpr ( std::is_same_v<T, float> ) {
+            static_assert(N % 4 == 0);
+            for ( std::size_t i = 0; i < N; i += 4 ) {
+                const philox4x32::block_type b = g.next_block();
+                for ( std::size_t j = 0; j < 4; ++j ) {
+                    us[i + j] = static_cast<T>(b[j] >> 8) * T{0x1.0p-24f};
+                }
+            }
+        } else {
+            static_assert(N % 2 == 0);
+            for ( std::size_t i = 0; i < N; i += 2 ) {
+                const philox4x32::block_type b = g.next_block();
+                for ( std::size_t j = 0; j < 2; ++j ) {
+                    const auto hi = static_cast<std::uint64_t>(b[j * 2 + 0]) >> 5;
+                    const auto lo = static_cast<std::uint64_t>(b[j * 2 + 1]) >> 6;
+                    us[i + j] = static_cast<T>((hi << 26) | lo) * T{0x1.0p-53};
+                }
+            }
+        }
+    }
+
+    template < typename T, std::size_t Count, typename G, typename ForwardIt, typename F >
+    constexpr void random_fill(G& g, ForwardIt first, ForwardIt last, F&& f) {
+        // f makes one sample from Count canonical numbers, philox4x32 gives them
+        // for 16 samples at once, other generators one number at a time
+        if constexpr ( std::is_same_v<G, philox4x32> ) {
+            constexpr std::size_t lanes = 16;
+            while ( first != last ) {
+                T us[Count * lanes]{};
+                random_canonical_blocks(g, us);
+                for ( std::size_t j = 0; j < lanes && first != last; ++j, ++first ) {
+                    *first = f(us + j * Count);
+                }
+            }
+        } else {
+            for ( ; first != last; ++first ) {
+                T us[Count]{};
+                for ( std::size_t i = 0; i < Count; ++i ) {
+                    us[i] = random_canonical<T>(g);
+                }
+                *first = f(us);
+            }
+        }
+    }
+
+    template < typename ForwardIt >
+    using random_value_t = typename std::iterator_traits<ForwardIt>::value_type;
+}
+
+namespace vmath_hpp
+{
+    // random_uniform
+
+    template < typename T, typename G >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr random_uniform(G& g) {
+        return detail::random_canonical<T>(g);
+    }
+
+    template < typename T, typename G >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr random_uniform(G& g, T min_x, T max_x) {
+        return lerp(min_x, max_x, random_uniform<T>(g));
+    }
+
+    template < typename T, std::size_t Size, typename G >
+    [[nodiscard]] constexpr vec<T, Size> random_uniform(G& g, const vec<T, Size>& min_xs, const vec<T, Size>& max_xs) {
+        vec<T, Size> as{no_init};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            as[i] = random_uniform<T>(g);
+        }
+        return lerp(min_xs, max_xs, as);
+    }
+
+    // random_on_circle
+
+    template < typename T, typename G >
+    [[nodiscard]] constexpr vec<T, 2> random_on_circle(G& g) {
+        return detail::random_on_circle_from(random_uniform<T>(g));
+    }
+
+    // random_in_disk
+
+    template < typename T, typename G >
+    [[nodiscard]] constexpr vec<T, 2> random_in_disk(G& g) {
+        const vec<T, 2> p = random_on_circle<T>(g);
+        return p * sqrt(random_uniform<T>(g));
+    }
+
+    // random_on_sphere
+
+    template < typename T, typename G >
+    [[nodiscard]] constexpr vec<T, 3> random_on_sphere(G& g) {
+        const T u0 = random_uniform<T>(g);
+        const T u1 = random_uniform<T>(g);
+        return detail::random_on_sphere_from(u0, u1);
+    }
+
+    // random_in_sphere
+
+    template < typename T, typename G >
+    [[nodiscard]] constexpr vec<T, 3> random_in_sphere(G& g) {
+        const vec<T, 3> p = random_on_sphere<T>(g);
+        return p * pow(random_uniform<T>(g), T{1} / T{3});
+    }
+
+    // random_on_hemisphere
+
+    template < typename T, typename G >
+    [[nodiscard]] constexpr vec<T, 3> random_on_hemisphere(G& g, const vec<T, 3>& normal) {
+        const vec<T, 3> p = random_on_sphere<T>(g);
+        return dot(p, normal) < T{0} ? -p : p;
+    }
+
+    // random_rotation
+
+    template < typename T, typename G >
+    [[nodiscard]] constexpr qua<T> random_rotation(G& g) {
+        const T u0 = random_uniform<T>(g);
+        const T u1 = random_uniform<T>(g);
+        const T u2 = random_uniform<T>(g);
+        return detail::random_rotation_from(u0, u1, u2);
+    }
+}
+
+//
+// Batch Random Distributions
+//
+
+namespace vmath_hpp
+{
+    // with philox4x32 the numbers are taken from whole blocks of next_block(), 16 samples at
+    // a time: the samples are the ones of the single versions when the engine is at a block
+    // boundary, the numbers left in the last blocks and in the buffer of operator() are skipped
+
+    // random_uniform
+
+    template < typename ForwardIt, typename G
+             , typename V = detail::random_value_t<ForwardIt> >
+    constexpr void random_uniform(G& g, ForwardIt first, ForwardIt last, const V& min_x, const V& max_x) {
+        if constexpr ( std::is_floating_point_v<V> ) {
+            detail::random_fill<V, 1>(g, first, last, [&min_x, &max_x](const V* us){
+                return lerp(min_x, max_x, us[0]);
+            });
+        } else {
+            using T = typename V::component_type;
+            detail::random_fill<T, V::size>(g, first, last, [&min_x, &max_x](const T* us){
+                V as{no_init};
+                for ( std::size_t i = 0; i < V::size; ++i ) {
+                    as[i] = us[i];
+                }
+                return lerp(min_x, max_x, as);
+            });
+        }
+    }
+
+    // random_on_circle
+
+    template < typename ForwardIt, typename G
+             , typename V = detail::random_value_t<ForwardIt> >
+    constexpr void random_on_circle(G& g, ForwardIt first, ForwardIt last) {
+        using T = typename V::component_type;
+        detail::random_fill<T, 1>(g, first, last, [](const T* us){
+            return detail::random_on_circle_from(us[0]);
+        });
+    }
+
+    // random_in_disk
+
+    template < typename ForwardIt, typename G
+             , typename V = detail::random_value_t<ForwardIt> >
+    constexpr void random_in_disk(G& g, ForwardIt first, ForwardIt last) {
+        using T = typename V::component_type;
+        detail::random_fill<T, 2>(g, first, last, [](const T* us){
+            return detail::random_on_circle_from(us[0]) * sqrt(us[1]);
+        });
+    }
+
+    // random_on_sphere
+
+    template < typename ForwardIt, typename G
+             , typename V = detail::random_value_t<ForwardIt> >
+    constexpr void random_on_sphere(G& g, ForwardIt first, ForwardIt last) {
+        using T = typename V::component_type;
+        detail::random_fill<T, 2>(g, first, last, [](const T* us){
+            return detail::random_on_sphere_from(us[0], us[1]);
+        });
+    }
+
+    // random_in_sphere
+
+    template < typename ForwardIt, typename G
+             , typename V = detail::random_value_t<ForwardIt> >
+    constexpr void random_in_sphere(G& g, ForwardIt first, ForwardIt last) {
+        using T = typename V::component_type;
+        detail::random_fill<T, 3>(g, first, last, [](const T* us){
+            return detail::random_on_sphere_from(us[0], us[1]) * pow(us[2], T{1} / T{3});
+        });
+    }
+
+    // random_on_hemisphere
+
+    template < typename ForwardIt, typename G
+             , typename V = detail::random_value_t<ForwardIt> >
+    constexpr void random_on_hemisphere(G& g, ForwardIt first, ForwardIt last, const V& normal) {
+        using T = typename V::component_type;
+        detail::random_fill<T, 2>(g, first, last, [&normal](const T* us){
+            const V p = detail::random_on_sphere_from(us[0], us[1]);
+            return dot(p, normal) < T{0} ? -p : p;
+        });
+    }
+
+    // random_rotation
+
+    template < typename ForwardIt, typename G
+             , typename Q = detail::random_value_t<ForwardIt> >
+    constexpr void random_rotation(G& g, ForwardIt first, ForwardIt last) {
+        using T = typename Q::component_type;
+        detail::random_fill<T, 3>(g, first, last, [](const T* us){
+            return detail::random_rotation_from(us[0], us[1], us[2]);
+        });
+    }
+}
+
+// generated by develop/scripts/gen_swizzles.py, do not edit
+
+//
+// Named Swizzles
+//
+
+namespace vmath_hpp::swizzles
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> xx(const vec<T, Size>& xs) { return swizzle<0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> xy(const vec<T, Size>& xs) { return swizzle<0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> xz(const vec<T, Size>& xs) { return swizzle<0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> xw(const vec<T, Size>& xs) { return swizzle<0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> yx(const vec<T, Size>& xs) { return swizzle<1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> yy(const vec<T, Size>& xs) { return swizzle<1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> yz(const vec<T, Size>& xs) { return swizzle<1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> yw(const vec<T, Size>& xs) { return swizzle<1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> zx(const vec<T, Size>& xs) { return swizzle<2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> zy(const vec<T, Size>& xs) { return swizzle<2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> zz(const vec<T, Size>& xs) { return swizzle<2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> zw(const vec<T, Size>& xs) { return swizzle<2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> wx(const vec<T, Size>& xs) { return swizzle<3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> wy(const vec<T, Size>& xs) { return swizzle<3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> wz(const vec<T, Size>& xs) { return swizzle<3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> ww(const vec<T, Size>& xs) { return swizzle<3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xxx(const vec<T, Size>& xs) { return swizzle<0, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xxy(const vec<T, Size>& xs) { return swizzle<0, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xxz(const vec<T, Size>& xs) { return swizzle<0, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xxw(const vec<T, Size>& xs) { return swizzle<0, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xyx(const vec<T, Size>& xs) { return swizzle<0, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xyy(const vec<T, Size>& xs) { return swizzle<0, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xyz(const vec<T, Size>& xs) { return swizzle<0, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xyw(const vec<T, Size>& xs) { return swizzle<0, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xzx(const vec<T, Size>& xs) { return swizzle<0, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xzy(const vec<T, Size>& xs) { return swizzle<0, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xzz(const vec<T, Size>& xs) { return swizzle<0, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xzw(const vec<T, Size>& xs) { return swizzle<0, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xwx(const vec<T, Size>& xs) { return swizzle<0, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xwy(const vec<T, Size>& xs) { return swizzle<0, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xwz(const vec<T, Size>& xs) { return swizzle<0, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xww(const vec<T, Size>& xs) { return swizzle<0, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yxx(const vec<T, Size>& xs) { return swizzle<1, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yxy(const vec<T, Size>& xs) { return swizzle<1, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yxz(const vec<T, Size>& xs) { return swizzle<1, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yxw(const vec<T, Size>& xs) { return swizzle<1, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yyx(const vec<T, Size>& xs) { return swizzle<1, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yyy(const vec<T, Size>& xs) { return swizzle<1, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yyz(const vec<T, Size>& xs) { return swizzle<1, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yyw(const vec<T, Size>& xs) { return swizzle<1, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yzx(const vec<T, Size>& xs) { return swizzle<1, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yzy(const vec<T, Size>& xs) { return swizzle<1, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yzz(const vec<T, Size>& xs) { return swizzle<1, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yzw(const vec<T, Size>& xs) { return swizzle<1, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> ywx(const vec<T, Size>& xs) { return swizzle<1, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> ywy(const vec<T, Size>& xs) { return swizzle<1, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> ywz(const vec<T, Size>& xs) { return swizzle<1, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yww(const vec<T, Size>& xs) { return swizzle<1, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zxx(const vec<T, Size>& xs) { return swizzle<2, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zxy(const vec<T, Size>& xs) { return swizzle<2, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zxz(const vec<T, Size>& xs) { return swizzle<2, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zxw(const vec<T, Size>& xs) { return swizzle<2, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zyx(const vec<T, Size>& xs) { return swizzle<2, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zyy(const vec<T, Size>& xs) { return swizzle<2, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zyz(const vec<T, Size>& xs) { return swizzle<2, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zyw(const vec<T, Size>& xs) { return swizzle<2, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zzx(const vec<T, Size>& xs) { return swizzle<2, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zzy(const vec<T, Size>& xs) { return swizzle<2, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zzz(const vec<T, Size>& xs) { return swizzle<2, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zzw(const vec<T, Size>& xs) { return swizzle<2, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zwx(const vec<T, Size>& xs) { return swizzle<2, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zwy(const vec<T, Size>& xs) { return swizzle<2, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zwz(const vec<T, Size>& xs) { return swizzle<2, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zww(const vec<T, Size>& xs) { return swizzle<2, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wxx(const vec<T, Size>& xs) { return swizzle<3, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wxy(const vec<T, Size>& xs) { return swizzle<3, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wxz(const vec<T, Size>& xs) { return swizzle<3, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wxw(const vec<T, Size>& xs) { return swizzle<3, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wyx(const vec<T, Size>& xs) { return swizzle<3, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wyy(const vec<T, Size>& xs) { return swizzle<3, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wyz(const vec<T, Size>& xs) { return swizzle<3, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wyw(const vec<T, Size>& xs) { return swizzle<3, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wzx(const vec<T, Size>& xs) { return swizzle<3, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wzy(const vec<T, Size>& xs) { return swizzle<3, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wzz(const vec<T, Size>& xs) { return swizzle<3, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wzw(const vec<T, Size>& xs) { return swizzle<3, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wwx(const vec<T, Size>& xs) { return swizzle<3, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wwy(const vec<T, Size>& xs) { return swizzle<3, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wwz(const vec<T, Size>& xs) { return swizzle<3, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> www(const vec<T, Size>& xs) { return swizzle<3, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxxx(const vec<T, Size>& xs) { return swizzle<0, 0, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxxy(const vec<T, Size>& xs) { return swizzle<0, 0, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxxz(const vec<T, Size>& xs) { return swizzle<0, 0, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxxw(const vec<T, Size>& xs) { return swizzle<0, 0, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxyx(const vec<T, Size>& xs) { return swizzle<0, 0, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxyy(const vec<T, Size>& xs) { return swizzle<0, 0, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxyz(const vec<T, Size>& xs) { return swizzle<0, 0, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxyw(const vec<T, Size>& xs) { return swizzle<0, 0, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxzx(const vec<T, Size>& xs) { return swizzle<0, 0, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxzy(const vec<T, Size>& xs) { return swizzle<0, 0, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxzz(const vec<T, Size>& xs) { return swizzle<0, 0, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxzw(const vec<T, Size>& xs) { return swizzle<0, 0, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxwx(const vec<T, Size>& xs) { return swizzle<0, 0, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxwy(const vec<T, Size>& xs) { return swizzle<0, 0, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxwz(const vec<T, Size>& xs) { return swizzle<0, 0, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxww(const vec<T, Size>& xs) { return swizzle<0, 0, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyxx(const vec<T, Size>& xs) { return swizzle<0, 1, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyxy(const vec<T, Size>& xs) { return swizzle<0, 1, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyxz(const vec<T, Size>& xs) { return swizzle<0, 1, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyxw(const vec<T, Size>& xs) { return swizzle<0, 1, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyyx(const vec<T, Size>& xs) { return swizzle<0, 1, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyyy(const vec<T, Size>& xs) { return swizzle<0, 1, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyyz(const vec<T, Size>& xs) { return swizzle<0, 1, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyyw(const vec<T, Size>& xs) { return swizzle<0, 1, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyzx(const vec<T, Size>& xs) { return swizzle<0, 1, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyzy(const vec<T, Size>& xs) { return swizzle<0, 1, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyzz(const vec<T, Size>& xs) { return swizzle<0, 1, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyzw(const vec<T, Size>& xs) { return swizzle<0, 1, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xywx(const vec<T, Size>& xs) { return swizzle<0, 1, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xywy(const vec<T, Size>& xs) { return swizzle<0, 1, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xywz(const vec<T, Size>& xs) { return swizzle<0, 1, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyww(const vec<T, Size>& xs) { return swizzle<0, 1, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzxx(const vec<T, Size>& xs) { return swizzle<0, 2, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzxy(const vec<T, Size>& xs) { return swizzle<0, 2, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzxz(const vec<T, Size>& xs) { return swizzle<0, 2, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzxw(const vec<T, Size>& xs) { return swizzle<0, 2, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzyx(const vec<T, Size>& xs) { return swizzle<0, 2, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzyy(const vec<T, Size>& xs) { return swizzle<0, 2, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzyz(const vec<T, Size>& xs) { return swizzle<0, 2, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzyw(const vec<T, Size>& xs) { return swizzle<0, 2, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzzx(const vec<T, Size>& xs) { return swizzle<0, 2, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzzy(const vec<T, Size>& xs) { return swizzle<0, 2, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzzz(const vec<T, Size>& xs) { return swizzle<0, 2, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzzw(const vec<T, Size>& xs) { return swizzle<0, 2, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzwx(const vec<T, Size>& xs) { return swizzle<0, 2, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzwy(const vec<T, Size>& xs) { return swizzle<0, 2, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzwz(const vec<T, Size>& xs) { return swizzle<0, 2, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzww(const vec<T, Size>& xs) { return swizzle<0, 2, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwxx(const vec<T, Size>& xs) { return swizzle<0, 3, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwxy(const vec<T, Size>& xs) { return swizzle<0, 3, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwxz(const vec<T, Size>& xs) { return swizzle<0, 3, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwxw(const vec<T, Size>& xs) { return swizzle<0, 3, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwyx(const vec<T, Size>& xs) { return swizzle<0, 3, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwyy(const vec<T, Size>& xs) { return swizzle<0, 3, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwyz(const vec<T, Size>& xs) { return swizzle<0, 3, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwyw(const vec<T, Size>& xs) { return swizzle<0, 3, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwzx(const vec<T, Size>& xs) { return swizzle<0, 3, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwzy(const vec<T, Size>& xs) { return swizzle<0, 3, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwzz(const vec<T, Size>& xs) { return swizzle<0, 3, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwzw(const vec<T, Size>& xs) { return swizzle<0, 3, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwwx(const vec<T, Size>& xs) { return swizzle<0, 3, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwwy(const vec<T, Size>& xs) { return swizzle<0, 3, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwwz(const vec<T, Size>& xs) { return swizzle<0, 3, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwww(const vec<T, Size>& xs) { return swizzle<0, 3, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxxx(const vec<T, Size>& xs) { return swizzle<1, 0, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxxy(const vec<T, Size>& xs) { return swizzle<1, 0, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxxz(const vec<T, Size>& xs) { return swizzle<1, 0, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxxw(const vec<T, Size>& xs) { return swizzle<1, 0, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxyx(const vec<T, Size>& xs) { return swizzle<1, 0, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxyy(const vec<T, Size>& xs) { return swizzle<1, 0, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxyz(const vec<T, Size>& xs) { return swizzle<1, 0, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxyw(const vec<T, Size>& xs) { return swizzle<1, 0, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxzx(const vec<T, Size>& xs) { return swizzle<1, 0, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxzy(const vec<T, Size>& xs) { return swizzle<1, 0, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxzz(const vec<T, Size>& xs) { return swizzle<1, 0, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxzw(const vec<T, Size>& xs) { return swizzle<1, 0, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxwx(const vec<T, Size>& xs) { return swizzle<1, 0, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxwy(const vec<T, Size>& xs) { return swizzle<1, 0, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxwz(const vec<T, Size>& xs) { return swizzle<1, 0, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxww(const vec<T, Size>& xs) { return swizzle<1, 0, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyxx(const vec<T, Size>& xs) { return swizzle<1, 1, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyxy(const vec<T, Size>& xs) { return swizzle<1, 1, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyxz(const vec<T, Size>& xs) { return swizzle<1, 1, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyxw(const vec<T, Size>& xs) { return swizzle<1, 1, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyyx(const vec<T, Size>& xs) { return swizzle<1, 1, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyyy(const vec<T, Size>& xs) { return swizzle<1, 1, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyyz(const vec<T, Size>& xs) { return swizzle<1, 1, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyyw(const vec<T, Size>& xs) { return swizzle<1, 1, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyzx(const vec<T, Size>& xs) { return swizzle<1, 1, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyzy(const vec<T, Size>& xs) { return swizzle<1, 1, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyzz(const vec<T, Size>& xs) { return swizzle<1, 1, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyzw(const vec<T, Size>& xs) { return swizzle<1, 1, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yywx(const vec<T, Size>& xs) { return swizzle<1, 1, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yywy(const vec<T, Size>& xs) { return swizzle<1, 1, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yywz(const vec<T, Size>& xs) { return swizzle<1, 1, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyww(const vec<T, Size>& xs) { return swizzle<1, 1, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzxx(const vec<T, Size>& xs) { return swizzle<1, 2, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzxy(const vec<T, Size>& xs) { return swizzle<1, 2, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzxz(const vec<T, Size>& xs) { return swizzle<1, 2, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzxw(const vec<T, Size>& xs) { return swizzle<1, 2, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzyx(const vec<T, Size>& xs) { return swizzle<1, 2, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzyy(const vec<T, Size>& xs) { return swizzle<1, 2, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzyz(const vec<T, Size>& xs) { return swizzle<1, 2, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzyw(const vec<T, Size>& xs) { return swizzle<1, 2, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzzx(const vec<T, Size>& xs) { return swizzle<1, 2, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzzy(const vec<T, Size>& xs) { return swizzle<1, 2, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzzz(const vec<T, Size>& xs) { return swizzle<1, 2, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzzw(const vec<T, Size>& xs) { return swizzle<1, 2, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzwx(const vec<T, Size>& xs) { return swizzle<1, 2, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzwy(const vec<T, Size>& xs) { return swizzle<1, 2, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzwz(const vec<T, Size>& xs) { return swizzle<1, 2, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzww(const vec<T, Size>& xs) { return swizzle<1, 2, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywxx(const vec<T, Size>& xs) { return swizzle<1, 3, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywxy(const vec<T, Size>& xs) { return swizzle<1, 3, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywxz(const vec<T, Size>& xs) { return swizzle<1, 3, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywxw(const vec<T, Size>& xs) { return swizzle<1, 3, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywyx(const vec<T, Size>& xs) { return swizzle<1, 3, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywyy(const vec<T, Size>& xs) { return swizzle<1, 3, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywyz(const vec<T, Size>& xs) { return swizzle<1, 3, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywyw(const vec<T, Size>& xs) { return swizzle<1, 3, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywzx(const vec<T, Size>& xs) { return swizzle<1, 3, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywzy(const vec<T, Size>& xs) { return swizzle<1, 3, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywzz(const vec<T, Size>& xs) { return swizzle<1, 3, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywzw(const vec<T, Size>& xs) { return swizzle<1, 3, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywwx(const vec<T, Size>& xs) { return swizzle<1, 3, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywwy(const vec<T, Size>& xs) { return swizzle<1, 3, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywwz(const vec<T, Size>& xs) { return swizzle<1, 3, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywww(const vec<T, Size>& xs) { return swizzle<1, 3, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxxx(const vec<T, Size>& xs) { return swizzle<2, 0, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxxy(const vec<T, Size>& xs) { return swizzle<2, 0, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxxz(const vec<T, Size>& xs) { return swizzle<2, 0, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxxw(const vec<T, Size>& xs) { return swizzle<2, 0, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxyx(const vec<T, Size>& xs) { return swizzle<2, 0, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxyy(const vec<T, Size>& xs) { return swizzle<2, 0, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxyz(const vec<T, Size>& xs) { return swizzle<2, 0, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxyw(const vec<T, Size>& xs) { return swizzle<2, 0, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxzx(const vec<T, Size>& xs) { return swizzle<2, 0, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxzy(const vec<T, Size>& xs) { return swizzle<2, 0, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxzz(const vec<T, Size>& xs) { return swizzle<2, 0, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxzw(const vec<T, Size>& xs) { return swizzle<2, 0, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxwx(const vec<T, Size>& xs) { return swizzle<2, 0, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxwy(const vec<T, Size>& xs) { return swizzle<2, 0, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxwz(const vec<T, Size>& xs) { return swizzle<2, 0, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxww(const vec<T, Size>& xs) { return swizzle<2, 0, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyxx(const vec<T, Size>& xs) { return swizzle<2, 1, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyxy(const vec<T, Size>& xs) { return swizzle<2, 1, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyxz(const vec<T, Size>& xs) { return swizzle<2, 1, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyxw(const vec<T, Size>& xs) { return swizzle<2, 1, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyyx(const vec<T, Size>& xs) { return swizzle<2, 1, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyyy(const vec<T, Size>& xs) { return swizzle<2, 1, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyyz(const vec<T, Size>& xs) { return swizzle<2, 1, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyyw(const vec<T, Size>& xs) { return swizzle<2, 1, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyzx(const vec<T, Size>& xs) { return swizzle<2, 1, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyzy(const vec<T, Size>& xs) { return swizzle<2, 1, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyzz(const vec<T, Size>& xs) { return swizzle<2, 1, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyzw(const vec<T, Size>& xs) { return swizzle<2, 1, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zywx(const vec<T, Size>& xs) { return swizzle<2, 1, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zywy(const vec<T, Size>& xs) { return swizzle<2, 1, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zywz(const vec<T, Size>& xs) { return swizzle<2, 1, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyww(const vec<T, Size>& xs) { return swizzle<2, 1, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzxx(const vec<T, Size>& xs) { return swizzle<2, 2, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzxy(const vec<T, Size>& xs) { return swizzle<2, 2, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzxz(const vec<T, Size>& xs) { return swizzle<2, 2, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzxw(const vec<T, Size>& xs) { return swizzle<2, 2, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzyx(const vec<T, Size>& xs) { return swizzle<2, 2, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzyy(const vec<T, Size>& xs) { return swizzle<2, 2, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzyz(const vec<T, Size>& xs) { return swizzle<2, 2, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzyw(const vec<T, Size>& xs) { return swizzle<2, 2, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzzx(const vec<T, Size>& xs) { return swizzle<2, 2, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzzy(const vec<T, Size>& xs) { return swizzle<2, 2, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzzz(const vec<T, Size>& xs) { return swizzle<2, 2, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzzw(const vec<T, Size>& xs) { return swizzle<2, 2, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzwx(const vec<T, Size>& xs) { return swizzle<2, 2, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzwy(const vec<T, Size>& xs) { return swizzle<2, 2, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzwz(const vec<T, Size>& xs) { return swizzle<2, 2, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzww(const vec<T, Size>& xs) { return swizzle<2, 2, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwxx(const vec<T, Size>& xs) { return swizzle<2, 3, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwxy(const vec<T, Size>& xs) { return swizzle<2, 3, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwxz(const vec<T, Size>& xs) { return swizzle<2, 3, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwxw(const vec<T, Size>& xs) { return swizzle<2, 3, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwyx(const vec<T, Size>& xs) { return swizzle<2, 3, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwyy(const vec<T, Size>& xs) { return swizzle<2, 3, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwyz(const vec<T, Size>& xs) { return swizzle<2, 3, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwyw(const vec<T, Size>& xs) { return swizzle<2, 3, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwzx(const vec<T, Size>& xs) { return swizzle<2, 3, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwzy(const vec<T, Size>& xs) { return swizzle<2, 3, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwzz(const vec<T, Size>& xs) { return swizzle<2, 3, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwzw(const vec<T, Size>& xs) { return swizzle<2, 3, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwwx(const vec<T, Size>& xs) { return swizzle<2, 3, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwwy(const vec<T, Size>& xs) { return swizzle<2, 3, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwwz(const vec<T, Size>& xs) { return swizzle<2, 3, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwww(const vec<T, Size>& xs) { return swizzle<2, 3, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxxx(const vec<T, Size>& xs) { return swizzle<3, 0, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxxy(const vec<T, Size>& xs) { return swizzle<3, 0, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxxz(const vec<T, Size>& xs) { return swizzle<3, 0, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxxw(const vec<T, Size>& xs) { return swizzle<3, 0, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxyx(const vec<T, Size>& xs) { return swizzle<3, 0, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxyy(const vec<T, Size>& xs) { return swizzle<3, 0, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxyz(const vec<T, Size>& xs) { return swizzle<3, 0, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxyw(const vec<T, Size>& xs) { return swizzle<3, 0, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxzx(const vec<T, Size>& xs) { return swizzle<3, 0, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxzy(const vec<T, Size>& xs) { return swizzle<3, 0, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxzz(const vec<T, Size>& xs) { return swizzle<3, 0, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxzw(const vec<T, Size>& xs) { return swizzle<3, 0, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxwx(const vec<T, Size>& xs) { return swizzle<3, 0, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxwy(const vec<T, Size>& xs) { return swizzle<3, 0, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxwz(const vec<T, Size>& xs) { return swizzle<3, 0, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxww(const vec<T, Size>& xs) { return swizzle<3, 0, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyxx(const vec<T, Size>& xs) { return swizzle<3, 1, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyxy(const vec<T, Size>& xs) { return swizzle<3, 1, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyxz(const vec<T, Size>& xs) { return swizzle<3, 1, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyxw(const vec<T, Size>& xs) { return swizzle<3, 1, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyyx(const vec<T, Size>& xs) { return swizzle<3, 1, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyyy(const vec<T, Size>& xs) { return swizzle<3, 1, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyyz(const vec<T, Size>& xs) { return swizzle<3, 1, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyyw(const vec<T, Size>& xs) { return swizzle<3, 1, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyzx(const vec<T, Size>& xs) { return swizzle<3, 1, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyzy(const vec<T, Size>& xs) { return swizzle<3, 1, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyzz(const vec<T, Size>& xs) { return swizzle<3, 1, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyzw(const vec<T, Size>& xs) { return swizzle<3, 1, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wywx(const vec<T, Size>& xs) { return swizzle<3, 1, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wywy(const vec<T, Size>& xs) { return swizzle<3, 1, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wywz(const vec<T, Size>& xs) { return swizzle<3, 1, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyww(const vec<T, Size>& xs) { return swizzle<3, 1, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzxx(const vec<T, Size>& xs) { return swizzle<3, 2, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzxy(const vec<T, Size>& xs) { return swizzle<3, 2, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzxz(const vec<T, Size>& xs) { return swizzle<3, 2, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzxw(const vec<T, Size>& xs) { return swizzle<3, 2, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzyx(const vec<T, Size>& xs) { return swizzle<3, 2, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzyy(const vec<T, Size>& xs) { return swizzle<3, 2, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzyz(const vec<T, Size>& xs) { return swizzle<3, 2, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzyw(const vec<T, Size>& xs) { return swizzle<3, 2, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzzx(const vec<T, Size>& xs) { return swizzle<3, 2, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzzy(const vec<T, Size>& xs) { return swizzle<3, 2, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzzz(const vec<T, Size>& xs) { return swizzle<3, 2, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzzw(const vec<T, Size>& xs) { return swizzle<3, 2, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzwx(const vec<T, Size>& xs) { return swizzle<3, 2, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzwy(const vec<T, Size>& xs) { return swizzle<3, 2, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzwz(const vec<T, Size>& xs) { return swizzle<3, 2, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzww(const vec<T, Size>& xs) { return swizzle<3, 2, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwxx(const vec<T, Size>& xs) { return swizzle<3, 3, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwxy(const vec<T, Size>& xs) { return swizzle<3, 3, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwxz(const vec<T, Size>& xs) { return swizzle<3, 3, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwxw(const vec<T, Size>& xs) { return swizzle<3, 3, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwyx(const vec<T, Size>& xs) { return swizzle<3, 3, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwyy(const vec<T, Size>& xs) { return swizzle<3, 3, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwyz(const vec<T, Size>& xs) { return swizzle<3, 3, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwyw(const vec<T, Size>& xs) { return swizzle<3, 3, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwzx(const vec<T, Size>& xs) { return swizzle<3, 3, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwzy(const vec<T, Size>& xs) { return swizzle<3, 3, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwzz(const vec<T, Size>& xs) { return swizzle<3, 3, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwzw(const vec<T, Size>& xs) { return swizzle<3, 3, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwwx(const vec<T, Size>& xs) { return swizzle<3, 3, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwwy(const vec<T, Size>& xs) { return swizzle<3, 3, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwwz(const vec<T, Size>& xs) { return swizzle<3, 3, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwww(const vec<T, Size>& xs) { return swizzle<3, 3, 3, 3>(xs); }
+}
+
+//
+// Transform
+//
+
+namespace vmath_hpp
+{
+    template < typename T >
+    class transform final {
+    public:
+        using self_type = transform;
+        using component_type = T;
+
+        using vec_type = vec<T, 3>;
+        using qua_type = qua<T>;
+        using mat_type = mat<T, 4>;
+        using normal_mat_type = mat<T, 3>;
+    public:
+        constexpr transform() = default;
+
+        constexpr explicit transform(
+            const vec_type& translation,
+            const qua_type& rotation = qua_type{identity_init},
+            const vec_type& scale = vec_type{unit_init})
+        : translation_{translation}
+        , rotation_{rotation}
+        , scale_{scale} {}
+
+        [[nodiscard]] constexpr const vec_type& translation() const noexcept { return translation_; }
+        [[nodiscard]] constexpr const qua_type& rotation() const noexcept { return rotation_; }
+        [[nodiscard]] constexpr const vec_type& scale() const noexcept { return scale_; }
+
+        constexpr void set_translation(const vec_type& translation) noexcept {
+            translation_ = translation;
+            dirty_ = all_dirty;
+        }
+
+        constexpr void set_rotation(const qua_type& rotation) noexcept {
+            rotation_ = rotation;
+            dirty_ = all_dirty;
+        }
+
+        constexpr void set_scale(const vec_type& scale) noexcept {
+            scale_ = scale;
+            dirty_ = all_dirty;
+        }
+
+        [[nodiscard]] const mat_type& matrix() const {
+            if ( dirty_ & matrix_dirty ) {
+                matrix_ = trs(translation_, rotation_, scale_);
+                dirty_ = static_cast<unsigned char>(dirty_ & ~matrix_dirty);
+            }
+            return matrix_;
+        }
+
+        [[nodiscard]] const mat_type& inverse_matrix() const {
+            if ( dirty_ & inverse_dirty ) {
+                // (S * R * T)^-1 = T^-1 * R^T * S^-1, no generic inverse required
+                const normal_mat_type rt = transpose(rotate(rotation_));
+                const vec_type rs = rcp(scale_);
+                inverse_matrix_ = {
+                    { rt[0] * rs, T{0} },
+                    { rt[1] * rs, T{0} },
+                    { rt[2] * rs, T{0} },
+                    { -(translation_ * rt) * rs, T{1} }};
+                dirty_ = static_cast<unsigned char>(dirty_ & ~inverse_dirty);
+            }
+            return inverse_matrix_;
+        }
+
+        [[nodiscard]] const normal_mat_type& normal_matrix() const {
+            if ( dirty_ & normal_dirty ) {
+                // transpose(inverse(S * R)) = S^-1 * R
+                const normal_mat_type r = rotate(rotation_);
+                const vec_type rs = rcp(scale_);
+                normal_matrix_ = {
+                    r[0] * rs[0],
+                    r[1] * rs[1],
+                    r[2] * rs[2]};
+                dirty_ = static_cast<unsigned char>(dirty_ & ~normal_dirty);
+            }
+            return normal_matrix_;
+        }
+    private:
+        enum : unsigned char {
+            matrix_dirty = 1u << 0,
+            inverse_dirty = 1u << 1,
+            normal_dirty = 1u << 2,
+            all_dirty = matrix_dirty | inverse_dirty | normal_dirty,
+        };
+    private:
+        vec_type translation_{zero_init};
+        qua_type rotation_{identity_init};
+        vec_type scale_{unit_init};
+        mutable mat_type matrix_{identity_init};
+        mutable mat_type inverse_matrix_{identity_init};
+        mutable normal_mat_type normal_matrix_{identity_init};
+        mutable unsigned char dirty_{all_dirty};
+    };
+}
+
+namespace vmath_hpp
+{
+    using ftransform = transform<float>;
+    using dtransform = transform<double>;
+
+    // operator*
+
+    template < typename T >
+    [[nodiscard]] constexpr transform<T> operator*(const transform<T>& xs, const transform<T>& ys) {
+        // exact while the scale of the right operand is uniform, shear is dropped otherwise
+        return transform<T>{
+            (xs.translation() * ys.scale()) * ys.rotation() + ys.translation(),
+            xs.rotation() * ys.rotation(),
+            xs.scale() * ys.scale()};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr vec<T, 3> operator*(const vec<T, 3>& xs, const transform<T>& ys) {
+        return (xs * ys.scale()) * ys.rotation() + ys.translation();
+    }
+
+    // operator*=
+
+    template < typename T >
+    constexpr transform<T>& operator*=(transform<T>& xs, const transform<T>& ys) {
+        return (xs = (xs * ys));
+    }
+
+    template < typename T >
+    constexpr vec<T, 3>& operator*=(vec<T, 3>& xs, const transform<T>& ys) {
+        return (xs = (xs * ys));
+    }
+
+    // operator==
+
+    template < typename T >
+    [[nodiscard]] constexpr bool operator==(const transform<T>& xs, const transform<T>& ys) {
+        return xs.translation() == ys.translation()
+            && xs.rotation() == ys.rotation()
+            && xs.scale() == ys.scale();
+    }
+
+    // operator!=
+
+    template < typename T >
+    [[nodiscard]] constexpr bool operator!=(const transform<T>& xs, const transform<T>& ys) {
+        return !(xs == ys);
+    }
+
+    // inverse
+
+    template < typename T >
+    [[nodiscard]] constexpr transform<T> inverse(const transform<T>& xs) {
+        // exact while the scale is uniform, use inverse_matrix() otherwise
+        const qua<T> r = inverse(xs.rotation());
+        const vec<T, 3> s = rcp(xs.scale());
+        return transform<T>{(-xs.translation() * r) * s, r, s};
+    }
+}
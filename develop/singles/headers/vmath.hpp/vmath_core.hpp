@@ -0,0 +1,4606 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER)
+#  define VMATH_HPP_FORCE_INLINE __forceinline
+#elif defined(__clang__) || defined(__GNUC__)
+#  define VMATH_HPP_FORCE_INLINE inline __attribute__((__always_inline__))
+#else
+#  define VMATH_HPP_FORCE_INLINE inline
+#endif
+
+#if !defined(__cpp_exceptions) && !defined(__EXCEPTIONS) && !defined(_CPPUNWIND)
+#  define VMATH_HPP_NO_EXCEPTIONS
+#endif
+
+#ifdef VMATH_HPP_NO_EXCEPTIONS
+#  define VMATH_HPP_THROW(...) std::abort()
+#else
+#  include <stdexcept>
+#  define VMATH_HPP_THROW(...) throw __VA_ARGS__
+#endif
+
+#define VMATH_HPP_THROW_IF(pred, ...)\
+    ( (pred) ? VMATH_HPP_THROW(__VA_ARGS__) : (void)0 )
+
+// included by vmath_fwd.hpp, must not depend on the rest of the library,
+// everything below is compiled out unless VMATH_HPP_INSTRUMENT or VMATH_HPP_CHECKED is defined
+
+#if defined(VMATH_HPP_INSTRUMENT) || defined(VMATH_HPP_CHECKED)
+#  include <atomic>
+#  include <cstddef>
+#  include <cstdint>
+#  include <cstdio>
+#endif
+
+#if defined(VMATH_HPP_INSTRUMENT)
+#  include <chrono>
+#  include <mutex>
+#endif
+
+#if defined(VMATH_HPP_CHECKED)
+#  include <cmath>
+#  include <type_traits>
+#endif
+
+#if defined(VMATH_HPP_INSTRUMENT) || defined(VMATH_HPP_CHECKED)
+#  if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#    define VMATH_HPP_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#  else
+#    error "VMATH_HPP_INSTRUMENT and VMATH_HPP_CHECKED require __builtin_is_constant_evaluated"
+#  endif
+#endif
+
+#if defined(VMATH_HPP_INSTRUMENT)
+#  define VMATH_HPP_INSTRUMENT_CALL(id, flops)\
+    ( VMATH_HPP_IS_CONSTANT_EVALUATED() ? (void)0 :\
+        ::vmath_hpp::instrument::impl::record(::vmath_hpp::instrument::function::id, (flops)) )
+#else
+#  define VMATH_HPP_INSTRUMENT_CALL(id, flops) (void)0
+#endif
+
+#if defined(VMATH_HPP_CHECKED)
+#  define VMATH_HPP_CHECK_RESULT(name, ...)\
+    ::vmath_hpp::checked::impl::check_result(name, __FILE__, __LINE__, __VA_ARGS__)
+#else
+#  define VMATH_HPP_CHECK_RESULT(name, ...) (__VA_ARGS__)
+#endif
+
+#if defined(VMATH_HPP_INSTRUMENT)
+
+//
+// Instrumentation
+//
+
+namespace vmath_hpp::instrument
+{
+    enum class function : unsigned char {
+        mat_mul,
+        determinant,
+        inverse,
+        normalize,
+        qua_mul,
+        vec_qua_mul,
+        qua_inverse,
+        nlerp,
+        slerp,
+        rotate,
+        qrotate,
+        look_at,
+        count,
+    };
+
+    inline constexpr std::size_t function_count = static_cast<std::size_t>(function::count);
+
+    struct counter {
+        std::uint64_t calls{};
+        std::uint64_t flops{};
+    };
+
+    // user_data is passed through unchanged, the callbacks may be called from any thread
+    struct hooks {
+        void (*on_call)(function f, std::uint64_t flops, void* user_data){};
+        void (*on_zone)(const char* name, std::uint64_t begin_ns, std::uint64_t end_ns, void* user_data){};
+        void* user_data{};
+    };
+}
+
+namespace vmath_hpp::instrument::impl
+{
+    inline thread_local counter thread_counters[function_count]{};
+
+    inline std::atomic<const hooks*> installed_hooks{nullptr};
+    inline std::atomic<unsigned> zone_sample_rate{0};
+
+    [[nodiscard]] inline std::uint64_t now_ns() noexcept {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
+
+    [[nodiscard]] inline unsigned thread_index() noexcept {
+        static std::atomic<unsigned> next_index{0};
+        static thread_local const unsigned index = next_index.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+
+    inline void record(function f, std::uint64_t flops) noexcept {
+        counter& c = thread_counters[static_cast<std::size_t>(f)];
+        c.calls += 1;
+        c.flops += flops;
+
+        if ( const hooks* h = installed_hooks.load(std::memory_order_acquire); h && h->on_call ) {
+            h->on_call(f, flops, h->user_data);
+        }
+    }
+}
+
+namespace vmath_hpp::instrument
+{
+    // function_name
+
+    [[nodiscard]] inline const char* function_name(function f) noexcept {
+        constexpr const char* names[function_count] = {
+            "mat * mat",
+            "determinant",
+            "inverse",
+            "normalize",
+            "qua * qua",
+            "vec * qua",
+            "inverse(qua)",
+            "nlerp",
+            "slerp",
+            "rotate",
+            "qrotate",
+            "look_at",
+        };
+        return names[static_cast<std::size_t>(f)];
+    }
+
+    // thread_counter
+
+    [[nodiscard]] inline counter thread_counter(function f) noexcept {
+        return impl::thread_counters[static_cast<std::size_t>(f)];
+    }
+
+    // reset_thread_counters
+
+    inline void reset_thread_counters() noexcept {
+        for ( counter& c : impl::thread_counters ) {
+            c = counter{};
+        }
+    }
+
+    // dump_thread_counters
+
+    inline void dump_thread_counters(std::FILE* out) {
+        for ( std::size_t i = 0; i < function_count; ++i ) {
+            if ( const counter& c = impl::thread_counters[i]; c.calls > 0 ) {
+                std::fprintf(out, "%-14s %12llu calls %14llu flops\n",
+                    function_name(static_cast<function>(i)),
+                    static_cast<unsigned long long>(c.calls),
+                    static_cast<unsigned long long>(c.flops));
+            }
+        }
+    }
+
+    // set_hooks
+
+    inline void set_hooks(const hooks* h) noexcept {
+        // the hooks must outlive the installation, pass nullptr to remove them
+        impl::installed_hooks.store(h, std::memory_order_release);
+    }
+
+    // set_zone_sample_rate
+
+    inline void set_zone_sample_rate(unsigned rate) noexcept {
+        // 0 disables zone timers, N times every Nth zone entered on each thread
+        impl::zone_sample_rate.store(rate, std::memory_order_relaxed);
+    }
+
+    // zone
+
+    class zone final {
+    public:
+        explicit zone(const char* name) noexcept
+        : name_{name} {
+            static thread_local unsigned entered{0};
+            const unsigned rate = impl::zone_sample_rate.load(std::memory_order_relaxed);
+            if ( rate > 0 && ++entered % rate == 0 ) {
+                begin_ns_ = impl::now_ns();
+            }
+        }
+
+        ~zone() noexcept {
+            if ( begin_ns_ == 0 ) {
+                return;
+            }
+            if ( const hooks* h = impl::installed_hooks.load(std::memory_order_acquire); h && h->on_zone ) {
+                h->on_zone(name_, begin_ns_, impl::now_ns(), h->user_data);
+            }
+        }
+
+        zone(const zone&) = delete;
+        zone& operator=(const zone&) = delete;
+    private:
+        const char* name_{};
+        std::uint64_t begin_ns_{};
+    };
+
+    // trace_writer
+
+    class trace_writer final {
+    public:
+        // writes the Chrome trace event format, loadable by Perfetto and chrome://tracing
+        explicit trace_writer(std::FILE* out)
+        : out_{out} {
+            std::fputs("{\"traceEvents\":[", out_);
+        }
+
+        ~trace_writer() {
+            const hooks* self = &hooks_;
+            impl::installed_hooks.compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+            std::fputs("\n]}\n", out_);
+            std::fflush(out_);
+        }
+
+        trace_writer(const trace_writer&) = delete;
+        trace_writer& operator=(const trace_writer&) = delete;
+
+        [[nodiscard]] const hooks& as_hooks() const noexcept {
+            return hooks_;
+        }
+
+        [[nodiscard]] std::uint64_t event_count() const {
+            const std::lock_guard<std::mutex> guard{mutex_};
+            return event_count_;
+        }
+    private:
+        static void on_call(function f, std::uint64_t flops, void* user_data) {
+            auto* self = static_cast<trace_writer*>(user_data);
+            const std::lock_guard<std::mutex> guard{self->mutex_};
+            self->begin_event_();
+            std::fprintf(self->out_,
+                R"({"name":"%s","cat":"vmath","ph":"i","s":"t","ts":%.3f,"pid":1,"tid":%u,"args":{"flops":%llu}})",
+                function_name(f),
+                static_cast<double>(impl::now_ns()) / 1000.0,
+                impl::thread_index(),
+                static_cast<unsigned long long>(flops));
+        }
+
+        static void on_zone(const char* name, std::uint64_t begin_ns, std::uint64_t end_ns, void* user_data) {
+            auto* self = static_cast<trace_writer*>(user_data);
+            const std::lock_guard<std::mutex> guard{self->mutex_};
+            self->begin_event_();
+            std::fputs(R"({"name":")", self->out_);
+            for ( const char* c = name; *c; ++c ) {
+                if ( *c == '"' || *c == '\\' ) {
+                    std::fputc('\\', self->out_);
+                }
+                std::fputc(*c, self->out_);
+            }
+            std::fprintf(self->out_,
+                R"(","cat":"zone","ph":"X","ts":%.3f,"dur":%.3f,"pid":1,"tid":%u})",
+                static_cast<double>(begin_ns) / 1000.0,
+                static_cast<double>(end_ns - begin_ns) / 1000.0,
+                impl::thread_index());
+        }
+
+        void begin_event_() {
+            std::fputs(event_count_ > 0 ? ",\n" : "\n", out_);
+            event_count_ += 1;
+        }
+    private:
+        hooks hooks_{&on_call, &on_zone, this};
+        mutable std::mutex mutex_;
+        std::FILE* out_{};
+        std::uint64_t event_count_{};
+    };
+}
+
+#endif
+
+#if defined(VMATH_HPP_CHECKED)
+
+//
+// Checked Results
+//
+
+namespace vmath_hpp::checked
+{
+    enum class issue : unsigned {
+        nan,
+        infinity,
+    };
+
+    struct report {
+        const char* function{};
+        const char* file{};
+        unsigned line{};
+        const char* scope{};
+        issue what{};
+        unsigned component{};
+    };
+
+    // on_issue is called for every invalid result on the thread that produced it
+    struct handler {
+        void (*on_issue)(const report& r, void* user_data){};
+        void* user_data{};
+    };
+}
+
+namespace vmath_hpp::checked::impl
+{
+    inline thread_local const char* thread_scope{};
+
+    inline thread_local report thread_first_issue{};
+    inline thread_local std::uint64_t thread_issue_count{};
+    inline thread_local std::uint64_t thread_denormal_count{};
+
+    inline std::atomic<const handler*> installed_handler{nullptr};
+
+    template < typename T, typename = void >
+    struct has_components : std::false_type {};
+
+    template < typename T >
+    struct has_components<T, std::void_t<decltype(T::size)>> : std::true_type {};
+
+    struct scan_state {
+        unsigned component{};
+        unsigned bad_component{};
+        bool bad{};
+        issue what{};
+    };
+
+    template < typename T >
+    void scan(const T& value, scan_state& state) noexcept {
+        if constexpr ( std::is_floating_point_v<T> ) {
+            const int category = std::fpclassify(value);
+            if ( category == FP_SUBNORMAL ) {
+                thread_denormal_count += 1;
+            } else if ( !state.bad && (category == FP_NAN || category == FP_INFINITE) ) {
+                state.bad = true;
+                state.bad_component = state.component;
+                state.what = category == FP_NAN ? issue::nan : issue::infinity;
+            }
+            state.component += 1;
+        } else if constexpr ( has_components<T>::value ) {
+            // vec, mat and qua, the matrix components are counted row by row
+            for ( std::size_t i = 0; i < T::size; ++i ) {
+                scan(value[i], state);
+            }
+        } else {
+            // integers and user-defined component types can't be invalid
+            state.component += 1;
+        }
+    }
+
+    inline void report_issue(const report& r) {
+        thread_issue_count += 1;
+        if ( thread_issue_count == 1 ) {
+            thread_first_issue = r;
+        }
+
+        if ( const handler* h = installed_handler.load(std::memory_order_acquire); h && h->on_issue ) {
+            h->on_issue(r, h->user_data);
+        } else if ( thread_issue_count == 1 ) {
+            std::fprintf(stderr, "%s:%u: vmath.hpp: %s in %s, component %u (scope: %s)\n",
+                r.file,
+                r.line,
+                r.what == issue::nan ? "nan" : "infinity",
+                r.function,
+                r.component,
+                r.scope ? r.scope : "none");
+        }
+    }
+
+    template < typename V >
+    constexpr V check_result(const char* function, const char* file, unsigned line, V value) {
+        if ( !VMATH_HPP_IS_CONSTANT_EVALUATED() ) {
+            scan_state state{};
+            scan(value, state);
+            if ( state.bad ) {
+                report_issue({function, file, line, thread_scope, state.what, state.bad_component});
+            }
+        }
+        return value;
+    }
+}
+
+namespace vmath_hpp::checked
+{
+    // set_handler
+
+    inline void set_handler(const handler* h) noexcept {
+        // the handler must outlive the installation, pass nullptr to print
+        // the first issue of each thread to stderr instead
+        impl::installed_handler.store(h, std::memory_order_release);
+    }
+
+    // thread_first_issue
+
+    [[nodiscard]] inline const report* thread_first_issue() noexcept {
+        return impl::thread_issue_count > 0 ? &impl::thread_first_issue : nullptr;
+    }
+
+    // thread_issue_count
+
+    [[nodiscard]] inline std::uint64_t thread_issue_count() noexcept {
+        return impl::thread_issue_count;
+    }
+
+    // thread_denormal_count
+
+    [[nodiscard]] inline std::uint64_t thread_denormal_count() noexcept {
+        return impl::thread_denormal_count;
+    }
+
+    // reset_thread_issues
+
+    inline void reset_thread_issues() noexcept {
+        impl::thread_first_issue = report{};
+        impl::thread_issue_count = 0;
+        impl::thread_denormal_count = 0;
+    }
+
+    // scope
+
+    class scope final {
+    public:
+        // names the reports of the current thread until destroyed, scopes nest
+        explicit scope(const char* name) noexcept
+        : previous_{impl::thread_scope} {
+            impl::thread_scope = name;
+        }
+
+        ~scope() noexcept {
+            impl::thread_scope = previous_;
+        }
+
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+    private:
+        const char* previous_{};
+    };
+}
+
+#endif
+
+namespace vmath_hpp
+{
+    struct no_init_t { explicit no_init_t() = default; };
+    inline constexpr no_init_t no_init{};
+
+    struct zero_init_t { explicit zero_init_t() = default; };
+    inline constexpr zero_init_t zero_init{};
+
+    struct unit_init_t { explicit unit_init_t() = default; };
+    inline constexpr unit_init_t unit_init{};
+
+    struct identity_init_t { explicit identity_init_t() = default; };
+    inline constexpr identity_init_t identity_init{};
+}
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    class vec;
+
+    using bvec2 = vec<bool, 2>;
+    using bvec3 = vec<bool, 3>;
+    using bvec4 = vec<bool, 4>;
+
+    using ivec2 = vec<int, 2>;
+    using ivec3 = vec<int, 3>;
+    using ivec4 = vec<int, 4>;
+
+    using uvec2 = vec<unsigned, 2>;
+    using uvec3 = vec<unsigned, 3>;
+    using uvec4 = vec<unsigned, 4>;
+
+    using fvec2 = vec<float, 2>;
+    using fvec3 = vec<float, 3>;
+    using fvec4 = vec<float, 4>;
+
+    using dvec2 = vec<double, 2>;
+    using dvec3 = vec<double, 3>;
+    using dvec4 = vec<double, 4>;
+}
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Rows, std::size_t Cols = Rows >
+    class mat;
+
+    using bmat2 = mat<bool, 2>;
+    using bmat3 = mat<bool, 3>;
+    using bmat4 = mat<bool, 4>;
+
+    using imat2 = mat<int, 2>;
+    using imat3 = mat<int, 3>;
+    using imat4 = mat<int, 4>;
+
+    using umat2 = mat<unsigned, 2>;
+    using umat3 = mat<unsigned, 3>;
+    using umat4 = mat<unsigned, 4>;
+
+    using fmat2 = mat<float, 2>;
+    using fmat3 = mat<float, 3>;
+    using fmat4 = mat<float, 4>;
+
+    using dmat2 = mat<double, 2>;
+    using dmat3 = mat<double, 3>;
+    using dmat4 = mat<double, 4>;
+
+    using bmat2x3 = mat<bool, 2, 3>;
+    using bmat2x4 = mat<bool, 2, 4>;
+    using bmat3x2 = mat<bool, 3, 2>;
+    using bmat3x4 = mat<bool, 3, 4>;
+    using bmat4x2 = mat<bool, 4, 2>;
+    using bmat4x3 = mat<bool, 4, 3>;
+
+    using imat2x3 = mat<int, 2, 3>;
+    using imat2x4 = mat<int, 2, 4>;
+    using imat3x2 = mat<int, 3, 2>;
+    using imat3x4 = mat<int, 3, 4>;
+    using imat4x2 = mat<int, 4, 2>;
+    using imat4x3 = mat<int, 4, 3>;
+
+    using umat2x3 = mat<unsigned, 2, 3>;
+    using umat2x4 = mat<unsigned, 2, 4>;
+    using umat3x2 = mat<unsigned, 3, 2>;
+    using umat3x4 = mat<unsigned, 3, 4>;
+    using umat4x2 = mat<unsigned, 4, 2>;
+    using umat4x3 = mat<unsigned, 4, 3>;
+
+    using fmat2x3 = mat<float, 2, 3>;
+    using fmat2x4 = mat<float, 2, 4>;
+    using fmat3x2 = mat<float, 3, 2>;
+    using fmat3x4 = mat<float, 3, 4>;
+    using fmat4x2 = mat<float, 4, 2>;
+    using fmat4x3 = mat<float, 4, 3>;
+
+    using dmat2x3 = mat<double, 2, 3>;
+    using dmat2x4 = mat<double, 2, 4>;
+    using dmat3x2 = mat<double, 3, 2>;
+    using dmat3x4 = mat<double, 3, 4>;
+    using dmat4x2 = mat<double, 4, 2>;
+    using dmat4x3 = mat<double, 4, 3>;
+}
+
+namespace vmath_hpp
+{
+    template < typename T >
+    class qua;
+
+    using fqua = qua<float>;
+    using dqua = qua<double>;
+}
+
+//
+// Common Functions
+//
+
+namespace vmath_hpp::impl
+{
+    // the unchecked forms are for the functions built on top of them,
+    // only the outermost public call checks its result
+
+    template < typename T >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    T lerp_impl(T x, T y, T a) noexcept {
+        return x * (T{1} - a) + y * a;
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    T lerp_impl(T x, T y, T x_a, T y_a) noexcept {
+        return x * x_a + y * y_a;
+    }
+}
+
+namespace vmath_hpp
+{
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr abs(T x) noexcept {
+        if constexpr ( std::is_signed_v<T> ) {
+            return x < T{0} ? -x : x;
+        } else {
+            return x;
+        }
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr sqr(T x) noexcept {
+        return x * x;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr sign(T x) noexcept {
+        return static_cast<T>((T{0} < x) - (x < T{0}));
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr rcp(T x) noexcept {
+        return T{1} / x;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr floor(T x) noexcept {
+        return std::floor(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr trunc(T x) noexcept {
+        return std::trunc(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr round(T x) noexcept {
+        return std::round(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr ceil(T x) noexcept {
+        return std::ceil(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr fract(T x) noexcept {
+        return x - floor(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr fmod(T x, T y) noexcept {
+        return std::fmod(x, y);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr modf(T x, T* y) noexcept {
+        return std::modf(x, y);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr copysign(T x, T s) noexcept {
+        return std::copysign(x, s);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr min(T x, T y) noexcept {
+        return x < y ? x : y;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr max(T x, T y) noexcept {
+        return x < y ? y : x;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr clamp(T x, T min_x, T max_x) noexcept {
+        return min(max(x, min_x), max_x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr saturate(T x) noexcept {
+        return clamp(x, T{0}, T{1});
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr lerp(T x, T y, T a) noexcept {
+        return VMATH_HPP_CHECK_RESULT("lerp", impl::lerp_impl(x, y, a));
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr lerp(T x, T y, T x_a, T y_a) noexcept {
+        return VMATH_HPP_CHECK_RESULT("lerp", impl::lerp_impl(x, y, x_a, y_a));
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr step(T edge, T x) noexcept {
+        return x < edge ? T{0} : T{1};
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr smoothstep(T edge0, T edge1, T x) noexcept {
+        const T t = clamp((x - edge0) * rcp(edge1 - edge0), T{0}, T{1});
+        return t * t * (T{3} - T{2} * t);
+    }
+}
+
+//
+// Angle and Trigonometric Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr radians(T degrees) noexcept {
+        return degrees * T(0.01745329251994329576923690768489);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr degrees(T radians) noexcept {
+        return radians * T(57.295779513082320876798154814105);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr sin(T x) noexcept {
+        return std::sin(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr cos(T x) noexcept {
+        return std::cos(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr tan(T x) noexcept {
+        return std::tan(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr asin(T x) noexcept {
+        return std::asin(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr acos(T x) noexcept {
+        return std::acos(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr atan(T x) noexcept {
+        return std::atan(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr atan2(T y, T x) noexcept {
+        return std::atan2(y, x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr sinh(T x) noexcept {
+        return std::sinh(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr cosh(T x) noexcept {
+        return std::cosh(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr tanh(T x) noexcept {
+        return std::tanh(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr asinh(T x) noexcept {
+        return std::asinh(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr acosh(T x) noexcept {
+        return std::acosh(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr atanh(T x) noexcept {
+        return std::atanh(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, std::pair<T, T>>
+    constexpr sincos(T x) noexcept {
+        return { sin(x), cos(x) };
+    }
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    constexpr sincos(T x, T* s, T* c) noexcept {
+        *s = sin(x);
+        *c = cos(x);
+    }
+}
+
+//
+// Exponential Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr pow(T x, T y) noexcept {
+        return std::pow(x, y);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr exp(T x) noexcept {
+        return std::exp(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr log(T x) noexcept {
+        return std::log(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr exp2(T x) noexcept {
+        return std::exp2(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr log2(T x) noexcept {
+        return std::log2(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr sqrt(T x) noexcept {
+        return std::sqrt(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr rsqrt(T x) noexcept {
+        return rcp(sqrt(x));
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    fast_rsqrt(T x) noexcept {
+        if constexpr ( std::is_same_v<T, float> && std::numeric_limits<float>::is_iec559 ) {
+            /// REFERENCE:
+            /// http://www.lomont.org/papers/2003/InvSqrt.pdf
+
+            std::uint32_t i{};
+            std::memcpy(&i, &x, sizeof(x));
+            i = 0x5f375a86u - (i >> 1);
+
+            float y{};
+            std::memcpy(&y, &i, sizeof(y));
+
+            // two newton steps, about 5e-6 relative error and no division,
+            // zero gives a large finite value instead of infinity
+            const float half_x = x * 0.5f;
+            y = y * (1.5f - half_x * y * y);
+            y = y * (1.5f - half_x * y * y);
+            return y;
+        } else {
+            return rsqrt(x);
+        }
+    }
+}
+
+//
+// Geometric Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, typename U
+             , typename V = decltype(std::declval<T>() * std::declval<U>()) >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<V>, V>
+    constexpr dot(T x, U y) noexcept {
+        return { x * y };
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr length(T x) noexcept {
+        return abs(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr rlength(T x) noexcept {
+        return rcp(abs(x));
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr length2(T x) noexcept {
+        return dot(x, x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr rlength2(T x) noexcept {
+        return rcp(dot(x, x));
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr distance(T x, T y) noexcept {
+        if constexpr ( std::is_unsigned_v<T> ) {
+            return x < y ? (y - x) : (x - y);
+        } else {
+            return length(x - y);
+        }
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    constexpr distance2(T x, T y) noexcept {
+        if constexpr ( std::is_unsigned_v<T> ) {
+            const T d = x < y ? (y - x) : (x - y);
+            return d * d;
+        } else {
+            return length2(x - y);
+        }
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr normalize(T x) noexcept {
+        return x * rlength(x);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr faceforward(T n, T i, T nref) noexcept {
+        return dot(nref, i) < T{0} ? n : -n;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr reflect(T i, T n) noexcept {
+        return i - T{2} * dot(n, i) * n;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr refract(T i, T n, T eta) noexcept {
+        const T d = dot(n, i);
+        const T k = T{1} - sqr(eta) * (T{1} - sqr(d));
+        return k < T{0} ? T{0} : (eta * i - (eta * d + sqrt(k)) * n);
+    }
+}
+
+//
+// Relational Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, bool>
+    constexpr any(T x) noexcept {
+        return !!x;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, bool>
+    constexpr all(T x) noexcept {
+        return !!x;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, bool>
+    constexpr approx(T x, T y, T epsilon) noexcept {
+        return distance(x, y) <= epsilon;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, bool>
+    constexpr approx(T x, T y) noexcept {
+        if constexpr ( std::is_floating_point_v<T> ) {
+            /// REFERENCE:
+            /// http://www.realtimecollisiondetection.net/pubs/Tolerances
+            const T epsilon = std::numeric_limits<T>::epsilon();
+            return approx(x, y, epsilon * max(T{1}, max(abs(x), abs(y))));
+        } else {
+            return x == y;
+        }
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, bool>
+    constexpr less(T x, T y) noexcept {
+        return x < y;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, bool>
+    constexpr less_equal(T x, T y) noexcept {
+        return x <= y;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, bool>
+    constexpr greater(T x, T y) noexcept {
+        return x > y;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, bool>
+    constexpr greater_equal(T x, T y) noexcept {
+        return x >= y;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, bool>
+    constexpr equal_to(T x, T y) noexcept {
+        return x == y;
+    }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, bool>
+    constexpr not_equal_to(T x, T y) noexcept {
+        return x != y;
+    }
+}
+
+namespace vmath_hpp::detail
+{
+    template < typename T, std::size_t Size >
+    class vec_base {
+        static_assert(Size > 1, "vec size must be greater than one");
+    public:
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        T components[Size];
+    public:
+        constexpr vec_base()
+        : vec_base{zero_init} {}
+
+        constexpr vec_base(no_init_t) {}
+        constexpr vec_base(zero_init_t): vec_base{T{0}} {}
+        constexpr vec_base(unit_init_t): vec_base{T{1}} {}
+
+        constexpr explicit vec_base(T v)
+        : vec_base(std::make_index_sequence<Size>{}, [v](std::size_t){ return v; }) {}
+
+        template < typename... Ts, std::enable_if_t<
+            (sizeof...(Ts) == Size) &&
+            (... && std::is_convertible_v<Ts, T>)
+        , int> = 0 >
+        constexpr vec_base(Ts... xs)
+        : components{static_cast<T>(xs)...} {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr vec_base(const vec_base<U, Size>& other)
+        : vec_base(std::make_index_sequence<Size>{}, [&other](std::size_t i){ return other[i]; }) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        // NOLINTNEXTLINE(*-pointer-arithmetic)
+        constexpr explicit vec_base(const U* p)
+        : vec_base(std::make_index_sequence<Size>{}, [p](std::size_t i){ return p[i]; }) {}
+
+        [[nodiscard]] constexpr T& operator[](std::size_t index) noexcept {
+            return components[index];
+        }
+
+        [[nodiscard]] constexpr const T& operator[](std::size_t index) const noexcept {
+            return components[index];
+        }
+    private:
+        template < std::size_t... Is, typename F >
+        constexpr vec_base(std::index_sequence<Is...>, F&& f)
+        : components{static_cast<T>(f(Is))...} {}
+    };
+
+    template < typename T >
+    class vec_base<T, 2> {
+    public:
+        T x, y;
+    public:
+        constexpr vec_base()
+        : vec_base{zero_init} {}
+
+        constexpr vec_base(no_init_t) {}
+        constexpr vec_base(zero_init_t): vec_base{T{0}} {}
+        constexpr vec_base(unit_init_t): vec_base{T{1}} {}
+
+        constexpr explicit vec_base(T v): x{v}, y{v} {}
+        constexpr vec_base(T x, T y): x{x}, y{y} {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr vec_base(const vec_base<U, 2>& other): vec_base(other[0], other[1]) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit vec_base(const vec_base<U, 3>& other): vec_base(other[0], other[1]) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit vec_base(const vec_base<U, 4>& other): vec_base(other[0], other[1]) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        // NOLINTNEXTLINE(*-pointer-arithmetic)
+        constexpr explicit vec_base(const U* p): vec_base(p[0], p[1]) {}
+
+        [[nodiscard]] constexpr T& operator[](std::size_t index) noexcept {
+            switch ( index ) {
+            default:
+            case 0: return x;
+            case 1: return y;
+            }
+        }
+
+        [[nodiscard]] constexpr const T& operator[](std::size_t index) const noexcept {
+            switch ( index ) {
+            default:
+            case 0: return x;
+            case 1: return y;
+            }
+        }
+    };
+
+    template < typename T >
+    class vec_base<T, 3> {
+    public:
+        T x, y, z;
+    public:
+        constexpr vec_base()
+        : vec_base{zero_init} {}
+
+        constexpr vec_base(no_init_t) {}
+        constexpr vec_base(zero_init_t): vec_base{T{0}} {}
+        constexpr vec_base(unit_init_t): vec_base{T{1}} {}
+
+        constexpr explicit vec_base(T v): x{v}, y{v}, z{v} {}
+        constexpr vec_base(T x, T y, T z): x{x}, y{y}, z{z} {}
+
+        constexpr vec_base(const vec_base<T, 2>& xy, T z): vec_base(xy[0], xy[1], z) {}
+        constexpr vec_base(T x, const vec_base<T, 2>& yz): vec_base(x, yz[0], yz[1]) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr vec_base(const vec_base<U, 3>& other): vec_base(other[0], other[1], other[2]) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit vec_base(const vec_base<U, 4>& other): vec_base(other[0], other[1], other[2]) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        // NOLINTNEXTLINE(*-pointer-arithmetic)
+        constexpr explicit vec_base(const U* p): vec_base(p[0], p[1], p[2]) {}
+
+        [[nodiscard]] constexpr T& operator[](std::size_t index) noexcept {
+            switch ( index ) {
+            default:
+            case 0: return x;
+            case 1: return y;
+            case 2: return z;
+            }
+        }
+
+        [[nodiscard]] constexpr const T& operator[](std::size_t index) const noexcept {
+            switch ( index ) {
+            default:
+            case 0: return x;
+            case 1: return y;
+            case 2: return z;
+            }
+        }
+    };
+
+    template < typename T >
+    class vec_base<T, 4> {
+    public:
+        T x, y, z, w;
+    public:
+        constexpr vec_base()
+        : vec_base{zero_init} {}
+
+        constexpr vec_base(no_init_t) {}
+        constexpr vec_base(zero_init_t) : vec_base{T{0}} {}
+        constexpr vec_base(unit_init_t) : vec_base{T{1}} {}
+
+        constexpr explicit vec_base(T v): x{v}, y{v}, z{v}, w{v} {}
+        constexpr vec_base(T x, T y, T z, T w): x{x}, y{y}, z{z}, w{w} {}
+
+        constexpr vec_base(const vec_base<T, 2>& xy, T z, T w): vec_base(xy[0], xy[1], z, w) {}
+        constexpr vec_base(T x, const vec_base<T, 2>& yz, T w): vec_base(x, yz[0], yz[1], w) {}
+        constexpr vec_base(T x, T y, const vec_base<T, 2>& zw): vec_base(x, y, zw[0], zw[1]) {}
+        constexpr vec_base(const vec_base<T, 2>& xy, const vec_base<T, 2>& zw): vec_base(xy[0], xy[1], zw[0], zw[1]) {}
+
+        constexpr vec_base(const vec_base<T, 3>& xyz, T w): vec_base(xyz[0], xyz[1], xyz[2], w) {}
+        constexpr vec_base(T x, const vec_base<T, 3>& yzw): vec_base(x, yzw[0], yzw[1], yzw[2]) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr vec_base(const vec_base<U, 4>& other): vec_base(other[0], other[1], other[2], other[3]) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        // NOLINTNEXTLINE(*-pointer-arithmetic)
+        constexpr explicit vec_base(const U* p): vec_base(p[0], p[1], p[2], p[3]) {}
+
+        [[nodiscard]] constexpr T& operator[](std::size_t index) noexcept {
+            switch ( index ) {
+            default:
+            case 0: return x;
+            case 1: return y;
+            case 2: return z;
+            case 3: return w;
+            }
+        }
+
+        [[nodiscard]] constexpr const T& operator[](std::size_t index) const noexcept {
+            switch ( index ) {
+            default:
+            case 0: return x;
+            case 1: return y;
+            case 2: return z;
+            case 3: return w;
+            }
+        }
+    };
+}
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    class vec final : public detail::vec_base<T, Size> {
+    public:
+        using self_type = vec;
+        using base_type = detail::vec_base<T, Size>;
+        using component_type = T;
+
+        using pointer = component_type*;
+        using const_pointer = const component_type*;
+
+        using reference = component_type&;
+        using const_reference = const component_type&;
+
+        using iterator = pointer;
+        using const_iterator = const_pointer;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static inline constexpr std::size_t size = Size;
+    public:
+        using base_type::vec_base;
+        using base_type::operator[];
+
+        // NOLINTNEXTLINE(*-noexcept-swap)
+        void swap(vec& other) noexcept(std::is_nothrow_swappable_v<T>) {
+            for ( std::size_t i = 0; i < Size; ++i ) {
+                using std::swap;
+                swap((*this)[i], other[i]);
+            }
+        }
+
+        [[nodiscard]] iterator begin() noexcept { return iterator(data()); }
+        [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(data()); }
+        [[nodiscard]] iterator end() noexcept { return iterator(data() + Size); }
+        [[nodiscard]] const_iterator end() const noexcept { return const_iterator(data() + Size); }
+
+        [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        [[nodiscard]] reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        [[nodiscard]] const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+        [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+        [[nodiscard]] const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+        [[nodiscard]] const_reverse_iterator crend() const noexcept { return rend(); }
+
+        [[nodiscard]] pointer data() noexcept {
+            return &(*this)[0];
+        }
+
+        [[nodiscard]] const_pointer data() const noexcept {
+            return &(*this)[0];
+        }
+
+        [[nodiscard]] constexpr reference at(std::size_t index) {
+            VMATH_HPP_THROW_IF(index >= size, std::out_of_range("vec::at"));
+            return (*this)[index];
+        }
+
+        [[nodiscard]] constexpr const_reference at(std::size_t index) const {
+            VMATH_HPP_THROW_IF(index >= size, std::out_of_range("vec::at"));
+            return (*this)[index];
+        }
+    };
+}
+
+namespace vmath_hpp
+{
+    // vec2
+
+    template < typename T >
+    vec(T, T) -> vec<T, 2>;
+
+    // vec3
+
+    template < typename T >
+    vec(T, T, T) -> vec<T, 3>;
+
+    template < typename T >
+    vec(const vec<T, 2>&, T) -> vec<T, 3>;
+
+    template < typename T >
+    vec(T, const vec<T, 2>&) -> vec<T, 3>;
+
+    // vec4
+
+    template < typename T >
+    vec(T, T, T, T) -> vec<T, 4>;
+
+    template < typename T >
+    vec(const vec<T, 2>&, T, T) -> vec<T, 4>;
+
+    template < typename T >
+    vec(T, const vec<T, 2>&, T) -> vec<T, 4>;
+
+    template < typename T >
+    vec(T, T, const vec<T, 2>&) -> vec<T, 4>;
+
+    template < typename T >
+    vec(const vec<T, 2>&, const vec<T, 2>&) -> vec<T, 4>;
+
+    template < typename T >
+    vec(const vec<T, 3>&, T) -> vec<T, 4>;
+
+    template < typename T >
+    vec(T, const vec<T, 3>&) -> vec<T, 4>;
+
+    // vecN
+
+    template < typename T, typename... Ts, std::enable_if_t<
+        (sizeof...(Ts) > 3) &&
+        (... && std::is_same_v<T, Ts>)
+    , int> = 0 >
+    vec(T, Ts...) -> vec<T, 1 + sizeof...(Ts)>;
+
+    // swap
+
+    template < typename T, std::size_t Size >
+    // NOLINTNEXTLINE(*-noexcept-swap)
+    void swap(vec<T, Size>& l, vec<T, Size>& r) noexcept(noexcept(l.swap(r))) {
+        l.swap(r);
+    }
+}
+
+namespace vmath_hpp::detail
+{
+    // data(), the pointer constructors and the blob serialization rely on the
+    // components being tightly packed in a trivially copyable standard-layout object
+
+    template < typename T, std::size_t Size >
+    inline constexpr bool is_packed_vec_v =
+        std::is_standard_layout_v<vec<T, Size>> &&
+        std::is_trivially_copyable_v<vec<T, Size>> &&
+        sizeof(vec<T, Size>) == sizeof(T) * Size;
+
+    static_assert(is_packed_vec_v<float, 2> && is_packed_vec_v<float, 3> && is_packed_vec_v<float, 4>);
+    static_assert(is_packed_vec_v<double, 2> && is_packed_vec_v<double, 3> && is_packed_vec_v<double, 4>);
+    static_assert(is_packed_vec_v<int, 2> && is_packed_vec_v<int, 3> && is_packed_vec_v<int, 4>);
+}
+
+namespace vmath_hpp::detail::impl
+{
+    template < typename A, std::size_t Size, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const vec<A, Size>& a,
+        std::index_sequence<Is...>)
+    {
+        return vec{ f(a[Is])... };
+    }
+
+    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const vec<A, Size>& a,
+        const vec<B, Size>& b,
+        std::index_sequence<Is...>)
+    {
+        return vec{ f(a[Is], b[Is])... };
+    }
+
+    template < typename A, typename B, typename C, std::size_t Size, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const vec<A, Size>& a,
+        const vec<B, Size>& b,
+        const vec<C, Size>& c,
+        std::index_sequence<Is...>)
+    {
+        return vec{ f(a[Is], b[Is], c[Is])... };
+    }
+
+    template < typename A, typename B, typename C, typename D, std::size_t Size, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const vec<A, Size>& a,
+        const vec<B, Size>& b,
+        const vec<C, Size>& c,
+        const vec<D, Size>& d,
+        std::index_sequence<Is...>)
+    {
+        return vec{ f(a[Is], b[Is], c[Is], d[Is])... };
+    }
+
+    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        A init,
+        const vec<B, Size>& b,
+        std::index_sequence<Is...>)
+    {
+        return ((init = f(std::move(init), b[Is])), ...);
+    }
+
+    template < typename A, std::size_t Size, typename F, std::size_t I, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const vec<A, Size>& a,
+        std::index_sequence<I, Is...>)
+    {
+        A init = a[I];
+        return ((init = f(std::move(init), a[Is])), ...);
+    }
+
+    template < typename A, std::size_t Size, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_and_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const vec<A, Size>& a,
+        std::index_sequence<Is...>)
+    {
+        return (... && f(a[Is]));
+    }
+
+    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_and_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const vec<A, Size>& a,
+        const vec<B, Size>& b,
+        std::index_sequence<Is...>)
+    {
+        return (... && f(a[Is], b[Is]));
+    }
+
+    template < typename A, std::size_t Size, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_or_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const vec<A, Size>& a,
+        std::index_sequence<Is...>)
+    {
+        return (... || f(a[Is]));
+    }
+
+    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_or_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const vec<A, Size>& a,
+        const vec<B, Size>& b,
+        std::index_sequence<Is...>)
+    {
+        return (... || f(a[Is], b[Is]));
+    }
+
+    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_plus_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const vec<A, Size>& a,
+        const vec<B, Size>& b,
+        std::index_sequence<Is...>)
+    {
+        return (... + f(a[Is], b[Is]));
+    }
+}
+
+namespace vmath_hpp::detail
+{
+    template < typename A, std::size_t Size, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join(F&& f, const vec<A, Size>& a) {
+        return impl::map_join_impl(std::forward<F>(f), a, std::make_index_sequence<Size>{});
+    }
+
+    template < typename A, typename B, std::size_t Size, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join(F&& f, const vec<A, Size>& a, const vec<B, Size>& b) {
+        return impl::map_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Size>{});
+    }
+
+    template < typename A, typename B, typename C, std::size_t Size, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join(F&& f, const vec<A, Size>& a, const vec<B, Size>& b, const vec<C, Size>& c) {
+        return impl::map_join_impl(std::forward<F>(f), a, b, c, std::make_index_sequence<Size>{});
+    }
+
+    template < typename A, typename B, typename C, typename D, std::size_t Size, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join(F&& f, const vec<A, Size>& a, const vec<B, Size>& b, const vec<C, Size>& c, const vec<D, Size>& d) {
+        return impl::map_join_impl(std::forward<F>(f), a, b, c, d, std::make_index_sequence<Size>{});
+    }
+
+    template < typename A, typename B, std::size_t Size, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold_join(F&& f, A init, const vec<B, Size>& b) {
+        return impl::fold_join_impl(std::forward<F>(f), std::move(init), b, std::make_index_sequence<Size>{});
+    }
+
+    template < typename A, std::size_t Size, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_join(F&& f, const vec<A, Size>& a) {
+        return impl::fold1_join_impl(std::forward<F>(f), a, std::make_index_sequence<Size>{});
+    }
+
+    template < typename A, std::size_t Size, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_and_join(F&& f, const vec<A, Size>& a) {
+        return impl::fold1_and_join_impl(std::forward<F>(f), a, std::make_index_sequence<Size>{});
+    }
+
+    template < typename A, typename B, std::size_t Size, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_and_join(F&& f, const vec<A, Size>& a, const vec<B, Size>& b) {
+        return impl::fold1_and_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Size>{});
+    }
+
+    template < typename A, std::size_t Size, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_or_join(F&& f, const vec<A, Size>& a) {
+        return impl::fold1_or_join_impl(std::forward<F>(f), a, std::make_index_sequence<Size>{});
+    }
+
+    template < typename A, typename B, std::size_t Size, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_or_join(F&& f, const vec<A, Size>& a, const vec<B, Size>& b) {
+        return impl::fold1_or_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Size>{});
+    }
+
+    template < typename A, typename B, std::size_t Size, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_plus_join(F&& f, const vec<A, Size>& a, const vec<B, Size>& b) {
+        return impl::fold1_plus_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Size>{});
+    }
+}
+
+//
+// Operators
+//
+
+namespace vmath_hpp
+{
+    // +operator
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator+(const vec<T, Size>& xs) {
+        return map_join([](T x){ return +x; }, xs);
+    }
+
+    // -operator
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator-(const vec<T, Size>& xs) {
+        return map_join([](T x){ return -x; }, xs);
+    }
+
+    // ~operator
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator~(const vec<T, Size>& xs) {
+        return map_join([](T x){ return ~x; }, xs);
+    }
+
+    // !operator
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator!(const vec<T, Size>& xs) {
+        return map_join([](T x){ return !x; }, xs);
+    }
+
+    // ++operator
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator++(vec<T, Size>& xs) {
+        return (xs = xs + T{1});
+    }
+
+    // --operator
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator--(vec<T, Size>& xs) {
+        return (xs = xs - T{1});
+    }
+
+    // operator++
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size> operator++(vec<T, Size>& xs, int) {
+        vec<T, Size> ys = xs;
+        ++xs;
+        return ys;
+    }
+
+    // operator--
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size> operator--(vec<T, Size>& xs, int) {
+        vec<T, Size> ys = xs;
+        --xs;
+        return ys;
+    }
+
+    // operator+
+
+    template < typename T, typename U, std::size_t Size >
+    [[nodiscard]] constexpr auto operator+(const vec<T, Size>& xs, U y) {
+        return map_join([y](T x){ return x + y; }, xs);
+    }
+
+    template < typename T, typename U, std::size_t Size >
+    [[nodiscard]] constexpr auto operator+(T x, const vec<U, Size>& ys) {
+        return map_join([x](U y){ return x + y; }, ys);
+    }
+
+    template < typename T, typename U, std::size_t Size >
+    [[nodiscard]] constexpr auto operator+(const vec<T, Size>& xs, const vec<U, Size>& ys) {
+        return map_join([](T x, U y){ return x + y; }, xs, ys);
+    }
+
+    // operator+=
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator+=(vec<T, Size>& xs, T y) {
+        return (xs = (xs + y));
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator+=(vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return (xs = (xs + ys));
+    }
+
+    // operator-
+
+    template < typename T, typename U, std::size_t Size >
+    [[nodiscard]] constexpr auto operator-(const vec<T, Size>& xs, U y) {
+        return map_join([y](T x){ return x - y; }, xs);
+    }
+
+    template < typename T, typename U, std::size_t Size >
+    [[nodiscard]] constexpr auto operator-(T x, const vec<U, Size>& ys) {
+        return map_join([x](U y){ return x - y; }, ys);
+    }
+
+    template < typename T, typename U, std::size_t Size >
+    [[nodiscard]] constexpr auto operator-(const vec<T, Size>& xs, const vec<U, Size>& ys) {
+        return map_join([](T x, U y){ return x - y; }, xs, ys);
+    }
+
+    // operator-=
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator-=(vec<T, Size>& xs, T y) {
+        return (xs = (xs - y));
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator-=(vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return (xs = (xs - ys));
+    }
+
+    // operator*
+
+    template < typename T, typename U, std::size_t Size >
+    [[nodiscard]] constexpr auto operator*(const vec<T, Size>& xs, U y) {
+        return map_join([y](T x){ return x * y; }, xs);
+    }
+
+    template < typename T, typename U, std::size_t Size >
+    [[nodiscard]] constexpr auto operator*(T x, const vec<U, Size>& ys) {
+        return map_join([x](U y){ return x * y; }, ys);
+    }
+
+    template < typename T, typename U, std::size_t Size >
+    [[nodiscard]] constexpr auto operator*(const vec<T, Size>& xs, const vec<U, Size>& ys) {
+        return map_join([](T x, U y){ return x * y; }, xs, ys);
+    }
+
+    // operator*=
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator*=(vec<T, Size>& xs, T y) {
+        return (xs = (xs * y));
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator*=(vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return (xs = (xs * ys));
+    }
+
+    // operator/
+
+    template < typename T, typename U, std::size_t Size >
+    [[nodiscard]] constexpr auto operator/(const vec<T, Size>& xs, U y) {
+        return map_join([y](T x){ return x / y; }, xs);
+    }
+
+    template < typename T, typename U, std::size_t Size >
+    [[nodiscard]] constexpr auto operator/(T x, const vec<U, Size>& ys) {
+        return map_join([x](U y){ return x / y; }, ys);
+    }
+
+    template < typename T, typename U, std::size_t Size >
+    [[nodiscard]] constexpr auto operator/(const vec<T, Size>& xs, const vec<U, Size>& ys) {
+        return map_join([](T x, U y){ return x / y; }, xs, ys);
+    }
+
+    // operator/=
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator/=(vec<T, Size>& xs, T y) {
+        return (xs = (xs / y));
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator/=(vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return (xs = (xs / ys));
+    }
+
+    // operator&
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator&(const vec<T, Size>& xs, T y) {
+        return map_join([y](T x){ return x & y; }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator&(T x, const vec<T, Size>& ys) {
+        return map_join([x](T y){ return x & y; }, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator&(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return x & y; }, xs, ys);
+    }
+
+    // operator&=
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator&=(vec<T, Size>& xs, T y) {
+        return (xs = (xs & y));
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator&=(vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return (xs = (xs & ys));
+    }
+
+    // operator|
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator|(const vec<T, Size>& xs, T y) {
+        return map_join([y](T x){ return x | y; }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator|(T x, const vec<T, Size>& ys) {
+        return map_join([x](T y){ return x | y; }, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator|(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return x | y; }, xs, ys);
+    }
+
+    // operator|=
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator|=(vec<T, Size>& xs, T y) {
+        return (xs = (xs | y));
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator|=(vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return (xs = (xs | ys));
+    }
+
+    // operator^
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator^(const vec<T, Size>& xs, T y) {
+        return map_join([y](T x){ return x ^ y; }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator^(T x, const vec<T, Size>& ys) {
+        return map_join([x](T y){ return x ^ y; }, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator^(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return x ^ y; }, xs, ys);
+    }
+
+    // operator^=
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator^=(vec<T, Size>& xs, T y) {
+        return (xs = (xs ^ y));
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator^=(vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return (xs = (xs ^ ys));
+    }
+
+    // operator<<
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator<<(const vec<T, Size>& xs, T y) {
+        return map_join([y](T x){ return x << y; }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator<<(T x, const vec<T, Size>& ys) {
+        return map_join([x](T y){ return x << y; }, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator<<(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return x << y; }, xs, ys);
+    }
+
+    // operator<<=
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator<<=(vec<T, Size>& xs, T y) {
+        return (xs = (xs << y));
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator<<=(vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return (xs = (xs << ys));
+    }
+
+    // operator>>
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator>>(const vec<T, Size>& xs, T y) {
+        return map_join([y](T x){ return x >> y; }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator>>(T x, const vec<T, Size>& ys) {
+        return map_join([x](T y){ return x >> y; }, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator>>(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return x >> y; }, xs, ys);
+    }
+
+    // operator>>=
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator>>=(vec<T, Size>& xs, T y) {
+        return (xs = (xs >> y));
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator>>=(vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return (xs = (xs >> ys));
+    }
+
+    // operator&&
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator&&(const vec<T, Size>& xs, T y) {
+        return map_join([y](T x){ return x && y; }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator&&(T x, const vec<T, Size>& ys) {
+        return map_join([x](T y){ return x && y; }, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator&&(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return x && y; }, xs, ys);
+    }
+
+    // operator||
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator||(const vec<T, Size>& xs, T y) {
+        return map_join([y](T x){ return x || y; }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator||(T x, const vec<T, Size>& ys) {
+        return map_join([x](T y){ return x || y; }, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr auto operator||(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return x || y; }, xs, ys);
+    }
+
+    // operator==
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool operator==(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return fold1_and_join([](T x, T y){ return x == y; }, xs, ys);
+    }
+
+    // operator!=
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool operator!=(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return fold1_or_join([](T x, T y){ return x != y; }, xs, ys);
+    }
+
+    // operator<
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool operator<(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            if ( xs[i] < ys[i] ) {
+                return true;
+            }
+            if ( ys[i] < xs[i] ) {
+                return false;
+            }
+        }
+        return false;
+    }
+}
+
+//
+// Common Functions
+//
+
+namespace vmath_hpp::impl
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, Size> lerp_impl(const vec<T, Size>& xs, const vec<T, Size>& ys, T a) {
+        return map_join([a](T x, T y) { return lerp_impl(x, y, a); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, Size> lerp_impl(const vec<T, Size>& xs, const vec<T, Size>& ys, T x_a, T y_a) {
+        return map_join([x_a, y_a](T x, T y) { return lerp_impl(x, y, x_a, y_a); }, xs, ys);
+    }
+}
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> abs(const vec<T, Size>& xs) {
+        return map_join([](T x) { return abs(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> sqr(const vec<T, Size>& xs) {
+        return map_join([](T x) { return sqr(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> sign(const vec<T, Size>& xs) {
+        return map_join([](T x) { return sign(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> rcp(const vec<T, Size>& xs) {
+        return map_join([](T x) { return rcp(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> floor(const vec<T, Size>& xs) {
+        return map_join([](T x) { return floor(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> trunc(const vec<T, Size>& xs) {
+        return map_join([](T x) { return trunc(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> round(const vec<T, Size>& xs) {
+        return map_join([](T x) { return round(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> ceil(const vec<T, Size>& xs) {
+        return map_join([](T x) { return ceil(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> fract(const vec<T, Size>& xs) {
+        return map_join([](T x) { return fract(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> fmod(const vec<T, Size>& xs, T y) {
+        return map_join([y](T x) { return fmod(x, y); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> fmod(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y) { return fmod(x, y); }, xs, ys);
+    }
+
+    namespace impl
+    {
+        template < typename T, std::size_t Size, std::size_t... Is >
+        constexpr VMATH_HPP_FORCE_INLINE
+        vec<T, Size> modf_impl(const vec<T, Size>& xs, vec<T, Size>* is, std::index_sequence<Is...>) {
+            return { modf(xs[Is], &(*is)[Is])... };
+        }
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size> modf(const vec<T, Size>& xs, vec<T, Size>* is) {
+        return impl::modf_impl(xs, is, std::make_index_sequence<Size>{});
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> copysign(const vec<T, Size>& xs, T s) {
+        return map_join([s](T x) { return copysign(x, s); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> copysign(const vec<T, Size>& xs, const vec<T, Size>& ss) {
+        return map_join([](T x, T s) { return copysign(x, s); }, xs, ss);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T min(const vec<T, Size>& xs) {
+        return fold1_join([](T acc, T x){ return min(acc, x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> min(const vec<T, Size>& xs, T y) {
+        return map_join([y](T x) { return min(x, y); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> min(T x, const vec<T, Size>& ys) {
+        return map_join([x](T y) { return min(x, y); }, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> min(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y) { return min(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T max(const vec<T, Size>& xs) {
+        return fold1_join([](T acc, T x){ return max(acc, x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> max(const vec<T, Size>& xs, T y) {
+        return map_join([y](T x) { return max(x, y); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> max(T x, const vec<T, Size>& ys) {
+        return map_join([x](T y) { return max(x, y); }, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> max(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y) { return max(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> clamp(const vec<T, Size>& xs, T min_x, T max_x) {
+        return map_join([min_x, max_x](T x) { return clamp(x, min_x, max_x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> clamp(const vec<T, Size>& xs, const vec<T, Size>& min_xs, const vec<T, Size>& max_xs) {
+        return map_join([](T x, T min_x, T max_x) { return clamp(x, min_x, max_x); }, xs, min_xs, max_xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> saturate(const vec<T, Size>& xs) {
+        return map_join([](T x) { return saturate(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> lerp(const vec<T, Size>& xs, const vec<T, Size>& ys, T a) {
+        return VMATH_HPP_CHECK_RESULT("lerp", impl::lerp_impl(xs, ys, a));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> lerp(const vec<T, Size>& xs, const vec<T, Size>& ys, T x_a, T y_a) {
+        return VMATH_HPP_CHECK_RESULT("lerp", impl::lerp_impl(xs, ys, x_a, y_a));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> lerp(
+        const vec<T, Size>& xs,
+        const vec<T, Size>& ys,
+        const vec<T, Size>& as)
+    {
+        return VMATH_HPP_CHECK_RESULT("lerp", map_join([](T x, T y, T a) { return impl::lerp_impl(x, y, a); }, xs, ys, as));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> lerp(
+        const vec<T, Size>& xs,
+        const vec<T, Size>& ys,
+        const vec<T, Size>& xs_a,
+        const vec<T, Size>& ys_a)
+    {
+        return VMATH_HPP_CHECK_RESULT("lerp", map_join([](T x, T y, T x_a, T y_a) { return impl::lerp_impl(x, y, x_a, y_a); }, xs, ys, xs_a, ys_a));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> step(T edge, const vec<T, Size>& xs) {
+        return map_join([edge](T x) { return step(edge, x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> step(const vec<T, Size>& edges, const vec<T, Size>& xs) {
+        return map_join([](T edge, T x) { return step(edge, x); }, edges, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> smoothstep(T edge0, T edge1, const vec<T, Size>& xs) {
+        return map_join([edge0, edge1](T x) { return smoothstep(edge0, edge1, x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> smoothstep(const vec<T, Size>& edges0, const vec<T, Size>& edges1, const vec<T, Size>& xs) {
+        return map_join([](T edge0, T edge1, T x) { return smoothstep(edge0, edge1, x); }, edges0, edges1, xs);
+    }
+}
+
+//
+// Angle and Trigonometric Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> radians(const vec<T, Size>& degrees) {
+        return map_join([](T x) { return radians(x); }, degrees);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> degrees(const vec<T, Size>& radians) {
+        return map_join([](T x) { return degrees(x); }, radians);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> sin(const vec<T, Size>& xs) {
+        return map_join([](T x) { return sin(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> cos(const vec<T, Size>& xs) {
+        return map_join([](T x) { return cos(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> tan(const vec<T, Size>& xs) {
+        return map_join([](T x) { return tan(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> asin(const vec<T, Size>& xs) {
+        return map_join([](T x) { return asin(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> acos(const vec<T, Size>& xs) {
+        return map_join([](T x) { return acos(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> atan(const vec<T, Size>& xs) {
+        return map_join([](T x) { return atan(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> atan2(const vec<T, Size>& ys, const vec<T, Size>& xs) {
+        return map_join([](T y, T x) { return atan2(y, x); }, ys, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> sinh(const vec<T, Size>& xs) {
+        return map_join([](T x) { return sinh(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> cosh(const vec<T, Size>& xs) {
+        return map_join([](T x) { return cosh(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> tanh(const vec<T, Size>& xs) {
+        return map_join([](T x) { return tanh(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> asinh(const vec<T, Size>& xs) {
+        return map_join([](T x) { return asinh(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> acosh(const vec<T, Size>& xs) {
+        return map_join([](T x) { return acosh(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> atanh(const vec<T, Size>& xs) {
+        return map_join([](T x) { return atanh(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr std::pair<vec<T, Size>, vec<T, Size>> sincos(const vec<T, Size>& xs) {
+        return { sin(xs), cos(xs) };
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr void sincos(const vec<T, Size>& xs, vec<T, Size>* ss, vec<T, Size>* cs) {
+        *ss = sin(xs);
+        *cs = cos(xs);
+    }
+}
+
+//
+// Exponential Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> pow(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y) { return pow(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> exp(const vec<T, Size>& xs) {
+        return map_join([](T x) { return exp(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> log(const vec<T, Size>& xs) {
+        return map_join([](T x) { return log(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> exp2(const vec<T, Size>& xs) {
+        return map_join([](T x) { return exp2(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> log2(const vec<T, Size>& xs) {
+        return map_join([](T x) { return log2(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> sqrt(const vec<T, Size>& xs) {
+        return map_join([](T x) { return sqrt(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> rsqrt(const vec<T, Size>& xs) {
+        return map_join([](T x) { return rsqrt(x); }, xs);
+    }
+}
+
+//
+// Swizzle
+//
+
+namespace vmath_hpp
+{
+    template < std::size_t... Is, typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, sizeof...(Is)> swizzle(const vec<T, Size>& xs) {
+        static_assert(((Is < Size) && ...), "swizzle index out of range");
+        // constant indices: the component switch folds away at -O1 and above
+        return { xs[Is]... };
+    }
+}
+
+//
+// Geometric Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, typename U, std::size_t Size
+             , typename V = decltype(std::declval<T>() * std::declval<U>()) >
+    [[nodiscard]] constexpr V dot(const vec<T, Size>& xs, const vec<U, Size>& ys) {
+        return fold1_plus_join([](T x, U y){ return x * y; }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T length(const vec<T, Size>& xs) {
+        return sqrt(dot(xs, xs));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T rlength(const vec<T, Size>& xs) {
+        return rsqrt(dot(xs, xs));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T length2(const vec<T, Size>& xs) {
+        return dot(xs, xs);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T rlength2(const vec<T, Size>& xs) {
+        return rcp(dot(xs, xs));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return length(xs - ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance2(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return length2(xs - ys);
+    }
+
+    template < typename T, typename U
+             , typename V = decltype(std::declval<T>() * std::declval<U>()) >
+    [[nodiscard]] constexpr V cross(const vec<T, 2>& xs, const vec<U, 2>& ys) {
+        return { xs.x * ys.y - xs.y * ys.x };
+    }
+
+    template < typename T, typename U
+             , typename V = decltype(std::declval<T>() * std::declval<U>()) >
+    [[nodiscard]] constexpr vec<V, 3> cross(const vec<T, 3>& xs, const vec<U, 3>& ys) {
+        return
+            swizzle<1, 2, 0>(xs) * swizzle<2, 0, 1>(ys) -
+            swizzle<2, 0, 1>(xs) * swizzle<1, 2, 0>(ys);
+    }
+
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, Size> normalize_impl(const vec<T, Size>& xs) {
+        return xs * rlength(xs);
+    }
+}
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> normalize(const vec<T, Size>& xs) {
+        VMATH_HPP_INSTRUMENT_CALL(normalize, 3 * Size);
+        return VMATH_HPP_CHECK_RESULT("normalize", impl::normalize_impl(xs));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> normalize_or(const vec<T, Size>& xs, const vec<T, Size>& fallback) {
+        // both sides are computed and selected, loops over it still vectorize
+        const T l2 = dot(xs, xs);
+        const bool valid = l2 >= std::numeric_limits<T>::min();
+        const vec<T, Size> ns = xs * rsqrt(valid ? l2 : T{1});
+        return valid ? ns : fallback;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] vec<T, Size> normalize_fast(const vec<T, Size>& xs) {
+        return xs * fast_rsqrt(dot(xs, xs));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr std::pair<vec<T, Size>, T> normalize_length(const vec<T, Size>& xs) {
+        const T l = length(xs);
+        return {xs * rcp(l), l};
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> faceforward(const vec<T, Size>& n, const vec<T, Size>& i, const vec<T, Size>& nref) {
+        return dot(nref, i) < T{0} ? n : -n;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> reflect(const vec<T, Size>& i, const vec<T, Size>& n) {
+        return i - T{2} * dot(n, i) * n;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> refract(const vec<T, Size>& i, const vec<T, Size>& n, T eta) {
+        const T d = dot(n, i);
+        const T k = T{1} - sqr(eta) * (T{1} - sqr(d));
+        return k < T{0} ? vec<T, Size>{T{0}} : (eta * i - (eta * d + sqrt(k)) * n);
+    }
+}
+
+//
+// Relational Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size
+             , typename U = decltype(any(std::declval<T>())) >
+    [[nodiscard]] constexpr U any(const vec<T, Size>& xs) {
+        return fold1_or_join([](T x){ return any(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size
+             , typename U = decltype(all(std::declval<T>())) >
+    [[nodiscard]] constexpr U all(const vec<T, Size>& xs) {
+        return fold1_and_join([](T x){ return all(x); }, xs);
+    }
+
+    template < typename T, std::size_t Size
+             , typename U = decltype(approx(
+                 std::declval<T>(),
+                 std::declval<T>())) >
+    [[nodiscard]] constexpr vec<U, Size> approx(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return approx(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size
+             , typename U = decltype(approx(
+                 std::declval<T>(),
+                 std::declval<T>(),
+                 std::declval<T>())) >
+    [[nodiscard]] constexpr vec<U, Size> approx(const vec<T, Size>& xs, const vec<T, Size>& ys, T epsilon) {
+        return map_join([epsilon](T x, T y){ return approx(x, y, epsilon); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size
+             , typename U = decltype(less(
+                 std::declval<T>(),
+                 std::declval<T>())) >
+    [[nodiscard]] constexpr vec<U, Size> less(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return less(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size
+             , typename U = decltype(less_equal(
+                 std::declval<T>(),
+                 std::declval<T>())) >
+    [[nodiscard]] constexpr vec<U, Size> less_equal(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return less_equal(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size
+             , typename U = decltype(greater(
+                 std::declval<T>(),
+                 std::declval<T>())) >
+    [[nodiscard]] constexpr vec<U, Size> greater(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return greater(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size
+             , typename U = decltype(greater_equal(
+                 std::declval<T>(),
+                 std::declval<T>())) >
+    [[nodiscard]] constexpr vec<U, Size> greater_equal(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return greater_equal(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size
+             , typename U = decltype(equal_to(
+                 std::declval<T>(),
+                 std::declval<T>())) >
+    [[nodiscard]] constexpr vec<U, Size> equal_to(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return equal_to(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size
+             , typename U = decltype(not_equal_to(
+                 std::declval<T>(),
+                 std::declval<T>())) >
+    [[nodiscard]] constexpr vec<U, Size> not_equal_to(const vec<T, Size>& xs, const vec<T, Size>& ys) {
+        return map_join([](T x, T y){ return not_equal_to(x, y); }, xs, ys);
+    }
+}
+
+namespace vmath_hpp::detail
+{
+    // a shape conversion either truncates both sizes or extends both sizes
+
+    template < std::size_t Rows, std::size_t Cols, std::size_t FromRows, std::size_t FromCols >
+    inline constexpr bool is_mat_reshape_v =
+        (Rows != FromRows || Cols != FromCols) &&
+        ((Rows <= FromRows && Cols <= FromCols) || (Rows >= FromRows && Cols >= FromCols));
+
+    template < typename T, std::size_t Cols, typename U, std::size_t FromRows, std::size_t FromCols >
+    [[nodiscard]] constexpr vec<T, Cols> mat_reshape_row(
+        const vec<U, FromCols> (&rows)[FromRows], // NOLINT(*-avoid-c-arrays)
+        std::size_t i)
+    {
+        // the common part is copied, the rest is taken from the identity
+        vec<T, Cols> r{zero_init};
+        for ( std::size_t j = 0; j < Cols; ++j ) {
+            if ( i < FromRows && j < FromCols ) {
+                r[j] = static_cast<T>(rows[i][j]);
+            } else if ( i == j ) {
+                r[j] = T{1};
+            }
+        }
+        return r;
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols = Rows >
+    class mat_base {
+        static_assert(Rows > 1 && Cols > 1, "mat sizes must be greater than one");
+    public:
+        using row_type = vec<T, Cols>;
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        row_type rows[Rows];
+    public:
+        constexpr mat_base()
+        : mat_base(identity_init) {}
+
+        constexpr mat_base(no_init_t)
+        : mat_base(std::make_index_sequence<Rows>{}, [](std::size_t){ return row_type{no_init}; }) {}
+
+        constexpr mat_base(zero_init_t)
+        : mat_base(std::make_index_sequence<Rows>{}, [](std::size_t){ return row_type{zero_init}; }) {}
+
+        constexpr mat_base(unit_init_t)
+        : mat_base(std::make_index_sequence<Rows>{}, [](std::size_t){ return row_type{unit_init}; }) {}
+
+        constexpr mat_base(identity_init_t): mat_base{T{1}} {}
+
+        constexpr explicit mat_base(T d)
+        : mat_base(std::make_index_sequence<Rows>{}, [d](std::size_t i){
+            row_type r{zero_init};
+            if ( i < Cols ) {
+                r[i] = d;
+            }
+            return r;
+        }) {}
+
+        // the diagonal has min(Rows, Cols) components
+        constexpr explicit mat_base(const vec<T, (Rows < Cols ? Rows : Cols)>& d)
+        : mat_base(std::make_index_sequence<Rows>{}, [&d](std::size_t i){
+            row_type r{zero_init};
+            if ( i < Cols ) {
+                r[i] = d[i];
+            }
+            return r;
+        }) {}
+
+        template < typename... Ts, std::enable_if_t<
+            (sizeof...(Ts) == Rows * Cols) &&
+            (... && std::is_convertible_v<Ts, T>)
+        , int> = 0 >
+        constexpr mat_base(Ts... xs)
+        : mat_base(std::make_index_sequence<Rows>{}, [xs...](std::size_t i){
+            // NOLINTNEXTLINE(*-avoid-c-arrays)
+            const T ms[]{static_cast<T>(xs)...};
+            return row_type{ms + i * Cols};
+        }) {}
+
+        template < typename... Rs, std::enable_if_t<
+            (sizeof...(Rs) == Rows) &&
+            (... && std::is_same_v<Rs, row_type>)
+        , int> = 0 >
+        constexpr mat_base(const Rs&... rs)
+        : rows{rs...} {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr mat_base(const mat_base<U, Rows, Cols>& other)
+        : mat_base(std::make_index_sequence<Rows>{}, [&other](std::size_t i){ return row_type{other.rows[i]}; }) {}
+
+        template < typename U, std::size_t FromRows, std::size_t FromCols, std::enable_if_t<
+            std::is_convertible_v<U, T> &&
+            is_mat_reshape_v<Rows, Cols, FromRows, FromCols>
+        , int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, FromRows, FromCols>& other)
+        : mat_base(std::make_index_sequence<Rows>{}, [&other](std::size_t i){ return mat_reshape_row<T, Cols>(other.rows, i); }) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit mat_base(const U* p)
+        : mat_base(std::make_index_sequence<Rows>{}, [p](std::size_t i){ return row_type{p + i * Cols}; }) {}
+    private:
+        template < std::size_t... Is, typename F >
+        constexpr mat_base(std::index_sequence<Is...>, F&& f)
+        : rows{f(Is)...} {}
+    };
+
+    template < typename T >
+    class mat_base<T, 2, 2> {
+    public:
+        using row_type = vec<T, 2>;
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        row_type rows[2]{no_init, no_init};
+    public:
+        constexpr mat_base()
+        : mat_base(identity_init) {}
+
+        constexpr mat_base(no_init_t) {}
+        constexpr mat_base(zero_init_t): mat_base{zero_init, zero_init} {}
+        constexpr mat_base(unit_init_t): mat_base{unit_init, unit_init} {}
+        constexpr mat_base(identity_init_t): mat_base{T{1}} {}
+
+        constexpr explicit mat_base(T d)
+        : rows{
+            {d, T{0}},
+            {T{0}, d}} {}
+
+        constexpr explicit mat_base(const row_type& d)
+        : rows{
+            {d[0], T{0}},
+            {T{0}, d[1]}} {}
+
+        constexpr mat_base(
+            T m11, T m12,
+            T m21, T m22)
+        : rows{
+            {m11, m12},
+            {m21, m22}} {}
+
+        constexpr mat_base(
+            const row_type& row0,
+            const row_type& row1)
+        : rows{row0, row1} {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr mat_base(const mat_base<U, 2>& other): mat_base(
+            row_type{other.rows[0]},
+            row_type{other.rows[1]}) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, 3>& other): mat_base(
+            row_type{other.rows[0]},
+            row_type{other.rows[1]}) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, 4>& other): mat_base(
+            row_type{other.rows[0]},
+            row_type{other.rows[1]}) {}
+
+        template < typename U, std::size_t FromRows, std::size_t FromCols, std::enable_if_t<
+            std::is_convertible_v<U, T> && FromRows != FromCols &&
+            is_mat_reshape_v<2, 2, FromRows, FromCols>
+        , int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, FromRows, FromCols>& other): mat_base(
+            mat_reshape_row<T, 2>(other.rows, 0),
+            mat_reshape_row<T, 2>(other.rows, 1)) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit mat_base(const U* p): mat_base(
+            row_type{p + 0u * row_type::size},
+            row_type{p + 1u * row_type::size}) {}
+    };
+
+    template < typename T >
+    class mat_base<T, 3, 3> {
+    public:
+        using row_type = vec<T, 3>;
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        row_type rows[3]{no_init, no_init, no_init};
+    public:
+        constexpr mat_base()
+        : mat_base(identity_init) {}
+
+        constexpr mat_base(no_init_t) {}
+        constexpr mat_base(zero_init_t): mat_base{zero_init, zero_init, zero_init} {}
+        constexpr mat_base(unit_init_t): mat_base{unit_init, unit_init, unit_init} {}
+        constexpr mat_base(identity_init_t): mat_base{T{1}} {}
+
+        constexpr explicit mat_base(T d)
+        : rows{
+            {d, T{0}, T{0}},
+            {T{0}, d, T{0}},
+            {T{0}, T{0}, d}} {}
+
+        constexpr explicit mat_base(const row_type& d)
+        : rows{
+            {d[0], T{0}, T{0}},
+            {T{0}, d[1], T{0}},
+            {T{0}, T{0}, d[2]}} {}
+
+        constexpr mat_base(
+            T m11, T m12, T m13,
+            T m21, T m22, T m23,
+            T m31, T m32, T m33)
+        : rows{
+            {m11, m12, m13},
+            {m21, m22, m23},
+            {m31, m32, m33}} {}
+
+        constexpr mat_base(
+            const row_type& row0,
+            const row_type& row1,
+            const row_type& row2)
+        : rows{row0, row1, row2} {}
+
+        constexpr mat_base(
+            const mat_base<T, 2>& m,
+            const vec_base<T, 2>& v)
+        : rows{
+            {m.rows[0], T{0}},
+            {m.rows[1], T{0}},
+            {v, T{1}}} {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr mat_base(const mat_base<U, 3>& other): mat_base(
+            row_type{other.rows[0]},
+            row_type{other.rows[1]},
+            row_type{other.rows[2]}) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, 2>& other): mat_base(
+            row_type{other.rows[0], T{0}},
+            row_type{other.rows[1], T{0}},
+            row_type{T{0}, T{0}, T{1}}) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, 4>& other): mat_base(
+            row_type{other.rows[0]},
+            row_type{other.rows[1]},
+            row_type{other.rows[2]}) {}
+
+        template < typename U, std::size_t FromRows, std::size_t FromCols, std::enable_if_t<
+            std::is_convertible_v<U, T> && FromRows != FromCols &&
+            is_mat_reshape_v<3, 3, FromRows, FromCols>
+        , int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, FromRows, FromCols>& other): mat_base(
+            mat_reshape_row<T, 3>(other.rows, 0),
+            mat_reshape_row<T, 3>(other.rows, 1),
+            mat_reshape_row<T, 3>(other.rows, 2)) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit mat_base(const U* p): mat_base(
+            row_type{p + 0u * row_type::size},
+            row_type{p + 1u * row_type::size},
+            row_type{p + 2u * row_type::size}) {}
+    };
+
+    template < typename T >
+    class mat_base<T, 4, 4> {
+    public:
+        using row_type = vec<T, 4>;
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        row_type rows[4]{no_init, no_init, no_init, no_init};
+    public:
+        constexpr mat_base()
+        : mat_base(identity_init) {}
+
+        constexpr mat_base(no_init_t) {}
+        constexpr mat_base(zero_init_t): mat_base{zero_init, zero_init, zero_init, zero_init} {}
+        constexpr mat_base(unit_init_t): mat_base{unit_init, unit_init, unit_init, unit_init} {}
+        constexpr mat_base(identity_init_t): mat_base{T{1}} {}
+
+        constexpr explicit mat_base(T d)
+        : rows{
+            {d, T{0}, T{0}, T{0}},
+            {T{0}, d, T{0}, T{0}},
+            {T{0}, T{0}, d, T{0}},
+            {T{0}, T{0}, T{0}, d}} {}
+
+        constexpr explicit mat_base(const row_type& d)
+        : rows{
+            {d[0], T{0}, T{0}, T{0}},
+            {T{0}, d[1], T{0}, T{0}},
+            {T{0}, T{0}, d[2], T{0}},
+            {T{0}, T{0}, T{0}, d[3]}} {}
+
+        constexpr mat_base(
+            T m11, T m12, T m13, T m14,
+            T m21, T m22, T m23, T m24,
+            T m31, T m32, T m33, T m34,
+            T m41, T m42, T m43, T m44)
+        : rows{
+            {m11, m12, m13, m14},
+            {m21, m22, m23, m24},
+            {m31, m32, m33, m34},
+            {m41, m42, m43, m44}} {}
+
+        constexpr mat_base(
+            const row_type& row0,
+            const row_type& row1,
+            const row_type& row2,
+            const row_type& row3)
+        : rows{row0, row1, row2, row3} {}
+
+        constexpr mat_base(
+            const mat_base<T, 3>& m,
+            const vec_base<T, 3>& v)
+        : rows{
+            {m.rows[0], T{0}},
+            {m.rows[1], T{0}},
+            {m.rows[2], T{0}},
+            {v, T{1}}} {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr mat_base(const mat_base<U, 4>& other): mat_base(
+            row_type{other.rows[0]},
+            row_type{other.rows[1]},
+            row_type{other.rows[2]},
+            row_type{other.rows[3]}) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, 2>& other): mat_base(
+            row_type{other.rows[0], T{0}, T{0}},
+            row_type{other.rows[1], T{0}, T{0}},
+            row_type{T{0}, T{0}, T{1}, T{0}},
+            row_type{T{0}, T{0}, T{0}, T{1}}) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, 3>& other): mat_base(
+            row_type{other.rows[0], T{0}},
+            row_type{other.rows[1], T{0}},
+            row_type{other.rows[2], T{0}},
+            row_type{T{0}, T{0}, T{0}, T{1}}) {}
+
+        template < typename U, std::size_t FromRows, std::size_t FromCols, std::enable_if_t<
+            std::is_convertible_v<U, T> && FromRows != FromCols &&
+            is_mat_reshape_v<4, 4, FromRows, FromCols>
+        , int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, FromRows, FromCols>& other): mat_base(
+            mat_reshape_row<T, 4>(other.rows, 0),
+            mat_reshape_row<T, 4>(other.rows, 1),
+            mat_reshape_row<T, 4>(other.rows, 2),
+            mat_reshape_row<T, 4>(other.rows, 3)) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit mat_base(const U* p): mat_base(
+            row_type{p + 0u * row_type::size},
+            row_type{p + 1u * row_type::size},
+            row_type{p + 2u * row_type::size},
+            row_type{p + 3u * row_type::size}) {}
+    };
+}
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    class mat final : public detail::mat_base<T, Rows, Cols> {
+    public:
+        using self_type = mat;
+        using base_type = detail::mat_base<T, Rows, Cols>;
+        using component_type = T;
+
+        using row_type = vec<T, Cols>;
+        using column_type = vec<T, Rows>;
+
+        using pointer = row_type*;
+        using const_pointer = const row_type*;
+
+        using reference = row_type&;
+        using const_reference = const row_type&;
+
+        using iterator = pointer;
+        using const_iterator = const_pointer;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static inline constexpr std::size_t size = Rows;
+    public:
+        using base_type::mat_base;
+        using base_type::rows;
+
+        // NOLINTNEXTLINE(*-noexcept-swap)
+        void swap(mat& other) noexcept(std::is_nothrow_swappable_v<T>) {
+            for ( std::size_t i = 0; i < Rows; ++i ) {
+                using std::swap;
+                swap(rows[i], other.rows[i]);
+            }
+        }
+
+        [[nodiscard]] iterator begin() noexcept { return iterator(data()); }
+        [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(data()); }
+        [[nodiscard]] iterator end() noexcept { return iterator(data() + Rows); }
+        [[nodiscard]] const_iterator end() const noexcept { return const_iterator(data() + Rows); }
+
+        [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        [[nodiscard]] reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        [[nodiscard]] const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+        [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+        [[nodiscard]] const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+        [[nodiscard]] const_reverse_iterator crend() const noexcept { return rend(); }
+
+        [[nodiscard]] pointer data() noexcept {
+            return &rows[0];
+        }
+
+        [[nodiscard]] const_pointer data() const noexcept {
+            return &rows[0];
+        }
+
+        [[nodiscard]] constexpr reference at(std::size_t index) {
+            VMATH_HPP_THROW_IF(index >= size, std::out_of_range("mat::at"));
+            return rows[index];
+        }
+
+        [[nodiscard]] constexpr const_reference at(std::size_t index) const {
+            VMATH_HPP_THROW_IF(index >= size, std::out_of_range("mat::at"));
+            return rows[index];
+        }
+
+        [[nodiscard]] constexpr reference operator[](std::size_t index) noexcept {
+            return rows[index];
+        }
+
+        [[nodiscard]] constexpr const_reference operator[](std::size_t index) const noexcept {
+            return rows[index];
+        }
+    };
+}
+
+namespace vmath_hpp
+{
+    // mat2
+
+    template < typename T >
+    mat(T, T, T, T) -> mat<T, 2>;
+
+    template < typename T >
+    mat(const vec<T, 2>&, const vec<T, 2>&) -> mat<T, 2>;
+
+    template < typename T >
+    mat(std::initializer_list<T>, std::initializer_list<T>) -> mat<T, 2>;
+
+    // mat3
+
+    template < typename T >
+    mat(T, T, T, T, T, T, T, T, T) -> mat<T, 3>;
+
+    template < typename T >
+    mat(const vec<T, 3>&, const vec<T, 3>&, const vec<T, 3>&) -> mat<T, 3>;
+
+    template < typename T >
+    mat(const mat<T, 2>&, const vec<T, 2>&) -> mat<T, 3>;
+
+    template < typename T >
+    mat(std::initializer_list<T>, std::initializer_list<T>, std::initializer_list<T>) -> mat<T, 3>;
+
+    // mat4
+
+    template < typename T >
+    mat(T, T, T, T, T, T, T, T, T, T, T, T, T, T, T, T) -> mat<T, 4>;
+
+    template < typename T >
+    mat(const vec<T, 4>&, const vec<T, 4>&, const vec<T, 4>&, const vec<T, 4>&) -> mat<T, 4>;
+
+    template < typename T >
+    mat(const mat<T, 3>&, const vec<T, 3>&) -> mat<T, 4>;
+
+    template < typename T >
+    mat(std::initializer_list<T>, std::initializer_list<T>, std::initializer_list<T>, std::initializer_list<T>) -> mat<T, 4>;
+
+    // matRxC
+
+    template < typename T, std::size_t Cols, typename... Rs, std::enable_if_t<
+        (... && std::is_same_v<vec<T, Cols>, Rs>)
+    , int> = 0 >
+    mat(const vec<T, Cols>&, const Rs&...) -> mat<T, 1 + sizeof...(Rs), Cols>;
+
+    // swap
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    // NOLINTNEXTLINE(*-noexcept-swap)
+    void swap(mat<T, Rows, Cols>& l, mat<T, Rows, Cols>& r) noexcept(noexcept(l.swap(r))) {
+        l.swap(r);
+    }
+}
+
+namespace vmath_hpp::detail
+{
+    // the rows are packed vectors, so the matrix is a packed row-major array
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    inline constexpr bool is_packed_mat_v =
+        std::is_standard_layout_v<mat<T, Rows, Cols>> &&
+        std::is_trivially_copyable_v<mat<T, Rows, Cols>> &&
+        sizeof(mat<T, Rows, Cols>) == sizeof(T) * Rows * Cols;
+
+    static_assert(is_packed_mat_v<float, 2, 2> && is_packed_mat_v<float, 3, 3> && is_packed_mat_v<float, 4, 4>);
+    static_assert(is_packed_mat_v<double, 2, 2> && is_packed_mat_v<double, 3, 3> && is_packed_mat_v<double, 4, 4>);
+    static_assert(is_packed_mat_v<float, 3, 4> && is_packed_mat_v<int, 4, 4>);
+}
+
+namespace vmath_hpp::detail::impl
+{
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const mat<A, Rows, Cols>& a,
+        std::index_sequence<Is...>)
+    {
+        return mat{ f(a[Is])... };
+    }
+
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const mat<A, Rows, Cols>& a,
+        const mat<B, Rows, Cols>& b,
+        std::index_sequence<Is...>)
+    {
+        return mat{ f(a[Is], b[Is])... };
+    }
+
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        A init,
+        const mat<B, Rows, Cols>& b,
+        std::index_sequence<Is...>)
+    {
+        return ((init = f(std::move(init), b[Is])), ...);
+    }
+
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_and_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const mat<A, Rows, Cols>& a,
+        std::index_sequence<Is...>)
+    {
+        return (... && f(a[Is]));
+    }
+
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_and_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const mat<A, Rows, Cols>& a,
+        const mat<B, Rows, Cols>& b,
+        std::index_sequence<Is...>)
+    {
+        return (... && f(a[Is], b[Is]));
+    }
+
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_or_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const mat<A, Rows, Cols>& a,
+        std::index_sequence<Is...>)
+    {
+        return (... || f(a[Is]));
+    }
+
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_or_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const mat<A, Rows, Cols>& a,
+        const mat<B, Rows, Cols>& b,
+        std::index_sequence<Is...>)
+    {
+        return (... || f(a[Is], b[Is]));
+    }
+
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_plus_join_impl(
+        F&& f, // NOLINT(*-missing-std-forward)
+        const vec<A, Rows>& a,
+        const mat<B, Rows, Cols>& b,
+        std::index_sequence<Is...>)
+    {
+        return (... + f(a[Is], b[Is]));
+    }
+}
+
+namespace vmath_hpp::detail
+{
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join(F&& f, const mat<A, Rows, Cols>& a) {
+        return impl::map_join_impl(std::forward<F>(f), a, std::make_index_sequence<Rows>{});
+    }
+
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join(F&& f, const mat<A, Rows, Cols>& a, const mat<B, Rows, Cols>& b) {
+        return impl::map_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Rows>{});
+    }
+
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold_join(F&& f, A init, const mat<B, Rows, Cols>& b) {
+        return impl::fold_join_impl(std::forward<F>(f), std::move(init), b, std::make_index_sequence<Rows>{});
+    }
+
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_and_join(F&& f, const mat<A, Rows, Cols>& a) {
+        return impl::fold1_and_join_impl(std::forward<F>(f), a, std::make_index_sequence<Rows>{});
+    }
+
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_and_join(F&& f, const mat<A, Rows, Cols>& a, const mat<B, Rows, Cols>& b) {
+        return impl::fold1_and_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Rows>{});
+    }
+
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_or_join(F&& f, const mat<A, Rows, Cols>& a) {
+        return impl::fold1_or_join_impl(std::forward<F>(f), a, std::make_index_sequence<Rows>{});
+    }
+
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_or_join(F&& f, const mat<A, Rows, Cols>& a, const mat<B, Rows, Cols>& b) {
+        return impl::fold1_or_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Rows>{});
+    }
+
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold1_plus_join(F&& f, const vec<A, Rows>& a, const mat<B, Rows, Cols>& b) {
+        return impl::fold1_plus_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Rows>{});
+    }
+}
+
+//
+// Operators
+//
+
+namespace vmath_hpp::impl
+{
+    // unchecked vec * mat, for the operators built on top of it
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto mul_impl(const vec<T, Rows>& xs, const mat<U, Rows, Cols>& ys) {
+        return fold1_plus_join([](T x, const vec<U, Cols>& y){ return x * y; }, xs, ys);
+    }
+}
+
+namespace vmath_hpp
+{
+    // +operator
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator+(const mat<T, Rows, Cols>& xs) {
+        return map_join([](const vec<T, Cols>& x){ return +x; }, xs);
+    }
+
+    // -operator
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator-(const mat<T, Rows, Cols>& xs) {
+        return map_join([](const vec<T, Cols>& x){ return -x; }, xs);
+    }
+
+    // ~operator
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator~(const mat<T, Rows, Cols>& xs) {
+        return map_join([](const vec<T, Cols>& x){ return ~x; }, xs);
+    }
+
+    // !operator
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator!(const mat<T, Rows, Cols>& xs) {
+        return map_join([](const vec<T, Cols>& x){ return !x; }, xs);
+    }
+
+    // ++operator
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator++(mat<T, Rows, Cols>& xs) {
+        return (xs = xs + T{1});
+    }
+
+    // --operator
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator--(mat<T, Rows, Cols>& xs) {
+        return (xs = xs - T{1});
+    }
+
+    // operator++
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols> operator++(mat<T, Rows, Cols>& xs, int) {
+        mat<T, Rows, Cols> ys = xs;
+        ++xs;
+        return ys;
+    }
+
+    // operator--
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols> operator--(mat<T, Rows, Cols>& xs, int) {
+        mat<T, Rows, Cols> ys = xs;
+        --xs;
+        return ys;
+    }
+
+    // operator+
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator+(const mat<T, Rows, Cols>& xs, U y) {
+        return map_join([y](const vec<T, Cols>& x){ return x + y; }, xs);
+    }
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator+(T x, const mat<U, Rows, Cols>& ys) {
+        return map_join([x](const vec<U, Cols>& y){ return x + y; }, ys);
+    }
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator+(const mat<T, Rows, Cols>& xs, const mat<U, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<U, Cols>& y){ return x + y; }, xs, ys);
+    }
+
+    // operator+=
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator+=(mat<T, Rows, Cols>& xs, T y) {
+        return (xs = (xs + y));
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator+=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return (xs = (xs + ys));
+    }
+
+    // operator-
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator-(const mat<T, Rows, Cols>& xs, U y) {
+        return map_join([y](const vec<T, Cols>& x){ return x - y; }, xs);
+    }
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator-(T x, const mat<U, Rows, Cols>& ys) {
+        return map_join([x](const vec<U, Cols>& y){ return x - y; }, ys);
+    }
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator-(const mat<T, Rows, Cols>& xs, const mat<U, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<U, Cols>& y){ return x - y; }, xs, ys);
+    }
+
+    // operator-=
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator-=(mat<T, Rows, Cols>& xs, T y) {
+        return (xs = (xs - y));
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator-=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return (xs = (xs - ys));
+    }
+
+    // operator*
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator*(const mat<T, Rows, Cols>& xs, U y) {
+        return map_join([y](const vec<T, Cols>& x){ return x * y; }, xs);
+    }
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator*(T x, const mat<U, Rows, Cols>& ys) {
+        return map_join([x](const vec<U, Cols>& y){ return x * y; }, ys);
+    }
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator*(const vec<T, Rows>& xs, const mat<U, Rows, Cols>& ys) {
+        return VMATH_HPP_CHECK_RESULT("vec * mat", impl::mul_impl(xs, ys));
+    }
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Size, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator*(const mat<T, Rows, Size>& xs, const mat<U, Size, Cols>& ys) {
+        VMATH_HPP_INSTRUMENT_CALL(mat_mul, Rows * Cols * (2 * Size - 1));
+        return VMATH_HPP_CHECK_RESULT("mat * mat", map_join([&ys](const vec<T, Size>& x){ return impl::mul_impl(x, ys); }, xs));
+    }
+
+    // operator*=
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator*=(mat<T, Rows, Cols>& xs, T y) {
+        return (xs = (xs * y));
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr vec<T, Size>& operator*=(vec<T, Size>& xs, const mat<T, Size>& ys) {
+        return (xs = (xs * ys));
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator*=(mat<T, Rows, Cols>& xs, const mat<T, Cols>& ys) {
+        return (xs = (xs * ys));
+    }
+
+    // operator/
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator/(const mat<T, Rows, Cols>& xs, U y) {
+        return map_join([y](const vec<T, Cols>& x){ return x / y; }, xs);
+    }
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator/(T x, const mat<U, Rows, Cols>& ys) {
+        return map_join([x](const vec<U, Cols>& y){ return x / y; }, ys);
+    }
+
+    // operator/=
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator/=(mat<T, Rows, Cols>& xs, T y) {
+        return (xs = (xs / y));
+    }
+
+    // operator&
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x & y; }, xs);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x & y; }, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x & y; }, xs, ys);
+    }
+
+    // operator&=
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator&=(mat<T, Rows, Cols>& xs, T y) {
+        return (xs = (xs & y));
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator&=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return (xs = (xs & ys));
+    }
+
+    // operator|
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator|(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x | y; }, xs);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator|(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x | y; }, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator|(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x | y; }, xs, ys);
+    }
+
+    // operator|=
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator|=(mat<T, Rows, Cols>& xs, T y) {
+        return (xs = (xs | y));
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator|=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return (xs = (xs | ys));
+    }
+
+    // operator^
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator^(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x ^ y; }, xs);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator^(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x ^ y; }, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator^(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x ^ y; }, xs, ys);
+    }
+
+    // operator^=
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator^=(mat<T, Rows, Cols>& xs, T y) {
+        return (xs = (xs ^ y));
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator^=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return (xs = (xs ^ ys));
+    }
+
+    // operator<<
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator<<(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x << y; }, xs);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator<<(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x << y; }, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator<<(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x << y; }, xs, ys);
+    }
+
+    // operator<<=
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator<<=(mat<T, Rows, Cols>& xs, T y) {
+        return (xs = (xs << y));
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator<<=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return (xs = (xs << ys));
+    }
+
+    // operator>>
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator>>(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x >> y; }, xs);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator>>(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x >> y; }, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator>>(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x >> y; }, xs, ys);
+    }
+
+    // operator>>=
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator>>=(mat<T, Rows, Cols>& xs, T y) {
+        return (xs = (xs >> y));
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator>>=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return (xs = (xs >> ys));
+    }
+
+    // operator&&
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&&(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x && y; }, xs);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&&(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x && y; }, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&&(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x && y; }, xs, ys);
+    }
+
+    // operator||
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator||(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x || y; }, xs);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator||(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x || y; }, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator||(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x || y; }, xs, ys);
+    }
+
+    // operator==
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr bool operator==(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return fold1_and_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x == y; }, xs, ys);
+    }
+
+    // operator!=
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr bool operator!=(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return fold1_or_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x != y; }, xs, ys);
+    }
+
+    // operator<
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr bool operator<(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        for ( std::size_t i = 0; i < Rows; ++i ) {
+            if ( xs[i] < ys[i] ) {
+                return true;
+            }
+            if ( ys[i] < xs[i] ) {
+                return false;
+            }
+        }
+        return false;
+    }
+}
+
+//
+// Relational Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = decltype(any(std::declval<vec<T, Cols>>())) >
+    [[nodiscard]] constexpr U any(const mat<T, Rows, Cols>& xs) {
+        return fold1_or_join([](const vec<T, Cols>& x){ return any(x); }, xs);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = decltype(all(std::declval<vec<T, Cols>>())) >
+    [[nodiscard]] constexpr U all(const mat<T, Rows, Cols>& xs) {
+        return fold1_and_join([](const vec<T, Cols>& x){ return all(x); }, xs);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = typename decltype(approx(
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> approx(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return approx(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = typename decltype(approx(
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<T>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> approx(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys, T epsilon) {
+        return map_join([epsilon](const vec<T, Cols>& x, const vec<T, Cols>& y){ return approx(x, y, epsilon); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = typename decltype(less(
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> less(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return less(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = typename decltype(less_equal(
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> less_equal(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return less_equal(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = typename decltype(greater(
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> greater(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return greater(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = typename decltype(greater_equal(
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> greater_equal(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return greater_equal(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = typename decltype(equal_to(
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> equal_to(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return equal_to(x, y); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = typename decltype(not_equal_to(
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> not_equal_to(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return not_equal_to(x, y); }, xs, ys);
+    }
+}
+
+//
+// Matrix Functions
+//
+
+namespace vmath_hpp
+{
+    //
+    // transpose
+    //
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 2> transpose(const mat<T, 2>& _m) {
+        // NOLINTNEXTLINE(*-isolate-declaration)
+        const T a = _m[0][0], b = _m[0][1],
+                c = _m[1][0], d = _m[1][1];
+        return {
+            a, c,
+            b, d};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 3> transpose(const mat<T, 3>& _m) {
+        // NOLINTNEXTLINE(*-isolate-declaration)
+        const T a = _m[0][0], b = _m[0][1], c = _m[0][2],
+                d = _m[1][0], e = _m[1][1], f = _m[1][2],
+                g = _m[2][0], h = _m[2][1], i = _m[2][2];
+        return {
+            a, d, g,
+            b, e, h,
+            c, f, i};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> transpose(const mat<T, 4>& _m) {
+        // NOLINTNEXTLINE(*-isolate-declaration)
+        const T a = _m[0][0], b = _m[0][1], c = _m[0][2], d = _m[0][3],
+                e = _m[1][0], f = _m[1][1], g = _m[1][2], h = _m[1][3],
+                i = _m[2][0], j = _m[2][1], k = _m[2][2], l = _m[2][3],
+                m = _m[3][0], n = _m[3][1], o = _m[3][2], p = _m[3][3];
+        return {
+            a, e, i, m,
+            b, f, j, n,
+            c, g, k, o,
+            d, h, l, p};
+    }
+
+    namespace impl
+    {
+        template < typename T, std::size_t Rows, std::size_t Cols, std::size_t... Is >
+        [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+        vec<T, Rows> transpose_column_impl(const mat<T, Rows, Cols>& m, std::size_t index, std::index_sequence<Is...>) {
+            return { m[Is][index]... };
+        }
+
+        template < typename T, std::size_t Rows, std::size_t Cols, std::size_t... Is >
+        [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+        mat<T, Cols, Rows> transpose_impl(const mat<T, Rows, Cols>& m, std::index_sequence<Is...>) {
+            return { transpose_column_impl(m, Is, std::make_index_sequence<Rows>{})... };
+        }
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr mat<T, Cols, Rows> transpose(const mat<T, Rows, Cols>& m) {
+        return impl::transpose_impl(m, std::make_index_sequence<Cols>{});
+    }
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename T >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    mat<T, 4> adjugate_4(const mat<T, 4>& _m) {
+        /// REFERENCE:
+        /// https://www.geometrictools.com/Documentation/LaplaceExpansionTheorem.pdf
+
+        // NOLINTNEXTLINE(*-isolate-declaration)
+        const T a = _m[0][0], b = _m[0][1], c = _m[0][2], d = _m[0][3],
+                e = _m[1][0], f = _m[1][1], g = _m[1][2], h = _m[1][3],
+                i = _m[2][0], j = _m[2][1], k = _m[2][2], l = _m[2][3],
+                m = _m[3][0], n = _m[3][1], o = _m[3][2], p = _m[3][3];
+
+        // the 2x2 minors of the upper and the lower row pairs,
+        // every cofactor and the determinant are built from these twelve
+
+        const T s0 = a * f - b * e;
+        const T s1 = a * g - c * e;
+        const T s2 = a * h - d * e;
+        const T s3 = b * g - c * f;
+        const T s4 = b * h - d * f;
+        const T s5 = c * h - d * g;
+
+        const T c0 = i * n - j * m;
+        const T c1 = i * o - k * m;
+        const T c2 = i * p - l * m;
+        const T c3 = j * o - k * n;
+        const T c4 = j * p - l * n;
+        const T c5 = k * p - l * o;
+
+        return {
+            f * c5 - g * c4 + h * c3,
+            c * c4 - b * c5 - d * c3,
+            n * s5 - o * s4 + p * s3,
+            k * s4 - j * s5 - l * s3,
+            g * c2 - e * c5 - h * c1,
+            a * c5 - c * c2 + d * c1,
+            o * s2 - m * s5 - p * s1,
+            i * s5 - k * s2 + l * s1,
+            e * c4 - f * c2 + h * c0,
+            b * c2 - a * c4 - d * c0,
+            m * s4 - n * s2 + p * s0,
+            j * s2 - i * s4 - l * s0,
+            f * c1 - e * c3 - g * c0,
+            a * c3 - b * c1 + c * c0,
+            n * s1 - m * s3 - o * s0,
+            i * s3 - j * s1 + k * s0};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    T determinant_from_adjugate_4(const mat<T, 4>& m, const mat<T, 4>& adj) {
+        // the first row expansion, its cofactors are the first column of the adjugate
+        return
+            m[0][0] * adj[0][0] +
+            m[0][1] * adj[1][0] +
+            m[0][2] * adj[2][0] +
+            m[0][3] * adj[3][0];
+    }
+}
+
+namespace vmath_hpp
+{
+    //
+    // adjugate
+    //
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 2> adjugate(const mat<T, 2>& _m) {
+        // NOLINTNEXTLINE(*-isolate-declaration)
+        const T a = _m[0][0], b = _m[0][1],
+                c = _m[1][0], d = _m[1][1];
+        return {
+            +d,
+            -b,
+            -c,
+            +a};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 3> adjugate(const mat<T, 3>& _m) {
+        // NOLINTNEXTLINE(*-isolate-declaration)
+        const T a = _m[0][0], b = _m[0][1], c = _m[0][2],
+                d = _m[1][0], e = _m[1][1], f = _m[1][2],
+                g = _m[2][0], h = _m[2][1], i = _m[2][2];
+        return {
+            e * i - f * h,
+            c * h - b * i,
+            b * f - c * e,
+            f * g - d * i,
+            a * i - c * g,
+            c * d - a * f,
+            d * h - e * g,
+            b * g - a * h,
+            a * e - b * d};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> adjugate(const mat<T, 4>& m) {
+        return impl::adjugate_4(m);
+    }
+
+    //
+    // determinant
+    //
+
+    template < typename T >
+    [[nodiscard]] constexpr T determinant(const mat<T, 2>& _m) {
+        VMATH_HPP_INSTRUMENT_CALL(determinant, 3);
+
+        // NOLINTNEXTLINE(*-isolate-declaration)
+        const T a = _m[0][0], b = _m[0][1],
+                c = _m[1][0], d = _m[1][1];
+        return
+            a * d - b * c;
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr T determinant(const mat<T, 3>& _m) {
+        VMATH_HPP_INSTRUMENT_CALL(determinant, 14);
+
+        // NOLINTNEXTLINE(*-isolate-declaration)
+        const T a = _m[0][0], b = _m[0][1], c = _m[0][2],
+                d = _m[1][0], e = _m[1][1], f = _m[1][2],
+                g = _m[2][0], h = _m[2][1], i = _m[2][2];
+        return
+            + a * (e * i - f * h)
+            - b * (d * i - f * g)
+            + c * (d * h - e * g);
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr T determinant(const mat<T, 4>& _m) {
+        VMATH_HPP_INSTRUMENT_CALL(determinant, 47);
+
+        // NOLINTNEXTLINE(*-isolate-declaration)
+        const T a = _m[0][0], b = _m[0][1], c = _m[0][2], d = _m[0][3],
+                e = _m[1][0], f = _m[1][1], g = _m[1][2], h = _m[1][3],
+                i = _m[2][0], j = _m[2][1], k = _m[2][2], l = _m[2][3],
+                m = _m[3][0], n = _m[3][1], o = _m[3][2], p = _m[3][3];
+        return
+            + (a * f - b * e) * (k * p - l * o)
+            - (a * g - c * e) * (j * p - l * n)
+            + (a * h - d * e) * (j * o - k * n)
+            + (b * g - c * f) * (i * p - l * m)
+            - (b * h - d * f) * (i * o - k * m)
+            + (c * h - d * g) * (i * n - j * m);
+    }
+
+    //
+    // inverse
+    //
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr mat<T, Size> inverse(const mat<T, Size>& m) {
+        if constexpr ( Size == 4 ) {
+            VMATH_HPP_INSTRUMENT_CALL(inverse, 140);
+            const mat<T, 4> adj = adjugate(m);
+            return VMATH_HPP_CHECK_RESULT("inverse", adj * rcp(impl::determinant_from_adjugate_4(m, adj)));
+        } else {
+            VMATH_HPP_INSTRUMENT_CALL(inverse, Size * Size * (Size * Size - 1) + 1);
+            return VMATH_HPP_CHECK_RESULT("inverse", adjugate(m) * rcp(determinant(m)));
+        }
+    }
+
+    //
+    // inverse_determinant
+    //
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, std::pair<mat<T, Size>, T>>
+    constexpr inverse_determinant(const mat<T, Size>& m) {
+        // a singular matrix, or one whose inverse would overflow,
+        // gets a zero inverse and a zero determinant
+        const mat<T, Size> adj = adjugate(m);
+        const T det = [&m, &adj](){
+            if constexpr ( Size == 4 ) {
+                return impl::determinant_from_adjugate_4(m, adj);
+            } else {
+                return determinant(m);
+            }
+        }();
+        // rcp(det) <= max without dividing by zero, which isn't a constant expression
+        const bool regular = abs(det) >= rcp(std::numeric_limits<T>::max());
+        return {adj * (regular ? rcp(det) : T{0}), regular ? det : T{0}};
+    }
+
+    //
+    // mul_chain
+    //
+
+    template < typename X, typename... Xs >
+    [[nodiscard]] constexpr auto mul_chain(const X& x, const Xs&... xs) {
+        // vectors are rows and can only start a chain, so the left fold always
+        // turns it into a sequence of cheap vector-matrix products
+        return (x * ... * xs);
+    }
+
+    //
+    // symmetric_eigen
+    //
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr std::pair<vec<T, Size>, mat<T, Size>> symmetric_eigen(const mat<T, Size>& m) {
+        /// REFERENCE:
+        /// https://en.wikipedia.org/wiki/Jacobi_eigenvalue_algorithm
+
+        mat<T, Size> a = m;
+        mat<T, Size> v = identity_init;
+
+        // cyclic Jacobi converges quadratically, a fixed sweep count is enough for small matrices;
+        // a zero off-diagonal element selects the identity rotation instead of skipping it,
+        // so every matrix runs the same instructions and a batch of them can be vectorized
+        for ( unsigned sweep = 0; sweep < 6; ++sweep ) {
+            for ( std::size_t p = 0; p + 1 < Size; ++p ) {
+                for ( std::size_t q = p + 1; q < Size; ++q ) {
+                    const T apq = a[p][q];
+                    const bool zero = apq == T{0};
+
+                    const T theta = (a[q][q] - a[p][p]) * rcp(T{2} * (zero ? T{1} : apq));
+                    const T t = zero ? T{0} : copysign(rcp(abs(theta) + sqrt(sqr(theta) + T{1})), theta);
+                    const T c = rsqrt(sqr(t) + T{1});
+                    const T s = t * c;
+
+                    a[p][p] -= t * apq;
+                    a[q][q] += t * apq;
+                    a[p][q] = a[q][p] = T{0};
+
+                    for ( std::size_t r = 0; r < Size; ++r ) {
+                        if ( r == p || r == q ) {
+                            continue;
+                        }
+                        const T arp = a[r][p];
+                        const T arq = a[r][q];
+                        a[r][p] = a[p][r] = c * arp - s * arq;
+                        a[r][q] = a[q][r] = s * arp + c * arq;
+                    }
+
+                    for ( std::size_t i = 0; i < Size; ++i ) {
+                        const T vip = v[i][p];
+                        const T viq = v[i][q];
+                        v[i][p] = c * vip - s * viq;
+                        v[i][q] = s * vip + c * viq;
+                    }
+                }
+            }
+        }
+
+        vec<T, Size> d{no_init};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            d[i] = a[i][i];
+        }
+
+        // sort eigenvalues in descending order with a sorting network:
+        // the compare-exchange pairs are fixed and each one selects instead of swapping
+        for ( std::size_t i = 0; i + 1 < Size; ++i ) {
+            for ( std::size_t j = i + 1; j < Size; ++j ) {
+                const bool swap = d[i] < d[j];
+                const T di = d[i];
+                const T dj = d[j];
+                d[i] = swap ? dj : di;
+                d[j] = swap ? di : dj;
+                for ( std::size_t k = 0; k < Size; ++k ) {
+                    const T vki = v[k][i];
+                    const T vkj = v[k][j];
+                    v[k][i] = swap ? vkj : vki;
+                    v[k][j] = swap ? vki : vkj;
+                }
+            }
+        }
+
+        return {d, v};
+    }
+
+    //
+    // svd
+    //
+
+    template < typename T >
+    [[nodiscard]] constexpr std::tuple<mat<T, 3>, vec<T, 3>, mat<T, 3>> svd(const mat<T, 3>& m) {
+        /// REFERENCE:
+        /// https://pages.cs.wisc.edu/~sifakis/papers/SVD_TR1690.pdf
+
+        auto [eigenvalues, v] = symmetric_eigen(transpose(m) * m);
+        (void)eigenvalues;
+
+        // make V a proper rotation
+        const T flip = determinant(v) < T{0} ? T{-1} : T{1};
+        v[0][2] *= flip;
+        v[1][2] *= flip;
+        v[2][2] *= flip;
+
+        // columns of M * V are U columns scaled by the singular values
+        const mat<T, 3> bt = transpose(m * v);
+        const T tolerance = std::numeric_limits<T>::epsilon() * length2(bt[0]);
+
+        const vec<T, 3> u0 = length2(bt[0]) > T{0}
+            ? bt[0] * rlength(bt[0])
+            : vec<T, 3>{T{1}, T{0}, T{0}};
+
+        const vec<T, 3> u1_raw = bt[1] - dot(bt[1], u0) * u0;
+        const vec<T, 3> u1 = length2(u1_raw) > tolerance
+            ? u1_raw * rlength(u1_raw)
+            : normalize(abs(u0[0]) < T{0.9f}
+                ? cross(u0, vec<T, 3>{T{1}, T{0}, T{0}})
+                : cross(u0, vec<T, 3>{T{0}, T{1}, T{0}}));
+
+        const vec<T, 3> u2 = cross(u0, u1);
+
+        // the last singular value carries the sign of the determinant
+        const vec<T, 3> s{dot(bt[0], u0), dot(bt[1], u1), dot(bt[2], u2)};
+
+        return {transpose(mat<T, 3>{u0, u1, u2}), s, v};
+    }
+
+    //
+    // polar
+    //
+
+    template < typename T >
+    [[nodiscard]] constexpr std::pair<mat<T, 3>, mat<T, 3>> polar(const mat<T, 3>& m) {
+        /// REFERENCE:
+        /// https://en.wikipedia.org/wiki/Polar_decomposition
+
+        const auto [u, s, v] = svd(m);
+        const mat<T, 3> vt = transpose(v);
+        return {u * vt, v * mat<T, 3>{s} * vt};
+    }
+}
+
+namespace vmath_hpp::detail
+{
+    template < typename T >
+    class qua_base {
+    public:
+        vec<T, 3> v{no_init};
+        T s;
+    public:
+        constexpr qua_base()
+        : qua_base(identity_init) {}
+
+        constexpr qua_base(no_init_t) {}
+        constexpr qua_base(zero_init_t) : qua_base{zero_init, T{0}} {}
+        constexpr qua_base(identity_init_t) : qua_base{zero_init, T{1}} {}
+
+        constexpr qua_base(T vx, T vy, T vz, T s): v{vx, vy, vz}, s{s} {}
+        constexpr qua_base(const vec<T, 3>& v, T s): v{v}, s{s} {}
+        constexpr explicit qua_base(const vec<T, 4>& vs): v{vs[0], vs[1], vs[2]}, s{vs[3]} {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr qua_base(const qua_base<U>& other): qua_base(other.v, other.s) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<T, U>, int> = 0 >
+        constexpr explicit operator vec<U, 4>() const { return vec<U, 4>(v, s); }
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        // NOLINTNEXTLINE(*-pointer-arithmetic)
+        constexpr explicit qua_base(const U* p): qua_base(p[0], p[1], p[2], p[3]) {}
+
+        [[nodiscard]] constexpr T& operator[](std::size_t index) noexcept {
+            switch ( index ) {
+            default:
+            case 0: return v.x;
+            case 1: return v.y;
+            case 2: return v.z;
+            case 3: return s;
+            }
+        }
+
+        [[nodiscard]] constexpr const T& operator[](std::size_t index) const noexcept {
+            switch ( index ) {
+            default:
+            case 0: return v.x;
+            case 1: return v.y;
+            case 2: return v.z;
+            case 3: return s;
+            }
+        }
+    };
+}
+
+namespace vmath_hpp
+{
+    template < typename T >
+    class qua final : public detail::qua_base<T> {
+    public:
+        using self_type = qua;
+        using base_type = detail::qua_base<T>;
+        using component_type = T;
+
+        using imag_type = vec<T, 3>;
+        using real_type = T;
+
+        using pointer = component_type*;
+        using const_pointer = const component_type*;
+
+        using reference = component_type&;
+        using const_reference = const component_type&;
+
+        using iterator = pointer;
+        using const_iterator = const_pointer;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static inline constexpr std::size_t size = 4;
+    public:
+        using base_type::qua_base;
+        using base_type::operator[];
+
+        // NOLINTNEXTLINE(*-noexcept-swap)
+        void swap(qua& other) noexcept(std::is_nothrow_swappable_v<T>) {
+            for ( std::size_t i = 0; i < size; ++i ) {
+                using std::swap;
+                swap((*this)[i], other[i]);
+            }
+        }
+
+        [[nodiscard]] iterator begin() noexcept { return iterator(data()); }
+        [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(data()); }
+        [[nodiscard]] iterator end() noexcept { return iterator(data() + size); }
+        [[nodiscard]] const_iterator end() const noexcept { return const_iterator(data() + size); }
+
+        [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        [[nodiscard]] reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        [[nodiscard]] const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+        [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+        [[nodiscard]] const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+        [[nodiscard]] const_reverse_iterator crend() const noexcept { return rend(); }
+
+        [[nodiscard]] pointer data() noexcept {
+            return &(*this)[0];
+        }
+
+        [[nodiscard]] const_pointer data() const noexcept {
+            return &(*this)[0];
+        }
+
+        [[nodiscard]] constexpr reference at(std::size_t index) {
+            VMATH_HPP_THROW_IF(index >= size, std::out_of_range("qua::at"));
+            return (*this)[index];
+        }
+
+        [[nodiscard]] constexpr const_reference at(std::size_t index) const {
+            VMATH_HPP_THROW_IF(index >= size, std::out_of_range("qua::at"));
+            return (*this)[index];
+        }
+    };
+}
+
+namespace vmath_hpp
+{
+    // vec
+
+    template < typename T >
+    vec(const qua<T>&) -> vec<T, 4>;
+
+    // qua
+
+    template < typename T >
+    qua(T, T, T, T) -> qua<T>;
+
+    template < typename T >
+    qua(const vec<T, 3>&, T) -> qua<T>;
+
+    template < typename T >
+    qua(const vec<T, 4>&) -> qua<T>;
+
+    template < typename T >
+    qua(std::initializer_list<T>) -> qua<T>;
+
+    // swap
+
+    template < typename T >
+    // NOLINTNEXTLINE(*-noexcept-swap)
+    void swap(qua<T>& l, qua<T>& r) noexcept(noexcept(l.swap(r))) {
+        l.swap(r);
+    }
+}
+
+namespace vmath_hpp::detail
+{
+    // the imaginary part is followed by the real one: x, y, z, w
+
+    template < typename T >
+    inline constexpr bool is_packed_qua_v =
+        std::is_standard_layout_v<qua<T>> &&
+        std::is_trivially_copyable_v<qua<T>> &&
+        sizeof(qua<T>) == sizeof(T) * 4;
+
+    static_assert(is_packed_qua_v<float> && is_packed_qua_v<double>);
+}
+
+namespace vmath_hpp::detail
+{
+    template < typename A, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto map_join(F&& f, const qua<A>& a) {
+        return qua(map_join(std::forward<F>(f), vec{a}));
+    }
+
+    template < typename A, typename B, typename F >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto fold_join(F&& f, A init, const qua<B>& b) {
+        return fold_join(std::forward<F>(f), std::move(init), vec{b});
+    }
+}
+
+//
+// Operators
+//
+
+namespace vmath_hpp
+{
+    // +operator
+
+    template < typename T >
+    [[nodiscard]] constexpr auto operator+(const qua<T>& xs) {
+        return qua(+vec<T, 4>{xs});
+    }
+
+    // -operator
+
+    template < typename T >
+    [[nodiscard]] constexpr auto operator-(const qua<T>& xs) {
+        return qua(-vec<T, 4>{xs});
+    }
+
+    // operator+
+
+    template < typename T, typename U >
+    [[nodiscard]] constexpr auto operator+(const qua<T>& xs, const qua<U>& ys) {
+        return qua(vec{xs} + vec{ys});
+    }
+
+    // operator+=
+
+    template < typename T >
+    constexpr qua<T>& operator+=(qua<T>& xs, const qua<T>& ys) {
+        return (xs = (xs + ys));
+    }
+
+    // operator-
+
+    template < typename T, typename U >
+    [[nodiscard]] constexpr auto operator-(const qua<T>& xs, const qua<U>& ys) {
+        return qua(vec{xs} - vec{ys});
+    }
+
+    // operator-=
+
+    template < typename T >
+    constexpr qua<T>& operator-=(qua<T>& xs, const qua<T>& ys) {
+        return (xs = (xs - ys));
+    }
+
+    // operator*
+
+    template < typename T, typename U >
+    [[nodiscard]] constexpr auto operator*(const qua<T>& xs, U y) {
+        return qua(vec{xs} * y);
+    }
+
+    template < typename T, typename U >
+    [[nodiscard]] constexpr auto operator*(T x, const qua<U>& ys) {
+        return qua(x * vec{ys});
+    }
+
+    template < typename T, typename U >
+    [[nodiscard]] constexpr auto operator*(const vec<T, 3>& xs, const qua<U>& ys) {
+        /// REFERENCE:
+        /// http://www.euclideanspace.com/maths/algebra/realNormedAlgebra/quaternions/transforms/
+
+        VMATH_HPP_INSTRUMENT_CALL(vec_qua_mul, 30);
+
+        const vec qv2 = cross(ys.v, xs) * T{2};
+        return xs + qv2 * ys.s + cross(ys.v, qv2);
+    }
+
+    template < typename T, typename U >
+    [[nodiscard]] constexpr auto operator*(const qua<T>& xs, const qua<U>& ys) {
+        /// REFERENCE:
+        /// http://www.euclideanspace.com/maths/algebra/realNormedAlgebra/quaternions/arithmetic/
+
+        VMATH_HPP_INSTRUMENT_CALL(qua_mul, 27);
+        return qua{
+            cross(ys.v, xs.v) + ys.s * xs.v + xs.s * ys.v,
+            ys.s * xs.s - dot(ys.v, xs.v)};
+    }
+
+    // operator*=
+
+    template < typename T >
+    constexpr qua<T>& operator*=(qua<T>& xs, T y) {
+        return (xs = (xs * y));
+    }
+
+    template < typename T >
+    constexpr vec<T, 3>& operator*=(vec<T, 3>& xs, const qua<T>& ys) {
+        return (xs = (xs * ys));
+    }
+
+    template < typename T >
+    constexpr qua<T>& operator*=(qua<T>& xs, const qua<T>& ys) {
+        return (xs = (xs * ys));
+    }
+
+    // operator/
+
+    template < typename T, typename U >
+    [[nodiscard]] constexpr auto operator/(const qua<T>& xs, U y) {
+        return qua(vec{xs} / y);
+    }
+
+    template < typename T, typename U >
+    [[nodiscard]] constexpr auto operator/(T x, const qua<U>& ys) {
+        return qua(x / vec{ys});
+    }
+
+    // operator/=
+
+    template < typename T >
+    constexpr qua<T>& operator/=(qua<T>& xs, T y) {
+        return (xs = (xs / y));
+    }
+
+    // operator==
+
+    template < typename T >
+    [[nodiscard]] constexpr bool operator==(const qua<T>& xs, const qua<T>& ys) {
+        return vec{xs} == vec{ys};
+    }
+
+    // operator!=
+
+    template < typename T >
+    [[nodiscard]] constexpr bool operator!=(const qua<T>& xs, const qua<T>& ys) {
+        return vec{xs} != vec{ys};
+    }
+
+    // operator<
+
+    template < typename T >
+    [[nodiscard]] constexpr bool operator<(const qua<T>& xs, const qua<T>& ys) {
+        return vec{xs} < vec{ys};
+    }
+}
+
+//
+// Common Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> lerp(const qua<T>& xs, const qua<T>& ys, T a) {
+        return qua(lerp(vec{xs}, vec{ys}, a));
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> lerp(const qua<T>& xs, const qua<T>& ys, T x_a, T y_a) {
+        return qua(lerp(vec{xs}, vec{ys}, x_a, y_a));
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> nlerp(const qua<T>& unit_xs, const qua<T>& unit_ys, T a) {
+        VMATH_HPP_INSTRUMENT_CALL(nlerp, 22);
+
+        const T xs_scale = T{1} - a;
+        const T ys_scale = a * sign(dot(unit_xs, unit_ys));
+        return VMATH_HPP_CHECK_RESULT("nlerp", qua(impl::normalize_impl(impl::lerp_impl(vec{unit_xs}, vec{unit_ys}, xs_scale, ys_scale))));
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> slerp(const qua<T>& unit_xs, const qua<T>& unit_ys, T a) {
+        /// REFERENCE:
+        /// http://www.euclideanspace.com/maths/algebra/realNormedAlgebra/quaternions/slerp/
+
+        VMATH_HPP_INSTRUMENT_CALL(slerp, 30);
+
+        const T raw_cos_theta = dot(unit_xs, unit_ys);
+        const T raw_cos_theta_sign = sign(raw_cos_theta);
+
+        // half degree linear threshold: cos((pi / 180) * 0.25)
+        if ( const T cos_theta = raw_cos_theta * raw_cos_theta_sign; cos_theta < T{0.99999f} ) {
+            const T theta = acos(cos_theta);
+            const T rsin_theta = rsqrt((T{1} - cos_theta) * (T{1} + cos_theta));
+            const T xs_scale = sin((T{1} - a) * theta) * rsin_theta;
+            const T ys_scale = sin(a * theta) * raw_cos_theta_sign * rsin_theta;
+            return VMATH_HPP_CHECK_RESULT("slerp", qua(impl::lerp_impl(vec{unit_xs}, vec{unit_ys}, xs_scale, ys_scale)));
+        }
+
+        // use linear interpolation for small angles
+        const T xs_scale = T{1} - a;
+        const T ys_scale = a * raw_cos_theta_sign;
+        return VMATH_HPP_CHECK_RESULT("slerp", qua(impl::normalize_impl(impl::lerp_impl(vec{unit_xs}, vec{unit_ys}, xs_scale, ys_scale))));
+    }
+}
+
+//
+// Geometric Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, typename U
+             , typename V = decltype(dot(
+                 std::declval<vec<T, 4>>(),
+                 std::declval<vec<U, 4>>())) >
+    [[nodiscard]] constexpr V dot(const qua<T>& xs, const qua<U>& ys) {
+        return dot(vec{xs}, vec{ys});
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr T length(const qua<T>& xs) {
+        return length(vec{xs});
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr T rlength(const qua<T>& xs) {
+        return rlength(vec{xs});
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr T length2(const qua<T>& xs) {
+        return length2(vec{xs});
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr T rlength2(const qua<T>& xs) {
+        return rlength2(vec{xs});
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr T distance(const qua<T>& xs, const qua<T>& ys) {
+        const qua zs = xs * conjugate(ys);
+        return T{2} * atan2(length(zs.v), abs(zs.s));
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> normalize(const qua<T>& xs) {
+        return qua(normalize(vec{xs}));
+    }
+}
+
+//
+// Relational Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T
+             , typename U = decltype(any(std::declval<vec<T, 4>>())) >
+    [[nodiscard]] constexpr U any(const qua<T>& xs) {
+        return any(vec{xs});
+    }
+
+    template < typename T
+             , typename U = decltype(all(std::declval<vec<T, 4>>())) >
+    [[nodiscard]] constexpr U all(const qua<T>& xs) {
+        return all(vec{xs});
+    }
+
+    template < typename T
+             , typename U = typename decltype(approx(
+                 std::declval<vec<T, 4>>(),
+                 std::declval<vec<T, 4>>()))::component_type >
+    [[nodiscard]] constexpr vec<U, 4> approx(const qua<T>& xs, const qua<T>& ys) {
+        return approx(vec{xs}, vec{ys});
+    }
+
+    template < typename T
+             , typename U = typename decltype(approx(
+                 std::declval<vec<T, 4>>(),
+                 std::declval<vec<T, 4>>(),
+                 std::declval<T>()))::component_type >
+    [[nodiscard]] constexpr vec<U, 4> approx(const qua<T>& xs, const qua<T>& ys, T epsilon) {
+        return approx(vec{xs}, vec{ys}, epsilon);
+    }
+
+    template < typename T
+             , typename U = typename decltype(less(
+                 std::declval<vec<T, 4>>(),
+                 std::declval<vec<T, 4>>()))::component_type >
+    [[nodiscard]] constexpr vec<U, 4> less(const qua<T>& xs, const qua<T>& ys) {
+        return less(vec{xs}, vec{ys});
+    }
+
+    template < typename T
+             , typename U = typename decltype(less_equal(
+                 std::declval<vec<T, 4>>(),
+                 std::declval<vec<T, 4>>()))::component_type >
+    [[nodiscard]] constexpr vec<U, 4> less_equal(const qua<T>& xs, const qua<T>& ys) {
+        return less_equal(vec{xs}, vec{ys});
+    }
+
+    template < typename T
+             , typename U = typename decltype(greater(
+                 std::declval<vec<T, 4>>(),
+                 std::declval<vec<T, 4>>()))::component_type >
+    [[nodiscard]] constexpr vec<U, 4> greater(const qua<T>& xs, const qua<T>& ys) {
+        return greater(vec{xs}, vec{ys});
+    }
+
+    template < typename T
+             , typename U = typename decltype(greater_equal(
+                 std::declval<vec<T, 4>>(),
+                 std::declval<vec<T, 4>>()))::component_type >
+    [[nodiscard]] constexpr vec<U, 4> greater_equal(const qua<T>& xs, const qua<T>& ys) {
+        return greater_equal(vec{xs}, vec{ys});
+    }
+
+    template < typename T
+             , typename U = typename decltype(equal_to(
+                 std::declval<vec<T, 4>>(),
+                 std::declval<vec<T, 4>>()))::component_type >
+    [[nodiscard]] constexpr vec<U, 4> equal_to(const qua<T>& xs, const qua<T>& ys) {
+        return equal_to(vec{xs}, vec{ys});
+    }
+
+    template < typename T
+             , typename U = typename decltype(not_equal_to(
+                 std::declval<vec<T, 4>>(),
+                 std::declval<vec<T, 4>>()))::component_type >
+    [[nodiscard]] constexpr vec<U, 4> not_equal_to(const qua<T>& xs, const qua<T>& ys) {
+        return not_equal_to(vec{xs}, vec{ys});
+    }
+}
+
+//
+// Quaternion Functions
+//
+
+namespace vmath_hpp
+{
+    // conjugate
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> conjugate(const qua<T>& q) {
+        return {-q.v, q.s};
+    }
+
+    // inverse
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> inverse(const qua<T>& q) {
+        VMATH_HPP_INSTRUMENT_CALL(qua_inverse, 15);
+        return VMATH_HPP_CHECK_RESULT("inverse(qua)", conjugate(q) * rlength2(q));
+    }
+}
@@ -0,0 +1,335 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+#include <array>
+#include <vector>
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_tests;
+}
+
+TEST_CASE("vmath/batch/multiply") {
+    SUBCASE("constant right operand") {
+        const fmat4 m = trs(fvec3(1.f,2.f,3.f), qrotate(0.5f, fvec3(0.f,0.f,1.f)), fvec3(2.f));
+
+        const std::vector<fmat4> as{fmat4(), translate(fvec3(1.f)), scale4(fvec3(2.f,3.f,4.f))};
+        std::vector<fmat4> ms(as.size());
+        CHECK(multiply(as.begin(), as.end(), m, ms.begin()) == ms.end());
+        for ( std::size_t i = 0; i < as.size(); ++i ) {
+            CHECK(ms[i] == as[i] * m);
+        }
+
+        const std::vector<fvec4> vs{fvec4(1.f,0.f,0.f,1.f), fvec4(0.f,1.f,0.f,1.f), fvec4(3.f,2.f,1.f,0.f)};
+        std::vector<fvec4> rs(vs.size());
+        CHECK(multiply(vs.begin(), vs.end(), m, rs.begin()) == rs.end());
+        for ( std::size_t i = 0; i < vs.size(); ++i ) {
+            CHECK(rs[i] == vs[i] * m);
+        }
+    }
+
+    SUBCASE("constant left operand") {
+        const fmat3 m = rotate(0.3f, fvec3(1.f,0.f,0.f));
+        const std::array<fmat3, 2> bs{scale(fvec3(2.f)), fmat3(2.f)};
+        std::array<fmat3, 2> ms{};
+        multiply(m, bs.begin(), bs.end(), ms.begin());
+        CHECK(ms[0] == m * bs[0]);
+        CHECK(ms[1] == m * bs[1]);
+    }
+
+    SUBCASE("in place") {
+        std::array<imat2, 2> ms{imat2(1,2,3,4), imat2(5,6,7,8)};
+        multiply(ms.begin(), ms.end(), ms[0], ms.begin());
+        CHECK(ms[0] == imat2(1,2,3,4) * imat2(1,2,3,4));
+        CHECK(ms[1] == imat2(5,6,7,8) * imat2(1,2,3,4));
+    }
+
+    SUBCASE("pairwise") {
+        const std::array<imat2, 2> as{imat2(1,2,3,4), imat2(5,6,7,8)};
+        const std::array<imat2, 2> bs{imat2(2,0,1,1), imat2(1,1,0,1)};
+        std::array<imat2, 2> ms{};
+        CHECK(multiply(as.begin(), as.end(), bs.begin(), ms.begin()) == ms.end());
+        CHECK(ms[0] == as[0] * bs[0]);
+        CHECK(ms[1] == as[1] * bs[1]);
+    }
+}
+
+TEST_CASE("vmath/batch/normalize") {
+    const std::array<fvec3, 3> vs{fvec3(3.f,0.f,4.f), fvec3(0.f), fvec3(1.f,2.f,3.f)};
+
+    SUBCASE("normalize") {
+        std::array<fvec3, 3> ns{};
+        CHECK(normalize(vs.begin(), vs.begin() + 1, ns.begin()) == ns.begin() + 1);
+        CHECK(ns[0] == uapprox3(0.6f,0.f,0.8f));
+
+        CHECK(normalize_fast(vs.begin(), vs.end(), ns.begin()) == ns.end());
+        CHECK(all(approx(ns[0], fvec3(0.6f,0.f,0.8f), 1e-5f)));
+        CHECK(ns[1] == uapprox3(0.f));
+    }
+
+    SUBCASE("normalize_or") {
+        std::array<fvec3, 3> ns{};
+        CHECK(normalize_or(vs.begin(), vs.end(), fvec3(0.f,1.f,0.f), ns.begin()) == ns.end());
+        CHECK(ns[0] == uapprox3(0.6f,0.f,0.8f));
+        CHECK(ns[1] == uapprox3(0.f,1.f,0.f));
+        CHECK(ns[2] == uapprox3(normalize(vs[2])));
+    }
+
+    SUBCASE("normalize_length") {
+        std::array<fvec3, 3> ns{};
+        std::array<float, 3> ls{};
+        const auto [n_last, l_last] = normalize_length(vs.begin(), vs.begin() + 1, ns.begin(), ls.begin());
+        CHECK(n_last == ns.begin() + 1);
+        CHECK(l_last == ls.begin() + 1);
+        CHECK(ns[0] == uapprox3(0.6f,0.f,0.8f));
+        CHECK(ls[0] == uapprox(5.f));
+    }
+
+    SUBCASE("normalize_or_soa") {
+        std::array<float, 3> xs{3.f, 0.f, 1.f};
+        std::array<float, 3> ys{0.f, 0.f, 2.f};
+        std::array<float, 3> zs{4.f, 0.f, 3.f};
+        normalize_or_soa({xs.data(), ys.data(), zs.data()}, xs.size(), fvec3(0.f,1.f,0.f));
+        CHECK(fvec3(xs[0],ys[0],zs[0]) == uapprox3(0.6f,0.f,0.8f));
+        CHECK(fvec3(xs[1],ys[1],zs[1]) == uapprox3(0.f,1.f,0.f));
+        CHECK(fvec3(xs[2],ys[2],zs[2]) == uapprox3(normalize(vs[2])));
+    }
+}
+
+TEST_CASE("vmath/batch/inverse") {
+    const std::array<fmat4, 3> ms{
+        trs(fvec3(1.f,2.f,3.f), qrotate(0.5f, unit3_y<float>), fvec3(2.f)),
+        fmat4(zero_init),
+        perspective_rh(800.f, 600.f, 0.1f, 100.f)};
+
+    SUBCASE("determinant") {
+        std::array<float, 3> ds{};
+        CHECK(determinant(ms.begin(), ms.end(), ds.begin()) == ds.end());
+        CHECK(ds[0] == uapprox(8.f));
+        CHECK(ds[1] == 0.f);
+    }
+
+    SUBCASE("inverse") {
+        std::array<fmat4, 3> is{};
+        CHECK(inverse(ms.begin(), ms.begin() + 1, is.begin()) == is.begin() + 1);
+        CHECK(all(approx(is[0] * ms[0], fmat4(identity_init), 1e-5f)));
+    }
+
+    SUBCASE("inverse_determinant") {
+        std::array<fmat4, 3> is{};
+        std::array<float, 3> ds{};
+        const auto [i_last, d_last] = inverse_determinant(ms.begin(), ms.end(), is.begin(), ds.begin());
+        CHECK(i_last == is.end());
+        CHECK(d_last == ds.end());
+        CHECK(all(approx(is[0] * ms[0], fmat4(identity_init), 1e-5f)));
+        CHECK(is[1] == fmat4(zero_init));
+        CHECK(ds[1] == 0.f);
+        CHECK(all(approx(is[2] * ms[2], fmat4(identity_init), 1e-5f)));
+    }
+}
+
+TEST_CASE("vmath/batch/decompose") {
+    const std::array<fmat4, 3> ms{
+        trs(fvec3(1.f,2.f,3.f), qrotate_x(0.5f), fvec3(2.f,3.f,4.f)),
+        trs(fvec3(-1.f,0.f,0.f), qrotate(1.f, normalize(fvec3(1.f,2.f,3.f))), fvec3(-1.f,1.f,2.f)),
+        trs(fvec3(0.f,5.f,0.f), qrotate_z(2.f), fvec3(0.f,1.f,1.f))};
+
+    std::array<fvec3, 3> ts{};
+    std::array<fqua, 3> rs{};
+    std::array<fvec3, 3> ss{};
+
+    CHECK(decompose(ms.begin(), ms.end(), ts.begin(), rs.begin(), ss.begin())
+        == std::make_tuple(ts.end(), rs.end(), ss.end()));
+    for ( std::size_t i = 0; i < ms.size(); ++i ) {
+        const auto [t, r, s] = decompose(ms[i]);
+        CHECK(ts[i] == t);
+        CHECK(rs[i] == r);
+        CHECK(ss[i] == s);
+    }
+
+    CHECK(decompose_fast(ms.begin(), ms.end(), ts.begin(), rs.begin(), ss.begin())
+        == std::make_tuple(ts.end(), rs.end(), ss.end()));
+    for ( std::size_t i = 0; i < ms.size(); ++i ) {
+        const auto [t, r, s] = decompose_fast(ms[i]);
+        CHECK(ts[i] == t);
+        CHECK(rs[i] == r);
+        CHECK(ss[i] == s);
+    }
+}
+
+TEST_CASE("vmath/batch/symmetric_eigen") {
+    const std::array<fmat3, 3> ms{
+        fmat3(fvec3(1.f,3.f,2.f)),
+        fmat3(4.f,1.f,2.f, 1.f,3.f,0.f, 2.f,0.f,5.f),
+        fmat3(zero_init)};
+
+    std::array<fvec3, 3> ds{};
+    std::array<fmat3, 3> vs{};
+
+    CHECK(symmetric_eigen(ms.begin(), ms.end(), ds.begin(), vs.begin())
+        == std::make_pair(ds.end(), vs.end()));
+    for ( std::size_t i = 0; i < ms.size(); ++i ) {
+        const auto [d, v] = symmetric_eigen(ms[i]);
+        CHECK(ds[i] == d);
+        CHECK(vs[i] == v);
+    }
+}
+
+TEST_CASE("vmath/batch/svd") {
+    const std::array<fmat3, 3> ms{
+        rotate(1.2f, normalize(fvec3(-1.f,2.f,0.5f))) * scale(fvec3(2.f,3.f,0.5f)),
+        fmat3(1.f,2.f,3.f, 0.f,1.f,4.f, 5.f,6.f,0.f),
+        fmat3(zero_init)};
+
+    std::array<fmat3, 3> us{};
+    std::array<fvec3, 3> ss{};
+    std::array<fmat3, 3> vs{};
+
+    CHECK(svd(ms.begin(), ms.end(), us.begin(), ss.begin(), vs.begin())
+        == std::make_tuple(us.end(), ss.end(), vs.end()));
+    for ( std::size_t i = 0; i < ms.size(); ++i ) {
+        const auto [u, s, v] = svd(ms[i]);
+        CHECK(us[i] == u);
+        CHECK(ss[i] == s);
+        CHECK(vs[i] == v);
+    }
+
+    std::array<fmat3, 3> rs{};
+    std::array<fmat3, 3> ps{};
+
+    CHECK(polar(ms.begin(), ms.end(), rs.begin(), ps.begin())
+        == std::make_pair(rs.end(), ps.end()));
+    for ( std::size_t i = 0; i < ms.size(); ++i ) {
+        const auto [r, p] = polar(ms[i]);
+        CHECK(rs[i] == r);
+        CHECK(ps[i] == p);
+    }
+}
+
+TEST_CASE("vmath/batch/quaternions") {
+    const std::array<fvec3, 3> vs{fvec3(1.f,2.f,3.f), fvec3(-1.f,0.f,0.5f), fvec3(0.f)};
+    const std::array<fqua, 3> qs{qrotate_x(0.5f), qrotate(1.f, normalize(fvec3(1.f,2.f,3.f))), fqua(1.f,2.f,3.f,4.f)};
+
+    SUBCASE("rotate") {
+        std::array<fvec3, 3> rs{};
+        CHECK(rotate(vs.begin(), vs.end(), qs[1], rs.begin()) == rs.end());
+        for ( std::size_t i = 0; i < vs.size(); ++i ) {
+            CHECK(all(approx(rs[i], vs[i] * qs[1], 1e-5f)));
+        }
+
+        // not a unit quaternion, still the same as v * q
+        CHECK(rotate(vs.begin(), vs.end(), qs[2], rs.begin()) == rs.end());
+        CHECK(all(approx(rs[0], vs[0] * qs[2], 1e-4f)));
+
+        CHECK(rotate(vs.begin(), vs.end(), qs.begin(), rs.begin()) == rs.end());
+        for ( std::size_t i = 0; i < vs.size(); ++i ) {
+            CHECK(rs[i] == vs[i] * qs[i]);
+        }
+    }
+
+    SUBCASE("conjugate and inverse") {
+        std::array<fqua, 3> rs{};
+        CHECK(conjugate(qs.begin(), qs.end(), rs.begin()) == rs.end());
+        CHECK(rs[2] == fqua(-1.f,-2.f,-3.f,4.f));
+        CHECK(inverse(qs.begin(), qs.end(), rs.begin()) == rs.end());
+        CHECK(all(approx(rs[2] * qs[2], fqua(), 1e-6f)));
+    }
+}
+
+TEST_CASE("vmath/batch/cameras") {
+    const std::array<fvec3, 2> eyes{fvec3(1.f,2.f,3.f), fvec3(-5.f,0.f,1.f)};
+    const std::array<fvec3, 2> ats{fvec3(0.f), fvec3(0.f,1.f,0.f)};
+    const std::array<fvec3, 2> ups{unit3_y<float>, unit3_z<float>};
+    const std::array<float, 2> fovys{1.f, 1.5f};
+    const std::array<float, 2> aspects{1.5f, 0.75f};
+
+    SUBCASE("look_at") {
+        std::array<fmat4, 2> ms{};
+        CHECK(look_at_lh(eyes.begin(), eyes.end(), ats.begin(), ups.begin(), ms.begin()) == ms.end());
+        CHECK(ms[1] == look_at_lh(eyes[1], ats[1], ups[1]));
+        CHECK(look_at_rh(eyes.begin(), eyes.end(), ats.begin(), ups.begin(), ms.begin()) == ms.end());
+        CHECK(ms[1] == look_at_rh(eyes[1], ats[1], ups[1]));
+    }
+
+    SUBCASE("perspective_fov") {
+        std::array<fmat4, 2> ms{};
+        CHECK(perspective_fov_lh(fovys.begin(), fovys.end(), aspects.begin(), 0.1f, 10.f, ms.begin()) == ms.end());
+        CHECK(ms[1] == perspective_fov_lh(fovys[1], aspects[1], 0.1f, 10.f));
+        CHECK(perspective_fov_rh(fovys.begin(), fovys.end(), aspects.begin(), 0.1f, 10.f, ms.begin()) == ms.end());
+        CHECK(ms[1] == perspective_fov_rh(fovys[1], aspects[1], 0.1f, 10.f));
+        CHECK(perspective_fov_infinite_reversed_lh(fovys.begin(), fovys.end(), aspects.begin(), 0.1f, ms.begin()) == ms.end());
+        CHECK(ms[1] == perspective_fov_infinite_reversed_lh(fovys[1], aspects[1], 0.1f));
+        CHECK(perspective_fov_infinite_reversed_rh(fovys.begin(), fovys.end(), aspects.begin(), 0.1f, ms.begin()) == ms.end());
+        CHECK(ms[1] == perspective_fov_infinite_reversed_rh(fovys[1], aspects[1], 0.1f));
+    }
+
+    SUBCASE("unproject") {
+        const fmat4 ivp = inverse_perspective(perspective_fov_infinite_reversed_lh(1.f, 1.5f, 0.1f));
+        const std::array<fvec3, 2> ndcs{fvec3(0.f,0.f,1.f), fvec3(0.5f,-0.5f,0.01f)};
+        std::array<fvec3, 2> ps{};
+        CHECK(unproject(ndcs.begin(), ndcs.end(), ivp, ps.begin()) == ps.end());
+        CHECK(ps[0] == uapprox3(0.f,0.f,0.1f));
+        CHECK(all(approx(ps[1], unproject(ndcs[1], ivp), 1e-5f)));
+
+        const fvec4 viewport{0.f, 0.f, 200.f, 100.f};
+        const std::array<fvec3, 1> windows{fvec3(150.f,75.f,0.01f)};
+        CHECK(unproject(windows.begin(), windows.end(), ivp, viewport, ps.begin()) == ps.begin() + 1);
+        CHECK(all(approx(ps[0], ps[1], 1e-4f)));
+    }
+}
+
+TEST_CASE("vmath/batch/reductions") {
+    SUBCASE("sum") {
+        constexpr std::array<int, 4> is{1, 2, 3, 4};
+        STATIC_CHECK(sum(is.begin(), is.end()) == 10);
+        STATIC_CHECK(sum(is.begin(), is.end(), summation::naive) == 10);
+        STATIC_CHECK(sum(is.begin(), is.end(), summation::kahan) == 10);
+        STATIC_CHECK(sum(is.begin(), is.end(), summation::neumaier) == 10);
+
+        const std::array<double, 4> ds{1.0, 1e100, 1.0, -1e100};
+        CHECK(sum(ds.begin(), ds.end(), summation::neumaier) == 2.0);
+
+        const std::vector<fvec3> vs(100000, fvec3(0.1f, 1.f, 10.f));
+        const dvec3 expected = dvec3(0.1f, 1.f, 10.f) * 100000.0;
+        for ( summation mode : {summation::pairwise, summation::kahan, summation::neumaier} ) {
+            const fvec3 s = sum(vs.begin(), vs.end(), mode);
+            CHECK(all(less(abs(cast_to<double>(s) - expected) / expected, dvec3(1e-6))));
+        }
+        const fvec3 n = sum(vs.begin(), vs.end(), summation::naive);
+        CHECK(any(greater(abs(cast_to<double>(n) - expected) / expected, dvec3(1e-4))));
+
+        const std::vector<fvec3> empty;
+        CHECK(sum(empty.begin(), empty.end()) == fvec3(0.f));
+    }
+
+    SUBCASE("dot and length") {
+        const std::array<fvec2, 3> as{fvec2(1.f,2.f), fvec2(3.f,4.f), fvec2(5.f,6.f)};
+        const std::array<fvec2, 3> bs{fvec2(2.f,0.f), fvec2(0.f,1.f), fvec2(1.f,1.f)};
+        CHECK(dot(as.begin(), as.end(), bs.begin()) == uapprox(17.f));
+        CHECK(dot(as.begin(), as.end(), bs.begin(), summation::kahan) == uapprox(17.f));
+        CHECK(length2(as.begin(), as.end()) == uapprox(91.f));
+        CHECK(length(as.begin(), as.end(), summation::neumaier) == uapprox(sqrt(91.f)));
+
+        const std::vector<float> fs(1000000, 0.1f);
+        CHECK(dot(fs.begin(), fs.end(), fs.begin()) == uapprox(10000.f));
+    }
+
+    SUBCASE("centroid and covariance") {
+        const std::array<fvec2, 4> ps{fvec2(1.f,1.f), fvec2(3.f,1.f), fvec2(3.f,3.f), fvec2(1.f,3.f)};
+        CHECK(centroid(ps.begin(), ps.end()) == uapprox2(2.f));
+        CHECK(covariance(ps.begin(), ps.end()) == fmat2(1.f,0.f,0.f,1.f));
+
+        const std::array<fvec2, 2> ls{fvec2(-1.f,-1.f), fvec2(1.f,1.f)};
+        CHECK(covariance(ls.begin(), ls.end(), summation::kahan) == fmat2(1.f,1.f,1.f,1.f));
+
+        const std::vector<fvec3> far(1000, fvec3(1e4f));
+        CHECK(centroid(far.begin(), far.end()) == uapprox3(1e4f));
+        CHECK(covariance(far.begin(), far.end()) == fmat3(0.f));
+    }
+}
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+#include <array>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_tests;
+
+    constexpr byte_order foreign_byte_order = native_byte_order == byte_order::little
+        ? byte_order::big
+        : byte_order::little;
+}
+
+TEST_CASE("vmath/blob") {
+    SUBCASE("traits") {
+        STATIC_CHECK(is_blittable_v<fvec3>);
+        STATIC_CHECK(is_blittable_v<dmat4>);
+        STATIC_CHECK(is_blittable_v<imat3>);
+        STATIC_CHECK(is_blittable_v<fqua>);
+        STATIC_CHECK_FALSE(is_blittable_v<bvec3>);
+        STATIC_CHECK_FALSE(is_blittable_v<float>);
+        STATIC_CHECK(blob_size<fvec3>(10) == blob_header_size + 120);
+    }
+
+    SUBCASE("native round trip") {
+        const std::array<fmat4, 3> ms{fmat4(), fmat4(2.f), translate(fvec3(1.f,2.f,3.f))};
+        std::vector<unsigned char> bytes(blob_size<fmat4>(ms.size()));
+        CHECK(write_blob(bytes.data(), ms.data(), ms.size()) == bytes.size());
+
+        const blob_view<fmat4> view = view_blob<fmat4>(bytes.data(), bytes.size());
+        REQUIRE(view.valid());
+        CHECK(view.size() == 3);
+        CHECK_FALSE(view.needs_swap());
+        REQUIRE(view.data() != nullptr);
+        CHECK(view.data()[2] == ms[2]);
+        CHECK(view[1] == ms[1]);
+
+        std::array<fmat4, 3> cs{};
+        CHECK(view.copy_to(cs.data()) == cs.data() + 3);
+        CHECK(cs == ms);
+    }
+
+    SUBCASE("foreign byte order") {
+        const std::array<ivec3, 2> vs{ivec3(1,-2,3), ivec3(0x01020304,5,6)};
+        std::vector<unsigned char> bytes(blob_size<ivec3>(vs.size()));
+        write_blob(bytes.data(), vs.data(), vs.size(), foreign_byte_order);
+
+        const unsigned char* p = bytes.data() + blob_header_size + sizeof(ivec3);
+        CHECK(p[0] == (native_byte_order == byte_order::little ? 0x01 : 0x04));
+
+        const blob_view<ivec3> view = view_blob<ivec3>(bytes.data(), bytes.size());
+        REQUIRE(view.valid());
+        CHECK(view.size() == 2);
+        CHECK(view.needs_swap());
+        CHECK(view.data() == nullptr);
+        CHECK(view[0] == vs[0]);
+        CHECK(view[1] == vs[1]);
+
+        std::array<ivec3, 2> cs{};
+        view.copy_to(cs.data());
+        CHECK(cs == vs);
+
+        const blob_view<ivec3> native = make_blob_native<ivec3>(bytes.data(), bytes.size());
+        REQUIRE(native.data() != nullptr);
+        CHECK(native.data()[1] == vs[1]);
+        CHECK(view_blob<ivec3>(bytes.data(), bytes.size()).order() == native_byte_order);
+    }
+
+    SUBCASE("quaternions") {
+        const std::array<dqua, 2> qs{dqua(), qrotate_x(0.5)};
+        std::vector<unsigned char> bytes(blob_size<dqua>(qs.size()));
+        write_blob(bytes.data(), qs.data(), qs.size(), foreign_byte_order);
+        const blob_view<dqua> view = view_blob<dqua>(bytes.data(), bytes.size());
+        CHECK(view[1] == qs[1]);
+    }
+
+    SUBCASE("misaligned payload") {
+        const std::array<fvec4, 2> vs{fvec4(1.f), fvec4(1.f,2.f,3.f,4.f)};
+        std::vector<unsigned char> bytes(blob_size<fvec4>(vs.size()) + 1);
+        write_blob(bytes.data() + 1, vs.data(), vs.size());
+        const blob_view<fvec4> view = view_blob<fvec4>(bytes.data() + 1, bytes.size() - 1);
+        REQUIRE(view.valid());
+        CHECK(view.data() == nullptr);
+        CHECK(view[1] == vs[1]);
+    }
+
+    SUBCASE("errors") {
+        const std::array<fvec3, 2> vs{fvec3(1.f), fvec3(2.f)};
+        std::vector<unsigned char> bytes(blob_size<fvec3>(vs.size()));
+        write_blob(bytes.data(), vs.data(), vs.size());
+
+        CHECK(view_blob<fvec3>(bytes.data(), 16).error() == blob_error::truncated);
+        CHECK(view_blob<fvec3>(bytes.data(), bytes.size() - 1).error() == blob_error::truncated);
+        CHECK(view_blob<fvec4>(bytes.data(), bytes.size()).error() == blob_error::type_mismatch);
+        CHECK(view_blob<dvec3>(bytes.data(), bytes.size()).error() == blob_error::type_mismatch);
+        CHECK(view_blob<ivec3>(bytes.data(), bytes.size()).error() == blob_error::type_mismatch);
+        CHECK(view_blob<fmat3>(bytes.data(), bytes.size()).error() == blob_error::type_mismatch);
+
+        std::vector<unsigned char> bad = bytes;
+        bad[4] = 2;
+        CHECK(view_blob<fvec3>(bad.data(), bad.size()).error() == blob_error::bad_version);
+        bad[0] = 'X';
+        CHECK(view_blob<fvec3>(bad.data(), bad.size()).error() == blob_error::bad_magic);
+        CHECK_FALSE(view_blob<fvec3>(bad.data(), bad.size()));
+    }
+
+    SUBCASE("file") {
+        std::vector<fvec2> vs(3000);
+        for ( std::size_t i = 0; i < vs.size(); ++i ) {
+            vs[i] = fvec2(static_cast<float>(i), -static_cast<float>(i));
+        }
+
+        for ( byte_order order : {byte_order::little, byte_order::big} ) {
+            std::FILE* file = std::tmpfile();
+            REQUIRE(file != nullptr);
+            CHECK(write_blob(file, vs.data(), vs.size(), order));
+
+            std::vector<unsigned char> bytes(static_cast<std::size_t>(std::ftell(file)));
+            CHECK(bytes.size() == blob_size<fvec2>(vs.size()));
+            std::rewind(file);
+            CHECK(std::fread(bytes.data(), 1, bytes.size(), file) == bytes.size());
+            std::fclose(file);
+
+            const blob_view<fvec2> view = view_blob<fvec2>(bytes.data(), bytes.size());
+            REQUIRE(view.valid());
+            CHECK(view.order() == order);
+            std::vector<fvec2> cs(view.size());
+            view.copy_to(cs.data());
+            CHECK(cs == vs);
+        }
+    }
+}
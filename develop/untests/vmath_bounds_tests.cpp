@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+#include <array>
+#include <vector>
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_tests;
+
+    std::vector<fvec3> make_cloud() {
+        philox4x32 g{7u};
+        std::vector<fvec3> ps;
+        for ( unsigned i = 0; i < 2000; ++i ) {
+            // an elongated, rotated and shifted ellipsoid
+            const fvec3 p = random_in_sphere<float>(g) * fvec3(10.f, 2.f, 0.5f);
+            ps.push_back(p * qrotate(0.7f, normalize(fvec3(1.f, 2.f, 3.f))) + fvec3(5.f, -3.f, 1.f));
+        }
+        return ps;
+    }
+}
+
+TEST_CASE("vmath/bounds/aabb") {
+    SUBCASE("ctors") {
+        STATIC_CHECK(empty(faabb3()));
+        STATIC_CHECK_FALSE(empty(faabb3(fvec3(0.f), fvec3(0.f))));
+        STATIC_CHECK(center(faabb2(fvec2(-1.f,0.f), fvec2(3.f,2.f))) == fvec2(1.f,1.f));
+        STATIC_CHECK(extent(faabb2(fvec2(-1.f,0.f), fvec2(3.f,2.f))) == fvec2(4.f,2.f));
+    }
+
+    SUBCASE("merge") {
+        constexpr faabb2 b = merge(merge(faabb2(), fvec2(1.f,2.f)), fvec2(-1.f,3.f));
+        STATIC_CHECK(b.min == fvec2(-1.f,2.f));
+        STATIC_CHECK(b.max == fvec2(1.f,3.f));
+        STATIC_CHECK(contains(b, fvec2(0.f,2.5f)));
+        STATIC_CHECK_FALSE(contains(b, fvec2(0.f,4.f)));
+
+        constexpr faabb2 m = merge(b, faabb2(fvec2(2.f), fvec2(4.f)));
+        STATIC_CHECK(m.min == fvec2(-1.f,2.f));
+        STATIC_CHECK(m.max == fvec2(4.f,4.f));
+        STATIC_CHECK(merge(faabb2(), b).min == b.min);
+    }
+
+    SUBCASE("compute_aabb") {
+        constexpr std::array<ivec2, 3> ps{ivec2(1,5), ivec2(-2,0), ivec2(3,-1)};
+        STATIC_CHECK(compute_aabb(ps.begin(), ps.end()).min == ivec2(-2,-1));
+        STATIC_CHECK(compute_aabb(ps.begin(), ps.end()).max == ivec2(3,5));
+
+        const std::vector<fvec3> cloud = make_cloud();
+        const faabb3 b = compute_aabb(cloud.begin(), cloud.end());
+        for ( const fvec3& p : cloud ) {
+            CHECK(contains(b, p));
+        }
+
+        // chunked bounds merge to the same result
+        const auto half = cloud.begin() + static_cast<std::ptrdiff_t>(cloud.size() / 2);
+        const faabb3 c = merge(compute_aabb(cloud.begin(), half), compute_aabb(half, cloud.end()));
+        CHECK(c.min == b.min);
+        CHECK(c.max == b.max);
+
+        CHECK(empty(compute_aabb(cloud.end(), cloud.end())));
+    }
+}
+
+TEST_CASE("vmath/bounds/sphere") {
+    SUBCASE("merge") {
+        STATIC_CHECK(empty(fsphere3()));
+        STATIC_CHECK(merge(fsphere2(), fvec2(1.f,2.f)).center == fvec2(1.f,2.f));
+        STATIC_CHECK(merge(fsphere2(), fvec2(1.f,2.f)).radius == 0.f);
+
+        const fsphere2 s = merge(fsphere2(fvec2(0.f), 1.f), fvec2(3.f,0.f));
+        CHECK(s.center == uapprox2(1.f,0.f));
+        CHECK(s.radius == uapprox(2.f));
+
+        const fsphere2 a{fvec2(0.f), 1.f};
+        const fsphere2 b{fvec2(4.f,0.f), 1.f};
+        CHECK(merge(a, b).center == uapprox2(2.f,0.f));
+        CHECK(merge(a, b).radius == uapprox(3.f));
+        CHECK(merge(a, fsphere2(fvec2(0.5f,0.f), 0.25f)).radius == uapprox(1.f));
+        CHECK(merge(fsphere2(fvec2(0.5f,0.f), 0.25f), a).radius == uapprox(1.f));
+    }
+
+    SUBCASE("compute_sphere") {
+        const std::vector<fvec3> cloud = make_cloud();
+        const fsphere3 r = compute_sphere_ritter(cloud.begin(), cloud.end());
+        const fsphere3 e = compute_sphere_epos(cloud.begin(), cloud.end());
+
+        const auto inside = [](const fsphere3& s, const fvec3& p){
+            return distance(s.center, p) <= s.radius * (1.f + 1e-5f);
+        };
+
+        for ( const fvec3& p : cloud ) {
+            CHECK(inside(r, p));
+            CHECK(inside(e, p));
+        }
+
+        // the cloud is about 20 units long
+        CHECK(r.radius < 11.f);
+        CHECK(e.radius < 10.5f);
+
+        const std::array<fvec3, 4> tetra{
+            fvec3(1.f,1.f,1.f), fvec3(1.f,-1.f,-1.f),
+            fvec3(-1.f,1.f,-1.f), fvec3(-1.f,-1.f,1.f)};
+        const fsphere3 t = compute_sphere_epos(tetra.begin(), tetra.end());
+        CHECK(all(approx(t.center, fvec3(0.f), 1e-5f)));
+        CHECK(approx(t.radius, sqrt(3.f), 1e-5f));
+
+        const std::array<fvec3, 3> line{fvec3(0.f), fvec3(1.f,0.f,0.f), fvec3(4.f,0.f,0.f)};
+        const fsphere3 l = compute_sphere_epos(line.begin(), line.end());
+        CHECK(l.center == uapprox3(2.f,0.f,0.f));
+        CHECK(l.radius == uapprox(2.f));
+
+        CHECK(empty(compute_sphere_ritter(cloud.end(), cloud.end())));
+        CHECK(empty(compute_sphere_epos(cloud.end(), cloud.end())));
+    }
+}
+
+TEST_CASE("vmath/bounds/obb") {
+    SUBCASE("compute_obb_pca") {
+        const std::vector<fvec3> cloud = make_cloud();
+        const fobb3 b = compute_obb_pca(cloud.begin(), cloud.end());
+
+        for ( std::size_t i = 0; i < 3; ++i ) {
+            CHECK(approx(length(b.axes[i]), 1.f, 1e-5f));
+            CHECK(approx(dot(b.axes[i], b.axes[(i + 1) % 3]), 0.f, 1e-5f));
+        }
+        CHECK(dot(cross(b.axes[0], b.axes[1]), b.axes[2]) > 0.f);
+
+        for ( const fvec3& p : cloud ) {
+            CHECK(contains(fobb3(b.center, b.axes, b.half_extents * 1.0001f), p));
+        }
+
+        // the box is tighter than the axis-aligned one
+        const faabb3 a = compute_aabb(cloud.begin(), cloud.end());
+        const fvec3 be = b.half_extents * 2.f;
+        const fvec3 ae = extent(a);
+        CHECK(be.x * be.y * be.z < ae.x * ae.y * ae.z);
+        CHECK(distance(b.center, fvec3(5.f,-3.f,1.f)) < 1.f);
+    }
+
+    SUBCASE("axis aligned input") {
+        const std::array<fvec2, 4> ps{fvec2(-4.f,-1.f), fvec2(4.f,-1.f), fvec2(4.f,1.f), fvec2(-4.f,1.f)};
+        const fobb2 b = compute_obb_pca(ps.begin(), ps.end());
+        CHECK(b.center == uapprox2(0.f));
+        CHECK(abs(b.axes[0]) == uapprox2(1.f,0.f));
+        CHECK(b.half_extents == uapprox2(4.f,1.f));
+    }
+}
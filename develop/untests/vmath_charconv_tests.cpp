@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+#if defined(VMATH_HPP_CHARCONV)
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_tests;
+
+    template < typename V >
+    std::string_view format(char (&buffer)[256], const V& x, char separator = ' ') {
+        const std::to_chars_result r = to_chars(buffer, buffer + 256, x, separator);
+        REQUIRE(r.ec == std::errc{});
+        return {buffer, static_cast<std::size_t>(r.ptr - buffer)};
+    }
+
+    template < typename V >
+    V parse(std::string_view text) {
+        V x{zero_init};
+        const std::from_chars_result r = from_chars(text.data(), text.data() + text.size(), x);
+        CHECK(r.ec == std::errc{});
+        CHECK(r.ptr == text.data() + text.size());
+        return x;
+    }
+}
+
+TEST_CASE("vmath/charconv") {
+    SUBCASE("to_chars") {
+        char buffer[256];
+        CHECK(format(buffer, ivec3(1,-2,30)) == "1 -2 30");
+        CHECK(format(buffer, ivec2(1,2), ',') == "1,2");
+        CHECK(format(buffer, imat2(1,2,3,4)) == "1 2 3 4");
+        CHECK(format(buffer, imat3x2(1,2,3,4,5,6), ',') == "1,2,3,4,5,6");
+        if constexpr ( impl::has_float_charconv ) {
+            CHECK(format(buffer, fvec3(0.1f,-2.f,1e10f)) == "0.1 -2 1e+10");
+            CHECK(format(buffer, fqua(1.f,2.f,3.f,0.5f)) == "1 2 3 0.5");
+        }
+
+        char small[6];
+        const std::to_chars_result r = to_chars(small, small + 6, ivec3(10,20,30));
+        CHECK(r.ec == std::errc::value_too_large);
+    }
+
+    SUBCASE("from_chars") {
+        CHECK(parse<ivec3>("1 -2 30") == ivec3(1,-2,30));
+        CHECK(parse<ivec3>("1,-2,30") == ivec3(1,-2,30));
+        CHECK(parse<ivec3>("1 ,\t-2,  30") == ivec3(1,-2,30));
+        CHECK(parse<imat2>("1 2\n3 4") == imat2(1,2,3,4));
+        if constexpr ( impl::has_float_charconv ) {
+            CHECK(parse<dvec2>("0.5, 1e-3") == dvec2(0.5, 1e-3));
+            CHECK(parse<fqua>("1 2 3 0.5") == fqua(1.f,2.f,3.f,0.5f));
+        }
+
+        ivec3 v{7};
+        const std::string_view bad = "1 2 x";
+        const std::from_chars_result r = from_chars(bad.data(), bad.data() + bad.size(), v);
+        CHECK(r.ec == std::errc::invalid_argument);
+        CHECK(r.ptr == bad.data() + 4);
+        CHECK(v == ivec3(7));
+
+        const std::string_view commas = "1,,2,3";
+        CHECK(from_chars(commas.data(), commas.data() + commas.size(), v).ec == std::errc::invalid_argument);
+    }
+
+    SUBCASE("round trip") {
+        if constexpr ( impl::has_float_charconv ) {
+            char buffer[256];
+            const fmat4 m = trs(fvec3(1.f,2.f,3.f), qrotate(0.3f, unit3_z<float>), fvec3(0.1f));
+            CHECK(parse<fmat4>(format(buffer, m)) == m);
+            const dqua q = qrotate(0.7, normalize(dvec3(1.0,2.0,3.0)));
+            CHECK(parse<dqua>(format(buffer, q, ',')) == q);
+        }
+    }
+
+    SUBCASE("batch") {
+        const std::array<ivec3, 3> vs{ivec3(1,2,3), ivec3(-4,5,6), ivec3(7,8,-9)};
+
+        char buffer[256];
+        const std::to_chars_result w = to_chars(buffer, buffer + 256, vs.begin(), vs.end(), ',');
+        REQUIRE(w.ec == std::errc{});
+        const std::string_view text{buffer, static_cast<std::size_t>(w.ptr - buffer)};
+        CHECK(text == "1,2,3\n-4,5,6\n7,8,-9\n");
+
+        std::vector<ivec3> ps(5);
+        const auto [r, p_last] = from_chars(text.data(), text.data() + text.size(), ps.begin(), ps.end());
+        CHECK(r.ec == std::errc{});
+        CHECK(r.ptr == text.data() + text.size() - 1);
+        CHECK(p_last == ps.begin() + 3);
+        CHECK(std::equal(vs.begin(), vs.end(), ps.begin()));
+
+        std::array<ivec3, 2> two{};
+        const auto [r2, t_last] = from_chars(text.data(), text.data() + text.size(), two.begin(), two.end());
+        CHECK(r2.ptr == text.data() + 12);
+        CHECK(t_last == two.end());
+
+        const std::to_chars_result o = to_chars(buffer, buffer + 15, vs.begin(), vs.end());
+        CHECK(o.ec == std::errc::value_too_large);
+        CHECK(o.ptr == buffer + 13);
+    }
+}
+
+#endif
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+#include <array>
+#include <vector>
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_tests;
+}
+
+TEST_CASE("vmath/curve/cubic") {
+    SUBCASE("end points") {
+        const fvec2 p0{0.f,0.f}, p1{1.f,2.f}, p2{3.f,3.f}, p3{4.f,0.f};
+
+        STATIC_CHECK(hermite(1.f, 2.f, 3.f, 4.f, 0.f) == 1.f);
+        STATIC_CHECK(hermite(1.f, 2.f, 3.f, 4.f, 1.f) == 3.f);
+        CHECK(hermite(p0, p1, p3, p2, 0.f) == p0);
+        CHECK(hermite(p0, p1, p3, p2, 1.f) == p3);
+
+        CHECK(catmull_rom(p0, p1, p2, p3, 0.f) == p1);
+        CHECK(catmull_rom(p0, p1, p2, p3, 1.f) == p2);
+
+        CHECK(bezier(p0, p1, p2, p3, 0.f) == p0);
+        CHECK(bezier(p0, p1, p2, p3, 1.f) == p3);
+        CHECK(bezier(p0, p1, p2, p3, 0.5f) == uapprox2(2.f,1.875f));
+    }
+
+    SUBCASE("linear data") {
+        CHECK(catmull_rom(0.0, 1.0, 2.0, 3.0, 0.25) == uapprox(1.25));
+        CHECK(bezier(fvec3(0.f), fvec3(1.f), fvec3(2.f), fvec3(3.f), 0.5f) == uapprox3(1.5f));
+    }
+}
+
+TEST_CASE("vmath/curve/squad") {
+    const fvec3 axis = normalize(fvec3(1.f,2.f,3.f));
+    const std::array<fqua, 4> qs{
+        qrotate(0.0f, axis), qrotate(0.5f, axis), qrotate(1.0f, axis), qrotate(1.5f, axis)};
+
+    SUBCASE("control points") {
+        // evenly spaced rotations around one axis have no curvature
+        CHECK(all(approx(squad_control(qs[0], qs[1], qs[2]), qs[1], 1e-5f)));
+        CHECK(all(approx(squad_control(-qs[0], qs[1], -qs[2]), qs[1], 1e-5f)));
+    }
+
+    SUBCASE("squad") {
+        const fqua s1 = squad_control(qs[0], qs[1], qs[2]);
+        const fqua s2 = squad_control(qs[1], qs[2], qs[3]);
+        CHECK(all(approx(squad(qs[1], qs[2], s1, s2, 0.f), qs[1], 1e-5f)));
+        CHECK(all(approx(squad(qs[1], qs[2], s1, s2, 1.f), qs[2], 1e-5f)));
+        CHECK(all(approx(squad(qs[1], qs[2], s1, s2, 0.5f), qrotate(0.75f, axis), 1e-5f)));
+    }
+}
+
+TEST_CASE("vmath/curve/keys") {
+    constexpr std::array<float, 5> ts{0.f, 1.f, 2.f, 4.f, 8.f};
+
+    SUBCASE("find_key") {
+        STATIC_CHECK(find_key(ts.begin(), ts.end(), -1.f) == 0);
+        STATIC_CHECK(find_key(ts.begin(), ts.end(), 0.f) == 0);
+        STATIC_CHECK(find_key(ts.begin(), ts.end(), 0.5f) == 0);
+        STATIC_CHECK(find_key(ts.begin(), ts.end(), 1.f) == 1);
+        STATIC_CHECK(find_key(ts.begin(), ts.end(), 3.f) == 2);
+        STATIC_CHECK(find_key(ts.begin(), ts.end(), 8.f) == 3);
+        STATIC_CHECK(find_key(ts.begin(), ts.end(), 9.f) == 3);
+        STATIC_CHECK(find_key(ts.begin(), ts.begin() + 1, 9.f) == 0);
+    }
+
+    SUBCASE("key_cursor") {
+        key_cursor c;
+        for ( float t = -1.f; t < 10.f; t += 0.25f ) {
+            CHECK(c.seek(ts.begin(), ts.end(), t) == find_key(ts.begin(), ts.end(), t));
+        }
+        for ( float t = 10.f; t > -1.f; t -= 0.75f ) {
+            CHECK(c.seek(ts.begin(), ts.end(), t) == find_key(ts.begin(), ts.end(), t));
+        }
+        CHECK(key_cursor{2}.index() == 2);
+    }
+}
+
+TEST_CASE("vmath/curve/sample") {
+    constexpr std::array<float, 4> ts{0.f, 1.f, 2.f, 4.f};
+
+    SUBCASE("scalars and vectors") {
+        constexpr std::array<float, 4> vs{0.f, 10.f, 20.f, 40.f};
+        CHECK(sample(ts.begin(), ts.end(), vs.begin(), -1.f) == 0.f);
+        CHECK(sample(ts.begin(), ts.end(), vs.begin(), 0.5f) == uapprox(5.f));
+        CHECK(sample(ts.begin(), ts.end(), vs.begin(), 3.f) == uapprox(30.f));
+        CHECK(sample(ts.begin(), ts.end(), vs.begin(), 5.f) == 40.f);
+
+        CHECK(sample(ts.begin(), ts.end(), vs.begin(), 1.5f, interpolation::step) == 10.f);
+        CHECK(sample(ts.begin(), ts.end(), vs.begin(), 4.f, interpolation::step) == 40.f);
+
+        // a linear function of time is reproduced by the non-uniform cubic
+        for ( float t = 0.f; t <= 4.f; t += 0.125f ) {
+            CHECK(approx(sample(ts.begin(), ts.end(), vs.begin(), t, interpolation::cubic), t * 10.f, 1e-4f));
+        }
+
+        const std::array<fvec2, 4> ps{fvec2(0.f), fvec2(1.f,0.f), fvec2(1.f,1.f), fvec2(0.f,1.f)};
+        key_cursor c;
+        CHECK(sample(ts.begin(), ts.end(), ps.begin(), 1.f, c, interpolation::cubic) == uapprox2(1.f,0.f));
+        CHECK(sample(ts.begin(), ts.end(), ps.begin(), 2.f, c, interpolation::cubic) == uapprox2(1.f,1.f));
+        CHECK(c.index() == 2);
+
+        const std::array<float, 1> t1{3.f};
+        const std::array<float, 1> v1{7.f};
+        CHECK(sample(t1.begin(), t1.end(), v1.begin(), 0.f, interpolation::cubic) == 7.f);
+    }
+
+    SUBCASE("quaternions") {
+        const fvec3 axis = unit3_z<float>;
+        const std::array<fqua, 4> qs{
+            qrotate(0.f, axis), qrotate(1.f, axis), qrotate(2.f, axis), qrotate(3.f, axis)};
+
+        CHECK(all(approx(sample(ts.begin(), ts.end(), qs.begin(), 0.5f), qrotate(0.5f, axis), 1e-5f)));
+        CHECK(all(approx(sample(ts.begin(), ts.end(), qs.begin(), 1.f, interpolation::cubic), qs[1], 1e-5f)));
+        CHECK(all(approx(sample(ts.begin(), ts.end(), qs.begin(), 1.5f, interpolation::cubic), qrotate(1.5f, axis), 1e-5f)));
+    }
+
+    SUBCASE("tracks") {
+        constexpr std::size_t track_count = 3;
+        std::vector<fvec3> vs;
+        for ( std::size_t k = 0; k < ts.size(); ++k ) {
+            for ( std::size_t i = 0; i < track_count; ++i ) {
+                vs.push_back(fvec3(ts[k] * static_cast<float>(i + 1), static_cast<float>(k), 1.f));
+            }
+        }
+
+        for ( interpolation mode : {interpolation::step, interpolation::linear, interpolation::cubic} ) {
+            key_cursor c;
+            for ( float t = -0.5f; t < 4.5f; t += 0.25f ) {
+                std::array<fvec3, track_count> rs{};
+                CHECK(sample_tracks(ts.begin(), ts.end(), vs.begin(), track_count, t, rs.begin(), c, mode) == rs.end());
+
+                for ( std::size_t i = 0; i < track_count; ++i ) {
+                    std::vector<fvec3> track;
+                    for ( std::size_t k = 0; k < ts.size(); ++k ) {
+                        track.push_back(vs[k * track_count + i]);
+                    }
+                    CHECK(rs[i] == sample(ts.begin(), ts.end(), track.begin(), t, mode));
+                }
+            }
+        }
+    }
+}
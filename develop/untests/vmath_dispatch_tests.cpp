@@ -0,0 +1,381 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+#include <vector>
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_tests;
+
+    std::vector<simd_level> supported_levels() {
+        std::vector<simd_level> levels{simd_level::baseline};
+        if ( supported_simd_level() >= simd_level::avx2 ) {
+            levels.push_back(simd_level::avx2);
+        }
+        if ( supported_simd_level() >= simd_level::avx512 ) {
+            levels.push_back(simd_level::avx512);
+        }
+        return levels;
+    }
+}
+
+TEST_CASE("vmath/dispatch") {
+    SUBCASE("levels") {
+        force_simd_level(simd_level::avx512);
+        CHECK(current_simd_level() == supported_simd_level());
+
+        force_simd_level(simd_level::baseline);
+        CHECK(current_simd_level() == simd_level::baseline);
+
+        reset_simd_level();
+        CHECK(current_simd_level() <= supported_simd_level());
+    }
+
+    SUBCASE("kernels") {
+        philox4x32 g{3u};
+
+        std::vector<fvec4> vs(1001);
+        std::vector<fmat4> ms(257);
+        std::vector<double> xs(1003);
+        std::vector<double> ys(xs.size());
+
+        for ( fvec4& v : vs ) {
+            v = random_uniform(g, fvec4(-1.f), fvec4(1.f));
+        }
+        for ( fmat4& m : ms ) {
+            m = trs(random_on_sphere<float>(g), random_rotation<float>(g), fvec3(2.f));
+        }
+        for ( std::size_t i = 0; i < xs.size(); ++i ) {
+            xs[i] = random_uniform(g, -1.0, 1.0);
+            ys[i] = random_uniform(g, -1.0, 1.0);
+        }
+
+        const fmat4 m = trs(fvec3(1.f,2.f,3.f), qrotate(0.5f, unit3_y<float>), fvec3(0.5f));
+
+        double reference_dot = 0.0;
+        for ( std::size_t i = 0; i < xs.size(); ++i ) {
+            reference_dot += xs[i] * ys[i];
+        }
+
+        for ( simd_level level : supported_levels() ) {
+            force_simd_level(level);
+            REQUIRE(current_simd_level() == level);
+
+            std::vector<fvec4> rvs(vs.size());
+            multiply_n(vs.data(), vs.size(), m, rvs.data());
+            for ( std::size_t i = 0; i < vs.size(); ++i ) {
+                CHECK(all(approx(rvs[i], vs[i] * m, 1e-5f)));
+            }
+
+            std::vector<fmat4> rms(ms.size());
+            multiply_n(ms.data(), ms.size(), m, rms.data());
+            for ( std::size_t i = 0; i < ms.size(); ++i ) {
+                CHECK(all(approx(rms[i], ms[i] * m, 1e-5f)));
+            }
+
+            std::vector<fmat4> ims(ms.size());
+            std::vector<float> dets(ms.size());
+            inverse_n(ms.data(), ms.size(), ims.data(), dets.data());
+            for ( std::size_t i = 0; i < ms.size(); ++i ) {
+                CHECK(all(approx(ims[i], inverse(ms[i]), 1e-5f)));
+                CHECK(approx(dets[i], 8.f, 1e-4f));
+            }
+
+            const fmat4 singular[3]{fmat4(zero_init), m, fmat4(1e-12f)};
+            fmat4 isingular[3]{};
+            inverse_n(singular, 3, isingular);
+            CHECK(isingular[0] == fmat4(zero_init));
+            CHECK(all(approx(isingular[1], inverse(m), 1e-5f)));
+            CHECK(isingular[2] == fmat4(zero_init));
+
+            CHECK(approx(dot_n(xs.data(), ys.data(), xs.size()), reference_dot, 1e-12));
+            CHECK(dot_n(xs.data(), ys.data(), 0) == 0.0);
+            CHECK(dot_n(xs.data(), ys.data(), 3) == uapprox(xs[0] * ys[0] + xs[1] * ys[1] + xs[2] * ys[2]));
+
+            // in place
+            std::vector<fvec4> ivs = vs;
+            multiply_n(ivs.data(), ivs.size(), m, ivs.data());
+            CHECK(ivs == rvs);
+
+            std::vector<fmat4> iims = ms;
+            inverse_n(iims.data(), iims.size(), iims.data());
+            CHECK(iims == ims);
+        }
+
+        reset_simd_level();
+    }
+
+    SUBCASE("exact") {
+        // every level has to give the same bits as the baseline
+        philox4x32 g{11u};
+
+        const std::size_t n = 111;
+        std::vector<double> xs(n);
+        std::vector<double> ys(n);
+        std::vector<float> fxs(n);
+        std::vector<float> fys(n);
+        std::vector<fvec4> vs(n);
+        std::vector<fmat4> ms(n);
+        std::vector<fvec3> ps(n);
+        std::vector<fqua> qs(n);
+        for ( std::size_t i = 0; i < n; ++i ) {
+            xs[i] = random_uniform(g, -1.0, 1.0);
+            ys[i] = random_uniform(g, -1.0, 1.0);
+            fxs[i] = random_uniform(g, -1.f, 1.f);
+            fys[i] = random_uniform(g, -1.f, 1.f);
+            vs[i] = random_uniform(g, fvec4(-1.f), fvec4(1.f));
+            ms[i] = trs(random_on_sphere<float>(g), random_rotation<float>(g), fvec3(1.5f));
+            ps[i] = random_uniform(g, fvec3(-1.f), fvec3(1.f));
+            qs[i] = random_rotation<float>(g);
+        }
+
+        const fmat4 m = trs(fvec3(1.f,2.f,3.f), qrotate(0.5f, unit3_y<float>), fvec3(0.5f));
+
+        force_simd_level(simd_level::baseline);
+        std::vector<double> dots(n + 1);
+        std::vector<float> fdots(n + 1);
+        for ( std::size_t i = 0; i <= n; ++i ) {
+            dots[i] = dot_n(xs.data(), ys.data(), i);
+            fdots[i] = dot_n(fxs.data(), fys.data(), i);
+        }
+        std::vector<fvec4> rvs(n);
+        std::vector<fmat4> rms(n);
+        std::vector<fmat4> ims(n);
+        std::vector<fvec3> rps(n);
+        std::vector<fqua> rqs(n);
+        multiply_n(vs.data(), n, m, rvs.data());
+        multiply_n(ms.data(), n, m, rms.data());
+        inverse_n(ms.data(), n, ims.data());
+        rotate_n(ps.data(), qs.data(), n, rps.data());
+        multiply_n(qs.data(), qs.data() + 1, n - 1, rqs.data());
+
+        for ( simd_level level : supported_levels() ) {
+            force_simd_level(level);
+
+            for ( std::size_t i = 0; i <= n; ++i ) {
+                CHECK(dot_n(xs.data(), ys.data(), i) == dots[i]);
+                CHECK(dot_n(fxs.data(), fys.data(), i) == fdots[i]);
+            }
+
+            std::vector<fvec4> lvs(n);
+            std::vector<fmat4> lms(n);
+            std::vector<fmat4> lims(n);
+            std::vector<fvec3> lps(n);
+            std::vector<fqua> lqs(n);
+            multiply_n(vs.data(), n, m, lvs.data());
+            multiply_n(ms.data(), n, m, lms.data());
+            inverse_n(ms.data(), n, lims.data());
+            rotate_n(ps.data(), qs.data(), n, lps.data());
+            multiply_n(qs.data(), qs.data() + 1, n - 1, lqs.data());
+            CHECK(lvs == rvs);
+            CHECK(lms == rms);
+            CHECK(lims == ims);
+            CHECK(lps == rps);
+            CHECK(lqs == rqs);
+        }
+
+        reset_simd_level();
+    }
+
+    SUBCASE("unproject") {
+        philox4x32 g{7u};
+
+        std::vector<fvec3> ndcs(133);
+        for ( fvec3& p : ndcs ) {
+            p = random_uniform(g, fvec3(-1.f,-1.f,0.f), fvec3(1.f,1.f,1.f));
+        }
+
+        const fmat4 view = look_at_rh(fvec3(3.f,2.f,1.f), fvec3(0.f), unit3_y<float>);
+        const fmat4 ivp = inverse(view) * inverse_perspective(perspective_fov_reversed_rh(1.f, 1.5f, 0.1f, 100.f));
+        const fvec4 viewport{0.f, 0.f, 1920.f, 1080.f};
+
+        for ( simd_level level : supported_levels() ) {
+            force_simd_level(level);
+
+            std::vector<fvec3> ps(ndcs.size());
+            unproject_n(ndcs.data(), ndcs.size(), ivp, ps.data());
+            for ( std::size_t i = 0; i < ndcs.size(); ++i ) {
+                CHECK(all(approx(ps[i], unproject(ndcs[i], ivp), 1e-3f)));
+            }
+
+            std::vector<fvec3> ws = ndcs;
+            unproject_n(ws.data(), ws.size(), ivp, viewport, ws.data());
+            for ( std::size_t i = 0; i < ndcs.size(); ++i ) {
+                CHECK(all(approx(ws[i], unproject(ndcs[i], ivp, viewport), 1e-3f)));
+            }
+        }
+
+        reset_simd_level();
+    }
+
+    SUBCASE("quaternions") {
+        philox4x32 g{9u};
+
+        const std::size_t n = 141;
+        std::vector<fvec3> vs(n);
+        std::vector<fqua> qs(n);
+        std::vector<fqua> ps(n);
+        for ( std::size_t i = 0; i < n; ++i ) {
+            vs[i] = random_uniform(g, fvec3(-1.f), fvec3(1.f));
+            qs[i] = random_rotation<float>(g);
+            ps[i] = random_rotation<float>(g) * 2.f;
+        }
+
+        for ( simd_level level : supported_levels() ) {
+            force_simd_level(level);
+
+            std::vector<fvec3> rs(n);
+            rotate_n(vs.data(), n, qs[0], rs.data());
+            for ( std::size_t i = 0; i < n; ++i ) {
+                CHECK(all(approx(rs[i], vs[i] * qs[0], 1e-5f)));
+            }
+
+            rotate_n(vs.data(), 3, ps[0], rs.data());
+            CHECK(all(approx(rs[2], vs[2] * ps[0], 1e-4f)));
+            rotate_n(vs.data(), n, ps[0], rs.data());
+            CHECK(all(approx(rs[2], vs[2] * ps[0], 1e-4f)));
+
+            rotate_n(vs.data(), qs.data(), n, rs.data());
+            for ( std::size_t i = 0; i < n; ++i ) {
+                CHECK(all(approx(rs[i], vs[i] * qs[i], 1e-5f)));
+            }
+
+            for ( std::size_t group : {std::size_t{1}, std::size_t{5}, std::size_t{16}, std::size_t{40}} ) {
+                std::vector<fvec3> gs = vs;
+                rotate_n(gs.data(), n, qs.data(), group, gs.data());
+                for ( std::size_t i = 0; i < n; ++i ) {
+                    CHECK(all(approx(gs[i], vs[i] * qs[i / group], 1e-5f)));
+                }
+            }
+
+            std::vector<fqua> ms(n);
+            multiply_n(qs.data(), ps.data(), n, ms.data());
+            for ( std::size_t i = 0; i < n; ++i ) {
+                CHECK(all(approx(ms[i], qs[i] * ps[i], 1e-5f)));
+            }
+
+            std::vector<fqua> cs = ps;
+            conjugate_n(cs.data(), n, cs.data());
+            inverse_n(ps.data(), n, ms.data());
+            for ( std::size_t i = 0; i < n; ++i ) {
+                CHECK(cs[i] == conjugate(ps[i]));
+                CHECK(all(approx(ms[i], inverse(ps[i]), 1e-6f)));
+            }
+        }
+
+        reset_simd_level();
+    }
+
+    SUBCASE("morton") {
+        philox4x32 g{13u};
+
+        const std::size_t n = 67;
+        std::vector<uvec2> v2s(n);
+        std::vector<uvec3> v3s(n);
+        for ( std::size_t i = 0; i < n; ++i ) {
+            v2s[i] = uvec2(g(), g());
+            v3s[i] = uvec3(g(), g(), g());
+        }
+
+        for ( simd_level level : supported_levels() ) {
+            force_simd_level(level);
+
+            std::vector<std::uint32_t> k32s(n);
+            std::vector<std::uint64_t> k64s(n);
+            std::vector<uvec2> d2s(n);
+            std::vector<uvec3> d3s(n);
+
+            morton_encode_n(v2s.data(), n, k32s.data());
+            morton_encode_n(v3s.data(), n, k64s.data());
+            for ( std::size_t i = 0; i < n; ++i ) {
+                CHECK(k32s[i] == morton_encode(v2s[i]));
+                CHECK(k64s[i] == morton_encode<std::uint64_t>(v3s[i]));
+            }
+
+            morton_decode_n(k32s.data(), n, d2s.data());
+            morton_decode_n(k64s.data(), n, d3s.data());
+            for ( std::size_t i = 0; i < n; ++i ) {
+                CHECK(d2s[i] == morton_decode<2>(k32s[i]));
+                CHECK(d3s[i] == morton_decode<3>(k64s[i]));
+            }
+
+            morton_encode_n(v3s.data(), n, k32s.data());
+            morton_encode_n(v2s.data(), n, k64s.data());
+            morton_decode_n(k32s.data(), n, d3s.data());
+            morton_decode_n(k64s.data(), n, d2s.data());
+            for ( std::size_t i = 0; i < n; ++i ) {
+                CHECK(k32s[i] == morton_encode(v3s[i]));
+                CHECK(k64s[i] == morton_encode<std::uint64_t>(v2s[i]));
+                CHECK(d3s[i] == (v3s[i] & 0x3FFu));
+                CHECK(d2s[i] == v2s[i]);
+            }
+        }
+
+        reset_simd_level();
+    }
+
+    SUBCASE("cameras") {
+        philox4x32 g{5u};
+
+        const std::size_t n = 37;
+        std::vector<fvec3> eyes(n);
+        std::vector<fvec3> ats(n);
+        std::vector<fvec3> ups(n, unit3_y<float>);
+        std::vector<float> fovys(n);
+        std::vector<float> aspects(n);
+        for ( std::size_t i = 0; i < n; ++i ) {
+            eyes[i] = random_on_sphere<float>(g) * 10.f;
+            ats[i] = random_uniform(g, fvec3(-1.f), fvec3(1.f));
+            fovys[i] = random_uniform(g, 0.5f, 2.f);
+            aspects[i] = random_uniform(g, 0.5f, 2.f);
+        }
+
+        for ( simd_level level : supported_levels() ) {
+            force_simd_level(level);
+
+            std::vector<fmat4> views(n);
+            std::vector<fmat4> projs(n);
+            std::vector<fmat4> view_projs(n);
+
+            cameras_lh_n(eyes.data(), ats.data(), ups.data(), fovys.data(), aspects.data(), n, 0.1f, 100.f,
+                views.data(), projs.data(), view_projs.data());
+            for ( std::size_t i = 0; i < n; ++i ) {
+                const fmat4 v = look_at_lh(eyes[i], ats[i], ups[i]);
+                const fmat4 p = perspective_fov_lh(fovys[i], aspects[i], 0.1f, 100.f);
+                CHECK(all(approx(views[i], v, 1e-5f)));
+                CHECK(all(approx(projs[i], p, 1e-5f)));
+                CHECK(all(approx(view_projs[i], v * p, 1e-4f)));
+            }
+
+            cameras_rh_n(eyes.data(), ats.data(), ups.data(), fovys.data(), aspects.data(), n, 0.1f, 100.f,
+                nullptr, nullptr, view_projs.data());
+            for ( std::size_t i = 0; i < n; ++i ) {
+                const fmat4 vp = look_at_rh(eyes[i], ats[i], ups[i]) * perspective_fov_rh(fovys[i], aspects[i], 0.1f, 100.f);
+                CHECK(all(approx(view_projs[i], vp, 1e-4f)));
+            }
+
+            cameras_infinite_reversed_lh_n(eyes.data(), ats.data(), ups.data(), fovys.data(), aspects.data(), n, 0.1f,
+                views.data(), projs.data(), view_projs.data());
+            for ( std::size_t i = 0; i < n; ++i ) {
+                const fmat4 p = perspective_fov_infinite_reversed_lh(fovys[i], aspects[i], 0.1f);
+                CHECK(all(approx(projs[i], p, 1e-5f)));
+                CHECK(all(approx(view_projs[i], views[i] * p, 1e-4f)));
+            }
+
+            cameras_infinite_reversed_rh_n(eyes.data(), ats.data(), ups.data(), fovys.data(), aspects.data(), n, 0.1f,
+                views.data(), projs.data());
+            for ( std::size_t i = 0; i < n; ++i ) {
+                CHECK(all(approx(views[i], look_at_rh(eyes[i], ats[i], ups[i]), 1e-5f)));
+                CHECK(all(approx(projs[i], perspective_fov_infinite_reversed_rh(fovys[i], aspects[i], 0.1f), 1e-5f)));
+            }
+        }
+
+        reset_simd_level();
+    }
+}
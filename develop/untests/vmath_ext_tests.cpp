@@ -6,6 +6,7 @@
 
 #include "vmath_tests.hpp"
 
+#include <array>
 #include <set>
 #include <map>
 #include <unordered_set>
@@ -98,6 +99,8 @@ TEST_CASE("vmath/ext/hash") {
     SUBCASE("matrix") {
         CHECK(std::hash<imat2>{}({1,2,3,4}) == std::hash<imat2>{}({1,2,3,4}));
         CHECK_FALSE(std::hash<imat2>{}({1,2,3,4}) == std::hash<imat2>{}({1,2,4,3}));
+        CHECK(std::hash<imat2x3>{}({1,2,3,4,5,6}) == std::hash<imat2x3>{}({1,2,3,4,5,6}));
+        CHECK_FALSE(std::hash<imat2x3>{}({1,2,3,4,5,6}) == std::hash<imat2x3>{}({1,2,3,4,6,5}));
 
         {
             std::set<imat2> s;
@@ -174,6 +177,10 @@ TEST_CASE("vmath/ext/cast") {
         STATIC_CHECK(m == imat2(1));
         STATIC_CHECK(std::is_same_v<decltype(m)::row_type, ivec2>);
 
+        constexpr auto n = cast_to<int>(fmat2x3(1.5f));
+        STATIC_CHECK(n == imat2x3(1));
+        STATIC_CHECK(std::is_same_v<decltype(n)::row_type, ivec3>);
+
         constexpr auto q = cast_to<int>(fqua(1.5f, 2.2f, 3.6f, 4.5f));
         STATIC_CHECK(q == qua(1,2,3,4));
         STATIC_CHECK(std::is_same_v<decltype(q)::component_type, int>);
@@ -195,6 +202,9 @@ TEST_CASE("vmath/ext/access") {
 
         STATIC_CHECK(row(imat2(), 0, {1,2}) == imat2(1,2,0,1));
         STATIC_CHECK(row(imat2(), 1, {3,4}) == imat2(1,0,3,4));
+
+        STATIC_CHECK(row(imat2x3(1,2,3,4,5,6), 1) == ivec3(4,5,6));
+        STATIC_CHECK(row(imat2x3(), 1, {3,4,5}) == imat2x3(1,0,0,3,4,5));
     }
 
     SUBCASE("column") {
@@ -203,6 +213,9 @@ TEST_CASE("vmath/ext/access") {
 
         STATIC_CHECK(column(imat2(), 0, {2,3}) == imat2(2,0,3,1));
         STATIC_CHECK(column(imat2(), 1, {3,4}) == imat2(1,3,0,4));
+
+        STATIC_CHECK(column(imat2x3(1,2,3,4,5,6), 2) == ivec2(3,6));
+        STATIC_CHECK(column(imat2x3(), 2, {7,8}) == imat2x3(1,0,7,0,1,8));
     }
 
     SUBCASE("diagonal") {
@@ -248,6 +261,61 @@ TEST_CASE("vmath/ext/matrix_transform") {
             scale3(fvec2(2,3)) * rotate3(pi) * translate(fvec2(1,2)))));
     }
 
+    SUBCASE("decompose") {
+        const fqua r = qrotate(1.1f, normalize(fvec3(1.f,2.f,3.f)));
+
+        for ( const fvec3& s : {fvec3(2.f,3.f,4.f), fvec3(-2.f,3.f,4.f), fvec3(2.f,-3.f,-4.f), fvec3(-1.f)} ) {
+            const fmat4 m = trs(fvec3(1.f,2.f,3.f), r, s);
+            {
+                const auto [dt, dr, ds] = decompose(m);
+                CHECK(dt == uapprox3(1.f,2.f,3.f));
+                CHECK(all(approx(trs(dt, dr, ds), m, 1e-5f)));
+            }
+            {
+                const auto [dt, dr, ds] = decompose_fast(m);
+                CHECK(dt == uapprox3(1.f,2.f,3.f));
+                CHECK(all(approx(trs(dt, dr, ds), m, 1e-5f)));
+            }
+        }
+
+        {
+            const auto [dt, dr, ds] = decompose(trs(fvec3(1.f,2.f,3.f), r, fvec3(2.f,3.f,4.f)));
+            CHECK(ds == uapprox3(2.f,3.f,4.f));
+            CHECK(all(approx(dr, r, 1e-5f)) || all(approx(dr, -r, 1e-5f)));
+        }
+
+        {
+            // shear is discarded
+            const fmat4 m = fmat4(fmat3(shear3(fvec2(0.5f,0.f)))) * scale4(fvec3(2.f,3.f,4.f));
+            const auto [dt, dr, ds] = decompose(m);
+            CHECK(dt == uapprox3(0.f));
+            CHECK(all(approx(rotate(dr), fmat3(), 1e-5f)));
+            CHECK(ds[2] == uapprox(4.f));
+        }
+
+        {
+            // zero scale axes don't turn the rotation into nans
+            const auto is_rotation = [](const fqua& q){
+                return all(approx(rotate(q) * transpose(rotate(q)), fmat3(), 1e-5f))
+                    && determinant(rotate(q)) == uapprox(1.f);
+            };
+
+            for ( const fvec3& s : {fvec3(0.f,3.f,4.f), fvec3(2.f,0.f,4.f), fvec3(2.f,3.f,0.f), fvec3(0.f,0.f,4.f), fvec3(2.f,0.f,0.f), fvec3(0.f)} ) {
+                const fmat4 m = trs(fvec3(1.f,2.f,3.f), r, s);
+                for ( const auto& [dt, dr, ds] : {decompose(m), decompose_fast(m)} ) {
+                    CHECK(dt == uapprox3(1.f,2.f,3.f));
+                    CHECK(all(approx(ds, s, 1e-5f)));
+                    CHECK(is_rotation(dr));
+                    CHECK(all(approx(trs(dt, dr, ds), m, 1e-5f)));
+                }
+            }
+
+            const auto [dt, dr, ds] = decompose(trs(fvec3(1.f,2.f,3.f), r, fvec3(0.f)));
+            CHECK(dr == fqua());
+            CHECK(ds == fvec3(0.f));
+        }
+    }
+
     SUBCASE("translate") {
         STATIC_CHECK(fvec3(2.f,3.f,1.f) * translate(fvec2{1.f,2.f}) == uapprox3(3.f,5.f,1.f));
         STATIC_CHECK(fvec4(2.f,3.f,4.f,1.f) * translate(fvec3{1.f,2.f,3.f}) == uapprox4(3.f,5.f,7.f,1.f));
@@ -322,6 +390,74 @@ TEST_CASE("vmath/ext/matrix_projections") {
             perspective_lh(100.f, 800.f, 50.f, 600.f, 5.f, 10.f),
             scale4(vec{1.f,1.f,-1.f}) * perspective_rh(100.f, 800.f, 50.f, 600.f, 5.f, 10.f))));
     }
+
+    SUBCASE("perspective_fov_infinite_reversed") {
+        CHECK(all(approx(
+            perspective_fov_infinite_reversed_lh(1.5f, 1.3f, 0.5f),
+            scale4(vec{1.f,1.f,-1.f}) * perspective_fov_infinite_reversed_rh(1.5f, 1.3f, 0.5f))));
+
+        const fmat4 p = perspective_fov_infinite_reversed_lh(1.5f, 1.3f, 0.5f);
+        const auto depth = [&p](float z){
+            const fvec4 c = fvec4(0.f, 0.f, z, 1.f) * p;
+            return c.z / c.w;
+        };
+        CHECK(depth(0.5f) == uapprox(1.f));
+        CHECK(depth(5.f) == uapprox(0.1f));
+        CHECK(depth(1e30f) == uapprox(0.f));
+        CHECK(depth(1e4f) > depth(1e5f));
+
+        const fmat4 s = perspective_fov_lh(1.5f, 1.3f, 0.5f, 100.f);
+        CHECK(p[0] == s[0]);
+        CHECK(p[1] == s[1]);
+    }
+
+    SUBCASE("perspective depth variants") {
+        const auto depth = [](const fmat4& p, float z){
+            const fvec4 c = fvec4(0.f, 0.f, z, 1.f) * p;
+            return c.z / c.w;
+        };
+
+        const fmat4 mirror = scale4(vec{1.f,1.f,-1.f});
+        const std::array<std::pair<fmat4, fmat4>, 8> lrs{{
+            {perspective_reversed_lh(800.f, 600.f, 5.f, 10.f), perspective_reversed_rh(800.f, 600.f, 5.f, 10.f)},
+            {perspective_reversed_lh(100.f, 800.f, 50.f, 600.f, 5.f, 10.f), perspective_reversed_rh(100.f, 800.f, 50.f, 600.f, 5.f, 10.f)},
+            {perspective_fov_reversed_lh(1.5f, 1.3f, 5.f, 10.f), perspective_fov_reversed_rh(1.5f, 1.3f, 5.f, 10.f)},
+            {perspective_infinite_lh(800.f, 600.f, 5.f), perspective_infinite_rh(800.f, 600.f, 5.f)},
+            {perspective_infinite_lh(100.f, 800.f, 50.f, 600.f, 5.f), perspective_infinite_rh(100.f, 800.f, 50.f, 600.f, 5.f)},
+            {perspective_fov_infinite_lh(1.5f, 1.3f, 5.f), perspective_fov_infinite_rh(1.5f, 1.3f, 5.f)},
+            {perspective_infinite_reversed_lh(800.f, 600.f, 5.f), perspective_infinite_reversed_rh(800.f, 600.f, 5.f)},
+            {perspective_infinite_reversed_lh(100.f, 800.f, 50.f, 600.f, 5.f), perspective_infinite_reversed_rh(100.f, 800.f, 50.f, 600.f, 5.f)}}};
+        for ( const auto& [lh, rh] : lrs ) {
+            CHECK(all(approx(lh, mirror * rh)));
+        }
+
+        CHECK(depth(perspective_reversed_lh(800.f, 600.f, 5.f, 10.f), 5.f) == uapprox(1.f));
+        CHECK(depth(perspective_reversed_lh(800.f, 600.f, 5.f, 10.f), 10.f) == uapprox(0.f));
+        CHECK(depth(perspective_fov_reversed_lh(1.5f, 1.3f, 5.f, 10.f), 10.f) == uapprox(0.f));
+        CHECK(depth(perspective_infinite_lh(800.f, 600.f, 5.f), 5.f) == uapprox(0.f));
+        CHECK(depth(perspective_infinite_lh(800.f, 600.f, 5.f), 1e30f) == uapprox(1.f));
+        CHECK(depth(perspective_infinite_reversed_lh(800.f, 600.f, 5.f), 5.f) == uapprox(1.f));
+
+        CHECK(perspective_reversed_lh(800.f, 600.f, 5.f, 10.f)[0] == perspective_lh(800.f, 600.f, 5.f, 10.f)[0]);
+        CHECK(perspective_infinite_lh(100.f, 800.f, 50.f, 600.f, 5.f)[2][0] == perspective_lh(100.f, 800.f, 50.f, 600.f, 5.f, 10.f)[2][0]);
+        CHECK(all(approx(perspective_fov_infinite_lh(1.5f, 1.3f, 5.f), perspective_fov_lh(1.5f, 1.3f, 5.f, 1e9f))));
+    }
+
+    SUBCASE("inverse_perspective") {
+        const std::array<dmat4, 8> ps{
+            perspective_lh(800.0, 600.0, 0.1, 1000.0),
+            perspective_rh(100.0, 800.0, 50.0, 600.0, 0.1, 1000.0),
+            perspective_fov_lh(1.5, 1.3, 0.1, 1000.0),
+            perspective_fov_reversed_rh(1.5, 1.3, 0.1, 1000.0),
+            perspective_reversed_lh(100.0, 800.0, 50.0, 600.0, 0.1, 1000.0),
+            perspective_infinite_rh(100.0, 800.0, 50.0, 600.0, 0.1),
+            perspective_fov_infinite_reversed_lh(1.5, 1.3, 0.1),
+            perspective_infinite_reversed_rh(800.0, 600.0, 0.1)};
+        for ( const dmat4& p : ps ) {
+            CHECK(all(approx(inverse_perspective(p) * p, dmat4(identity_init), 1e-12)));
+            CHECK(all(approx(inverse_perspective(p), inverse(p), 1e-9)));
+        }
+    }
 }
 
 TEST_CASE("vmath/ext/vector_transform") {
@@ -350,6 +486,25 @@ TEST_CASE("vmath/ext/vector_transform") {
         STATIC_CHECK(project(fvec3(2.f, 2.f, 2.f), fvec3(0.f, 0.f, 1.f)) == uapprox3(0.f, 0.f, 2.f));
     }
 
+    SUBCASE("unproject") {
+        const fmat4 vp = look_at_lh(fvec3(1.f,2.f,-5.f), fvec3(0.f), unit3_y<float>)
+            * perspective_fov_reversed_lh(1.2f, 1.5f, 0.1f, 100.f);
+        const fmat4 ivp = inverse(vp);
+
+        const fvec3 p{0.5f, -0.3f, 2.f};
+        const fvec4 c = fvec4(p, 1.f) * vp;
+        const fvec3 ndc = fvec3(c.x, c.y, c.z) / c.w;
+        CHECK(all(approx(unproject(ndc, ivp), p, 1e-4f)));
+
+        const fvec4 viewport{10.f, 20.f, 800.f, 600.f};
+        const fvec3 window{
+            viewport.x + (ndc.x + 1.f) * 0.5f * viewport.z,
+            viewport.y + (1.f - ndc.y) * 0.5f * viewport.w,
+            ndc.z};
+        CHECK(all(approx(unproject(window, ivp, viewport), p, 1e-4f)));
+        CHECK(all(approx(fvec4(window, 1.f) * window_to_ndc(viewport), fvec4(ndc, 1.f), 1e-5f)));
+    }
+
     SUBCASE("perpendicular") {
         STATIC_CHECK(perpendicular(fvec2(2.f, 2.f), fvec2(0.f, 1.f)) == uapprox2(2.f, 0.f));
         STATIC_CHECK(perpendicular(fvec3(2.f, 2.f, 2.f), fvec3(0.f, 0.f, 1.f)) == uapprox3(2.f, 2.f, 0.f));
@@ -403,3 +558,46 @@ TEST_CASE("vmath/ext/quaternion_transform") {
             qrotate(fmat3(look_at_rh(fvec3(), fvec3(1.f,2.f,3.f), fvec3(0,1,0)))))));
     }
 }
+
+TEST_CASE("vmath/ext/morton_codes") {
+    SUBCASE("morton_encode") {
+        STATIC_CHECK(morton_encode(uvec2(0,0)) == 0u);
+        STATIC_CHECK(morton_encode(uvec2(1,0)) == 1u);
+        STATIC_CHECK(morton_encode(uvec2(0,1)) == 2u);
+        STATIC_CHECK(morton_encode(uvec2(3,5)) == 0b100111u);
+        STATIC_CHECK(morton_encode(uvec2(0xFFFF,0xFFFF)) == 0xFFFFFFFFu);
+
+        STATIC_CHECK(morton_encode(uvec3(1,0,0)) == 1u);
+        STATIC_CHECK(morton_encode(uvec3(0,1,0)) == 2u);
+        STATIC_CHECK(morton_encode(uvec3(0,0,1)) == 4u);
+        STATIC_CHECK(morton_encode(uvec3(3,5,6)) == 0b110101011u);
+        STATIC_CHECK(morton_encode(uvec3(0x3FF,0x3FF,0x3FF)) == 0x3FFFFFFFu);
+
+        STATIC_CHECK(morton_encode<std::uint64_t>(uvec2(0xFFFFFFFF,0)) == 0x5555555555555555u);
+        STATIC_CHECK(morton_encode<std::uint64_t>(uvec3(0,0x1FFFFF,0)) == 0x2492492492492492u);
+        STATIC_CHECK(std::is_same_v<decltype(morton_encode<std::uint64_t>(uvec3())), std::uint64_t>);
+    }
+
+    SUBCASE("morton_decode") {
+        STATIC_CHECK(morton_decode<2>(0b100111u) == uvec2(3,5));
+        STATIC_CHECK(morton_decode<3>(0b110101011u) == uvec3(3,5,6));
+
+        STATIC_CHECK(morton_decode<2>(morton_encode(uvec2(12345,54321))) == uvec2(12345,54321));
+        STATIC_CHECK(morton_decode<3>(morton_encode(uvec3(1023,512,7))) == uvec3(1023,512,7));
+
+        STATIC_CHECK(morton_decode<2>(morton_encode<std::uint64_t>(uvec2(0xDEADBEEF,0xCAFEBABE))) == uvec2(0xDEADBEEF,0xCAFEBABE));
+        STATIC_CHECK(morton_decode<3>(morton_encode<std::uint64_t>(uvec3(0x1FFFFF,0x12345,0xABCDE))) == uvec3(0x1FFFFF,0x12345,0xABCDE));
+    }
+
+    SUBCASE("quantize") {
+        STATIC_CHECK(quantize(fvec3(0.f,5.f,10.f), fvec3(0.f), fvec3(10.f), 10) == uvec3(0,512,1023));
+        STATIC_CHECK(quantize(fvec2(-5.f,15.f), fvec2(0.f), fvec2(10.f), 8) == uvec2(0,255));
+        STATIC_CHECK(quantize(dvec3(1.0,2.0,3.0), dvec3(1.0), dvec3(3.0), 21) == uvec3(0,1048576,2097151));
+
+        STATIC_CHECK(quantize(fvec3(1.f,.5f,0.f), fvec3(0.f), fvec3(1.f), 32) == uvec3(0xFFFFFFFF,0x80000000,0));
+        STATIC_CHECK(quantize(fvec3(1.f,.5f,0.f), fvec3(0.f), fvec3(1.f), 64) == uvec3(0xFFFFFFFF,0x80000000,0));
+        STATIC_CHECK(quantize(fvec2(1.f,1.f - 0x1p-24f), fvec2(0.f), fvec2(1.f), 30) == uvec2(0x3FFFFFFF,0x3FFFFFBF));
+        STATIC_CHECK(quantize(fvec2(2.f,3.f), fvec2(2.f,1.f), fvec2(2.f,5.f), 8) == uvec2(0,128));
+        STATIC_CHECK(quantize(fvec2(0.7f), fvec2(0.f), fvec2(1.f), 0) == uvec2(0));
+    }
+}
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+#include <limits>
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_tests;
+}
+
+TEST_CASE("vmath/fenv") {
+    SUBCASE("ftz_guard") {
+        volatile float tiny = std::numeric_limits<float>::min();
+        const bool was_enabled = ftz_enabled();
+
+        {
+            const ftz_guard guard;
+            CHECK(ftz_enabled() == ftz_supported());
+
+            const float half = tiny * 0.5f;
+            if ( ftz_supported() ) {
+                CHECK(half == 0.f);
+            }
+
+            {
+                const ftz_guard nested;
+                CHECK(ftz_enabled() == ftz_supported());
+            }
+            CHECK(ftz_enabled() == ftz_supported());
+        }
+
+        CHECK(ftz_enabled() == was_enabled);
+        if ( !was_enabled ) {
+            const float half = tiny * 0.5f;
+            CHECK(half > 0.f);
+        }
+    }
+}
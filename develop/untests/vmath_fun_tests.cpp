@@ -46,6 +46,11 @@ TEST_CASE("vmath/fun") {
         (void)log2(2.f);
         (void)sqrt(2.f);
         (void)rsqrt(2.f);
+
+        for ( float x : {1e-30f, 0.25f, 2.f, 3.f, 1e30f} ) {
+            CHECK(approx(fast_rsqrt(x), rsqrt(x), rsqrt(x) * 1e-5f));
+        }
+        CHECK(fast_rsqrt(4.0) == uapprox(0.5));
     }
 
     SUBCASE("Common Functions") {
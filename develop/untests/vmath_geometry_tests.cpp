@@ -0,0 +1,292 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_tests;
+
+    fobb3 make_obb(const fvec3& center, const fqua& rotation, const fvec3& half_extents) {
+        return {center, rotate(rotation), half_extents};
+    }
+}
+
+TEST_CASE("vmath/geometry/closest_point") {
+    SUBCASE("plane") {
+        constexpr fplane3 pl{unit3_y<float>, 2.f};
+        STATIC_CHECK(signed_distance(pl, fvec3(1.f,5.f,1.f)) == uapprox(3.f));
+        STATIC_CHECK(signed_distance(pl, fvec3(1.f,0.f,1.f)) == uapprox(-2.f));
+        STATIC_CHECK(distance(pl, fvec3(1.f,0.f,1.f)) == uapprox(2.f));
+        STATIC_CHECK(closest_point(pl, fvec3(1.f,5.f,1.f)) == uapprox3(1.f,2.f,1.f));
+
+        const fplane3 p3 = plane_from_points(fvec3(0.f,0.f,1.f), fvec3(1.f,0.f,1.f), fvec3(0.f,1.f,1.f));
+        CHECK(p3.normal == uapprox3(0.f,0.f,1.f));
+        CHECK(p3.offset == uapprox(1.f));
+    }
+
+    SUBCASE("segment") {
+        constexpr fsegment2 s{fvec2(0.f,0.f), fvec2(4.f,0.f)};
+        STATIC_CHECK(closest_point(s, fvec2(2.f,3.f)) == uapprox2(2.f,0.f));
+        STATIC_CHECK(closest_point(s, fvec2(-2.f,3.f)) == uapprox2(0.f,0.f));
+        STATIC_CHECK(closest_point(s, fvec2(6.f,3.f)) == uapprox2(4.f,0.f));
+        STATIC_CHECK(closest_point(fsegment2(fvec2(1.f), fvec2(1.f)), fvec2(6.f,3.f)) == uapprox2(1.f,1.f));
+        CHECK(distance(s, fvec2(7.f,4.f)) == uapprox(5.f));
+    }
+
+    SUBCASE("segments") {
+        {
+            constexpr auto ps = closest_points(
+                fsegment3(fvec3(-1.f,0.f,0.f), fvec3(1.f,0.f,0.f)),
+                fsegment3(fvec3(0.f,-1.f,2.f), fvec3(0.f,1.f,2.f)));
+            STATIC_CHECK(ps.first == uapprox3(0.f,0.f,0.f));
+            STATIC_CHECK(ps.second == uapprox3(0.f,0.f,2.f));
+        }
+        {
+            // parallel
+            constexpr auto ps = closest_points(
+                fsegment2(fvec2(0.f,0.f), fvec2(2.f,0.f)),
+                fsegment2(fvec2(3.f,1.f), fvec2(5.f,1.f)));
+            STATIC_CHECK(ps.first == uapprox2(2.f,0.f));
+            STATIC_CHECK(ps.second == uapprox2(3.f,1.f));
+        }
+        {
+            // degenerate
+            constexpr auto ps = closest_points(
+                fsegment2(fvec2(1.f,1.f), fvec2(1.f,1.f)),
+                fsegment2(fvec2(0.f,0.f), fvec2(2.f,0.f)));
+            STATIC_CHECK(ps.first == uapprox2(1.f,1.f));
+            STATIC_CHECK(ps.second == uapprox2(1.f,0.f));
+        }
+    }
+
+    SUBCASE("triangle") {
+        constexpr ftriangle3 t{fvec3(0.f,0.f,0.f), fvec3(2.f,0.f,0.f), fvec3(0.f,2.f,0.f)};
+        STATIC_CHECK(closest_point(t, fvec3(0.5f,0.5f,3.f)) == uapprox3(0.5f,0.5f,0.f));
+        STATIC_CHECK(closest_point(t, fvec3(-1.f,-1.f,0.f)) == uapprox3(0.f,0.f,0.f));
+        STATIC_CHECK(closest_point(t, fvec3(3.f,-1.f,0.f)) == uapprox3(2.f,0.f,0.f));
+        STATIC_CHECK(closest_point(t, fvec3(-1.f,3.f,1.f)) == uapprox3(0.f,2.f,0.f));
+        STATIC_CHECK(closest_point(t, fvec3(1.f,-1.f,0.f)) == uapprox3(1.f,0.f,0.f));
+        STATIC_CHECK(closest_point(t, fvec3(-1.f,1.f,0.f)) == uapprox3(0.f,1.f,0.f));
+        STATIC_CHECK(closest_point(t, fvec3(2.f,2.f,0.f)) == uapprox3(1.f,1.f,0.f));
+        CHECK(distance(t, fvec3(0.5f,0.5f,-3.f)) == uapprox(3.f));
+
+        constexpr ftriangle2 t2{fvec2(0.f,0.f), fvec2(2.f,0.f), fvec2(0.f,2.f)};
+        STATIC_CHECK(closest_point(t2, fvec2(0.5f,0.5f)) == uapprox2(0.5f,0.5f));
+    }
+
+    SUBCASE("solids") {
+        constexpr fsphere3 s{fvec3(1.f,0.f,0.f), 2.f};
+        CHECK(closest_point(s, fvec3(1.f,5.f,0.f)) == uapprox3(1.f,2.f,0.f));
+        CHECK(closest_point(s, fvec3(1.f,1.f,0.f)) == uapprox3(1.f,1.f,0.f));
+        CHECK(distance(s, fvec3(1.f,5.f,0.f)) == uapprox(3.f));
+        CHECK(distance(s, fvec3(1.f,1.f,0.f)) == uapprox(0.f));
+        CHECK(signed_distance(s, fvec3(1.f,1.f,0.f)) == uapprox(-1.f));
+
+        constexpr fcapsule2 c{fvec2(0.f,0.f), fvec2(4.f,0.f), 1.f};
+        CHECK(closest_point(c, fvec2(2.f,3.f)) == uapprox2(2.f,1.f));
+        CHECK(closest_point(c, fvec2(-3.f,0.f)) == uapprox2(-1.f,0.f));
+        CHECK(distance(c, fvec2(7.f,4.f)) == uapprox(4.f));
+        CHECK(distance(c, fvec2(2.f,0.5f)) == uapprox(0.f));
+
+        constexpr faabb3 b{fvec3(-1.f), fvec3(1.f)};
+        STATIC_CHECK(closest_point(b, fvec3(3.f,0.5f,-2.f)) == uapprox3(1.f,0.5f,-1.f));
+        CHECK(distance(b, fvec3(4.f,5.f,0.f)) == uapprox(5.f));
+
+        const fobb3 o = make_obb(fvec3(1.f,0.f,0.f), qrotate_z(radians(90.f)), fvec3(2.f,1.f,1.f));
+        CHECK(closest_point(o, fvec3(1.f,5.f,0.f)) == uapprox3(1.f,2.f,0.f));
+        CHECK(closest_point(o, fvec3(4.f,0.f,0.f)) == uapprox3(2.f,0.f,0.f));
+        CHECK(distance(o, fvec3(1.f,0.5f,0.f)) == uapprox(0.f));
+    }
+}
+
+TEST_CASE("vmath/geometry/overlaps") {
+    SUBCASE("sphere") {
+        STATIC_CHECK(overlaps(fsphere2(fvec2(0.f), 1.f), fsphere2(fvec2(2.f,0.f), 1.f)));
+        STATIC_CHECK_FALSE(overlaps(fsphere2(fvec2(0.f), 1.f), fsphere2(fvec2(2.f,0.1f), 1.f)));
+    }
+
+    SUBCASE("aabb") {
+        STATIC_CHECK(overlaps(faabb2(fvec2(0.f), fvec2(2.f)), faabb2(fvec2(1.f), fvec2(3.f))));
+        STATIC_CHECK(overlaps(faabb2(fvec2(0.f), fvec2(2.f)), faabb2(fvec2(2.f), fvec2(3.f))));
+        STATIC_CHECK_FALSE(overlaps(faabb2(fvec2(0.f), fvec2(2.f)), faabb2(fvec2(1.f,3.f), fvec2(3.f))));
+        STATIC_CHECK_FALSE(overlaps(faabb2(), faabb2(fvec2(0.f), fvec2(2.f))));
+    }
+
+    SUBCASE("capsule") {
+        constexpr fcapsule3 c{fvec3(-1.f,0.f,0.f), fvec3(1.f,0.f,0.f), 0.5f};
+        STATIC_CHECK(overlaps(c, fcapsule3(fvec3(0.f,-1.f,0.9f), fvec3(0.f,1.f,0.9f), 0.5f)));
+        STATIC_CHECK_FALSE(overlaps(c, fcapsule3(fvec3(0.f,-1.f,1.1f), fvec3(0.f,1.f,1.1f), 0.5f)));
+        STATIC_CHECK(overlaps(c, fcapsule3(fvec3(1.5f,0.f,0.f), fvec3(3.f,0.f,0.f), 0.1f)));
+        STATIC_CHECK_FALSE(overlaps(c, fcapsule3(fvec3(1.7f,0.f,0.f), fvec3(3.f,0.f,0.f), 0.1f)));
+    }
+
+    SUBCASE("obb2") {
+        const fobb2 a{fvec2(0.f), fmat2(identity_init), fvec2(1.f)};
+        const float s = sqrt(0.5f);
+        const fmat2 r45{s, s, -s, s};
+        CHECK(overlaps(a, fobb2(fvec2(2.3f,0.f), r45, fvec2(1.f))));
+        CHECK_FALSE(overlaps(a, fobb2(fvec2(2.5f,0.f), r45, fvec2(1.f))));
+        CHECK_FALSE(overlaps(a, fobb2(fvec2(2.f,2.f), r45, fvec2(0.5f))));
+    }
+
+    SUBCASE("obb3") {
+        const fobb3 a = make_obb(fvec3(0.f), fqua(), fvec3(1.f));
+        CHECK(overlaps(a, make_obb(fvec3(1.9f,0.f,0.f), fqua(), fvec3(1.f))));
+        CHECK_FALSE(overlaps(a, make_obb(fvec3(2.1f,0.f,0.f), fqua(), fvec3(1.f))));
+
+        // an edge along z against an edge along y, only their cross product separates
+        const fobb3 e1 = make_obb(fvec3(0.f), qrotate_z(radians(45.f)), fvec3(1.f));
+        CHECK(overlaps(e1, make_obb(fvec3(2.7f,0.f,0.f), qrotate_y(radians(45.f)), fvec3(1.f))));
+        CHECK_FALSE(overlaps(e1, make_obb(fvec3(3.2f,0.f,0.f), qrotate_y(radians(45.f)), fvec3(1.f))));
+        CHECK_FALSE(overlaps(make_obb(fvec3(3.2f,0.f,0.f), qrotate_y(radians(45.f)), fvec3(1.f)), e1));
+
+        // parallel edges don't produce false separations
+        CHECK(overlaps(a, make_obb(fvec3(0.5f,0.5f,0.f), qrotate_z(radians(90.f)), fvec3(1.f))));
+    }
+}
+
+TEST_CASE("vmath/geometry/batch") {
+    SUBCASE("iterators") {
+        const fsphere3 q{fvec3(0.f), 1.f};
+        const std::array<fsphere3, 3> ss{
+            fsphere3(fvec3(1.5f,0.f,0.f), 1.f),
+            fsphere3(fvec3(3.f,0.f,0.f), 1.f),
+            fsphere3(fvec3(0.f,-1.f,0.f), 0.1f)};
+        std::array<bool, 3> os{};
+        CHECK(overlaps(q, ss.begin(), ss.end(), os.begin()) == os.end());
+        CHECK(os == std::array<bool, 3>{true, false, true});
+
+        std::array<float, 3> ds{};
+        CHECK(distance(fvec3(0.f), ss.begin(), ss.end(), ds.begin()) == ds.end());
+        CHECK(ds[0] == uapprox(0.5f));
+        CHECK(ds[1] == uapprox(2.f));
+        CHECK(ds[2] == uapprox(0.9f));
+
+        std::array<fvec3, 3> cs{};
+        CHECK(closest_point(fvec3(0.f), ss.begin(), ss.end(), cs.begin()) == cs.end());
+        CHECK(cs[1] == uapprox3(2.f,0.f,0.f));
+    }
+
+    SUBCASE("soa") {
+        philox4x32 g{11u};
+
+        constexpr std::size_t n = 257;
+        std::vector<fsphere3> spheres(n);
+        std::vector<faabb3> boxes(n);
+        std::vector<fplane3> planes(n);
+        std::vector<fcapsule3> capsules(n);
+        std::vector<float> xs[3], ys[3], zs[3], ws(n), vs(n);
+
+        for ( std::size_t c = 0; c < 3; ++c ) {
+            xs[c].resize(n);
+            ys[c].resize(n);
+            zs[c].resize(n);
+        }
+
+        for ( std::size_t i = 0; i < n; ++i ) {
+            const fvec3 a = random_in_sphere<float>(g) * 4.f;
+            const fvec3 b = random_in_sphere<float>(g) * 4.f;
+            const fvec3 u = random_on_sphere<float>(g);
+            const float r = random_uniform(g, 0.1f, 1.f);
+
+            spheres[i] = {a, r};
+            boxes[i] = {min(a, b), max(a, b)};
+            planes[i] = {u, r};
+            capsules[i] = {a, b, r};
+
+            for ( std::size_t c = 0; c < 3; ++c ) {
+                xs[c][i] = a[c];
+                ys[c][i] = b[c];
+                zs[c][i] = u[c];
+            }
+            ws[i] = r;
+        }
+
+        const float* const as[3]{xs[0].data(), xs[1].data(), xs[2].data()};
+        const float* const bs[3]{ys[0].data(), ys[1].data(), ys[2].data()};
+        const float* const us[3]{zs[0].data(), zs[1].data(), zs[2].data()};
+
+        std::vector<float> lo[3], hi[3];
+        for ( std::size_t c = 0; c < 3; ++c ) {
+            for ( const faabb3& b : boxes ) {
+                lo[c].push_back(b.min[c]);
+                hi[c].push_back(b.max[c]);
+            }
+        }
+        const float* const los[3]{lo[0].data(), lo[1].data(), lo[2].data()};
+        const float* const his[3]{hi[0].data(), hi[1].data(), hi[2].data()};
+
+        std::unique_ptr<bool[]> os{new bool[n]};
+
+        const fsphere3 qs{fvec3(0.5f,-0.5f,1.f), 1.5f};
+        overlaps_soa(qs, as, ws.data(), n, os.get());
+        for ( std::size_t i = 0; i < n; ++i ) {
+            CHECK(os[i] == overlaps(qs, spheres[i]));
+        }
+
+        const faabb3 qb{fvec3(-1.f,-2.f,0.f), fvec3(1.f,0.5f,2.f)};
+        overlaps_soa(qb, los, his, n, os.get());
+        for ( std::size_t i = 0; i < n; ++i ) {
+            CHECK(os[i] == overlaps(qb, boxes[i]));
+        }
+
+        const fcapsule3 qc{fvec3(-2.f,0.f,0.f), fvec3(2.f,1.f,0.f), 0.5f};
+        overlaps_soa(qc, as, bs, ws.data(), n, os.get());
+        for ( std::size_t i = 0; i < n; ++i ) {
+            CHECK(os[i] == overlaps(qc, capsules[i]));
+        }
+
+        // a point capsule takes the other branches of the segment test
+        const fcapsule3 qp{fvec3(0.5f,0.f,1.f), fvec3(0.5f,0.f,1.f), 1.f};
+        overlaps_soa(qp, as, bs, ws.data(), n, os.get());
+        for ( std::size_t i = 0; i < n; ++i ) {
+            CHECK(os[i] == overlaps(qp, capsules[i]));
+        }
+
+        std::vector<fobb3> obbs(n);
+        std::vector<float> rs[3][3], es[3];
+        for ( std::size_t i = 0; i < n; ++i ) {
+            const fvec3 e = fvec3(
+                random_uniform(g, 0.1f, 1.5f),
+                random_uniform(g, 0.1f, 1.5f),
+                random_uniform(g, 0.1f, 1.5f));
+            obbs[i] = make_obb(capsules[i].a, random_rotation<float>(g), e);
+            for ( std::size_t r = 0; r < 3; ++r ) {
+                for ( std::size_t c = 0; c < 3; ++c ) {
+                    rs[r][c].push_back(obbs[i].axes[r][c]);
+                }
+                es[r].push_back(e[r]);
+            }
+        }
+        const float* const rss[3][3]{
+            {rs[0][0].data(), rs[0][1].data(), rs[0][2].data()},
+            {rs[1][0].data(), rs[1][1].data(), rs[1][2].data()},
+            {rs[2][0].data(), rs[2][1].data(), rs[2][2].data()}};
+        const float* const ess[3]{es[0].data(), es[1].data(), es[2].data()};
+
+        const fobb3 qo = make_obb(fvec3(0.5f,-1.f,0.f), qrotate(radians(30.f), normalize(fvec3(1.f,2.f,3.f))), fvec3(2.f,0.5f,1.f));
+        overlaps_soa(qo, as, rss, ess, n, os.get());
+        std::size_t hits = 0;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            CHECK(os[i] == overlaps(qo, obbs[i]));
+            hits += os[i] ? 1 : 0;
+        }
+        CHECK(hits > 0);
+        CHECK(hits < n);
+
+        const fvec3 p{1.f,2.f,-0.5f};
+        signed_distance_soa(p, us, ws.data(), n, vs.data());
+        for ( std::size_t i = 0; i < n; ++i ) {
+            CHECK(vs[i] == uapprox(signed_distance(planes[i], p)));
+        }
+    }
+}
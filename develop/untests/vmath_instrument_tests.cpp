@@ -0,0 +1,266 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+#if defined(VMATH_HPP_INSTRUMENT)
+#  include <cstdio>
+#  include <string>
+#  include <thread>
+#endif
+
+#if defined(VMATH_HPP_CHECKED)
+#  include <limits>
+#endif
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_tests;
+
+#if defined(VMATH_HPP_CHECKED)
+    // the tests of every file produce invalid results on purpose,
+    // they are counted instead of being printed to stderr
+    struct counting_handler : checked::handler {
+        std::atomic<std::uint64_t> count{};
+
+        counting_handler() {
+            on_issue = [](const checked::report&, void* user_data){
+                static_cast<counting_handler*>(user_data)->count += 1;
+            };
+            user_data = this;
+            checked::set_handler(this);
+        }
+    };
+
+    counting_handler quiet_handler;
+#endif
+}
+
+TEST_CASE("vmath/instrument") {
+    SUBCASE("constant evaluation") {
+        STATIC_CHECK(determinant(fmat3{1.f, 0.f, 0.f, 0.f, 2.f, 0.f, 0.f, 0.f, 3.f}) == uapprox(6.f));
+        STATIC_CHECK(inverse(fmat2{2.f, 0.f, 0.f, 4.f}) == fmat2{0.5f, 0.f, 0.f, 0.25f});
+        STATIC_CHECK(fmat2{1.f, 2.f, 3.f, 4.f} * fmat2{identity_init} == fmat2{1.f, 2.f, 3.f, 4.f});
+    }
+
+#if defined(VMATH_HPP_INSTRUMENT)
+    using namespace vmath_hpp::instrument;
+
+    SUBCASE("counters") {
+        reset_thread_counters();
+        for ( std::size_t i = 0; i < function_count; ++i ) {
+            CHECK(thread_counter(static_cast<function>(i)).calls == 0);
+        }
+
+        volatile float angle = 0.5f;
+        const fmat4 m = rotate4(angle, unit3_z<float>);
+        CHECK(thread_counter(function::rotate).calls == 1);
+        CHECK(thread_counter(function::normalize).calls == 1);
+
+        const fmat4 mm = m * inverse(m);
+        CHECK(all(approx(mm, fmat4{identity_init}, 1e-5f)));
+        CHECK(thread_counter(function::mat_mul).calls == 1);
+        CHECK(thread_counter(function::mat_mul).flops == 4 * 4 * 7);
+        CHECK(thread_counter(function::inverse).calls == 1);
+        CHECK(thread_counter(function::inverse).flops == 140);
+        CHECK(thread_counter(function::determinant).calls == 0);
+
+        const fqua q = slerp(qrotate_z(0.f), qrotate_z(angle), 0.5f);
+        CHECK(all(approx(q, qrotate_z(0.25f), 1e-5f)));
+        CHECK(thread_counter(function::slerp).calls == 1);
+
+        // counters are thread-local
+        std::thread([](){
+            CHECK(thread_counter(function::slerp).calls == 0);
+            (void)normalize(fvec2{1.f, 1.f});
+            CHECK(thread_counter(function::normalize).calls == 1);
+        }).join();
+        CHECK(thread_counter(function::normalize).calls == 1);
+
+        reset_thread_counters();
+        CHECK(thread_counter(function::slerp).calls == 0);
+        CHECK(thread_counter(function::mat_mul).flops == 0);
+    }
+
+    SUBCASE("batch kernels") {
+        // the kernels don't go through the public operators lane by lane
+        reset_thread_counters();
+
+        const fqua xs[1]{qrotate_z(0.5f)};
+        const fqua ys[1]{qrotate_x(0.25f)};
+        fqua rs[1]{};
+        multiply_n(xs, ys, 1, rs);
+        CHECK(all(approx(rs[0], xs[0] * ys[0], 1e-6f)));
+        CHECK(thread_counter(function::qua_mul).calls == 1);
+
+        reset_thread_counters();
+        multiply_n(xs, ys, 1, rs);
+        CHECK(thread_counter(function::qua_mul).calls == 0);
+    }
+
+    SUBCASE("hooks") {
+        struct calls_t {
+            unsigned calls{};
+            std::uint64_t flops{};
+        } calls;
+
+        hooks h;
+        h.on_call = [](function f, std::uint64_t flops, void* user_data){
+            auto* c = static_cast<calls_t*>(user_data);
+            c->calls += f == function::normalize ? 1u : 0u;
+            c->flops += flops;
+        };
+        h.user_data = &calls;
+
+        set_hooks(&h);
+        (void)normalize(fvec4{1.f, 2.f, 3.f, 4.f});
+        (void)normalize(fvec4{4.f, 3.f, 2.f, 1.f});
+        set_hooks(nullptr);
+        (void)normalize(fvec4{1.f, 1.f, 1.f, 1.f});
+
+        CHECK(calls.calls == 2);
+        CHECK(calls.flops == 2 * 3 * 4);
+    }
+
+    SUBCASE("trace_writer") {
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file);
+
+        std::uint64_t events{};
+        {
+            trace_writer writer{file};
+            set_hooks(&writer.as_hooks());
+            set_zone_sample_rate(1);
+            {
+                const zone z{"frame \"1\""};
+                (void)inverse(fqua{1.f, 2.f, 3.f, 4.f});
+            }
+            set_zone_sample_rate(0);
+            {
+                const zone z{"unsampled"};
+            }
+            events = writer.event_count();
+        }
+        CHECK(events == 2);
+
+        std::string json;
+        std::rewind(file);
+        for ( int c = std::fgetc(file); c != EOF; c = std::fgetc(file) ) {
+            json.push_back(static_cast<char>(c));
+        }
+        std::fclose(file);
+
+        CHECK(json.find("{\"traceEvents\":[") == 0);
+        CHECK(json.find("\"name\":\"inverse(qua)\"") != std::string::npos);
+        CHECK(json.find("\"name\":\"frame \\\"1\\\"\"") != std::string::npos);
+        CHECK(json.find("unsampled") == std::string::npos);
+        CHECK(json.find("\n]}\n") == json.size() - 4);
+    }
+#endif
+}
+
+TEST_CASE("vmath/checked") {
+    SUBCASE("constant evaluation") {
+        STATIC_CHECK(lerp(0.f, 2.f, 0.5f) == uapprox(1.f));
+        STATIC_CHECK(inverse(qua{vec{0.f, 0.f, 0.f}, 2.f}) == qua{vec{0.f, 0.f, 0.f}, 0.5f});
+    }
+
+#if defined(VMATH_HPP_CHECKED)
+    using namespace vmath_hpp::checked;
+
+    SUBCASE("issues") {
+        struct issues_t {
+            unsigned count{};
+            report last{};
+        } issues;
+
+        handler h;
+        h.on_issue = [](const report& r, void* user_data){
+            auto* i = static_cast<issues_t*>(user_data);
+            i->count += 1;
+            i->last = r;
+        };
+        h.user_data = &issues;
+
+        set_handler(&h);
+        reset_thread_issues();
+
+        CHECK(normalize(fvec3{1.f, 0.f, 0.f}) == uapprox3(1.f, 0.f, 0.f));
+        CHECK(thread_first_issue() == nullptr);
+
+        {
+            const scope s{"physics"};
+            (void)normalize(fvec3{0.f});
+        }
+        REQUIRE(thread_first_issue() != nullptr);
+        CHECK(thread_first_issue()->function == std::string_view{"normalize"});
+        CHECK(thread_first_issue()->scope == std::string_view{"physics"});
+        CHECK(thread_first_issue()->what == issue::nan);
+        CHECK(thread_first_issue()->component == 0);
+        CHECK(std::string_view{thread_first_issue()->file}.find("vmath") != std::string_view::npos);
+        CHECK(thread_first_issue()->line > 0);
+
+        (void)inverse(fmat2{1.f, 2.f, 2.f, 4.f});
+        CHECK(issues.last.function == std::string_view{"inverse"});
+        CHECK(issues.last.scope == nullptr);
+        CHECK(issues.last.what == issue::infinity);
+
+        (void)angle(fvec2{0.f}, fvec2{1.f, 0.f});
+        CHECK(issues.last.function == std::string_view{"angle"});
+
+        // the first issue is kept
+        CHECK(issues.count == 3);
+        CHECK(thread_issue_count() == 3);
+        CHECK(thread_first_issue()->function == std::string_view{"normalize"});
+
+        set_handler(&quiet_handler);
+        reset_thread_issues();
+        CHECK(thread_first_issue() == nullptr);
+    }
+
+    SUBCASE("outermost") {
+        // a nested call doesn't report the same value again
+        reset_thread_issues();
+        const std::uint64_t handled = quiet_handler.count;
+
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        (void)(fmat2{nan, 0.f, 0.f, 1.f} * fmat2{});
+        CHECK(thread_issue_count() == 1);
+        CHECK(quiet_handler.count == handled + 1);
+        CHECK(thread_first_issue()->function == std::string_view{"mat * mat"});
+
+        reset_thread_issues();
+        (void)lerp(fvec3{nan, 0.f, 0.f}, fvec3{1.f}, 0.5f);
+        CHECK(thread_issue_count() == 1);
+        CHECK(thread_first_issue()->function == std::string_view{"lerp"});
+
+        reset_thread_issues();
+        (void)nlerp(fqua{nan, 0.f, 0.f, 1.f}, fqua{}, 0.5f);
+        CHECK(thread_issue_count() == 1);
+        CHECK(thread_first_issue()->function == std::string_view{"nlerp"});
+
+        reset_thread_issues();
+        volatile float tiny = std::numeric_limits<float>::min();
+        (void)lerp(fvec2{tiny, 1.f}, fvec2{0.f, 1.f}, 0.5f);
+        CHECK(thread_denormal_count() == 1);
+
+        reset_thread_issues();
+    }
+
+    SUBCASE("denormals") {
+        reset_thread_issues();
+
+        volatile float tiny = std::numeric_limits<float>::min();
+        (void)lerp(fvec2{tiny}, fvec2{0.f}, 0.5f);
+        CHECK(thread_denormal_count() > 0);
+        CHECK(thread_issue_count() == 0);
+
+        reset_thread_issues();
+        CHECK(thread_denormal_count() == 0);
+    }
+#endif
+}
@@ -291,6 +291,45 @@ TEST_CASE("vmath/mat_fun") {
         ));
     }
 
+    SUBCASE("non-square") {
+        constexpr imat2x3 a{1,2,3,4,5,6};
+
+        STATIC_CHECK(-a == imat2x3(-1,-2,-3,-4,-5,-6));
+        STATIC_CHECK(a + 1 == imat2x3(2,3,4,5,6,7));
+        STATIC_CHECK(a + a == a * 2);
+        STATIC_CHECK(transpose(a) == imat3x2(1,4,2,5,3,6));
+        STATIC_CHECK(transpose(transpose(a)) == a);
+
+        STATIC_CHECK(ivec2(1,1) * a == ivec3(5,7,9));
+        STATIC_CHECK(a * transpose(a) == imat2(14,32,32,77));
+        STATIC_CHECK(transpose(a) * a == imat3(17,22,27,22,29,36,27,36,45));
+        STATIC_CHECK(a * imat3() == a);
+
+        // 4x3 affine matrix: three basis rows and a translation row
+        constexpr fmat4x3 bone{
+            2.f, 0.f, 0.f,
+            0.f, 2.f, 0.f,
+            0.f, 0.f, 2.f,
+            1.f, 2.f, 3.f};
+        STATIC_CHECK(fvec4(1.f,1.f,1.f,1.f) * bone == fvec3(3.f,4.f,5.f));
+        STATIC_CHECK(transpose(bone)[0] == fvec4(2.f,0.f,0.f,1.f));
+
+        {
+            imat2x3 m = a;
+            m *= imat3(2);
+            CHECK(m == a * 2);
+            m += 1;
+            CHECK(m == a * 2 + 1);
+        }
+
+        STATIC_CHECK(all(less(a, a + 1)));
+        STATIC_CHECK(any(equal_to(a, imat2x3(zero_init))) == false);
+
+        constexpr mat<double, 6> j{2.0};
+        STATIC_CHECK(j * j == mat<double, 6>{4.0});
+        STATIC_CHECK(vec<double, 6>{1.0} * j == vec<double, 6>{2.0});
+    }
+
     SUBCASE("determinant") {
         constexpr imat2 m2{1,2,3,4};
         constexpr imat3 m3{1,2,3,4,5,6,7,8,9};
@@ -306,6 +345,40 @@ TEST_CASE("vmath/mat_fun") {
         STATIC_CHECK(determinant(transpose(generate_frank_matrix<int, 2>())) == 1);
         STATIC_CHECK(determinant(transpose(generate_frank_matrix<int, 3>())) == 1);
         STATIC_CHECK(determinant(transpose(generate_frank_matrix<int, 4>())) == 1);
+
+        constexpr imat4 m5{2,-1,0,3,1,4,-2,0,0,5,1,-3,7,0,2,1};
+        STATIC_CHECK(adjugate(m5) * m5 == imat4(determinant(m5)));
+        STATIC_CHECK(m5 * adjugate(m5) == imat4(determinant(m5)));
+    }
+
+    SUBCASE("inverse_determinant") {
+        {
+            constexpr auto id = inverse_determinant(fmat4(0.5f));
+            STATIC_CHECK(id.first == fmat4(2.f));
+            STATIC_CHECK(id.second == uapprox(0.0625f));
+        }
+        {
+            constexpr auto id = inverse_determinant(fmat3(2.f));
+            STATIC_CHECK(id.first == fmat3(0.5f));
+            STATIC_CHECK(id.second == uapprox(8.f));
+        }
+        {
+            constexpr auto id = inverse_determinant(fmat4(1.f,2.f,3.f,4.f, 2.f,4.f,6.f,8.f, 0.f,1.f,0.f,1.f, 1.f,0.f,1.f,0.f));
+            STATIC_CHECK(id.first == fmat4(zero_init));
+            STATIC_CHECK(id.second == 0.f);
+        }
+        {
+            // the determinant is denormal, the inverse would overflow
+            const auto id = inverse_determinant(fmat4(1e-12f));
+            CHECK(id.first == fmat4(zero_init));
+            CHECK(id.second == 0.f);
+        }
+        {
+            const fmat4 m = perspective_lh(800.f, 600.f, 0.1f, 100.f) * translate(fvec3(1.f, 2.f, 3.f));
+            const auto [inv, det] = inverse_determinant(m);
+            CHECK(all(approx(inv, inverse(m), 1e-5f)));
+            CHECK(det == uapprox(determinant(m)));
+        }
     }
 
     SUBCASE("inverse") {
@@ -356,4 +429,117 @@ TEST_CASE("vmath/mat_fun") {
                 0.0001f)));
         }
     }
+    SUBCASE("mul_chain") {
+        constexpr imat2 a{1,2,3,4};
+        constexpr imat2 b{0,1,1,0};
+        constexpr imat2 c{2,0,0,3};
+        STATIC_CHECK(mul_chain(a) == a);
+        STATIC_CHECK(mul_chain(a, b, c) == a * b * c);
+        STATIC_CHECK(mul_chain(ivec2(1,2), a, b, c) == ivec2(1,2) * (a * b * c));
+    }
+
+    SUBCASE("symmetric_eigen") {
+        {
+            const auto [d, v] = symmetric_eigen(dmat3(dvec3(1.0, 3.0, 2.0)));
+            CHECK(d == uapprox3(3.0, 2.0, 1.0));
+            CHECK(abs(v[0]) == uapprox3(0.0, 0.0, 1.0));
+            CHECK(abs(v[1]) == uapprox3(1.0, 0.0, 0.0));
+            CHECK(abs(v[2]) == uapprox3(0.0, 1.0, 0.0));
+        }
+
+        {
+            constexpr dmat3 m{
+                4.0, 1.0, -2.0,
+                1.0, 2.0,  0.0,
+               -2.0, 0.0,  3.0};
+            const auto [d, v] = symmetric_eigen(m);
+            CHECK(d[0] >= d[1]);
+            CHECK(d[1] >= d[2]);
+            CHECK(d[0] + d[1] + d[2] == uapprox(9.0));
+            CHECK(all(approx(v * dmat3(d) * transpose(v), m, 1e-12)));
+            CHECK(all(approx(transpose(v) * v, dmat3(), 1e-12)));
+        }
+
+        {
+            const fmat3 r = rotate(0.7f, normalize(fvec3(1.f, 2.f, 3.f)));
+            const fmat3 m = transpose(r) * fmat3(fvec3(5.f, 0.5f, 2.f)) * r;
+            const auto [d, v] = symmetric_eigen(m);
+            CHECK(d == uapprox3(5.f, 2.f, 0.5f));
+            CHECK(all(approx(v * fmat3(d) * transpose(v), m, 1e-5f)));
+        }
+
+        {
+            const auto [d, v] = symmetric_eigen(dmat2(2.0, 1.0, 1.0, 2.0));
+            CHECK(d == uapprox2(3.0, 1.0));
+            CHECK(all(approx(v * dmat2(d) * transpose(v), dmat2(2.0, 1.0, 1.0, 2.0), 1e-12)));
+        }
+
+        {
+            constexpr dmat4 m{
+                4.0, 1.0, -2.0, 0.5,
+                1.0, 2.0,  0.0, 1.0,
+               -2.0, 0.0,  3.0, 0.0,
+                0.5, 1.0,  0.0, 1.0};
+            const auto [d, v] = symmetric_eigen(m);
+            CHECK(d[0] >= d[1]);
+            CHECK(d[2] >= d[3]);
+            CHECK(all(approx(v * dmat4(d) * transpose(v), m, 1e-12)));
+            CHECK(all(approx(transpose(v) * v, dmat4(), 1e-12)));
+        }
+    }
+
+    SUBCASE("svd") {
+        {
+            constexpr dmat3 m{
+                1.0, 2.0, 3.0,
+               -4.0, 5.0, 6.0,
+                7.0, 8.0, -9.0};
+            const auto [u, s, v] = svd(m);
+            CHECK(all(approx(u * dmat3(s) * transpose(v), m, 1e-12)));
+            CHECK(all(approx(transpose(u) * u, dmat3(), 1e-12)));
+            CHECK(all(approx(transpose(v) * v, dmat3(), 1e-12)));
+            CHECK(determinant(u) == uapprox(1.0));
+            CHECK(determinant(v) == uapprox(1.0));
+            CHECK(abs(s[0]) >= abs(s[1]));
+            CHECK(abs(s[1]) >= abs(s[2]));
+        }
+
+        {
+            // reflection: the sign goes to the smallest singular value
+            constexpr dmat3 m = dmat3(dvec3(2.0, -1.0, 3.0));
+            const auto [u, s, v] = svd(m);
+            CHECK(s == uapprox3(3.0, 2.0, -1.0));
+            CHECK(all(approx(u * dmat3(s) * transpose(v), m, 1e-12)));
+            CHECK(determinant(u) == uapprox(1.0));
+            CHECK(determinant(v) == uapprox(1.0));
+        }
+
+        {
+            // rank deficient
+            constexpr fmat3 m{
+                1.f, 2.f, 3.f,
+                2.f, 4.f, 6.f,
+                0.f, 0.f, 0.f};
+            const auto [u, s, v] = svd(m);
+            CHECK(all(approx(u * fmat3(s) * transpose(v), m, 1e-4f)));
+            CHECK(all(approx(transpose(u) * u, fmat3(), 1e-5f)));
+            CHECK(determinant(u) == uapprox(1.f));
+        }
+
+        {
+            const auto [u, s, v] = svd(fmat3(zero_init));
+            CHECK(s == uapprox3(0.f));
+            CHECK(determinant(u) == uapprox(1.f));
+            CHECK(determinant(v) == uapprox(1.f));
+        }
+    }
+
+    SUBCASE("polar") {
+        const fmat3 r = rotate(1.2f, normalize(fvec3(-1.f, 2.f, 0.5f)));
+        const fmat3 s = scale(fvec3(2.f, 3.f, 0.5f));
+        const auto [pr, ps] = polar(r * s);
+        CHECK(all(approx(pr, r, 1e-5f)));
+        CHECK(all(approx(ps, s, 1e-5f)));
+        CHECK(all(approx(pr * ps, r * s, 1e-5f)));
+    }
 }
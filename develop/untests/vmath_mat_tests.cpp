@@ -333,3 +333,77 @@ TEST_CASE("vmath/mat") {
         STATIC_CHECK_FALSE(imat2(1,2,3,4) < imat2(0,3,3,4));
     }
 }
+
+TEST_CASE("vmath/mat/generic") {
+    SUBCASE("size/sizeof") {
+        STATIC_CHECK(imat2x3{}.size == 2);
+        STATIC_CHECK(imat2x3::row_type::size == 3);
+        STATIC_CHECK(imat2x3::column_type::size == 2);
+        STATIC_CHECK(imat4x3{}.size == 4);
+        STATIC_CHECK(mat<int, 6>{}.size == 6);
+
+        STATIC_CHECK(sizeof(imat2x3{}) == sizeof(int) * 2 * 3);
+        STATIC_CHECK(sizeof(imat3x4{}) == sizeof(int) * 3 * 4);
+        STATIC_CHECK(sizeof(mat<int, 6>{}) == sizeof(int) * 6 * 6);
+    }
+
+    SUBCASE("guides") {
+        STATIC_CHECK(std::is_same_v<decltype(mat{vec{1,2,3},vec{4,5,6}}), imat2x3>);
+        STATIC_CHECK(std::is_same_v<decltype(mat{vec{1,2},vec{3,4},vec{5,6}}), imat3x2>);
+        STATIC_CHECK(std::is_same_v<decltype(mat{vec{1,2},vec{3,4}}), imat2>);
+    }
+
+    SUBCASE("ctors") {
+        STATIC_CHECK(imat2x3() == imat2x3(ivec3(1,0,0), ivec3(0,1,0)));
+        STATIC_CHECK(imat3x2() == imat3x2(ivec2(1,0), ivec2(0,1), ivec2(0,0)));
+        STATIC_CHECK(imat2x3(zero_init) == imat2x3(0,0,0,0,0,0));
+        STATIC_CHECK(imat2x3(unit_init) == imat2x3(1,1,1,1,1,1));
+        STATIC_CHECK(imat2x3(2) == imat2x3(2,0,0,0,2,0));
+        STATIC_CHECK(imat2x3(1,2,3,4,5,6) == imat2x3(ivec3(1,2,3), ivec3(4,5,6)));
+        STATIC_CHECK(fmat2x3(imat2x3(1,2,3,4,5,6)) == fmat2x3(1.f,2.f,3.f,4.f,5.f,6.f));
+
+        constexpr int is[]{1,2,3,4,5,6};
+        STATIC_CHECK(imat3x2(is) == imat3x2(1,2,3,4,5,6));
+
+        STATIC_CHECK(mat<int, 6>()[5] == vec<int, 6>(0,0,0,0,0,1));
+
+        STATIC_CHECK(imat2x3(ivec2(2,3)) == imat2x3(2,0,0,0,3,0));
+        STATIC_CHECK(imat4x3(ivec3(2,3,4)) == imat4x3(2,0,0,0,3,0,0,0,4,0,0,0));
+        STATIC_CHECK(mat<int, 5>(vec<int, 5>(1,2,3,4,5))[4] == vec<int, 5>(0,0,0,0,5));
+    }
+
+    SUBCASE("shape ctors") {
+        constexpr imat4 m4{1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16};
+        constexpr imat3 m3{1,2,3,4,5,6,7,8,9};
+
+        // truncating
+        STATIC_CHECK(imat4x3(m4) == imat4x3(1,2,3,5,6,7,9,10,11,13,14,15));
+        STATIC_CHECK(imat3x4(m4) == imat3x4(1,2,3,4,5,6,7,8,9,10,11,12));
+        STATIC_CHECK(imat2x3(m3) == imat2x3(1,2,3,4,5,6));
+        STATIC_CHECK(imat2x3(imat3x4(m4)) == imat2x3(1,2,3,5,6,7));
+        STATIC_CHECK(imat3(imat4x3(m4)) == imat3(1,2,3,5,6,7,9,10,11));
+        STATIC_CHECK(imat2(imat2x4(m4)) == imat2(1,2,5,6));
+
+        // extending with the identity
+        STATIC_CHECK(imat3x4(m3) == imat3x4(1,2,3,0,4,5,6,0,7,8,9,0));
+        STATIC_CHECK(imat4x3(m3) == imat4x3(1,2,3,4,5,6,7,8,9,0,0,0));
+        STATIC_CHECK(imat4(imat4x3(m4)) == imat4(1,2,3,0,5,6,7,0,9,10,11,0,13,14,15,1));
+        STATIC_CHECK(imat3(imat2x3(1,2,3,4,5,6)) == imat3(1,2,3,4,5,6,0,0,1));
+        STATIC_CHECK(imat4x3(imat3x2(1,2,3,4,5,6)) == imat4x3(1,2,0,3,4,0,5,6,1,0,0,0));
+        STATIC_CHECK(fmat3x4(imat3()) == fmat3x4(1.f,0.f,0.f,0.f,0.f,1.f,0.f,0.f,0.f,0.f,1.f,0.f));
+
+        // a shape that truncates one size and extends the other isn't convertible
+        STATIC_CHECK_FALSE(std::is_constructible_v<imat4x3, imat3x4>);
+        STATIC_CHECK_FALSE(std::is_constructible_v<imat3, imat2x4>);
+        STATIC_CHECK_FALSE(std::is_convertible_v<imat4, imat4x3>);
+        STATIC_CHECK_FALSE(std::is_convertible_v<imat3, imat3x4>);
+    }
+
+    SUBCASE("access") {
+        constexpr imat2x3 m{1,2,3,4,5,6};
+        STATIC_CHECK(m[1] == ivec3(4,5,6));
+        STATIC_CHECK(m.at(1) == ivec3(4,5,6));
+        STATIC_CHECK(m[1][2] == 6);
+        CHECK(std::distance(m.begin(), m.end()) == 2);
+    }
+}
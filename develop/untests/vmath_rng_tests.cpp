@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_tests;
+}
+
+TEST_CASE("vmath/rng/engines") {
+    SUBCASE("philox4x32") {
+        // known answers from the Random123 test vectors
+        STATIC_CHECK(philox4x32::generate(
+            {0u, 0u, 0u, 0u},
+            {0u, 0u}) == uvec4(0x6627E8D5u, 0xE169C58Du, 0xBC57AC4Cu, 0x9B00DBD8u));
+        STATIC_CHECK(philox4x32::generate(
+            {0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu},
+            {0xFFFFFFFFu, 0xFFFFFFFFu}) == uvec4(0x408F276Du, 0x41C83B0Eu, 0xA20BC7C6u, 0x6D5451FDu));
+        STATIC_CHECK(philox4x32::generate(
+            {0x243F6A88u, 0x85A308D3u, 0x13198A2Eu, 0x03707344u},
+            {0xA4093822u, 0x299F31D0u}) == uvec4(0xD16CFE09u, 0x94FDCCEBu, 0x5001E420u, 0x24126EA1u));
+    }
+
+    SUBCASE("streams") {
+        philox4x32 g0{42u, 0u};
+        philox4x32 g1{42u, 1u};
+        philox4x32 g2{42u, 0u};
+
+        const uvec4 b0 = g0.next_block();
+        CHECK(b0 != g1.next_block());
+        CHECK(b0 == g2.next_block());
+        CHECK(b0 != g0.next_block());
+
+        philox4x32 g3{42u, 0u};
+        philox4x32 g4{42u, 0u};
+        g3.discard(5);
+        for ( unsigned i = 0; i < 5; ++i ) {
+            (void)g4();
+        }
+        CHECK(g3() == g4());
+    }
+}
+
+TEST_CASE("vmath/rng/distributions") {
+    philox4x32 g{12345u};
+
+    SUBCASE("random_uniform") {
+        for ( unsigned i = 0; i < 1000; ++i ) {
+            const float f = random_uniform<float>(g);
+            CHECK((f >= 0.f && f < 1.f));
+
+            const double d = random_uniform<double>(g);
+            CHECK((d >= 0.0 && d < 1.0));
+
+            const float r = random_uniform(g, -2.f, 3.f);
+            CHECK((r >= -2.f && r <= 3.f));
+
+            const fvec3 v = random_uniform(g, fvec3(-1.f,0.f,1.f), fvec3(0.f,1.f,2.f));
+            CHECK(all(greater_equal(v, fvec3(-1.f,0.f,1.f))));
+            CHECK(all(less_equal(v, fvec3(0.f,1.f,2.f))));
+        }
+
+        std::mt19937 mt{42u};
+        const float f = random_uniform<float>(mt);
+        CHECK((f >= 0.f && f < 1.f));
+    }
+
+    SUBCASE("circle and disk") {
+        for ( unsigned i = 0; i < 1000; ++i ) {
+            CHECK(length(random_on_circle<float>(g)) == uapprox(1.f));
+            CHECK(length(random_in_disk<double>(g)) <= 1.0 + 1e-12);
+        }
+    }
+
+    SUBCASE("sphere and hemisphere") {
+        dvec3 mean{0.0};
+        for ( unsigned i = 0; i < 10000; ++i ) {
+            const dvec3 p = random_on_sphere<double>(g);
+            CHECK(length(p) == uapprox(1.0));
+            mean += p;
+
+            CHECK(length(random_in_sphere<float>(g)) <= 1.f + 1e-6f);
+
+            const fvec3 h = random_on_hemisphere(g, fvec3(0.f,1.f,0.f));
+            CHECK(h.y >= 0.f);
+        }
+        CHECK(all(less(abs(mean / 10000.0), dvec3(0.05))));
+    }
+
+    SUBCASE("random_rotation") {
+        for ( unsigned i = 0; i < 1000; ++i ) {
+            CHECK(length(random_rotation<float>(g)) == uapprox(1.f));
+        }
+    }
+
+    SUBCASE("batches") {
+        // from a block boundary the samples are the ones of the single versions
+        {
+            philox4x32 g0{42u};
+            philox4x32 g1{42u};
+            fvec3 ps[37];
+            random_on_sphere(g0, std::begin(ps), std::end(ps));
+            for ( const fvec3& p : ps ) {
+                CHECK(p == random_on_sphere<float>(g1));
+            }
+        }
+        {
+            philox4x32 g0{42u, 1u};
+            philox4x32 g1{42u, 1u};
+            dvec2 ds[21];
+            random_in_disk(g0, std::begin(ds), std::end(ds));
+            for ( const dvec2& d : ds ) {
+                CHECK(d == random_in_disk<double>(g1));
+            }
+        }
+        {
+            // the numbers of the last blocks are skipped, 16 samples
+            // of 3 floats take 12 blocks, 100 samples take 84
+            philox4x32 g0{42u, 2u};
+            philox4x32 g1{42u, 2u};
+            std::vector<fqua> qs(100);
+            random_rotation(g0, qs.begin(), qs.end());
+            for ( const fqua& q : qs ) {
+                CHECK(q == random_rotation<float>(g1));
+            }
+            for ( unsigned i = 0; i < 84 - 75; ++i ) {
+                (void)g1.next_block();
+            }
+            CHECK(g0.next_block() == g1.next_block());
+        }
+
+        fvec3 vs[50];
+        random_uniform(g, std::begin(vs), std::end(vs), fvec3(-1.f,0.f,1.f), fvec3(0.f,1.f,2.f));
+        for ( const fvec3& v : vs ) {
+            CHECK(all(greater_equal(v, fvec3(-1.f,0.f,1.f))));
+            CHECK(all(less_equal(v, fvec3(0.f,1.f,2.f))));
+        }
+
+        float fs[10];
+        random_uniform(g, std::begin(fs), std::end(fs), -2.f, 3.f);
+        for ( const float f : fs ) {
+            CHECK((f >= -2.f && f <= 3.f));
+        }
+
+        fvec3 hs[20];
+        random_on_hemisphere(g, std::begin(hs), std::end(hs), fvec3(0.f,1.f,0.f));
+        for ( const fvec3& h : hs ) {
+            CHECK(h.y >= 0.f);
+        }
+
+        dvec3 ss[20];
+        random_in_sphere(g, std::begin(ss), std::end(ss));
+        fvec2 cs[20];
+        random_on_circle(g, std::begin(cs), std::end(cs));
+        for ( std::size_t i = 0; i < 20; ++i ) {
+            CHECK(length(ss[i]) <= 1.0 + 1e-12);
+            CHECK(length(cs[i]) == uapprox(1.f));
+        }
+
+        // other generators give one number at a time, like the single versions
+        std::mt19937 mt0{42u};
+        std::mt19937 mt1{42u};
+        fvec3 ms[5];
+        random_on_sphere(mt0, std::begin(ms), std::end(ms));
+        for ( const fvec3& m : ms ) {
+            CHECK(m == random_on_sphere<float>(mt1));
+        }
+        CHECK(mt0() == mt1());
+    }
+}
@@ -0,0 +1,40 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_hpp::swizzles;
+    using namespace vmath_tests;
+}
+
+TEST_CASE("vmath/swizzle") {
+    SUBCASE("vec2") {
+        STATIC_CHECK(xx(ivec2(1,2)) == ivec2(1,1));
+        STATIC_CHECK(yx(ivec2(1,2)) == ivec2(2,1));
+        STATIC_CHECK(xyx(ivec2(1,2)) == ivec3(1,2,1));
+        STATIC_CHECK(yyxx(ivec2(1,2)) == ivec4(2,2,1,1));
+    }
+
+    SUBCASE("vec3") {
+        STATIC_CHECK(zyx(ivec3(1,2,3)) == ivec3(3,2,1));
+        STATIC_CHECK(xz(ivec3(1,2,3)) == ivec2(1,3));
+        STATIC_CHECK(xyzz(ivec3(1,2,3)) == ivec4(1,2,3,3));
+    }
+
+    SUBCASE("vec4") {
+        STATIC_CHECK(wzyx(ivec4(1,2,3,4)) == ivec4(4,3,2,1));
+        STATIC_CHECK(xyz(ivec4(1,2,3,4)) == ivec3(1,2,3));
+        STATIC_CHECK(ww(ivec4(1,2,3,4)) == ivec2(4,4));
+        STATIC_CHECK(xyz(fvec4(1.f,2.f,3.f,4.f)) == fvec3(1.f,2.f,3.f));
+    }
+
+    SUBCASE("generic") {
+        STATIC_CHECK(wzyx(vec<int, 5>(1,2,3,4,5)) == ivec4(4,3,2,1));
+    }
+}
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_tests;
+}
+
+TEST_CASE("vmath/transform") {
+    const fvec3 t{1.f, 2.f, 3.f};
+    const fqua r = qrotate(0.7f, normalize(fvec3(1.f, 2.f, 3.f)));
+    const fvec3 s{2.f, 3.f, 4.f};
+
+    SUBCASE("ctors") {
+        STATIC_CHECK(ftransform().translation() == fvec3(0.f));
+        STATIC_CHECK(ftransform().rotation() == fqua());
+        STATIC_CHECK(ftransform().scale() == fvec3(1.f));
+
+        STATIC_CHECK(ftransform(fvec3(1.f)).translation() == fvec3(1.f));
+        STATIC_CHECK(ftransform(fvec3(1.f)).scale() == fvec3(1.f));
+
+        CHECK(ftransform().matrix() == fmat4());
+        CHECK(ftransform().inverse_matrix() == fmat4());
+        CHECK(ftransform().normal_matrix() == fmat3());
+    }
+
+    SUBCASE("matrix") {
+        const ftransform x{t, r, s};
+        CHECK(x.matrix() == trs(t, r, s));
+        CHECK(all(approx(x.inverse_matrix(), inverse(trs(t, r, s)), 0.0001f)));
+        CHECK(all(approx(x.normal_matrix(), transpose(inverse(fmat3(trs(t, r, s)))), 0.0001f)));
+        CHECK(all(approx(x.matrix() * x.inverse_matrix(), fmat4(), 0.0001f)));
+    }
+
+    SUBCASE("dirty tracking") {
+        ftransform x{t, r, s};
+        const fmat4 m0 = x.matrix();
+        const fmat4 i0 = x.inverse_matrix();
+        const fmat3 n0 = x.normal_matrix();
+
+        x.set_translation(fvec3(5.f));
+        CHECK(x.matrix() == trs(fvec3(5.f), r, s));
+        CHECK(x.matrix() != m0);
+        CHECK(x.inverse_matrix() != i0);
+        CHECK(x.normal_matrix() == n0);
+
+        x.set_rotation(qrotate_x(0.5f));
+        CHECK(x.matrix() == trs(fvec3(5.f), qrotate_x(0.5f), s));
+        CHECK(all(approx(x.normal_matrix(), transpose(inverse(fmat3(x.matrix()))), 0.0001f)));
+
+        x.set_scale(fvec3(0.5f));
+        CHECK(x.matrix() == trs(fvec3(5.f), qrotate_x(0.5f), fvec3(0.5f)));
+        CHECK(all(approx(x.inverse_matrix(), inverse(x.matrix()), 0.0001f)));
+    }
+
+    SUBCASE("operators") {
+        const ftransform a{t, r, s};
+        const ftransform b{fvec3(-1.f, 0.f, 2.f), qrotate_y(0.3f), fvec3(2.f)};
+
+        CHECK(a == a);
+        CHECK(a != b);
+
+        CHECK(all(approx((a * b).matrix(), a.matrix() * b.matrix(), 0.0001f)));
+        CHECK(all(approx(fvec3(1.f, 2.f, 3.f) * a, fvec3(fvec4(1.f, 2.f, 3.f, 1.f) * a.matrix()), 0.0001f)));
+
+        ftransform c = a;
+        c *= b;
+        CHECK(c == a * b);
+
+        fvec3 v{1.f, 2.f, 3.f};
+        v *= b;
+        CHECK(v == fvec3(1.f, 2.f, 3.f) * b);
+    }
+
+    SUBCASE("inverse") {
+        const ftransform x{t, r, fvec3(2.f)};
+        CHECK(all(approx(inverse(x).matrix(), x.inverse_matrix(), 0.0001f)));
+        CHECK(all(approx((x * inverse(x)).matrix(), fmat4(), 0.0001f)));
+    }
+}
@@ -0,0 +1,637 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "vmath_tests.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace vmath_hpp;
+    using namespace vmath_tests;
+
+    //
+    // float results are compared against long double references:
+    // 64 (or at least 53) significand bits are plenty for 24-bit floats
+    //
+    // covered: the scalar and vector functions of vmath_fun and vmath_vec_fun,
+    // the geometric and quaternion functions, the rotation, translation, scale,
+    // look_at, orthographic and perspective_fov builders of vmath_ext and dot_n,
+    // the other projection builders are the same formulas on other parameters
+    //
+    // VMATH_HPP_ULP_REPORT=1 prints the table of all measured errors
+    //
+
+    using ref_t = long double;
+
+    struct ulp_stats {
+        double budget{0.0};
+        double max_ulp{0.0};
+        double sum_ulp{0.0};
+        std::size_t count{0};
+        std::size_t special_failures{0};
+        float worst_input{0.f};
+    };
+
+    using ulp_registry = std::map<std::string, ulp_stats>;
+
+    // every subcase is a separate run of the test case,
+    // their results are collected here for the report
+    ulp_registry& report_registry() {
+        static ulp_registry registry;
+        return registry;
+    }
+
+    ref_t ulp_of(float x) {
+        const float a = std::fabs(x);
+        if ( a == std::numeric_limits<float>::max() ) {
+            return static_cast<ref_t>(a) - static_cast<ref_t>(std::nextafter(a, 0.f));
+        }
+        return static_cast<ref_t>(std::nextafter(a, std::numeric_limits<float>::infinity())) - static_cast<ref_t>(a);
+    }
+
+    // scale: the magnitude the error is measured against when the result
+    // itself may cancel (dot products, rotations), zero otherwise
+    void record(ulp_registry& registry, const std::string& key, double budget, float input, float result, ref_t reference, ref_t scale = 0) {
+        ulp_stats& s = registry[key];
+        s.budget = budget;
+
+        const float rf = static_cast<float>(reference);
+        if ( std::isnan(rf) || std::isinf(rf) || !std::isfinite(result) ) {
+            const bool ok = std::isnan(rf) ? std::isnan(result) : result == rf;
+            if ( !ok ) {
+                ++s.special_failures;
+                s.worst_input = input;
+            }
+            return;
+        }
+
+        const float at = static_cast<float>(std::fmax(std::fabs(reference), scale));
+        const double err = static_cast<double>(std::fabs(static_cast<ref_t>(result) - reference) / ulp_of(at));
+        if ( err > s.max_ulp ) {
+            s.max_ulp = err;
+            s.worst_input = input;
+        }
+        s.sum_ulp += err;
+        ++s.count;
+    }
+
+    //
+    // inputs
+    //
+
+    std::vector<float> edge_inputs() {
+        return {
+            0.f, -0.f, 1.f, -1.f, 0.5f, -0.5f, 2.f, -2.f,
+            1e-30f, -1e-30f, 1e30f, -1e30f,
+            3.14159265f, -3.14159265f, 1.57079632f, 100.f, -100.f,
+            std::numeric_limits<float>::denorm_min(),
+            -std::numeric_limits<float>::denorm_min(),
+            std::numeric_limits<float>::min(),
+            -std::numeric_limits<float>::min(),
+            std::numeric_limits<float>::max(),
+            std::numeric_limits<float>::lowest(),
+            std::numeric_limits<float>::infinity(),
+            -std::numeric_limits<float>::infinity(),
+            std::numeric_limits<float>::quiet_NaN()};
+    }
+
+    std::vector<float> make_inputs(philox4x32& g, float lo, float hi, std::size_t count) {
+        std::vector<float> xs = edge_inputs();
+        for ( std::size_t i = 0; i < count; ++i ) {
+            xs.push_back(random_uniform(g, lo, hi));
+        }
+        return xs;
+    }
+
+    std::vector<float> make_random_inputs(philox4x32& g, float lo, float hi, std::size_t count) {
+        std::vector<float> xs;
+        for ( std::size_t i = 0; i < count; ++i ) {
+            xs.push_back(random_uniform(g, lo, hi));
+        }
+        return xs;
+    }
+
+    // magnitudes from 1e-15 to 1e15 with random signs: squared lengths don't overflow
+    fvec4 make_vector(philox4x32& g) {
+        fvec4 v;
+        for ( std::size_t i = 0; i < 4; ++i ) {
+            const float m = exp2(random_uniform(g, -50.f, 50.f));
+            v[i] = random_uniform<float>(g) < 0.5f ? -m : m;
+        }
+        return v;
+    }
+
+    //
+    // function tables
+    //
+
+    struct unary_case {
+        const char* name;
+        float (*f)(float);
+        fvec4 (*vf)(const fvec4&);
+        ref_t (*ref)(ref_t);
+        float lo;
+        float hi;
+        double budget;
+    };
+
+    struct binary_case {
+        const char* name;
+        float (*f)(float, float);
+        fvec4 (*vf)(const fvec4&, const fvec4&);
+        ref_t (*ref)(ref_t, ref_t);
+        float lo0;
+        float hi0;
+        float lo1;
+        float hi1;
+        double budget;
+    };
+
+    // scale: the magnitude the error is measured against, see record
+    struct ternary_case {
+        const char* name;
+        float (*f)(float, float, float);
+        fvec4 (*vf)(const fvec4&, const fvec4&, const fvec4&);
+        ref_t (*ref)(ref_t, ref_t, ref_t);
+        ref_t (*scale)(ref_t, ref_t, ref_t);
+        float lo0;
+        float hi0;
+        float lo1;
+        float hi1;
+        float lo2;
+        float hi2;
+        double budget;
+    };
+
+    // the order of the comparisons of min(max(x, min_x), max_x), nan included
+    ref_t ref_clamp(ref_t x, ref_t min_x, ref_t max_x) {
+        const ref_t t = x < min_x ? min_x : x;
+        return t < max_x ? t : max_x;
+    }
+
+    #define UNARY_CASE(name, ref, lo, hi, budget) unary_case{#name,\
+        [](float x){ return vmath_hpp::name(x); },\
+        [](const fvec4& x){ return vmath_hpp::name(x); },\
+        [](ref_t x) -> ref_t { return ref; }, lo, hi, budget}
+
+    #define BINARY_CASE(name, ref, lo0, hi0, lo1, hi1, budget) binary_case{#name,\
+        [](float x, float y){ return vmath_hpp::name(x, y); },\
+        [](const fvec4& x, const fvec4& y){ return vmath_hpp::name(x, y); },\
+        [](ref_t x, ref_t y) -> ref_t { return ref; }, lo0, hi0, lo1, hi1, budget}
+
+    #define TERNARY_CASE(name, ref, scale, lo0, hi0, lo1, hi1, lo2, hi2, budget) ternary_case{#name,\
+        [](float x, float y, float z){ return vmath_hpp::name(x, y, z); },\
+        [](const fvec4& x, const fvec4& y, const fvec4& z){ return vmath_hpp::name(x, y, z); },\
+        [](ref_t x, ref_t y, ref_t z) -> ref_t { return ref; },\
+        [](ref_t x, ref_t y, ref_t z) -> ref_t { (void)x; (void)y; (void)z; return scale; },\
+        lo0, hi0, lo1, hi1, lo2, hi2, budget}
+
+    std::vector<unary_case> unary_cases() {
+        return {
+            UNARY_CASE(rcp, 1 / x, -1e3f, 1e3f, 0.5),
+            UNARY_CASE(sqr, x * x, -1e3f, 1e3f, 0.5),
+            UNARY_CASE(sqrt, std::sqrt(x), 0.f, 1e6f, 0.5),
+            UNARY_CASE(rsqrt, 1 / std::sqrt(x), 0.f, 1e6f, 1.5),
+            UNARY_CASE(radians, x * 3.14159265358979323846264338327950288L / 180, -1e3f, 1e3f, 1.5),
+            UNARY_CASE(degrees, x * 180 / 3.14159265358979323846264338327950288L, -1e3f, 1e3f, 1.5),
+            UNARY_CASE(sin, std::sin(x), -1e2f, 1e2f, 2.),
+            UNARY_CASE(cos, std::cos(x), -1e2f, 1e2f, 2.),
+            UNARY_CASE(tan, std::tan(x), -1e2f, 1e2f, 2.),
+            UNARY_CASE(asin, std::asin(x), -1.f, 1.f, 2.),
+            UNARY_CASE(acos, std::acos(x), -1.f, 1.f, 2.),
+            UNARY_CASE(atan, std::atan(x), -1e2f, 1e2f, 2.),
+            UNARY_CASE(sinh, std::sinh(x), -80.f, 80.f, 2.),
+            UNARY_CASE(cosh, std::cosh(x), -80.f, 80.f, 2.),
+            UNARY_CASE(tanh, std::tanh(x), -10.f, 10.f, 2.),
+            UNARY_CASE(asinh, std::asinh(x), -1e3f, 1e3f, 2.),
+            UNARY_CASE(acosh, std::acosh(x), 1.f, 1e3f, 2.),
+            UNARY_CASE(atanh, std::atanh(x), -1.f, 1.f, 2.),
+            UNARY_CASE(exp, std::exp(x), -80.f, 80.f, 2.),
+            UNARY_CASE(exp2, std::exp2(x), -120.f, 120.f, 2.),
+            UNARY_CASE(log, std::log(x), 0.f, 1e6f, 2.),
+            UNARY_CASE(log2, std::log2(x), 0.f, 1e6f, 2.),
+            UNARY_CASE(floor, std::floor(x), -1e3f, 1e3f, 0.),
+            UNARY_CASE(ceil, std::ceil(x), -1e3f, 1e3f, 0.),
+            UNARY_CASE(trunc, std::trunc(x), -1e3f, 1e3f, 0.),
+            UNARY_CASE(round, std::round(x), -1e3f, 1e3f, 0.),
+            UNARY_CASE(fract, x - std::floor(x), -1e3f, 1e3f, 0.5)};
+    }
+
+    std::vector<binary_case> binary_cases() {
+        return {
+            BINARY_CASE(pow, std::pow(x, y), 0.f, 1e2f, -10.f, 10.f, 2.),
+            BINARY_CASE(atan2, std::atan2(x, y), -1e2f, 1e2f, -1e2f, 1e2f, 2.),
+            BINARY_CASE(fmod, std::fmod(x, y), -1e3f, 1e3f, 0.5f, 1e2f, 0.),
+            BINARY_CASE(min, x < y ? x : y, -1e3f, 1e3f, -1e3f, 1e3f, 0.),
+            BINARY_CASE(max, x < y ? y : x, -1e3f, 1e3f, -1e3f, 1e3f, 0.)};
+    }
+
+    std::vector<ternary_case> ternary_cases() {
+        return {
+            TERNARY_CASE(clamp, ref_clamp(x, y, z), 0, -1e3f, 1e3f, -1e3f, 0.f, 0.f, 1e3f, 0.),
+            TERNARY_CASE(lerp, x * (1 - z) + y * z, std::fabs(x * (1 - z)) + std::fabs(y * z), -1e3f, 1e3f, -1e3f, 1e3f, 0.f, 1.f, 1.5),
+            TERNARY_CASE(smoothstep, [](ref_t t){ return t * t * (3 - 2 * t); }(ref_clamp((z - x) / (y - x), 0, 1)), 1, -10.f, -1.f, 1.f, 10.f, -12.f, 12.f, 2.)};
+    }
+
+    #undef UNARY_CASE
+    #undef BINARY_CASE
+    #undef TERNARY_CASE
+
+    std::string ulp_report(const ulp_registry& registry) {
+        std::string report = "function [path]                  max ulp   mean ulp   budget  specials  worst input\n";
+        for ( const auto& [key, s] : registry ) {
+            char line[160];
+            std::snprintf(line, sizeof(line), "%-32s %8.3f %10.4f %8.2f %9zu  %g\n",
+                key.c_str(),
+                s.max_ulp,
+                s.count > 0 ? s.sum_ulp / static_cast<double>(s.count) : 0.0,
+                s.budget,
+                s.special_failures,
+                static_cast<double>(s.worst_input));
+            report += line;
+        }
+        return report;
+    }
+}
+
+TEST_CASE("vmath/ulp") {
+    philox4x32 g{2023u};
+    ulp_registry registry;
+    constexpr std::size_t samples = 20000;
+
+    SUBCASE("vmath_fun and vmath_vec_fun") {
+        for ( const unary_case& c : unary_cases() ) {
+            const std::vector<float> xs = make_inputs(g, c.lo, c.hi, samples);
+            for ( std::size_t i = 0; i + 4 <= xs.size(); i += 4 ) {
+                const fvec4 v{xs[i + 0], xs[i + 1], xs[i + 2], xs[i + 3]};
+                const fvec4 r = c.vf(v);
+                for ( std::size_t j = 0; j < 4; ++j ) {
+                    const ref_t ref = c.ref(static_cast<ref_t>(v[j]));
+                    record(registry, std::string(c.name) + " [scalar]", c.budget, v[j], c.f(v[j]), ref);
+                    record(registry, std::string(c.name) + " [vec]", c.budget, v[j], r[j], ref);
+                }
+            }
+        }
+
+        for ( const binary_case& c : binary_cases() ) {
+            const std::vector<float> xs = make_inputs(g, c.lo0, c.hi0, samples);
+            const std::vector<float> ys = make_inputs(g, c.lo1, c.hi1, samples);
+            for ( std::size_t i = 0; i + 4 <= xs.size(); i += 4 ) {
+                const fvec4 vx{xs[i + 0], xs[i + 1], xs[i + 2], xs[i + 3]};
+                const fvec4 vy{ys[i + 3], ys[i + 2], ys[i + 1], ys[i + 0]};
+                const fvec4 r = c.vf(vx, vy);
+                for ( std::size_t j = 0; j < 4; ++j ) {
+                    const ref_t ref = c.ref(static_cast<ref_t>(vx[j]), static_cast<ref_t>(vy[j]));
+                    record(registry, std::string(c.name) + " [scalar]", c.budget, vx[j], c.f(vx[j], vy[j]), ref);
+                    record(registry, std::string(c.name) + " [vec]", c.budget, vx[j], r[j], ref);
+                }
+            }
+        }
+
+        for ( const ternary_case& c : ternary_cases() ) {
+            // the special values go to the first argument only,
+            // all of them at once overflow where long double doesn't
+            const std::vector<float> xs = make_inputs(g, c.lo0, c.hi0, samples);
+            const std::vector<float> ys = make_random_inputs(g, c.lo1, c.hi1, xs.size());
+            const std::vector<float> zs = make_random_inputs(g, c.lo2, c.hi2, xs.size());
+            for ( std::size_t i = 0; i + 4 <= xs.size(); i += 4 ) {
+                const fvec4 vx{xs[i + 0], xs[i + 1], xs[i + 2], xs[i + 3]};
+                const fvec4 vy{ys[i + 0], ys[i + 1], ys[i + 2], ys[i + 3]};
+                const fvec4 vz{zs[i + 0], zs[i + 1], zs[i + 2], zs[i + 3]};
+                const fvec4 r = c.vf(vx, vy, vz);
+                for ( std::size_t j = 0; j < 4; ++j ) {
+                    const ref_t x = vx[j];
+                    const ref_t y = vy[j];
+                    const ref_t z = vz[j];
+                    const ref_t ref = c.ref(x, y, z);
+                    const ref_t scale = c.scale(x, y, z);
+                    record(registry, std::string(c.name) + " [scalar]", c.budget, vx[j], c.f(vx[j], vy[j], vz[j]), ref, scale);
+                    record(registry, std::string(c.name) + " [vec]", c.budget, vx[j], r[j], ref, scale);
+                }
+            }
+        }
+    }
+
+    SUBCASE("geometric functions") {
+        // a generator of its own for the later functions, the samples of the others stay
+        philox4x32 h{2024u};
+        for ( std::size_t i = 0; i < samples; ++i ) {
+            const fvec4 a = i == 0 ? fvec4(0.f) : make_vector(g);
+            const fvec4 b = make_vector(g);
+            const fvec3 a3{a};
+            const fvec3 b3{b};
+
+            ref_t l2 = 0;
+            ref_t d = 0;
+            ref_t d_scale = 0;
+            ref_t dist2 = 0;
+            for ( std::size_t j = 0; j < 4; ++j ) {
+                l2 += static_cast<ref_t>(a[j]) * a[j];
+                d += static_cast<ref_t>(a[j]) * b[j];
+                d_scale += std::fabs(static_cast<ref_t>(a[j]) * b[j]);
+                dist2 += (static_cast<ref_t>(a[j]) - b[j]) * (static_cast<ref_t>(a[j]) - b[j]);
+            }
+
+            record(registry, "length [vec]", 2.0, a[0], length(a), std::sqrt(l2));
+            record(registry, "rlength [vec]", 2.5, a[0], rlength(a), 1 / std::sqrt(l2));
+            record(registry, "length2 [vec]", 2.0, a[0], length2(a), l2);
+            record(registry, "distance [vec]", 2.5, a[0], distance(a, b), std::sqrt(dist2));
+            record(registry, "dot [vec]", 2.0, a[0], dot(a, b), d, d_scale);
+
+            const fvec4 n = normalize(a);
+            for ( std::size_t j = 0; j < 4; ++j ) {
+                record(registry, "normalize [vec]", 2.5, a[j], n[j], a[j] / std::sqrt(l2));
+            }
+
+            const fvec3 c = cross(a3, b3);
+            const ref_t cs = std::sqrt(static_cast<ref_t>(length2(a3))) * std::sqrt(static_cast<ref_t>(length2(b3)));
+            record(registry, "cross [vec]", 1.5, a3.x, c.x, static_cast<ref_t>(a3.y) * b3.z - static_cast<ref_t>(a3.z) * b3.y, cs);
+            record(registry, "cross [vec]", 1.5, a3.y, c.y, static_cast<ref_t>(a3.z) * b3.x - static_cast<ref_t>(a3.x) * b3.z, cs);
+            record(registry, "cross [vec]", 1.5, a3.z, c.z, static_cast<ref_t>(a3.x) * b3.y - static_cast<ref_t>(a3.y) * b3.x, cs);
+
+            // the product of the squared lengths has to fit a float
+            const fvec3 u3 = random_on_sphere<float>(h) * random_uniform(h, 0.1f, 10.f);
+            const fvec3 v3 = random_on_sphere<float>(h) * random_uniform(h, 0.1f, 10.f);
+            ref_t uv = 0;
+            ref_t u2 = 0;
+            ref_t v2 = 0;
+            for ( std::size_t j = 0; j < 3; ++j ) {
+                uv += static_cast<ref_t>(u3[j]) * v3[j];
+                u2 += static_cast<ref_t>(u3[j]) * u3[j];
+                v2 += static_cast<ref_t>(v3[j]) * v3[j];
+            }
+            // acos is ill-conditioned at the ends, one ulp of the cosine there is
+            // thousands of the angle, these pairs are skipped and the error of
+            // the others is measured against pi
+            if ( const ref_t cos_uv = uv / std::sqrt(u2 * v2); std::fabs(cos_uv) < 0.99L ) {
+                record(registry, "angle [vec]", 8.0, u3.x, angle(u3, v3), std::acos(cos_uv), 3.14159265358979323846264338327950288L);
+            }
+
+            // unit normals, refract with eta below 1 never reflects totally
+            const fvec3 i3 = random_on_sphere<float>(h);
+            const fvec3 n3 = random_on_sphere<float>(h);
+            const float eta = random_uniform(h, 0.5f, 0.9f);
+            const fvec3 rfl = reflect(i3, n3);
+            const fvec3 rfr = refract(i3, n3, eta);
+
+            const ref_t ni =
+                static_cast<ref_t>(n3.x) * i3.x +
+                static_cast<ref_t>(n3.y) * i3.y +
+                static_cast<ref_t>(n3.z) * i3.z;
+            const ref_t k = 1 - static_cast<ref_t>(eta) * eta * (1 - ni * ni);
+            for ( std::size_t j = 0; j < 3; ++j ) {
+                record(registry, "reflect [vec]", 2.0, i3[j], rfl[j], i3[j] - 2 * ni * n3[j], 1);
+                record(registry, "refract [vec]", 3.0, i3[j], rfr[j], eta * static_cast<ref_t>(i3[j]) - (eta * ni + std::sqrt(k)) * n3[j], 1);
+            }
+        }
+    }
+
+    SUBCASE("vmath_qua_fun and vmath_ext") {
+        philox4x32 h{2024u};
+        for ( std::size_t i = 0; i < samples; ++i ) {
+            const float angle = random_uniform(g, -10.f, 10.f);
+            const fvec3 axis = random_on_sphere<float>(g);
+            const fvec3 v = random_uniform(g, fvec3(-1e3f), fvec3(1e3f));
+
+            // Rodrigues rotation in long double
+            const ref_t c = std::cos(static_cast<ref_t>(angle));
+            const ref_t s = std::sin(static_cast<ref_t>(angle));
+            const ref_t ax[3]{axis.x, axis.y, axis.z};
+            const ref_t vv[3]{v.x, v.y, v.z};
+            const ref_t kv = ax[0] * vv[0] + ax[1] * vv[1] + ax[2] * vv[2];
+            const ref_t kxv[3]{
+                ax[1] * vv[2] - ax[2] * vv[1],
+                ax[2] * vv[0] - ax[0] * vv[2],
+                ax[0] * vv[1] - ax[1] * vv[0]};
+            const ref_t vlen = std::sqrt(vv[0] * vv[0] + vv[1] * vv[1] + vv[2] * vv[2]);
+
+            const fqua q = qrotate(angle, axis);
+            const fvec3 rq = v * q;
+            const fvec3 rm = v * rotate(angle, axis);
+            for ( std::size_t j = 0; j < 3; ++j ) {
+                const ref_t ref = vv[j] * c + kxv[j] * s + ax[j] * kv * (1 - c);
+                // several roundings of |v|-sized terms, measured against |v|
+                record(registry, "qrotate [qua]", 16.0, angle, rq[j], ref, vlen);
+                record(registry, "rotate [mat]", 16.0, angle, rm[j], ref, vlen);
+            }
+
+            const ref_t half = static_cast<ref_t>(angle) / 2;
+            record(registry, "qrotate [qua]", 16.0, angle, q.s, std::cos(half), 1);
+
+            const fqua q3 = q * 3.f;
+            const ref_t q3_length = std::sqrt(
+                static_cast<ref_t>(q3.v.x) * q3.v.x + static_cast<ref_t>(q3.v.y) * q3.v.y +
+                static_cast<ref_t>(q3.v.z) * q3.v.z + static_cast<ref_t>(q3.s) * q3.s);
+            record(registry, "length [qua]", 2.0, angle, length(q3), q3_length);
+            for ( std::size_t j = 0; j < 3; ++j ) {
+                record(registry, "normalize [qua]", 2.5, angle, normalize(q3).v[j], q3.v[j] / q3_length, 1);
+            }
+
+            const fqua iq3 = inverse(q3);
+            for ( std::size_t j = 0; j < 4; ++j ) {
+                const ref_t c3 = j < 3 ? -static_cast<ref_t>(q3.v[j]) : static_cast<ref_t>(q3.s);
+                record(registry, "inverse [qua]", 2.5, angle, j < 3 ? iq3.v[j] : iq3.s, c3 / (q3_length * q3_length), 1 / q3_length);
+            }
+
+            // interpolation between two unit quaternions, long double slerp and nlerp
+            const fqua p = qrotate(random_uniform(h, -10.f, 10.f), random_on_sphere<float>(h));
+            const float t = random_uniform(h, 0.f, 1.f);
+            const fqua sq = slerp(q, p, t);
+            const fqua nq = nlerp(q, p, t);
+
+            ref_t qs[4];
+            ref_t ps[4];
+            ref_t qp = 0;
+            for ( std::size_t j = 0; j < 4; ++j ) {
+                qs[j] = j < 3 ? q.v[j] : q.s;
+                ps[j] = j < 3 ? p.v[j] : p.s;
+                qp += qs[j] * ps[j];
+            }
+            const ref_t qp_sign = qp < 0 ? -1 : 1;
+            const ref_t theta = std::acos(ref_clamp(qp * qp_sign, -1, 1));
+            const ref_t rsin_theta = 1 / std::sin(theta);
+
+            ref_t ns[4];
+            ref_t ns_length2 = 0;
+            for ( std::size_t j = 0; j < 4; ++j ) {
+                ns[j] = qs[j] * (1 - t) + ps[j] * t * qp_sign;
+                ns_length2 += ns[j] * ns[j];
+            }
+            for ( std::size_t j = 0; j < 4; ++j ) {
+                // slerp turns into nlerp below half a degree, sin(theta) is too small there
+                const ref_t sref = theta < 0.005L
+                    ? ns[j] / std::sqrt(ns_length2)
+                    : (qs[j] * std::sin((1 - t) * theta) + ps[j] * std::sin(t * theta) * qp_sign) * rsin_theta;
+                record(registry, "slerp [qua]", 3.0, t, j < 3 ? sq.v[j] : sq.s, sref, 1);
+                record(registry, "nlerp [qua]", 3.0, t, j < 3 ? nq.v[j] : nq.s, ns[j] / std::sqrt(ns_length2), 1);
+            }
+        }
+    }
+
+    SUBCASE("vmath_ext builders") {
+        const auto record_mat = [&registry](const char* key, double budget, float input, const auto& m, const auto& ref, ref_t scale) {
+            for ( std::size_t r = 0; r < std::size(ref); ++r ) {
+                for ( std::size_t c = 0; c < std::size(ref[r]); ++c ) {
+                    record(registry, key, budget, input, m[r][c], ref[r][c], scale);
+                }
+            }
+        };
+
+        for ( std::size_t i = 0; i < samples; ++i ) {
+            const float angle = random_uniform(g, -10.f, 10.f);
+            const ref_t s = std::sin(static_cast<ref_t>(angle));
+            const ref_t c = std::cos(static_cast<ref_t>(angle));
+
+            const ref_t rx[3][3]{{1, 0, 0}, {0, c, s}, {0, -s, c}};
+            const ref_t ry[3][3]{{c, 0, -s}, {0, 1, 0}, {s, 0, c}};
+            const ref_t rz[3][3]{{c, s, 0}, {-s, c, 0}, {0, 0, 1}};
+            record_mat("rotate_x [mat]", 2.0, angle, rotate_x(angle), rx, 1);
+            record_mat("rotate_y [mat]", 2.0, angle, rotate_y(angle), ry, 1);
+            record_mat("rotate_z [mat]", 2.0, angle, rotate_z(angle), rz, 1);
+
+            const ref_t hs = std::sin(static_cast<ref_t>(angle) / 2);
+            const ref_t hc = std::cos(static_cast<ref_t>(angle) / 2);
+            const fqua qx = qrotate_x(angle);
+            const fqua qy = qrotate_y(angle);
+            const fqua qz = qrotate_z(angle);
+            const ref_t qrx[1][4]{{hs, 0, 0, hc}};
+            const ref_t qry[1][4]{{0, hs, 0, hc}};
+            const ref_t qrz[1][4]{{0, 0, hs, hc}};
+            record_mat("qrotate_x [qua]", 2.0, angle, std::array{fvec4{qx}}, qrx, 1);
+            record_mat("qrotate_y [qua]", 2.0, angle, std::array{fvec4{qy}}, qry, 1);
+            record_mat("qrotate_z [qua]", 2.0, angle, std::array{fvec4{qz}}, qrz, 1);
+
+            // translate and scale only place their arguments
+            const fvec3 v = random_uniform(g, fvec3(-1e3f), fvec3(1e3f));
+            const ref_t rt[4][4]{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {v.x, v.y, v.z, 1}};
+            const ref_t rs[3][3]{{v.x, 0, 0}, {0, v.y, 0}, {0, 0, v.z}};
+            record_mat("translate [mat]", 0.0, v.x, translate(v), rt, 0);
+            record_mat("scale [mat]", 0.0, v.x, scale(v), rs, 0);
+
+            // look_at, the translation row cancels and is measured against the eye
+            const fvec3 eye = random_uniform(g, fvec3(-1e2f), fvec3(1e2f));
+            const fvec3 at = eye + random_on_sphere<float>(g) * random_uniform(g, 1.f, 1e2f);
+            const fvec3 up = random_on_sphere<float>(g);
+            for ( const bool lh : {true, false} ) {
+                ref_t az[3];
+                ref_t az_length2 = 0;
+                for ( std::size_t j = 0; j < 3; ++j ) {
+                    az[j] = lh ? static_cast<ref_t>(at[j]) - eye[j] : static_cast<ref_t>(eye[j]) - at[j];
+                    az_length2 += az[j] * az[j];
+                }
+                for ( ref_t& e : az ) {
+                    e /= std::sqrt(az_length2);
+                }
+                ref_t ax[3]{
+                    up.y * az[2] - up.z * az[1],
+                    up.z * az[0] - up.x * az[2],
+                    up.x * az[1] - up.y * az[0]};
+                const ref_t ax_length = std::sqrt(ax[0] * ax[0] + ax[1] * ax[1] + ax[2] * ax[2]);
+                if ( ax_length < 0.1L ) {
+                    // up is almost parallel to the direction, the basis is ill-conditioned
+                    continue;
+                }
+                for ( ref_t& e : ax ) {
+                    e /= ax_length;
+                }
+                const ref_t ay[3]{
+                    az[1] * ax[2] - az[2] * ax[1],
+                    az[2] * ax[0] - az[0] * ax[2],
+                    az[0] * ax[1] - az[1] * ax[0]};
+
+                ref_t rl[4][4]{};
+                for ( std::size_t j = 0; j < 3; ++j ) {
+                    rl[j][0] = ax[j];
+                    rl[j][1] = ay[j];
+                    rl[j][2] = az[j];
+                    rl[3][0] -= ax[j] * eye[j];
+                    rl[3][1] -= ay[j] * eye[j];
+                    rl[3][2] -= az[j] * eye[j];
+                }
+                rl[3][3] = 1;
+
+                const ref_t eye_length = std::sqrt(static_cast<ref_t>(length2(eye)));
+                const fmat4 l = lh ? look_at_lh(eye, at, up) : look_at_rh(eye, at, up);
+                record_mat(lh ? "look_at_lh [mat]" : "look_at_rh [mat]", 8.0, eye.x, l, rl, std::fmax(eye_length, 1));
+            }
+
+            // projections
+            const float fovy = random_uniform(g, 0.1f, 3.f);
+            const float aspect = random_uniform(g, 0.5f, 2.5f);
+            const float znear = random_uniform(g, 0.01f, 10.f);
+            const float zfar = znear + random_uniform(g, 1.f, 1e4f);
+            const float width = random_uniform(g, 0.1f, 1e3f);
+            const float height = random_uniform(g, 0.1f, 1e3f);
+
+            const ref_t n = znear;
+            const ref_t f = zfar;
+            const ref_t sy = 1 / std::tan(static_cast<ref_t>(fovy) / 2);
+            const ref_t sx = sy / aspect;
+            const ref_t pl[4][4]{{sx, 0, 0, 0}, {0, sy, 0, 0}, {0, 0, f / (f - n), 1}, {0, 0, n * f / (n - f), 0}};
+            const ref_t pr[4][4]{{sx, 0, 0, 0}, {0, sy, 0, 0}, {0, 0, f / (n - f), -1}, {0, 0, n * f / (n - f), 0}};
+            record_mat("perspective_fov_lh [mat]", 4.0, fovy, perspective_fov_lh(fovy, aspect, znear, zfar), pl, 0);
+            record_mat("perspective_fov_rh [mat]", 4.0, fovy, perspective_fov_rh(fovy, aspect, znear, zfar), pr, 0);
+
+            const ref_t ow = 2 / static_cast<ref_t>(width);
+            const ref_t oh = 2 / static_cast<ref_t>(height);
+            const ref_t ol[4][4]{{ow, 0, 0, 0}, {0, oh, 0, 0}, {0, 0, 1 / (f - n), 0}, {0, 0, -n / (f - n), 1}};
+            const ref_t orh[4][4]{{ow, 0, 0, 0}, {0, oh, 0, 0}, {0, 0, 1 / (n - f), 0}, {0, 0, n / (n - f), 1}};
+            record_mat("orthographic_lh [mat]", 2.0, width, orthographic_lh(width, height, znear, zfar), ol, 0);
+            record_mat("orthographic_rh [mat]", 2.0, width, orthographic_rh(width, height, znear, zfar), orh, 0);
+        }
+    }
+
+    SUBCASE("vmath_dispatch") {
+        std::vector<float> xs(4099);
+        std::vector<float> ys(xs.size());
+        for ( std::size_t i = 0; i < xs.size(); ++i ) {
+            xs[i] = random_uniform(g, -1.f, 1.f);
+            ys[i] = random_uniform(g, -1.f, 1.f);
+        }
+
+        for ( simd_level level : {simd_level::baseline, simd_level::avx2, simd_level::avx512} ) {
+            if ( level > supported_simd_level() ) {
+                continue;
+            }
+            force_simd_level(level);
+
+            const char* names[]{"dot_n [baseline]", "dot_n [avx2]", "dot_n [avx512]"};
+            for ( std::size_t n = 1; n < xs.size(); n += 97 ) {
+                ref_t d = 0;
+                ref_t d_scale = 0;
+                for ( std::size_t i = 0; i < n; ++i ) {
+                    d += static_cast<ref_t>(xs[i]) * ys[i];
+                    d_scale += std::fabs(static_cast<ref_t>(xs[i]) * ys[i]);
+                }
+                record(registry, names[static_cast<std::size_t>(level)], 4.0, xs[0], dot_n(xs.data(), ys.data(), n), d, d_scale);
+            }
+        }
+        reset_simd_level();
+    }
+
+    for ( const auto& [key, s] : registry ) {
+        INFO(key);
+        CHECK(s.special_failures == 0);
+        CHECK(s.max_ulp <= s.budget);
+        report_registry()[key] = s;
+    }
+}
+
+TEST_CASE("vmath/ulp report") {
+    // after all subcases of vmath/ulp, doctest runs the test cases in the file order
+    if ( std::getenv("VMATH_HPP_ULP_REPORT") ) {
+        MESSAGE(ulp_report(report_registry()));
+    }
+}
@@ -309,6 +309,14 @@ TEST_CASE("vmath/vec_fun") {
         STATIC_CHECK(smoothstep(fvec2(0.f), fvec2(1.f), fvec2(0.1f)) == uapprox2(0.028f));
     }
 
+    SUBCASE("Swizzle") {
+        STATIC_CHECK(swizzle<1, 0>(ivec2(1,2)) == ivec2(2,1));
+        STATIC_CHECK(swizzle<2, 1, 0>(ivec3(1,2,3)) == ivec3(3,2,1));
+        STATIC_CHECK(swizzle<0, 0, 1, 1>(ivec2(1,2)) == ivec4(1,1,2,2));
+        STATIC_CHECK(swizzle<3, 0>(ivec4(1,2,3,4)) == ivec2(4,1));
+        STATIC_CHECK(swizzle<4, 0, 1, 2, 3>(vec<int, 5>(1,2,3,4,5)) == vec<int, 5>(5,1,2,3,4));
+    }
+
     SUBCASE("Geometric Functions") {
         CHECK(length(fvec2(10.f,0.f)) == uapprox(10.f));
         CHECK(length(fvec2(-10.f,0.f)) == uapprox(10.f));
@@ -342,6 +350,17 @@ TEST_CASE("vmath/vec_fun") {
 
         CHECK(normalize(fvec2(0.5f,0.f)).x == uapprox(1.f));
 
+        CHECK(normalize_or(fvec2(0.f,0.5f), fvec2(1.f,0.f)) == uapprox2(0.f,1.f));
+        CHECK(normalize_or(fvec2(0.f,0.f), fvec2(1.f,0.f)) == uapprox2(1.f,0.f));
+        CHECK(normalize_or(fvec2(1e-30f,0.f), fvec2(0.f,1.f)) == uapprox2(0.f,1.f));
+        CHECK(normalize_or(dvec3(1e-30,0.0,0.0), dvec3(0.0)) == uapprox3(1.0,0.0,0.0));
+
+        CHECK(all(approx(normalize_fast(fvec3(1.f,2.f,3.f)), normalize(fvec3(1.f,2.f,3.f)), 1e-5f)));
+        CHECK(normalize_fast(fvec3(0.f)) == uapprox3(0.f));
+
+        CHECK(normalize_length(fvec2(0.f,4.f)).first == uapprox2(0.f,1.f));
+        CHECK(normalize_length(fvec2(0.f,4.f)).second == uapprox(4.f));
+
         STATIC_CHECK(faceforward(fvec2(1.f), fvec2(2.f), fvec2(3.f)).x == uapprox(-1.f));
         STATIC_CHECK(reflect(fvec2(1.f), fvec2(2.f)).x == uapprox(-15.f));
         CHECK(refract(fvec2(1.f), fvec2(2.f), 1.f).x == uapprox(-15.f));
@@ -326,3 +326,44 @@ TEST_CASE("vmath/vec") {
         STATIC_CHECK_FALSE(ivec2(1,2) < ivec2(0,3));
     }
 }
+
+TEST_CASE("vmath/vec/generic") {
+    SUBCASE("size/sizeof") {
+        STATIC_CHECK(vec<int, 5>{}.size == 5);
+        STATIC_CHECK(vec<float, 8>{}.size == 8);
+        STATIC_CHECK(sizeof(vec<float, 8>{}) == sizeof(float) * 8);
+    }
+
+    SUBCASE("guides") {
+        STATIC_CHECK(vec{1,2,3,4,5}.size == 5);
+        STATIC_CHECK(std::is_same_v<decltype(vec{1.f,2.f,3.f,4.f,5.f,6.f}), vec<float, 6>>);
+    }
+
+    SUBCASE("ctors") {
+        STATIC_CHECK(vec<int, 5>() == vec<int, 5>(0,0,0,0,0));
+        STATIC_CHECK(vec<int, 5>(zero_init) == vec<int, 5>(0));
+        STATIC_CHECK(vec<int, 5>(unit_init) == vec<int, 5>(1,1,1,1,1));
+        STATIC_CHECK(vec<int, 5>(2) == vec<int, 5>(2,2,2,2,2));
+        STATIC_CHECK(vec<float, 5>(vec<int, 5>(1,2,3,4,5)) == vec<float, 5>(1.f,2.f,3.f,4.f,5.f));
+
+        constexpr float fs[]{1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+        STATIC_CHECK(vec<float, 6>(fs) == vec{1.f,2.f,3.f,4.f,5.f,6.f});
+    }
+
+    SUBCASE("operators") {
+        constexpr vec<int, 5> v{1,2,3,4,5};
+        STATIC_CHECK(v[4] == 5);
+        STATIC_CHECK(v.at(4) == 5);
+        STATIC_CHECK(v + v == vec{2,4,6,8,10});
+        STATIC_CHECK(v * 2 - 1 == vec{1,3,5,7,9});
+        STATIC_CHECK(dot(v, v) == 55);
+        STATIC_CHECK(min(v) == 1);
+        STATIC_CHECK(max(v) == 5);
+        STATIC_CHECK(v < vec{1,2,3,4,6});
+
+        vec<float, 8> w{unit_init};
+        CHECK(length(w) == uapprox(std::sqrt(8.f)));
+        CHECK(length(normalize(w)) == uapprox(1.f));
+        CHECK(std::distance(w.begin(), w.end()) == 8);
+    }
+}
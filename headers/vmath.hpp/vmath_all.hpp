@@ -8,8 +8,19 @@
 
 #include "vmath_fwd.hpp"
 
-#include "vmath_fun.hpp"
+#include "vmath_batch.hpp"
+#include "vmath_blob.hpp"
+#include "vmath_bounds.hpp"
+
+#include "vmath_cast.hpp"
+#include "vmath_charconv.hpp"
+#include "vmath_curve.hpp"
+#include "vmath_dispatch.hpp"
 #include "vmath_ext.hpp"
+#include "vmath_fenv.hpp"
+#include "vmath_fun.hpp"
+#include "vmath_geometry.hpp"
+#include "vmath_hash.hpp"
 
 #include "vmath_mat.hpp"
 #include "vmath_mat_fun.hpp"
@@ -17,5 +28,11 @@
 #include "vmath_qua.hpp"
 #include "vmath_qua_fun.hpp"
 
+#include "vmath_rng.hpp"
+
+#include "vmath_swizzle.hpp"
+
+#include "vmath_transform.hpp"
+
 #include "vmath_vec.hpp"
 #include "vmath_vec_fun.hpp"
@@ -0,0 +1,532 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_ext.hpp"
+#include "vmath_fun.hpp"
+#include "vmath_mat_fun.hpp"
+#include "vmath_qua_fun.hpp"
+#include "vmath_vec_fun.hpp"
+
+//
+// Batch Multiplication
+//
+
+namespace vmath_hpp
+{
+    // multiply
+
+    template < typename InputIt, typename OutputIt, typename T, std::size_t Rows, std::size_t Cols >
+    constexpr OutputIt multiply(InputIt first, InputIt last, const mat<T, Rows, Cols>& m, OutputIt d_first) {
+        // local copy: the output range may alias the matrix, and it lets the rows stay in registers
+        const mat<T, Rows, Cols> mm = m;
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = *first * mm;
+        }
+        return d_first;
+    }
+
+    template < typename InputIt, typename OutputIt, typename T, std::size_t Rows, std::size_t Cols >
+    constexpr OutputIt multiply(const mat<T, Rows, Cols>& m, InputIt first, InputIt last, OutputIt d_first) {
+        const mat<T, Rows, Cols> mm = m;
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = mm * *first;
+        }
+        return d_first;
+    }
+
+    template < typename InputIt1, typename InputIt2, typename OutputIt >
+    constexpr OutputIt multiply(InputIt1 first1, InputIt1 last1, InputIt2 first2, OutputIt d_first) {
+        for ( ; first1 != last1; ++first1, ++first2, ++d_first ) {
+            *d_first = *first1 * *first2;
+        }
+        return d_first;
+    }
+}
+
+//
+// Batch Normalization
+//
+
+namespace vmath_hpp
+{
+    // normalize
+
+    template < typename InputIt, typename OutputIt >
+    constexpr OutputIt normalize(InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = normalize(*first);
+        }
+        return d_first;
+    }
+
+    // normalize_or
+
+    template < typename InputIt, typename OutputIt, typename T, std::size_t Size >
+    constexpr OutputIt normalize_or(InputIt first, InputIt last, const vec<T, Size>& fallback, OutputIt d_first) {
+        const vec<T, Size> ff = fallback;
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = normalize_or(*first, ff);
+        }
+        return d_first;
+    }
+
+    // normalize_fast
+
+    template < typename InputIt, typename OutputIt >
+    OutputIt normalize_fast(InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = normalize_fast(*first);
+        }
+        return d_first;
+    }
+
+    // normalize_length
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2 >
+    constexpr std::pair<OutputIt1, OutputIt2> normalize_length(InputIt first, InputIt last, OutputIt1 d_first, OutputIt2 l_first) {
+        for ( ; first != last; ++first, ++d_first, ++l_first ) {
+            const auto [n, l] = normalize_length(*first);
+            *d_first = n;
+            *l_first = l;
+        }
+        return {d_first, l_first};
+    }
+
+    // normalize_or_soa
+
+    template < typename T, std::size_t Size >
+    constexpr void normalize_or_soa(T* const (&components)[Size], std::size_t n, const vec<T, Size>& fallback) {
+        // in place, components[c][i] is the component c of the vector i
+        const vec<T, Size> ff = fallback;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            T l2{0};
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                l2 += components[c][i] * components[c][i];
+            }
+
+            const bool valid = l2 >= std::numeric_limits<T>::min();
+            const T s = rsqrt(valid ? l2 : T{1});
+
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                const T nc = components[c][i] * s;
+                components[c][i] = valid ? nc : ff[c];
+            }
+        }
+    }
+}
+
+//
+// Batch Inversion
+//
+
+namespace vmath_hpp
+{
+    // determinant
+
+    template < typename InputIt, typename OutputIt >
+    constexpr OutputIt determinant(InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = determinant(*first);
+        }
+        return d_first;
+    }
+
+    // inverse
+
+    template < typename InputIt, typename OutputIt >
+    constexpr OutputIt inverse(InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = inverse(*first);
+        }
+        return d_first;
+    }
+
+    // inverse_determinant
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2 >
+    constexpr std::pair<OutputIt1, OutputIt2> inverse_determinant(InputIt first, InputIt last, OutputIt1 d_first, OutputIt2 det_first) {
+        for ( ; first != last; ++first, ++d_first, ++det_first ) {
+            const auto [inv, det] = inverse_determinant(*first);
+            *d_first = inv;
+            *det_first = det;
+        }
+        return {d_first, det_first};
+    }
+}
+
+//
+// Batch Decomposition
+//
+
+namespace vmath_hpp
+{
+    // decompose
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2, typename OutputIt3 >
+    constexpr std::tuple<OutputIt1, OutputIt2, OutputIt3> decompose(InputIt first, InputIt last, OutputIt1 t_first, OutputIt2 r_first, OutputIt3 s_first) {
+        for ( ; first != last; ++first, ++t_first, ++r_first, ++s_first ) {
+            const auto [t, r, s] = decompose(*first);
+            *t_first = t;
+            *r_first = r;
+            *s_first = s;
+        }
+        return {t_first, r_first, s_first};
+    }
+
+    // decompose_fast
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2, typename OutputIt3 >
+    constexpr std::tuple<OutputIt1, OutputIt2, OutputIt3> decompose_fast(InputIt first, InputIt last, OutputIt1 t_first, OutputIt2 r_first, OutputIt3 s_first) {
+        for ( ; first != last; ++first, ++t_first, ++r_first, ++s_first ) {
+            const auto [t, r, s] = decompose_fast(*first);
+            *t_first = t;
+            *r_first = r;
+            *s_first = s;
+        }
+        return {t_first, r_first, s_first};
+    }
+
+    // symmetric_eigen
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2 >
+    constexpr std::pair<OutputIt1, OutputIt2> symmetric_eigen(InputIt first, InputIt last, OutputIt1 d_first, OutputIt2 v_first) {
+        for ( ; first != last; ++first, ++d_first, ++v_first ) {
+            const auto [d, v] = symmetric_eigen(*first);
+            *d_first = d;
+            *v_first = v;
+        }
+        return {d_first, v_first};
+    }
+
+    // svd
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2, typename OutputIt3 >
+    constexpr std::tuple<OutputIt1, OutputIt2, OutputIt3> svd(InputIt first, InputIt last, OutputIt1 u_first, OutputIt2 s_first, OutputIt3 v_first) {
+        for ( ; first != last; ++first, ++u_first, ++s_first, ++v_first ) {
+            const auto [u, s, v] = svd(*first);
+            *u_first = u;
+            *s_first = s;
+            *v_first = v;
+        }
+        return {u_first, s_first, v_first};
+    }
+
+    // polar
+
+    template < typename InputIt, typename OutputIt1, typename OutputIt2 >
+    constexpr std::pair<OutputIt1, OutputIt2> polar(InputIt first, InputIt last, OutputIt1 r_first, OutputIt2 s_first) {
+        for ( ; first != last; ++first, ++r_first, ++s_first ) {
+            const auto [r, s] = polar(*first);
+            *r_first = r;
+            *s_first = s;
+        }
+        return {r_first, s_first};
+    }
+}
+
+//
+// Batch Quaternions
+//
+
+namespace vmath_hpp
+{
+    // rotate
+
+    template < typename InputIt, typename OutputIt, typename T >
+    constexpr OutputIt rotate(InputIt first, InputIt last, const qua<T>& q, OutputIt d_first) {
+        // *d_first = *first * q through the matrix of q, converted once: v * m is half the work of v * q
+        const mat<T, 3> m = impl::qua_to_mat3(q);
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = *first * m;
+        }
+        return d_first;
+    }
+
+    template < typename InputIt1, typename InputIt2, typename OutputIt >
+    constexpr OutputIt rotate(InputIt1 first, InputIt1 last, InputIt2 q_first, OutputIt d_first) {
+        // a quaternion per vector, no conversion would pay for itself
+        for ( ; first != last; ++first, ++q_first, ++d_first ) {
+            *d_first = *first * *q_first;
+        }
+        return d_first;
+    }
+
+    // conjugate
+
+    template < typename InputIt, typename OutputIt >
+    constexpr OutputIt conjugate(InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = conjugate(*first);
+        }
+        return d_first;
+    }
+}
+
+//
+// Batch Cameras
+//
+
+namespace vmath_hpp
+{
+    // look_at
+
+    template < typename InputIt1, typename InputIt2, typename InputIt3, typename OutputIt >
+    constexpr OutputIt look_at_lh(InputIt1 eye_first, InputIt1 eye_last, InputIt2 at_first, InputIt3 up_first, OutputIt d_first) {
+        for ( ; eye_first != eye_last; ++eye_first, ++at_first, ++up_first, ++d_first ) {
+            *d_first = look_at_lh(*eye_first, *at_first, *up_first);
+        }
+        return d_first;
+    }
+
+    template < typename InputIt1, typename InputIt2, typename InputIt3, typename OutputIt >
+    constexpr OutputIt look_at_rh(InputIt1 eye_first, InputIt1 eye_last, InputIt2 at_first, InputIt3 up_first, OutputIt d_first) {
+        for ( ; eye_first != eye_last; ++eye_first, ++at_first, ++up_first, ++d_first ) {
+            *d_first = look_at_rh(*eye_first, *at_first, *up_first);
+        }
+        return d_first;
+    }
+
+    // perspective_fov
+
+    template < typename InputIt1, typename InputIt2, typename OutputIt, typename T >
+    constexpr OutputIt perspective_fov_lh(InputIt1 fovy_first, InputIt1 fovy_last, InputIt2 aspect_first, T znear, T zfar, OutputIt d_first) {
+        for ( ; fovy_first != fovy_last; ++fovy_first, ++aspect_first, ++d_first ) {
+            *d_first = perspective_fov_lh(*fovy_first, *aspect_first, znear, zfar);
+        }
+        return d_first;
+    }
+
+    template < typename InputIt1, typename InputIt2, typename OutputIt, typename T >
+    constexpr OutputIt perspective_fov_rh(InputIt1 fovy_first, InputIt1 fovy_last, InputIt2 aspect_first, T znear, T zfar, OutputIt d_first) {
+        for ( ; fovy_first != fovy_last; ++fovy_first, ++aspect_first, ++d_first ) {
+            *d_first = perspective_fov_rh(*fovy_first, *aspect_first, znear, zfar);
+        }
+        return d_first;
+    }
+
+    // perspective_fov_infinite_reversed
+
+    template < typename InputIt1, typename InputIt2, typename OutputIt, typename T >
+    constexpr OutputIt perspective_fov_infinite_reversed_lh(InputIt1 fovy_first, InputIt1 fovy_last, InputIt2 aspect_first, T znear, OutputIt d_first) {
+        for ( ; fovy_first != fovy_last; ++fovy_first, ++aspect_first, ++d_first ) {
+            *d_first = perspective_fov_infinite_reversed_lh(*fovy_first, *aspect_first, znear);
+        }
+        return d_first;
+    }
+
+    template < typename InputIt1, typename InputIt2, typename OutputIt, typename T >
+    constexpr OutputIt perspective_fov_infinite_reversed_rh(InputIt1 fovy_first, InputIt1 fovy_last, InputIt2 aspect_first, T znear, OutputIt d_first) {
+        for ( ; fovy_first != fovy_last; ++fovy_first, ++aspect_first, ++d_first ) {
+            *d_first = perspective_fov_infinite_reversed_rh(*fovy_first, *aspect_first, znear);
+        }
+        return d_first;
+    }
+
+    // unproject
+
+    template < typename InputIt, typename OutputIt, typename T >
+    constexpr OutputIt unproject(InputIt first, InputIt last, const mat<T, 4>& inv_view_proj, OutputIt d_first) {
+        const mat<T, 4> mm = inv_view_proj;
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = unproject(*first, mm);
+        }
+        return d_first;
+    }
+
+    template < typename InputIt, typename OutputIt, typename T >
+    constexpr OutputIt unproject(InputIt first, InputIt last, const mat<T, 4>& inv_view_proj, const vec<T, 4>& viewport, OutputIt d_first) {
+        // the viewport mapping is folded into the matrix once
+        const mat<T, 4> mm = window_to_ndc(viewport) * inv_view_proj;
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = unproject(*first, mm);
+        }
+        return d_first;
+    }
+}
+
+//
+// Batch Reductions
+//
+
+namespace vmath_hpp
+{
+    enum class summation : unsigned char {
+        naive,
+        pairwise,
+        kahan,
+        neumaier,
+    };
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename V >
+    [[nodiscard]] constexpr V reduce_zero() noexcept {
+        if constexpr ( std::is_arithmetic_v<V> ) {
+            return V{0};
+        } else {
+            return V{zero_init};
+        }
+    }
+
+    template < typename T >
+    constexpr std::enable_if_t<std::is_arithmetic_v<T>, void>
+    neumaier_add(T& sum, T& c, T x) noexcept {
+        const T t = sum + x;
+        c += abs(sum) >= abs(x) ? (sum - t) + x : (x - t) + sum;
+        sum = t;
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr void neumaier_add(vec<T, Size>& sum, vec<T, Size>& c, const vec<T, Size>& x) noexcept {
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            neumaier_add(sum[i], c[i], x[i]);
+        }
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr void neumaier_add(mat<T, Rows, Cols>& sum, mat<T, Rows, Cols>& c, const mat<T, Rows, Cols>& x) noexcept {
+        for ( std::size_t i = 0; i < Rows; ++i ) {
+            neumaier_add(sum[i], c[i], x[i]);
+        }
+    }
+
+    template < typename V, typename InputIt, typename F >
+    [[nodiscard]] constexpr V reduce(InputIt first, InputIt last, F&& f, summation mode) {
+        switch ( mode ) {
+            case summation::pairwise: {
+                /// REFERENCE:
+                /// https://en.wikipedia.org/wiki/Pairwise_summation
+                // plain sums of short blocks merged like a binary counter:
+                // the inner loop stays branchless, one pass, O(log n) error growth
+                constexpr std::size_t block_size = 32;
+                V partials[64]{};
+                std::size_t blocks = 0;
+                while ( first != last ) {
+                    V b = reduce_zero<V>();
+                    for ( std::size_t i = 0; i < block_size && first != last; ++i, ++first ) {
+                        b += f(*first);
+                    }
+                    std::size_t level = 0;
+                    for ( ; (blocks >> level) & 1u; ++level ) {
+                        b = partials[level] + b;
+                    }
+                    partials[level] = b;
+                    ++blocks;
+                }
+                V s = reduce_zero<V>();
+                for ( std::size_t level = 0; (blocks >> level) != 0; ++level ) {
+                    if ( (blocks >> level) & 1u ) {
+                        s = partials[level] + s;
+                    }
+                }
+                return s;
+            }
+            case summation::kahan: {
+                /// REFERENCE:
+                /// https://en.wikipedia.org/wiki/Kahan_summation_algorithm
+                V s = reduce_zero<V>();
+                V c = reduce_zero<V>();
+                for ( ; first != last; ++first ) {
+                    const V y = f(*first) - c;
+                    const V t = s + y;
+                    c = (t - s) - y;
+                    s = t;
+                }
+                return s;
+            }
+            case summation::neumaier: {
+                V s = reduce_zero<V>();
+                V c = reduce_zero<V>();
+                for ( ; first != last; ++first ) {
+                    neumaier_add(s, c, f(*first));
+                }
+                return s + c;
+            }
+            case summation::naive:
+                break;
+        }
+        V s = reduce_zero<V>();
+        for ( ; first != last; ++first ) {
+            s += f(*first);
+        }
+        return s;
+    }
+}
+
+namespace vmath_hpp
+{
+    // sum
+
+    template < typename InputIt
+             , typename V = typename std::iterator_traits<InputIt>::value_type >
+    [[nodiscard]] constexpr V sum(InputIt first, InputIt last, summation mode = summation::pairwise) {
+        return impl::reduce<V>(first, last, [](const V& x){ return x; }, mode);
+    }
+
+    // dot
+
+    template < typename InputIt1, typename InputIt2
+             , typename V = decltype(dot(*std::declval<InputIt1>(), *std::declval<InputIt2>())) >
+    [[nodiscard]] constexpr V dot(InputIt1 first1, InputIt1 last1, InputIt2 first2, summation mode = summation::pairwise) {
+        return impl::reduce<V>(first1, last1, [&first2](const auto& x){ return dot(x, *first2++); }, mode);
+    }
+
+    // length
+
+    template < typename InputIt
+             , typename V = decltype(length2(*std::declval<InputIt>())) >
+    [[nodiscard]] constexpr V length(InputIt first, InputIt last, summation mode = summation::pairwise) {
+        return sqrt(length2(first, last, mode));
+    }
+
+    // length2
+
+    template < typename InputIt
+             , typename V = decltype(length2(*std::declval<InputIt>())) >
+    [[nodiscard]] constexpr V length2(InputIt first, InputIt last, summation mode = summation::pairwise) {
+        return impl::reduce<V>(first, last, [](const auto& x){ return length2(x); }, mode);
+    }
+
+    // centroid
+
+    template < typename InputIt
+             , typename T = typename std::iterator_traits<InputIt>::value_type::component_type
+             , std::size_t Size = std::iterator_traits<InputIt>::value_type::size >
+    [[nodiscard]] constexpr vec<T, Size> centroid(InputIt first, InputIt last, summation mode = summation::pairwise) {
+        std::size_t count = 0;
+        const vec<T, Size> s = impl::reduce<vec<T, Size>>(first, last, [&count](const vec<T, Size>& x){
+            ++count;
+            return x;
+        }, mode);
+        return count > 0 ? s / static_cast<T>(count) : s;
+    }
+
+    // covariance
+
+    template < typename ForwardIt
+             , typename T = typename std::iterator_traits<ForwardIt>::value_type::component_type
+             , std::size_t Size = std::iterator_traits<ForwardIt>::value_type::size >
+    [[nodiscard]] constexpr mat<T, Size> covariance(ForwardIt first, ForwardIt last, summation mode = summation::pairwise) {
+        // population covariance, two passes: the mean is subtracted first to avoid cancellation
+        const vec<T, Size> mean = centroid(first, last, mode);
+        std::size_t count = 0;
+        const mat<T, Size> s = impl::reduce<mat<T, Size>>(first, last, [&count, &mean](const vec<T, Size>& x){
+            ++count;
+            const vec<T, Size> d = x - mean;
+            mat<T, Size> m{zero_init};
+            for ( std::size_t i = 0; i < Size; ++i ) {
+                m[i] = d * d[i];
+            }
+            return m;
+        }, mode);
+        return count > 0 ? s / static_cast<T>(count) : s;
+    }
+}
@@ -0,0 +1,392 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_mat.hpp"
+#include "vmath_qua.hpp"
+#include "vmath_vec.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+//
+// Byte Order
+//
+
+namespace vmath_hpp
+{
+    enum class byte_order : unsigned {
+        little,
+        big,
+    };
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    inline constexpr byte_order native_byte_order = byte_order::big;
+#else
+    inline constexpr byte_order native_byte_order = byte_order::little;
+#endif
+}
+
+namespace vmath_hpp::impl
+{
+    template < std::size_t Size >
+    struct blob_uint;
+
+    template <> struct blob_uint<1> { using type = std::uint8_t; };
+    template <> struct blob_uint<2> { using type = std::uint16_t; };
+    template <> struct blob_uint<4> { using type = std::uint32_t; };
+    template <> struct blob_uint<8> { using type = std::uint64_t; };
+
+    template < typename U >
+    [[nodiscard]] VMATH_HPP_FORCE_INLINE U byteswap(U x) noexcept {
+        if constexpr ( sizeof(U) == 1 ) {
+            return x;
+        } else {
+        #if defined(__clang__) || defined(__GNUC__)
+            if constexpr ( sizeof(U) == 2 ) {
+                return __builtin_bswap16(x);
+            } else if constexpr ( sizeof(U) == 4 ) {
+                return __builtin_bswap32(x);
+            } else {
+                return __builtin_bswap64(x);
+            }
+        #else
+            U r{0};
+            for ( std::size_t i = 0; i < sizeof(U); ++i, x >>= 8 ) {
+                r = static_cast<U>((r << 8) | (x & 0xFFu));
+            }
+            return r;
+        #endif
+        }
+    }
+
+    template < std::size_t ComponentSize >
+    void copy_byteswapped(void* dst, const void* src, std::size_t components) noexcept {
+        // memcpy per component: the source is often a mapped file with no alignment guarantees
+        using U = typename blob_uint<ComponentSize>::type;
+        unsigned char* d = static_cast<unsigned char*>(dst);
+        const unsigned char* s = static_cast<const unsigned char*>(src);
+        for ( std::size_t i = 0; i < components; ++i ) {
+            U u;
+            std::memcpy(&u, s + i * sizeof(U), sizeof(U));
+            u = byteswap(u);
+            std::memcpy(d + i * sizeof(U), &u, sizeof(U));
+        }
+    }
+
+    inline void store_u64(unsigned char* dst, std::uint64_t x, byte_order order) noexcept {
+        for ( std::size_t i = 0; i < 8; ++i ) {
+            const std::size_t shift = order == byte_order::little ? i * 8 : (7 - i) * 8;
+            dst[i] = static_cast<unsigned char>((x >> shift) & 0xFFu);
+        }
+    }
+
+    [[nodiscard]] inline std::uint64_t load_u64(const unsigned char* src, byte_order order) noexcept {
+        std::uint64_t x{0};
+        for ( std::size_t i = 0; i < 8; ++i ) {
+            const std::size_t shift = order == byte_order::little ? i * 8 : (7 - i) * 8;
+            x |= std::uint64_t{src[i]} << shift;
+        }
+        return x;
+    }
+}
+
+//
+// Blob Traits
+//
+
+namespace vmath_hpp::impl
+{
+    template < typename V >
+    struct blob_shape {
+        static constexpr bool valid = false;
+    };
+
+    template < typename T, std::size_t Size >
+    struct blob_shape<vec<T, Size>> {
+        static constexpr bool valid = true;
+        using component_type = T;
+        static constexpr unsigned char kind = 'v';
+        static constexpr std::size_t rows = 1;
+        static constexpr std::size_t cols = Size;
+    };
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    struct blob_shape<mat<T, Rows, Cols>> {
+        static constexpr bool valid = true;
+        using component_type = T;
+        static constexpr unsigned char kind = 'm';
+        static constexpr std::size_t rows = Rows;
+        static constexpr std::size_t cols = Cols;
+    };
+
+    template < typename T >
+    struct blob_shape<qua<T>> {
+        static constexpr bool valid = true;
+        using component_type = T;
+        static constexpr unsigned char kind = 'q';
+        static constexpr std::size_t rows = 1;
+        static constexpr std::size_t cols = 4;
+    };
+
+    template < typename V, bool = blob_shape<V>::valid >
+    struct is_blittable : std::false_type {};
+
+    template < typename V >
+    struct is_blittable<V, true> {
+        using T = typename blob_shape<V>::component_type;
+        static constexpr bool value =
+            std::is_arithmetic_v<T> &&
+            !std::is_same_v<T, bool> &&
+            (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8) &&
+            std::is_standard_layout_v<V> &&
+            std::is_trivially_copyable_v<V> &&
+            sizeof(V) == sizeof(T) * blob_shape<V>::rows * blob_shape<V>::cols;
+    };
+
+    template < typename V >
+    [[nodiscard]] constexpr unsigned char blob_component_kind() noexcept {
+        using T = typename blob_shape<V>::component_type;
+        if constexpr ( std::is_floating_point_v<T> ) {
+            return 'f';
+        } else if constexpr ( std::is_signed_v<T> ) {
+            return 'i';
+        } else {
+            return 'u';
+        }
+    }
+}
+
+namespace vmath_hpp
+{
+    // vectors, matrices and quaternions of arithmetic components that
+    // can be written and mapped as raw bytes, see the layout notes
+    // at the end of vmath_vec.hpp, vmath_mat.hpp and vmath_qua.hpp
+
+    template < typename V >
+    inline constexpr bool is_blittable_v = impl::is_blittable<V>::value;
+}
+
+//
+// Blob Serialization
+//
+
+namespace vmath_hpp
+{
+    // layout of the 32 byte header, the payload follows it:
+    //
+    // [0..4)   magic "VMTH"
+    // [4]      version
+    // [5]      byte order of the payload and the count (0 - little, 1 - big)
+    // [6]      shape ('v', 'm' or 'q')
+    // [7]      component kind ('f', 'i' or 'u')
+    // [8]      component size in bytes
+    // [9]      rows
+    // [10]     columns
+    // [16..24) element count
+    // the rest is reserved and written as zeros
+
+    inline constexpr std::size_t blob_header_size = 32;
+    inline constexpr unsigned char blob_version = 1;
+
+    enum class blob_error : unsigned {
+        none,
+        truncated,
+        bad_magic,
+        bad_version,
+        type_mismatch,
+    };
+
+    template < typename V >
+    [[nodiscard]] constexpr std::size_t blob_size(std::size_t count) noexcept {
+        static_assert(is_blittable_v<V>);
+        return blob_header_size + count * sizeof(V);
+    }
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename V >
+    void write_blob_header(unsigned char* dst, std::size_t count, byte_order order) noexcept {
+        using T = typename blob_shape<V>::component_type;
+        std::memset(dst, 0, blob_header_size);
+        std::memcpy(dst, "VMTH", 4);
+        dst[4] = blob_version;
+        dst[5] = static_cast<unsigned char>(order);
+        dst[6] = blob_shape<V>::kind;
+        dst[7] = blob_component_kind<V>();
+        dst[8] = static_cast<unsigned char>(sizeof(T));
+        dst[9] = static_cast<unsigned char>(blob_shape<V>::rows);
+        dst[10] = static_cast<unsigned char>(blob_shape<V>::cols);
+        store_u64(dst + 16, static_cast<std::uint64_t>(count), order);
+    }
+
+    template < typename V >
+    void copy_blob_payload(void* dst, const void* src, std::size_t count, bool swap) noexcept {
+        using T = typename blob_shape<V>::component_type;
+        if ( swap ) {
+            copy_byteswapped<sizeof(T)>(dst, src, count * (sizeof(V) / sizeof(T)));
+        } else if ( count > 0 ) {
+            std::memcpy(dst, src, count * sizeof(V));
+        }
+    }
+}
+
+namespace vmath_hpp
+{
+    // view_blob
+
+    template < typename V >
+    class blob_view final {
+    public:
+        static_assert(is_blittable_v<V>);
+
+        using value_type = V;
+        using component_type = typename impl::blob_shape<V>::component_type;
+
+        blob_view() = default;
+
+        blob_view(blob_error error)
+        : error_{error} {}
+
+        blob_view(const unsigned char* payload, std::size_t size, byte_order order)
+        : payload_{payload}
+        , size_{size}
+        , order_{order} {}
+
+        [[nodiscard]] blob_error error() const noexcept { return error_; }
+        [[nodiscard]] bool valid() const noexcept { return error_ == blob_error::none; }
+        explicit operator bool() const noexcept { return valid(); }
+
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        [[nodiscard]] byte_order order() const noexcept { return order_; }
+        [[nodiscard]] bool needs_swap() const noexcept { return order_ != native_byte_order; }
+
+        // the mapped elements themselves, nullptr when they can't be used
+        // in place: the payload has a foreign byte order or is misaligned
+
+        [[nodiscard]] const V* data() const noexcept {
+            const bool aligned = reinterpret_cast<std::uintptr_t>(payload_) % alignof(V) == 0;
+            return valid() && !needs_swap() && aligned
+                ? reinterpret_cast<const V*>(payload_)
+                : nullptr;
+        }
+
+        // always available, swaps on access when needed
+
+        [[nodiscard]] V operator[](std::size_t index) const noexcept {
+            V v{no_init};
+            impl::copy_blob_payload<V>(&v, payload_ + index * sizeof(V), 1, needs_swap());
+            return v;
+        }
+
+        V* copy_to(V* d_first) const noexcept {
+            impl::copy_blob_payload<V>(d_first, payload_, size_, needs_swap());
+            return d_first + size_;
+        }
+    private:
+        const unsigned char* payload_{};
+        std::size_t size_{};
+        byte_order order_{native_byte_order};
+        blob_error error_{blob_error::none};
+    };
+
+    template < typename V >
+    [[nodiscard]] blob_view<V> view_blob(const void* bytes, std::size_t size) noexcept {
+        using T = typename impl::blob_shape<V>::component_type;
+        const unsigned char* b = static_cast<const unsigned char*>(bytes);
+
+        if ( size < blob_header_size ) {
+            return blob_error::truncated;
+        }
+
+        if ( std::memcmp(b, "VMTH", 4) != 0 || b[5] > 1 ) {
+            return blob_error::bad_magic;
+        }
+
+        if ( b[4] != blob_version ) {
+            return blob_error::bad_version;
+        }
+
+        if ( b[6] != impl::blob_shape<V>::kind
+            || b[7] != impl::blob_component_kind<V>()
+            || b[8] != sizeof(T)
+            || b[9] != impl::blob_shape<V>::rows
+            || b[10] != impl::blob_shape<V>::cols )
+        {
+            return blob_error::type_mismatch;
+        }
+
+        const byte_order order = static_cast<byte_order>(b[5]);
+        const std::uint64_t count = impl::load_u64(b + 16, order);
+
+        if ( count > (size - blob_header_size) / sizeof(V) ) {
+            return blob_error::truncated;
+        }
+
+        return {b + blob_header_size, static_cast<std::size_t>(count), order};
+    }
+
+    // make_blob_native
+
+    template < typename V >
+    blob_view<V> make_blob_native(void* bytes, std::size_t size) noexcept {
+        // swaps a writable mapping in place once instead of on every access
+        unsigned char* b = static_cast<unsigned char*>(bytes);
+        const blob_view<V> view = view_blob<V>(b, size);
+        if ( !view.valid() || !view.needs_swap() ) {
+            return view;
+        }
+        unsigned char* payload = b + blob_header_size;
+        impl::copy_blob_payload<V>(payload, payload, view.size(), true);
+        impl::write_blob_header<V>(b, view.size(), native_byte_order);
+        return {payload, view.size(), native_byte_order};
+    }
+
+    // write_blob
+
+    template < typename V >
+    std::size_t write_blob(void* dst, const V* xs, std::size_t count, byte_order order = native_byte_order) noexcept {
+        // dst must hold blob_size<V>(count) bytes, returns the number of bytes written
+        static_assert(is_blittable_v<V>);
+        unsigned char* d = static_cast<unsigned char*>(dst);
+        impl::write_blob_header<V>(d, count, order);
+        impl::copy_blob_payload<V>(d + blob_header_size, xs, count, order != native_byte_order);
+        return blob_size<V>(count);
+    }
+
+    template < typename V >
+    [[nodiscard]] bool write_blob(std::FILE* file, const V* xs, std::size_t count, byte_order order = native_byte_order) noexcept {
+        static_assert(is_blittable_v<V>);
+
+        unsigned char header[blob_header_size];
+        impl::write_blob_header<V>(header, count, order);
+        if ( std::fwrite(header, 1, blob_header_size, file) != blob_header_size ) {
+            return false;
+        }
+
+        if ( order == native_byte_order ) {
+            return std::fwrite(xs, sizeof(V), count, file) == count;
+        }
+
+        // foreign byte order: swap through a small stack buffer
+        constexpr std::size_t chunk_size = 4096 / sizeof(V) > 0 ? 4096 / sizeof(V) : 1;
+        alignas(V) unsigned char chunk[chunk_size * sizeof(V)];
+        for ( std::size_t i = 0; i < count; i += chunk_size ) {
+            const std::size_t n = count - i < chunk_size ? count - i : chunk_size;
+            impl::copy_blob_payload<V>(chunk, xs + i, n, true);
+            if ( std::fwrite(chunk, sizeof(V), n, file) != n ) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
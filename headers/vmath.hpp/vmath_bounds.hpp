@@ -0,0 +1,441 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_batch.hpp"
+#include "vmath_fun.hpp"
+#include "vmath_mat_fun.hpp"
+#include "vmath_vec_fun.hpp"
+
+#include <limits>
+
+//
+// Bounding Volumes
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    class aabb final {
+    public:
+        using self_type = aabb;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+    public:
+        // empty box: merging anything into it gives the bounds of that thing
+        vec_type min{std::numeric_limits<T>::max()};
+        vec_type max{std::numeric_limits<T>::lowest()};
+    public:
+        constexpr aabb() = default;
+
+        constexpr aabb(const vec_type& lower, const vec_type& upper)
+        : min{lower}
+        , max{upper} {}
+    };
+
+    template < typename T, std::size_t Size >
+    class sphere final {
+    public:
+        using self_type = sphere;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+    public:
+        // empty sphere has a negative radius
+        vec_type center{zero_init};
+        T radius{-1};
+    public:
+        constexpr sphere() = default;
+
+        constexpr sphere(const vec_type& c, T r)
+        : center{c}
+        , radius{r} {}
+    };
+
+    template < typename T, std::size_t Size >
+    class obb final {
+    public:
+        using self_type = obb;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+        using mat_type = mat<T, Size>;
+    public:
+        // the rows of axes are the unit box axes in world space
+        vec_type center{zero_init};
+        mat_type axes{identity_init};
+        vec_type half_extents{zero_init};
+    public:
+        constexpr obb() = default;
+
+        constexpr obb(const vec_type& c, const mat_type& a, const vec_type& h)
+        : center{c}
+        , axes{a}
+        , half_extents{h} {}
+    };
+}
+
+namespace vmath_hpp
+{
+    using faabb2 = aabb<float, 2>;
+    using faabb3 = aabb<float, 3>;
+    using daabb2 = aabb<double, 2>;
+    using daabb3 = aabb<double, 3>;
+
+    using fsphere2 = sphere<float, 2>;
+    using fsphere3 = sphere<float, 3>;
+    using dsphere2 = sphere<double, 2>;
+    using dsphere3 = sphere<double, 3>;
+
+    using fobb2 = obb<float, 2>;
+    using fobb3 = obb<float, 3>;
+    using dobb2 = obb<double, 2>;
+    using dobb3 = obb<double, 3>;
+}
+
+//
+// AABB Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool empty(const aabb<T, Size>& b) {
+        return any(greater(b.min, b.max));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> center(const aabb<T, Size>& b) {
+        return (b.min + b.max) / T{2};
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> extent(const aabb<T, Size>& b) {
+        return b.max - b.min;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool contains(const aabb<T, Size>& b, const vec<T, Size>& p) {
+        return all(greater_equal(p, b.min)) && all(less_equal(p, b.max));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr aabb<T, Size> merge(const aabb<T, Size>& b, const vec<T, Size>& p) {
+        return {min(b.min, p), max(b.max, p)};
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr aabb<T, Size> merge(const aabb<T, Size>& a, const aabb<T, Size>& b) {
+        return {min(a.min, b.min), max(a.max, b.max)};
+    }
+
+    template < typename InputIt
+             , typename T = typename std::iterator_traits<InputIt>::value_type::component_type
+             , std::size_t Size = std::iterator_traits<InputIt>::value_type::size >
+    [[nodiscard]] constexpr aabb<T, Size> compute_aabb(InputIt first, InputIt last) {
+        // plain min/max accumulators, the loop body is branchless and vectorizes
+        vec<T, Size> lower{std::numeric_limits<T>::max()};
+        vec<T, Size> upper{std::numeric_limits<T>::lowest()};
+        for ( ; first != last; ++first ) {
+            const vec<T, Size>& p = *first;
+            lower = min(lower, p);
+            upper = max(upper, p);
+        }
+        return {lower, upper};
+    }
+}
+
+//
+// Sphere Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool empty(const sphere<T, Size>& s) {
+        return s.radius < T{0};
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool contains(const sphere<T, Size>& s, const vec<T, Size>& p) {
+        return length2(p - s.center) <= s.radius * s.radius;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr sphere<T, Size> merge(const sphere<T, Size>& s, const vec<T, Size>& p) {
+        if ( empty(s) ) {
+            return {p, T{0}};
+        }
+
+        const vec<T, Size> d = p - s.center;
+        const T d2 = length2(d);
+        if ( d2 <= s.radius * s.radius ) {
+            return s;
+        }
+
+        const T dist = sqrt(d2);
+        const T radius = (s.radius + dist) * T{0.5};
+        return {s.center + d * ((radius - s.radius) / dist), radius};
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr sphere<T, Size> merge(const sphere<T, Size>& a, const sphere<T, Size>& b) {
+        if ( empty(a) ) {
+            return b;
+        }
+
+        if ( empty(b) ) {
+            return a;
+        }
+
+        const vec<T, Size> d = b.center - a.center;
+        const T dist = length(d);
+        if ( dist + b.radius <= a.radius ) {
+            return a;
+        }
+
+        if ( dist + a.radius <= b.radius ) {
+            return b;
+        }
+
+        const T radius = (dist + a.radius + b.radius) * T{0.5};
+        return {a.center + d * ((radius - a.radius) / dist), radius};
+    }
+
+    template < typename ForwardIt
+             , typename T = typename std::iterator_traits<ForwardIt>::value_type::component_type
+             , std::size_t Size = std::iterator_traits<ForwardIt>::value_type::size >
+    [[nodiscard]] constexpr sphere<T, Size> compute_sphere_ritter(ForwardIt first, ForwardIt last) {
+        /// REFERENCE:
+        /// Jack Ritter, An Efficient Bounding Sphere (Graphics Gems, 1990)
+
+        if ( first == last ) {
+            return {};
+        }
+
+        const auto farthest = [first, last](const vec<T, Size>& from){
+            vec<T, Size> r = *first;
+            T r2 = length2(r - from);
+            for ( ForwardIt iter = first; iter != last; ++iter ) {
+                const T d2 = length2(*iter - from);
+                if ( d2 > r2 ) {
+                    r = *iter;
+                    r2 = d2;
+                }
+            }
+            return r;
+        };
+
+        const vec<T, Size> y = farthest(*first);
+        const vec<T, Size> z = farthest(y);
+
+        sphere<T, Size> s{(y + z) * T{0.5}, distance(y, z) * T{0.5}};
+        for ( ; first != last; ++first ) {
+            s = merge(s, *first);
+        }
+        return s;
+    }
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename T >
+    [[nodiscard]] constexpr bool epos_contains(const sphere<T, 3>& s, const vec<T, 3>& p) {
+        // tolerate the rounding of the circumsphere computations
+        const T eps = T{16} * std::numeric_limits<T>::epsilon();
+        return length2(p - s.center) <= s.radius * s.radius * (T{1} + eps);
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr sphere<T, 3> epos_diameter_sphere(const vec<T, 3>& a, const vec<T, 3>& b) {
+        return {(a + b) * T{0.5}, distance(a, b) * T{0.5}};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr sphere<T, 3> epos_support_sphere(const vec<T, 3>* ps, std::size_t n) {
+        const T eps = std::numeric_limits<T>::epsilon();
+
+        if ( n == 0 ) {
+            return {};
+        }
+
+        if ( n == 1 ) {
+            return {ps[0], T{0}};
+        }
+
+        if ( n == 2 ) {
+            return epos_diameter_sphere(ps[0], ps[1]);
+        }
+
+        if ( n == 3 ) {
+            const vec<T, 3> ab = ps[1] - ps[0];
+            const vec<T, 3> ac = ps[2] - ps[0];
+            const vec<T, 3> nn = cross(ab, ac);
+            const T nn2 = length2(nn);
+
+            if ( nn2 <= eps * length2(ab) * length2(ac) ) {
+                // collinear: the farthest pair spans the sphere
+                sphere<T, 3> s = epos_diameter_sphere(ps[0], ps[1]);
+                s = merge(s, epos_diameter_sphere(ps[0], ps[2]));
+                return merge(s, epos_diameter_sphere(ps[1], ps[2]));
+            }
+
+            const vec<T, 3> o = (cross(nn, ab) * length2(ac) + cross(ac, nn) * length2(ab)) / (T{2} * nn2);
+            return {ps[0] + o, length(o)};
+        }
+
+        const vec<T, 3> u = ps[1] - ps[0];
+        const vec<T, 3> v = ps[2] - ps[0];
+        const vec<T, 3> w = ps[3] - ps[0];
+        const T det = dot(u, cross(v, w));
+
+        if ( abs(det) <= eps * length(u) * length(v) * length(w) ) {
+            // coplanar: the fourth point is already on the circle of the others
+            return merge(epos_support_sphere(ps, 3), ps[3]);
+        }
+
+        const vec<T, 3> o = (
+            cross(v, w) * length2(u) +
+            cross(w, u) * length2(v) +
+            cross(u, v) * length2(w)) / (T{2} * det);
+        return {ps[0] + o, length(o)};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr sphere<T, 3> epos_welzl(const vec<T, 3>* ps, std::size_t n, vec<T, 3>* support, std::size_t ns) {
+        /// REFERENCE:
+        /// Emo Welzl, Smallest enclosing disks (balls and ellipsoids), 1991
+
+        if ( n == 0 || ns == 4 ) {
+            return epos_support_sphere(support, ns);
+        }
+
+        const sphere<T, 3> s = epos_welzl(ps, n - 1, support, ns);
+        if ( !empty(s) && epos_contains(s, ps[n - 1]) ) {
+            return s;
+        }
+
+        support[ns] = ps[n - 1];
+        return epos_welzl(ps, n - 1, support, ns + 1);
+    }
+}
+
+namespace vmath_hpp
+{
+    template < typename ForwardIt
+             , typename T = typename std::iterator_traits<ForwardIt>::value_type::component_type
+             , std::size_t Size = std::iterator_traits<ForwardIt>::value_type::size >
+    [[nodiscard]] constexpr std::enable_if_t<Size == 3, sphere<T, Size>>
+    compute_sphere_epos(ForwardIt first, ForwardIt last) {
+        /// REFERENCE:
+        /// Thomas Larsson, Fast and Tight Fitting Bounding Spheres (SIGRAD 2008)
+
+        // EPOS-14: the extremal points along 7 directions, the exact
+        // minimum sphere of them and a Ritter pass over all points
+
+        if ( first == last ) {
+            return {};
+        }
+
+        constexpr std::size_t dir_count = 7;
+        const vec<T, 3> dirs[dir_count]{
+            {T{1}, T{0}, T{0}},
+            {T{0}, T{1}, T{0}},
+            {T{0}, T{0}, T{1}},
+            {T{1}, T{1}, T{1}},
+            {T{1}, T{1}, T{-1}},
+            {T{1}, T{-1}, T{1}},
+            {T{1}, T{-1}, T{-1}}};
+
+        vec<T, 3> extremes[dir_count * 2]{};
+        T projs[dir_count * 2]{};
+
+        for ( std::size_t i = 0; i < dir_count; ++i ) {
+            extremes[i * 2 + 0] = *first;
+            extremes[i * 2 + 1] = *first;
+            projs[i * 2 + 0] = dot(dirs[i], *first);
+            projs[i * 2 + 1] = projs[i * 2 + 0];
+        }
+
+        for ( ForwardIt iter = first; iter != last; ++iter ) {
+            const vec<T, 3>& p = *iter;
+            for ( std::size_t i = 0; i < dir_count; ++i ) {
+                const T d = dot(dirs[i], p);
+                if ( d < projs[i * 2 + 0] ) {
+                    projs[i * 2 + 0] = d;
+                    extremes[i * 2 + 0] = p;
+                }
+                if ( d > projs[i * 2 + 1] ) {
+                    projs[i * 2 + 1] = d;
+                    extremes[i * 2 + 1] = p;
+                }
+            }
+        }
+
+        vec<T, 3> support[4]{};
+        sphere<T, 3> s = impl::epos_welzl(extremes, dir_count * 2, support, 0);
+
+        for ( ; first != last; ++first ) {
+            s = merge(s, *first);
+        }
+        return s;
+    }
+}
+
+//
+// OBB Functions
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool contains(const obb<T, Size>& b, const vec<T, Size>& p) {
+        const vec<T, Size> d = p - b.center;
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            if ( abs(dot(d, b.axes[i])) > b.half_extents[i] ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template < typename ForwardIt
+             , typename T = typename std::iterator_traits<ForwardIt>::value_type::component_type
+             , std::size_t Size = std::iterator_traits<ForwardIt>::value_type::size >
+    [[nodiscard]] constexpr obb<T, Size> compute_obb_pca(ForwardIt first, ForwardIt last) {
+        // the box axes are the eigenvectors of the covariance matrix of the points
+
+        if ( first == last ) {
+            return {};
+        }
+
+        // the eigenvectors are the columns, the box axes are rows
+        mat<T, Size> axes = transpose(symmetric_eigen(covariance(first, last)).second);
+
+        if constexpr ( Size == 3 ) {
+            if ( dot(cross(axes[0], axes[1]), axes[2]) < T{0} ) {
+                axes[2] = -axes[2];
+            }
+        }
+
+        vec<T, Size> lower{std::numeric_limits<T>::max()};
+        vec<T, Size> upper{std::numeric_limits<T>::lowest()};
+        for ( ; first != last; ++first ) {
+            vec<T, Size> local{no_init};
+            for ( std::size_t i = 0; i < Size; ++i ) {
+                local[i] = dot(*first, axes[i]);
+            }
+            lower = min(lower, local);
+            upper = max(upper, local);
+        }
+
+        return {
+            ((lower + upper) * T{0.5}) * axes,
+            axes,
+            (upper - lower) * T{0.5}};
+    }
+}
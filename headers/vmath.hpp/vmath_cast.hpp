@@ -0,0 +1,43 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_mat_fun.hpp"
+#include "vmath_qua_fun.hpp"
+#include "vmath_vec_fun.hpp"
+
+//
+// Cast
+//
+
+namespace vmath_hpp
+{
+    template < typename To, typename From >
+    [[nodiscard]] std::enable_if_t<
+        std::is_arithmetic_v<To> && std::is_arithmetic_v<From>
+    , To>
+    constexpr cast_to(From x) noexcept {
+        return static_cast<To>(x);
+    }
+
+    template < typename To, typename From, std::size_t Size >
+    [[nodiscard]] constexpr vec<To, Size> cast_to(const vec<From, Size>& v) {
+        return map_join([](From x){ return cast_to<To>(x); }, v);
+    }
+
+    template < typename To, typename From, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr mat<To, Rows, Cols> cast_to(const mat<From, Rows, Cols>& m) {
+        return map_join([](const vec<From, Cols>& v){ return cast_to<To>(v); }, m);
+    }
+
+    template < typename To, typename From >
+    [[nodiscard]] constexpr qua<To> cast_to(const qua<From>& q) {
+        return map_join([](From x){ return cast_to<To>(x); }, q);
+    }
+}
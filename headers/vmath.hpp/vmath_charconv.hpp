@@ -0,0 +1,288 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_mat.hpp"
+#include "vmath_qua.hpp"
+#include "vmath_vec.hpp"
+
+#include <iterator>
+
+#if defined(__has_include)
+#  if __has_include(<charconv>)
+#    define VMATH_HPP_CHARCONV
+#    include <charconv>
+#  endif
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+
+#if defined(__cpp_lib_format)
+#  include <format>
+#endif
+
+// <charconv> first shipped with gcc 8, without it
+// to_chars and from_chars are compiled out
+
+#if defined(VMATH_HPP_CHARCONV)
+
+//
+// Chars
+//
+
+namespace vmath_hpp::impl
+{
+    // floating-point std::to_chars and std::from_chars came later than the integral ones,
+    // __cpp_lib_to_chars is defined only by the standard libraries that have both
+
+#if defined(__cpp_lib_to_chars)
+    inline constexpr bool has_float_charconv = true;
+#else
+    inline constexpr bool has_float_charconv = false;
+#endif
+
+    template < typename T >
+    inline constexpr bool is_charconv_v =
+        (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+        (std::is_floating_point_v<T> && has_float_charconv);
+
+    [[nodiscard]] constexpr bool is_chars_space(char c) noexcept {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    [[nodiscard]] constexpr const char* skip_chars_separator(const char* first, const char* last) noexcept {
+        // whitespace with at most one comma
+        for ( ; first != last && is_chars_space(*first); ++first ) {}
+        if ( first != last && *first == ',' ) {
+            for ( ++first; first != last && is_chars_space(*first); ++first ) {}
+        }
+        return first;
+    }
+
+    template < typename T >
+    std::to_chars_result to_chars_n(char* first, char* last, const T* xs, std::size_t n, char separator) noexcept {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            if ( i > 0 ) {
+                if ( first == last ) {
+                    return {last, std::errc::value_too_large};
+                }
+                *first++ = separator;
+            }
+            const std::to_chars_result r = std::to_chars(first, last, xs[i]);
+            if ( r.ec != std::errc{} ) {
+                return r;
+            }
+            first = r.ptr;
+        }
+        return {first, std::errc{}};
+    }
+
+    template < typename T >
+    std::from_chars_result from_chars_n(const char* first, const char* last, T* xs, std::size_t n) noexcept {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            if ( i > 0 ) {
+                first = skip_chars_separator(first, last);
+            }
+            const std::from_chars_result r = std::from_chars(first, last, xs[i]);
+            if ( r.ec != std::errc{} ) {
+                return r;
+            }
+            first = r.ptr;
+        }
+        return {first, std::errc{}};
+    }
+}
+
+namespace vmath_hpp
+{
+    // the text form is the components in memory order (row-major for matrices, x, y, z, w
+    // for quaternions) joined by the separator, every number is the shortest one that
+    // round-trips, nothing depends on the locale and nothing allocates
+
+    // to_chars
+
+    template < typename T, std::size_t Size >
+    std::enable_if_t<impl::is_charconv_v<T>, std::to_chars_result>
+    to_chars(char* first, char* last, const vec<T, Size>& v, char separator = ' ') noexcept {
+        return impl::to_chars_n(first, last, v.data(), Size, separator);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    std::enable_if_t<impl::is_charconv_v<T>, std::to_chars_result>
+    to_chars(char* first, char* last, const mat<T, Rows, Cols>& m, char separator = ' ') noexcept {
+        for ( std::size_t i = 0; i < Rows; ++i ) {
+            if ( i > 0 ) {
+                if ( first == last ) {
+                    return {last, std::errc::value_too_large};
+                }
+                *first++ = separator;
+            }
+            const std::to_chars_result r = impl::to_chars_n(first, last, m[i].data(), Cols, separator);
+            if ( r.ec != std::errc{} ) {
+                return r;
+            }
+            first = r.ptr;
+        }
+        return {first, std::errc{}};
+    }
+
+    template < typename T >
+    std::enable_if_t<impl::is_charconv_v<T>, std::to_chars_result>
+    to_chars(char* first, char* last, const qua<T>& q, char separator = ' ') noexcept {
+        return impl::to_chars_n(first, last, q.data(), 4, separator);
+    }
+
+    // from_chars
+
+    template < typename T, std::size_t Size >
+    std::enable_if_t<impl::is_charconv_v<T>, std::from_chars_result>
+    from_chars(const char* first, const char* last, vec<T, Size>& v) noexcept {
+        // components are separated by whitespace and at most one comma,
+        // the output is left untouched when the parsing fails
+        vec<T, Size> t{no_init};
+        const std::from_chars_result r = impl::from_chars_n(first, last, t.data(), Size);
+        if ( r.ec == std::errc{} ) {
+            v = t;
+        }
+        return r;
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    std::enable_if_t<impl::is_charconv_v<T>, std::from_chars_result>
+    from_chars(const char* first, const char* last, mat<T, Rows, Cols>& m) noexcept {
+        mat<T, Rows, Cols> t{no_init};
+        for ( std::size_t i = 0; i < Rows; ++i ) {
+            if ( i > 0 ) {
+                first = impl::skip_chars_separator(first, last);
+            }
+            const std::from_chars_result r = impl::from_chars_n(first, last, t[i].data(), Cols);
+            if ( r.ec != std::errc{} ) {
+                return r;
+            }
+            first = r.ptr;
+        }
+        m = t;
+        return {first, std::errc{}};
+    }
+
+    template < typename T >
+    std::enable_if_t<impl::is_charconv_v<T>, std::from_chars_result>
+    from_chars(const char* first, const char* last, qua<T>& q) noexcept {
+        qua<T> t{no_init};
+        const std::from_chars_result r = impl::from_chars_n(first, last, t.data(), 4);
+        if ( r.ec == std::errc{} ) {
+            q = t;
+        }
+        return r;
+    }
+}
+
+//
+// Batch Chars
+//
+
+namespace vmath_hpp
+{
+    // to_chars
+
+    template < typename InputIt
+             , typename V = typename std::iterator_traits<InputIt>::value_type >
+    std::to_chars_result to_chars(char* first, char* last, InputIt x_first, InputIt x_last, char separator = ' ', char delimiter = '\n') noexcept {
+        // every element is followed by the delimiter, on overflow the result
+        // points to the end of the last element that was written completely
+        char* done = first;
+        for ( ; x_first != x_last; ++x_first ) {
+            const std::to_chars_result r = to_chars(done, last, *x_first, separator);
+            if ( r.ec != std::errc{} || r.ptr == last ) {
+                return {done, std::errc::value_too_large};
+            }
+            *r.ptr = delimiter;
+            done = r.ptr + 1;
+        }
+        return {done, std::errc{}};
+    }
+
+    // from_chars
+
+    template < typename ForwardIt
+             , typename V = typename std::iterator_traits<ForwardIt>::value_type >
+    std::pair<std::from_chars_result, ForwardIt> from_chars(const char* first, const char* last, ForwardIt d_first, ForwardIt d_last) noexcept {
+        // stops at the end of the output range or of the text, elements are
+        // separated like components: whitespace and at most one comma
+        for ( ; d_first != d_last; ++d_first ) {
+            const char* next = impl::skip_chars_separator(first, last);
+            if ( next == last ) {
+                break;
+            }
+            const std::from_chars_result r = from_chars(next, last, *d_first);
+            if ( r.ec != std::errc{} ) {
+                return {r, d_first};
+            }
+            first = r.ptr;
+        }
+        return {{first, std::errc{}}, d_first};
+    }
+}
+
+#endif
+
+//
+// Formatters
+//
+
+namespace vmath_hpp::impl
+{
+    template < typename Formatter, typename T, typename FormatContext >
+    void format_n(const Formatter& f, const T* xs, std::size_t n, bool separate, FormatContext& ctx) {
+        // every component is formatted with the user's format spec
+        for ( std::size_t i = 0; i < n; ++i ) {
+            if ( separate || i > 0 ) {
+                auto out = ctx.out();
+                *out++ = ' ';
+                ctx.advance_to(out);
+            }
+            ctx.advance_to(f.format(xs[i], ctx));
+        }
+    }
+}
+
+#if defined(__cpp_lib_format)
+namespace std
+{
+    template < typename T, size_t Size >
+    struct formatter<vmath_hpp::vec<T, Size>, char> : formatter<T, char> {
+        template < typename FormatContext >
+        auto format(const vmath_hpp::vec<T, Size>& v, FormatContext& ctx) const {
+            vmath_hpp::impl::format_n(static_cast<const formatter<T, char>&>(*this), v.data(), Size, false, ctx);
+            return ctx.out();
+        }
+    };
+
+    template < typename T, size_t Rows, size_t Cols >
+    struct formatter<vmath_hpp::mat<T, Rows, Cols>, char> : formatter<T, char> {
+        template < typename FormatContext >
+        auto format(const vmath_hpp::mat<T, Rows, Cols>& m, FormatContext& ctx) const {
+            for ( size_t i = 0; i < Rows; ++i ) {
+                vmath_hpp::impl::format_n(static_cast<const formatter<T, char>&>(*this), m[i].data(), Cols, i > 0, ctx);
+            }
+            return ctx.out();
+        }
+    };
+
+    template < typename T >
+    struct formatter<vmath_hpp::qua<T>, char> : formatter<T, char> {
+        template < typename FormatContext >
+        auto format(const vmath_hpp::qua<T>& q, FormatContext& ctx) const {
+            vmath_hpp::impl::format_n(static_cast<const formatter<T, char>&>(*this), q.data(), 4, false, ctx);
+            return ctx.out();
+        }
+    };
+}
+#endif
@@ -0,0 +1,20 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_fun.hpp"
+
+#include "vmath_mat.hpp"
+#include "vmath_mat_fun.hpp"
+
+#include "vmath_qua.hpp"
+#include "vmath_qua_fun.hpp"
+
+#include "vmath_vec.hpp"
+#include "vmath_vec_fun.hpp"
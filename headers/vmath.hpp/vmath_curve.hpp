@@ -0,0 +1,356 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_fun.hpp"
+#include "vmath_qua_fun.hpp"
+#include "vmath_vec_fun.hpp"
+
+//
+// Cubic Curves
+//
+
+namespace vmath_hpp
+{
+    // hermite
+
+    template < typename V, typename T >
+    [[nodiscard]] constexpr std::enable_if_t<std::is_floating_point_v<T>, V>
+    hermite(const V& p0, const V& m0, const V& p1, const V& m1, T t) {
+        const T t2 = t * t;
+        const T t3 = t2 * t;
+        return
+            p0 * (T{2} * t3 - T{3} * t2 + T{1}) +
+            m0 * (t3 - T{2} * t2 + t) +
+            p1 * (T{3} * t2 - T{2} * t3) +
+            m1 * (t3 - t2);
+    }
+
+    // catmull_rom
+
+    template < typename V, typename T >
+    [[nodiscard]] constexpr std::enable_if_t<std::is_floating_point_v<T>, V>
+    catmull_rom(const V& p0, const V& p1, const V& p2, const V& p3, T t) {
+        return hermite(p1, (p2 - p0) * T{0.5}, p2, (p3 - p1) * T{0.5}, t);
+    }
+
+    // bezier
+
+    template < typename V, typename T >
+    [[nodiscard]] constexpr std::enable_if_t<std::is_floating_point_v<T>, V>
+    bezier(const V& p0, const V& p1, const V& p2, const V& p3, T t) {
+        const T s = T{1} - t;
+        return
+            p0 * (s * s * s) +
+            p1 * (T{3} * s * s * t) +
+            p2 * (T{3} * s * t * t) +
+            p3 * (t * t * t);
+    }
+}
+
+//
+// Quaternion Curves
+//
+
+namespace vmath_hpp::impl
+{
+    template < typename T >
+    [[nodiscard]] constexpr vec<T, 3> unit_qua_log(const qua<T>& unit_q) {
+        const T vl = length(unit_q.v);
+        return vl > T{0} ? unit_q.v * (atan2(vl, unit_q.s) / vl) : vec<T, 3>{zero_init};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> unit_qua_exp(const vec<T, 3>& w) {
+        const T wl = length(w);
+        return wl > T{0} ? qua<T>{w * (sin(wl) / wl), cos(wl)} : qua<T>{identity_init};
+    }
+}
+
+namespace vmath_hpp
+{
+    // squad_control
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> squad_control(const qua<T>& unit_q0, const qua<T>& unit_q1, const qua<T>& unit_q2) {
+        /// REFERENCE:
+        /// Ken Shoemake, Animating rotation with quaternion curves (SIGGRAPH 1985)
+
+        // neighbours are moved to the hemisphere of q1 to take the short arcs
+        const qua<T> q0 = dot(unit_q0, unit_q1) < T{0} ? -unit_q0 : unit_q0;
+        const qua<T> q2 = dot(unit_q2, unit_q1) < T{0} ? -unit_q2 : unit_q2;
+
+        // a * b applies a first, so q1^-1 * q is written as q * inverse(q1)
+        const qua<T> iq1 = conjugate(unit_q1);
+        const vec<T, 3> l0 = impl::unit_qua_log(q0 * iq1);
+        const vec<T, 3> l2 = impl::unit_qua_log(q2 * iq1);
+        return impl::unit_qua_exp((l0 + l2) * T{-0.25}) * unit_q1;
+    }
+
+    // squad
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> squad(
+        const qua<T>& unit_q1,
+        const qua<T>& unit_q2,
+        const qua<T>& unit_s1,
+        const qua<T>& unit_s2,
+        T t)
+    {
+        return slerp(
+            slerp(unit_q1, unit_q2, t),
+            slerp(unit_s1, unit_s2, t),
+            T{2} * t * (T{1} - t));
+    }
+}
+
+//
+// Key Search
+//
+
+namespace vmath_hpp
+{
+    // find_key
+
+    template < typename RandomIt, typename T >
+    [[nodiscard]] constexpr std::size_t find_key(RandomIt first, RandomIt last, T time) {
+        // index of the segment [first[i], first[i + 1]) containing the time,
+        // clamped to the first and the last segments
+        const auto size = static_cast<std::size_t>(last - first);
+        if ( size < 2 ) {
+            return 0;
+        }
+
+        std::size_t lo = 0;
+        std::size_t hi = size - 1;
+        while ( hi - lo > 1 ) {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if ( time < first[static_cast<std::ptrdiff_t>(mid)] ) {
+                hi = mid;
+            } else {
+                lo = mid;
+            }
+        }
+        return lo;
+    }
+
+    // key_cursor
+
+    class key_cursor final {
+    public:
+        constexpr key_cursor() = default;
+        constexpr explicit key_cursor(std::size_t index)
+        : index_{index} {}
+
+        [[nodiscard]] constexpr std::size_t index() const noexcept {
+            return index_;
+        }
+
+        template < typename RandomIt, typename T >
+        constexpr std::size_t seek(RandomIt first, RandomIt last, T time) {
+            // playback usually stays in the same segment or steps to the next one
+            const auto size = static_cast<std::size_t>(last - first);
+            if ( size < 2 ) {
+                return index_ = 0;
+            }
+
+            if ( index_ + 1 < size ) {
+                if ( in_segment_(first, size, index_, time) ) {
+                    return index_;
+                }
+                if ( index_ + 2 < size && in_segment_(first, size, index_ + 1, time) ) {
+                    return ++index_;
+                }
+            }
+
+            return index_ = find_key(first, last, time);
+        }
+    private:
+        template < typename RandomIt, typename T >
+        [[nodiscard]] static constexpr bool in_segment_(RandomIt first, std::size_t size, std::size_t index, T time) {
+            return (index == 0 || !(time < first[static_cast<std::ptrdiff_t>(index)]))
+                && (index + 2 == size || time < first[static_cast<std::ptrdiff_t>(index + 1)]);
+        }
+    private:
+        std::size_t index_{0};
+    };
+}
+
+//
+// Key Sampling
+//
+
+namespace vmath_hpp
+{
+    enum class interpolation : unsigned char {
+        step,
+        linear,
+        cubic,
+    };
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename T >
+    struct curve_segment final {
+        std::size_t keys[4]{};
+        T weights[4]{};
+        T t{0};
+    };
+
+    template < typename TimeIt, typename T >
+    [[nodiscard]] constexpr curve_segment<T> make_curve_segment(TimeIt times, std::size_t size, std::size_t index, T time) {
+        curve_segment<T> s;
+
+        if ( size < 2 ) {
+            // a single key: every mode returns it
+            s.weights[1] = T{1};
+            return s;
+        }
+
+        const std::size_t i0 = index > 0 ? index - 1 : index;
+        const std::size_t i1 = index;
+        const std::size_t i2 = index + 1;
+        const std::size_t i3 = index + 2 < size ? index + 2 : index + 1;
+
+        const T t0 = times[static_cast<std::ptrdiff_t>(i0)];
+        const T t1 = times[static_cast<std::ptrdiff_t>(i1)];
+        const T t2 = times[static_cast<std::ptrdiff_t>(i2)];
+        const T t3 = times[static_cast<std::ptrdiff_t>(i3)];
+
+        const T h = t2 - t1;
+        const T t = h > T{0} ? saturate((time - t1) / h) : T{1};
+
+        // non-uniform Catmull-Rom: m1 = (p2 - p0) * s1 and m2 = (p3 - p1) * s2,
+        // the hermite basis is then folded into one weight per key
+        const T s1 = t2 > t0 ? h / (t2 - t0) : T{0};
+        const T s2 = t3 > t1 ? h / (t3 - t1) : T{0};
+
+        const T tt = t * t;
+        const T ttt = tt * t;
+        const T h00 = T{2} * ttt - T{3} * tt + T{1};
+        const T h10 = ttt - T{2} * tt + t;
+        const T h01 = T{3} * tt - T{2} * ttt;
+        const T h11 = ttt - tt;
+
+        s.keys[0] = i0;
+        s.keys[1] = i1;
+        s.keys[2] = i2;
+        s.keys[3] = i3;
+
+        s.weights[0] = -h10 * s1;
+        s.weights[1] = h00 - h11 * s2;
+        s.weights[2] = h10 * s1 + h01;
+        s.weights[3] = h11 * s2;
+
+        s.t = t;
+        return s;
+    }
+
+    template < typename V, typename T >
+    [[nodiscard]] constexpr V curve_sample(
+        const curve_segment<T>& s,
+        const V& p0, const V& p1, const V& p2, const V& p3,
+        interpolation mode)
+    {
+        switch ( mode ) {
+            case interpolation::step:
+                return s.t < T{1} ? p1 : p2;
+            case interpolation::linear:
+                return lerp(p1, p2, s.t);
+            case interpolation::cubic:
+                break;
+        }
+        return p0 * s.weights[0] + p1 * s.weights[1] + p2 * s.weights[2] + p3 * s.weights[3];
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> curve_sample(
+        const curve_segment<T>& s,
+        const qua<T>& p0, const qua<T>& p1, const qua<T>& p2, const qua<T>& p3,
+        interpolation mode)
+    {
+        switch ( mode ) {
+            case interpolation::step:
+                return s.t < T{1} ? p1 : p2;
+            case interpolation::linear:
+                return slerp(p1, p2, s.t);
+            case interpolation::cubic:
+                break;
+        }
+        const qua<T> q2 = dot(p1, p2) < T{0} ? -p2 : p2;
+        return squad(p1, q2, squad_control(p0, p1, q2), squad_control(p1, q2, p3), s.t);
+    }
+}
+
+namespace vmath_hpp
+{
+    // sample
+
+    template < typename TimeIt, typename ValueIt, typename T
+             , typename V = typename std::iterator_traits<ValueIt>::value_type >
+    [[nodiscard]] constexpr V sample(
+        TimeIt t_first, TimeIt t_last, ValueIt v_first, T time,
+        key_cursor& cursor, interpolation mode = interpolation::linear)
+    {
+        // precondition: the key times are sorted and the track is not empty
+        const auto size = static_cast<std::size_t>(t_last - t_first);
+        const impl::curve_segment<T> s = impl::make_curve_segment(
+            t_first, size, cursor.seek(t_first, t_last, time), time);
+        return impl::curve_sample(s,
+            v_first[static_cast<std::ptrdiff_t>(s.keys[0])],
+            v_first[static_cast<std::ptrdiff_t>(s.keys[1])],
+            v_first[static_cast<std::ptrdiff_t>(s.keys[2])],
+            v_first[static_cast<std::ptrdiff_t>(s.keys[3])],
+            mode);
+    }
+
+    template < typename TimeIt, typename ValueIt, typename T
+             , typename V = typename std::iterator_traits<ValueIt>::value_type >
+    [[nodiscard]] constexpr V sample(
+        TimeIt t_first, TimeIt t_last, ValueIt v_first, T time,
+        interpolation mode = interpolation::linear)
+    {
+        key_cursor cursor;
+        return sample(t_first, t_last, v_first, time, cursor, mode);
+    }
+
+    // sample_tracks
+
+    template < typename TimeIt, typename ValueIt, typename OutputIt, typename T >
+    constexpr OutputIt sample_tracks(
+        TimeIt t_first, TimeIt t_last, ValueIt v_first, std::size_t track_count, T time,
+        OutputIt d_first, key_cursor& cursor, interpolation mode = interpolation::linear)
+    {
+        // tracks sharing key times, values are stored key by key: v_first[key * track_count + track],
+        // the segment and its weights are computed once for all tracks
+        const auto size = static_cast<std::size_t>(t_last - t_first);
+        const impl::curve_segment<T> s = impl::make_curve_segment(
+            t_first, size, cursor.seek(t_first, t_last, time), time);
+
+        const ValueIt k0 = v_first + static_cast<std::ptrdiff_t>(s.keys[0] * track_count);
+        const ValueIt k1 = v_first + static_cast<std::ptrdiff_t>(s.keys[1] * track_count);
+        const ValueIt k2 = v_first + static_cast<std::ptrdiff_t>(s.keys[2] * track_count);
+        const ValueIt k3 = v_first + static_cast<std::ptrdiff_t>(s.keys[3] * track_count);
+
+        for ( std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(track_count); ++i, ++d_first ) {
+            *d_first = impl::curve_sample(s, k0[i], k1[i], k2[i], k3[i], mode);
+        }
+        return d_first;
+    }
+
+    template < typename TimeIt, typename ValueIt, typename OutputIt, typename T >
+    constexpr OutputIt sample_tracks(
+        TimeIt t_first, TimeIt t_last, ValueIt v_first, std::size_t track_count, T time,
+        OutputIt d_first, interpolation mode = interpolation::linear)
+    {
+        key_cursor cursor;
+        return sample_tracks(t_first, t_last, v_first, track_count, time, d_first, cursor, mode);
+    }
+}
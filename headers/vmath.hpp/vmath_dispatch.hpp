@@ -0,0 +1,1171 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_ext.hpp"
+#include "vmath_mat_fun.hpp"
+#include "vmath_qua_fun.hpp"
+#include "vmath_vec_fun.hpp"
+
+#include <atomic>
+#include <limits>
+#include <string_view>
+
+#if (defined(__clang__) || defined(__GNUC__)) && (defined(__x86_64__) || defined(__i386__))
+#  define VMATH_HPP_DISPATCH_X86
+#  define VMATH_HPP_TARGET_AVX2 __attribute__((__target__("avx2,fma")))
+#  define VMATH_HPP_TARGET_AVX512 __attribute__((__target__("avx512f,avx512vl,avx2,fma")))
+#endif
+
+#if defined(VMATH_HPP_DISPATCH_X86) && defined(__x86_64__)
+#  define VMATH_HPP_DISPATCH_BMI2
+#  define VMATH_HPP_TARGET_BMI2 __attribute__((__target__("bmi2")))
+#endif
+
+// the variants with fma would fuse multiplies and adds and round differently,
+// contraction is turned off so every level gives the same bits: clang decides it
+// per expression and gets a pragma in every kernel, gcc decides it per function
+// after inlining and gets the option for every function of the kernels section.
+// the pragmas cover only the code of the kernels, so the kernels use no library
+// function that multiplies and adds unless it's forced inline: an out of line
+// one is compiled with the options of the translation unit and may be fused.
+// msvc has no runtime dispatch, every call runs the same baseline kernel
+
+#if defined(__clang__)
+#  define VMATH_HPP_NO_CONTRACT _Pragma("clang fp contract(off)")
+#else
+#  define VMATH_HPP_NO_CONTRACT
+#endif
+
+//
+// Runtime Dispatch
+//
+
+namespace vmath_hpp
+{
+    // baseline is whatever the translation unit is compiled for
+    enum class simd_level : unsigned char {
+        baseline,
+        avx2,
+        avx512,
+    };
+}
+
+namespace vmath_hpp::impl
+{
+    [[nodiscard]] inline simd_level detect_simd_level() noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") ) {
+            return simd_level::avx512;
+        }
+        if ( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ) {
+            return simd_level::avx2;
+        }
+    #endif
+        return simd_level::baseline;
+    }
+
+    [[nodiscard]] inline simd_level clamp_simd_level(simd_level level, simd_level supported) noexcept {
+        return level < supported ? level : supported;
+    }
+
+    [[nodiscard]] inline simd_level startup_simd_level(simd_level supported) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        // VMATH_HPP_SIMD=baseline|avx2|avx512 lowers the level, e.g. for testing
+        if ( const char* env = std::getenv("VMATH_HPP_SIMD") ) {
+            const std::string_view name{env};
+            if ( name == "baseline" ) {
+                return simd_level::baseline;
+            }
+            if ( name == "avx2" ) {
+                return clamp_simd_level(simd_level::avx2, supported);
+            }
+        }
+    #endif
+        return supported;
+    }
+
+    // -1 when not forced
+    inline std::atomic<int> forced_simd_level{-1};
+}
+
+namespace vmath_hpp
+{
+    [[nodiscard]] inline simd_level supported_simd_level() noexcept {
+        static const simd_level level = impl::detect_simd_level();
+        return level;
+    }
+
+    [[nodiscard]] inline simd_level current_simd_level() noexcept {
+        if ( const int forced = impl::forced_simd_level.load(std::memory_order_relaxed); forced >= 0 ) {
+            return static_cast<simd_level>(forced);
+        }
+        static const simd_level level = impl::startup_simd_level(supported_simd_level());
+        return level;
+    }
+
+    inline void force_simd_level(simd_level level) noexcept {
+        const simd_level clamped = impl::clamp_simd_level(level, supported_simd_level());
+        impl::forced_simd_level.store(static_cast<int>(clamped), std::memory_order_relaxed);
+    }
+
+    inline void reset_simd_level() noexcept {
+        impl::forced_simd_level.store(-1, std::memory_order_relaxed);
+    }
+}
+
+//
+// Dispatched Kernels
+//
+
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC push_options
+#  pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace vmath_hpp::impl
+{
+    // the kernels are plain loops, every variant is the same code
+    // compiled for a different instruction set and auto-vectorized
+
+    template < typename T, std::size_t Size >
+    VMATH_HPP_FORCE_INLINE
+    void multiply_n_kernel(const vec<T, Size>* xs, std::size_t n, const mat<T, Size>& m, vec<T, Size>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        const mat<T, Size> mm = m;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            out[i] = mul_impl(xs[i], mm);
+        }
+    }
+
+    template < typename T, std::size_t Size >
+    VMATH_HPP_FORCE_INLINE
+    void multiply_n_kernel(const mat<T, Size>* xs, std::size_t n, const mat<T, Size>& m, mat<T, Size>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        const mat<T, Size> mm = m;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            const mat<T, Size> x = xs[i];
+            for ( std::size_t r = 0; r < Size; ++r ) {
+                out[i][r] = mul_impl(x[r], mm);
+            }
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    T dot_n_kernel(const T* xs, const T* ys, std::size_t n) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        // fixed lanes and no contraction: the result doesn't depend on the instruction set
+        constexpr std::size_t lanes = 16;
+        T acc[lanes]{};
+        std::size_t i = 0;
+        for ( ; i + lanes <= n; i += lanes ) {
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                acc[j] += xs[i + j] * ys[i + j];
+            }
+        }
+        for ( std::size_t j = 0; i < n; ++i, ++j ) {
+            acc[j] += xs[i] * ys[i];
+        }
+        T r{0};
+        for ( std::size_t j = 0; j < lanes; ++j ) {
+            r += acc[j];
+        }
+        return r;
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void inverse_n_kernel(const mat<T, 4>* xs, std::size_t n, mat<T, 4>* out, T* dets) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        // one matrix at a time, up to avx2 this is faster than the blocked kernel,
+        // the transposition into lanes costs more than the wider loop wins back
+        for ( std::size_t i = 0; i < n; ++i ) {
+            const mat<T, 4> m = xs[i];
+            const mat<T, 4> adj = adjugate_4(m);
+            const T det = determinant_from_adjugate_4(m, adj);
+            const T inv_det = rcp(det);
+            if ( abs(inv_det) <= std::numeric_limits<T>::max() ) {
+                out[i] = adj * inv_det;
+                if ( dets ) {
+                    dets[i] = det;
+                }
+            } else {
+                out[i] = mat<T, 4>{zero_init};
+                if ( dets ) {
+                    dets[i] = T{0};
+                }
+            }
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void inverse_n_blocked_kernel(const mat<T, 4>* xs, std::size_t n, mat<T, 4>* out, T* dets) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        // blocks of matrices are transposed into local arrays, one array per element,
+        // so the inversion loop has no aliasing to check and runs over whole registers
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T ms[16][lanes];
+            if ( w == lanes ) {
+                for ( std::size_t j = 0; j < lanes; ++j ) {
+                    for ( std::size_t e = 0; e < 16; ++e ) {
+                        ms[e][j] = xs[i + j][e / 4][e % 4];
+                    }
+                }
+            } else {
+                // the tail block is padded with identities
+                for ( std::size_t j = 0; j < lanes; ++j ) {
+                    const mat<T, 4> m = j < w ? xs[i + j] : mat<T, 4>{};
+                    for ( std::size_t e = 0; e < 16; ++e ) {
+                        ms[e][j] = m[e / 4][e % 4];
+                    }
+                }
+            }
+
+            T rs[16][lanes];
+            T ds[lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const mat<T, 4> m{
+                    ms[ 0][j], ms[ 1][j], ms[ 2][j], ms[ 3][j],
+                    ms[ 4][j], ms[ 5][j], ms[ 6][j], ms[ 7][j],
+                    ms[ 8][j], ms[ 9][j], ms[10][j], ms[11][j],
+                    ms[12][j], ms[13][j], ms[14][j], ms[15][j]};
+                const mat<T, 4> adj = adjugate_4(m);
+                const T det = determinant_from_adjugate_4(m, adj);
+
+                // the division has to be unconditional, a guarded one
+                // stays a branch and the loop isn't vectorized
+                const T inv_det = rcp(det);
+                const bool regular = abs(inv_det) <= std::numeric_limits<T>::max();
+                const T scale = regular ? inv_det : T{0};
+                for ( std::size_t e = 0; e < 16; ++e ) {
+                    rs[e][j] = adj[e / 4][e % 4] * scale;
+                }
+                ds[j] = regular ? det : T{0};
+            }
+
+            for ( std::size_t j = 0; j < w; ++j ) {
+                for ( std::size_t e = 0; e < 16; ++e ) {
+                    out[i + j][e / 4][e % 4] = rs[e][j];
+                }
+            }
+            if ( dets ) {
+                for ( std::size_t j = 0; j < w; ++j ) {
+                    dets[i + j] = ds[j];
+                }
+            }
+        }
+    }
+
+    template < typename T, std::size_t Lanes >
+    VMATH_HPP_FORCE_INLINE
+    void store_lanes_4(const T (&xs)[16][Lanes], std::size_t n, mat<T, 4>* out) noexcept {
+        // transposes the first n lanes back to matrices, whole rows at a time
+        if ( !out ) {
+            return;
+        }
+        for ( std::size_t j = 0; j < n; ++j ) {
+            out[j] = mat<T, 4>{
+                xs[ 0][j], xs[ 1][j], xs[ 2][j], xs[ 3][j],
+                xs[ 4][j], xs[ 5][j], xs[ 6][j], xs[ 7][j],
+                xs[ 8][j], xs[ 9][j], xs[10][j], xs[11][j],
+                xs[12][j], xs[13][j], xs[14][j], xs[15][j]};
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void cameras_n_kernel(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n,
+        T hand, T sz, T tz,
+        mat<T, 4>* views, mat<T, 4>* projs, mat<T, 4>* view_projs) noexcept
+    {
+        VMATH_HPP_NO_CONTRACT
+        // the same matrices as look_at and perspective_fov, the handedness only flips
+        // the forward axis and the w row, the depth row is the same for every camera
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            // the tail block is padded with a valid camera
+            T ex[lanes], ey[lanes], ez[lanes];
+            T fx[lanes], fy[lanes], fz[lanes];
+            T ux[lanes], uy[lanes], uz[lanes];
+            T ts[lanes], rs[lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const bool live = j < w;
+                const vec<T, 3> e = live ? eyes[i + j] : vec<T, 3>{T{0}};
+                const vec<T, 3> f = live ? ats[i + j] - e : vec<T, 3>{T{0}, T{0}, T{1}};
+                const vec<T, 3> u = live ? ups[i + j] : vec<T, 3>{T{0}, T{1}, T{0}};
+                ex[j] = e.x; ey[j] = e.y; ez[j] = e.z;
+                fx[j] = f.x * hand; fy[j] = f.y * hand; fz[j] = f.z * hand;
+                ux[j] = u.x; uy[j] = u.y; uz[j] = u.z;
+                ts[j] = live ? fovys[i + j] : T{1};
+                rs[j] = live ? aspects[i + j] : T{1};
+            }
+
+            // libm calls and the square roots keep their error handling branches,
+            // so they get their own short loops and the others are vectorized
+
+            T ls[lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                ts[j] = tan(ts[j] * T{0.5f});
+                ls[j] = sqrt(fx[j] * fx[j] + fy[j] * fy[j] + fz[j] * fz[j]);
+            }
+
+            T zx[lanes], zy[lanes], zz[lanes];
+            T xx[lanes], xy[lanes], xz[lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const T rl = rcp(ls[j]);
+                zx[j] = fx[j] * rl;
+                zy[j] = fy[j] * rl;
+                zz[j] = fz[j] * rl;
+                xx[j] = uy[j] * zz[j] - uz[j] * zy[j];
+                xy[j] = uz[j] * zx[j] - ux[j] * zz[j];
+                xz[j] = ux[j] * zy[j] - uy[j] * zx[j];
+            }
+
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                ls[j] = sqrt(xx[j] * xx[j] + xy[j] * xy[j] + xz[j] * xz[j]);
+            }
+
+            T vs[16][lanes];
+            T ps[16][lanes];
+            T vps[16][lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const T rl = rcp(ls[j]);
+                const T ax = xx[j] * rl;
+                const T ay = xy[j] * rl;
+                const T az = xz[j] * rl;
+                const T bx = zy[j] * az - zz[j] * ay;
+                const T by = zz[j] * ax - zx[j] * az;
+                const T bz = zx[j] * ay - zy[j] * ax;
+                const T dx = -(ax * ex[j] + ay * ey[j] + az * ez[j]);
+                const T dy = -(bx * ex[j] + by * ey[j] + bz * ez[j]);
+                const T dz = -(zx[j] * ex[j] + zy[j] * ey[j] + zz[j] * ez[j]);
+
+                vs[ 0][j] = ax; vs[ 1][j] = bx; vs[ 2][j] = zx[j]; vs[ 3][j] = T{0};
+                vs[ 4][j] = ay; vs[ 5][j] = by; vs[ 6][j] = zy[j]; vs[ 7][j] = T{0};
+                vs[ 8][j] = az; vs[ 9][j] = bz; vs[10][j] = zz[j]; vs[11][j] = T{0};
+                vs[12][j] = dx; vs[13][j] = dy; vs[14][j] = dz;    vs[15][j] = T{1};
+
+                const T sy = rcp(ts[j]);
+                const T sx = sy * rcp(rs[j]);
+
+                ps[ 0][j] = sx;   ps[ 1][j] = T{0}; ps[ 2][j] = T{0}; ps[ 3][j] = T{0};
+                ps[ 4][j] = T{0}; ps[ 5][j] = sy;   ps[ 6][j] = T{0}; ps[ 7][j] = T{0};
+                ps[ 8][j] = T{0}; ps[ 9][j] = T{0}; ps[10][j] = sz;   ps[11][j] = hand;
+                ps[12][j] = T{0}; ps[13][j] = T{0}; ps[14][j] = tz;   ps[15][j] = T{0};
+
+                // the projection is sparse, a row of view * proj
+                // is (a * sx, b * sy, c * sz + d * tz, c * hand)
+                vps[ 0][j] = ax * sx; vps[ 1][j] = bx * sy; vps[ 2][j] = zx[j] * sz; vps[ 3][j] = zx[j] * hand;
+                vps[ 4][j] = ay * sx; vps[ 5][j] = by * sy; vps[ 6][j] = zy[j] * sz; vps[ 7][j] = zy[j] * hand;
+                vps[ 8][j] = az * sx; vps[ 9][j] = bz * sy; vps[10][j] = zz[j] * sz; vps[11][j] = zz[j] * hand;
+                vps[12][j] = dx * sx; vps[13][j] = dy * sy; vps[14][j] = dz * sz + tz; vps[15][j] = dz * hand;
+            }
+
+            store_lanes_4(vs, w, views ? views + i : nullptr);
+            store_lanes_4(ps, w, projs ? projs + i : nullptr);
+            store_lanes_4(vps, w, view_projs ? view_projs + i : nullptr);
+        }
+    }
+
+    template < typename T, std::size_t Lanes >
+    VMATH_HPP_FORCE_INLINE
+    void load_lanes(const vec<T, 3>* xs, std::size_t n, const vec<T, 3>& pad, T (&ps)[3][Lanes]) noexcept {
+        // transposes the first n lanes from vectors, the rest is padded, a whole
+        // block gets its own branch-free loop, the guarded one isn't vectorized
+        if ( n == Lanes ) {
+            for ( std::size_t j = 0; j < Lanes; ++j ) {
+                ps[0][j] = xs[j].x;
+                ps[1][j] = xs[j].y;
+                ps[2][j] = xs[j].z;
+            }
+        } else {
+            for ( std::size_t j = 0; j < Lanes; ++j ) {
+                const vec<T, 3> p = j < n ? xs[j] : pad;
+                ps[0][j] = p.x;
+                ps[1][j] = p.y;
+                ps[2][j] = p.z;
+            }
+        }
+    }
+
+    template < typename T, std::size_t Lanes >
+    VMATH_HPP_FORCE_INLINE
+    void load_lanes(const qua<T>* qs, std::size_t n, const qua<T>& pad, T (&ps)[4][Lanes]) noexcept {
+        if ( n == Lanes ) {
+            for ( std::size_t j = 0; j < Lanes; ++j ) {
+                ps[0][j] = qs[j].v.x;
+                ps[1][j] = qs[j].v.y;
+                ps[2][j] = qs[j].v.z;
+                ps[3][j] = qs[j].s;
+            }
+        } else {
+            for ( std::size_t j = 0; j < Lanes; ++j ) {
+                const qua<T> q = j < n ? qs[j] : pad;
+                ps[0][j] = q.v.x;
+                ps[1][j] = q.v.y;
+                ps[2][j] = q.v.z;
+                ps[3][j] = q.s;
+            }
+        }
+    }
+
+    template < typename T, std::size_t Lanes >
+    VMATH_HPP_FORCE_INLINE
+    void store_lanes(const T (&rs)[3][Lanes], std::size_t n, vec<T, 3>* out) noexcept {
+        if ( n == Lanes ) {
+            for ( std::size_t j = 0; j < Lanes; ++j ) {
+                out[j] = vec<T, 3>{rs[0][j], rs[1][j], rs[2][j]};
+            }
+        } else {
+            for ( std::size_t j = 0; j < n; ++j ) {
+                out[j] = vec<T, 3>{rs[0][j], rs[1][j], rs[2][j]};
+            }
+        }
+    }
+
+    template < typename T, std::size_t Lanes >
+    VMATH_HPP_FORCE_INLINE
+    void store_lanes(const T (&rs)[4][Lanes], std::size_t n, qua<T>* out) noexcept {
+        if ( n == Lanes ) {
+            for ( std::size_t j = 0; j < Lanes; ++j ) {
+                out[j] = qua<T>{rs[0][j], rs[1][j], rs[2][j], rs[3][j]};
+            }
+        } else {
+            for ( std::size_t j = 0; j < n; ++j ) {
+                out[j] = qua<T>{rs[0][j], rs[1][j], rs[2][j], rs[3][j]};
+            }
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void unproject_n_kernel(const vec<T, 3>* xs, std::size_t n, const mat<T, 4>& m, vec<T, 3>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        // blocks are loaded into local arrays first, so out may be xs
+        constexpr std::size_t lanes = 16;
+        const mat<T, 4> mm = m;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T ps[3][lanes];
+            load_lanes(xs + i, w, vec<T, 3>{T{0}}, ps);
+
+            T rs[3][lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const vec<T, 4> p = ps[0][j] * mm[0] + ps[1][j] * mm[1] + ps[2][j] * mm[2] + mm[3];
+                const T rw = rcp(p.w);
+                rs[0][j] = p.x * rw;
+                rs[1][j] = p.y * rw;
+                rs[2][j] = p.z * rw;
+            }
+
+            store_lanes(rs, w, out + i);
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void rotate_n_kernel(const vec<T, 3>* xs, std::size_t n, const mat<T, 3>& m, vec<T, 3>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        // one rotation for the whole range, already converted to a matrix
+        constexpr std::size_t lanes = 16;
+        const mat<T, 3> mm = m;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T ps[3][lanes];
+            load_lanes(xs + i, w, vec<T, 3>{T{0}}, ps);
+
+            T rs[3][lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const vec<T, 3> p = ps[0][j] * mm[0] + ps[1][j] * mm[1] + ps[2][j] * mm[2];
+                rs[0][j] = p.x;
+                rs[1][j] = p.y;
+                rs[2][j] = p.z;
+            }
+
+            store_lanes(rs, w, out + i);
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void rotate_n_kernel(const vec<T, 3>* xs, const qua<T>* qs, std::size_t n, vec<T, 3>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        // a rotation per vector, v * q in lanes: no matrix would pay for itself
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T ps[3][lanes];
+            T qs4[4][lanes];
+            load_lanes(xs + i, w, vec<T, 3>{T{0}}, ps);
+            load_lanes(qs + i, w, qua<T>{}, qs4);
+
+            T rs[3][lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                // the crosses are written out, an out of line cross may be fused
+                const T qx = qs4[0][j];
+                const T qy = qs4[1][j];
+                const T qz = qs4[2][j];
+                const T tx = (qy * ps[2][j] - qz * ps[1][j]) * T{2};
+                const T ty = (qz * ps[0][j] - qx * ps[2][j]) * T{2};
+                const T tz = (qx * ps[1][j] - qy * ps[0][j]) * T{2};
+                rs[0][j] = ps[0][j] + tx * qs4[3][j] + (qy * tz - qz * ty);
+                rs[1][j] = ps[1][j] + ty * qs4[3][j] + (qz * tx - qx * tz);
+                rs[2][j] = ps[2][j] + tz * qs4[3][j] + (qx * ty - qy * tx);
+            }
+
+            store_lanes(rs, w, out + i);
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void multiply_n_kernel(const qua<T>* xs, const qua<T>* ys, std::size_t n, qua<T>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T as[4][lanes];
+            T bs[4][lanes];
+            load_lanes(xs + i, w, qua<T>{}, as);
+            load_lanes(ys + i, w, qua<T>{}, bs);
+
+            T rs[4][lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                // the same operations in the same order as qua * qua:
+                // cross(ys.v, xs.v) + ys.s * xs.v + xs.s * ys.v, ys.s * xs.s - dot(ys.v, xs.v)
+                const T cx = bs[1][j] * as[2][j] - bs[2][j] * as[1][j];
+                const T cy = bs[2][j] * as[0][j] - bs[0][j] * as[2][j];
+                const T cz = bs[0][j] * as[1][j] - bs[1][j] * as[0][j];
+                rs[0][j] = cx + bs[3][j] * as[0][j] + as[3][j] * bs[0][j];
+                rs[1][j] = cy + bs[3][j] * as[1][j] + as[3][j] * bs[1][j];
+                rs[2][j] = cz + bs[3][j] * as[2][j] + as[3][j] * bs[2][j];
+                rs[3][j] = bs[3][j] * as[3][j] - (bs[0][j] * as[0][j] + bs[1][j] * as[1][j] + bs[2][j] * as[2][j]);
+            }
+
+            store_lanes(rs, w, out + i);
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void conjugate_n_kernel(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            out[i] = conjugate(qs[i]);
+        }
+    }
+
+    template < typename T >
+    VMATH_HPP_FORCE_INLINE
+    void inverse_n_kernel(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+        VMATH_HPP_NO_CONTRACT
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T ps[4][lanes];
+            load_lanes(qs + i, w, qua<T>{}, ps);
+
+            T rs[4][lanes];
+            for ( std::size_t j = 0; j < lanes; ++j ) {
+                const T rl2 = rcp(ps[0][j] * ps[0][j] + ps[1][j] * ps[1][j] + ps[2][j] * ps[2][j] + ps[3][j] * ps[3][j]);
+                rs[0][j] = -ps[0][j] * rl2;
+                rs[1][j] = -ps[1][j] * rl2;
+                rs[2][j] = -ps[2][j] * rl2;
+                rs[3][j] = ps[3][j] * rl2;
+            }
+
+            store_lanes(rs, w, out + i);
+        }
+    }
+
+#if defined(VMATH_HPP_DISPATCH_X86)
+    template < typename X, typename T, std::size_t Size >
+    VMATH_HPP_TARGET_AVX2
+    void multiply_n_avx2(const X* xs, std::size_t n, const mat<T, Size>& m, X* out) noexcept {
+        multiply_n_kernel(xs, n, m, out);
+    }
+
+    template < typename X, typename T, std::size_t Size >
+    VMATH_HPP_TARGET_AVX512
+    void multiply_n_avx512(const X* xs, std::size_t n, const mat<T, Size>& m, X* out) noexcept {
+        multiply_n_kernel(xs, n, m, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void inverse_n_avx512(const mat<T, 4>* xs, std::size_t n, mat<T, 4>* out, T* dets) noexcept {
+        inverse_n_blocked_kernel(xs, n, out, dets);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    T dot_n_avx2(const T* xs, const T* ys, std::size_t n) noexcept {
+        return dot_n_kernel(xs, ys, n);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    T dot_n_avx512(const T* xs, const T* ys, std::size_t n) noexcept {
+        return dot_n_kernel(xs, ys, n);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void unproject_n_avx2(const vec<T, 3>* xs, std::size_t n, const mat<T, 4>& m, vec<T, 3>* out) noexcept {
+        unproject_n_kernel(xs, n, m, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void unproject_n_avx512(const vec<T, 3>* xs, std::size_t n, const mat<T, 4>& m, vec<T, 3>* out) noexcept {
+        unproject_n_kernel(xs, n, m, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void rotate_n_avx2(const vec<T, 3>* xs, std::size_t n, const mat<T, 3>& m, vec<T, 3>* out) noexcept {
+        rotate_n_kernel(xs, n, m, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void rotate_n_avx512(const vec<T, 3>* xs, std::size_t n, const mat<T, 3>& m, vec<T, 3>* out) noexcept {
+        rotate_n_kernel(xs, n, m, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void rotate_n_avx2(const vec<T, 3>* xs, const qua<T>* qs, std::size_t n, vec<T, 3>* out) noexcept {
+        rotate_n_kernel(xs, qs, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void rotate_n_avx512(const vec<T, 3>* xs, const qua<T>* qs, std::size_t n, vec<T, 3>* out) noexcept {
+        rotate_n_kernel(xs, qs, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void multiply_n_avx2(const qua<T>* xs, const qua<T>* ys, std::size_t n, qua<T>* out) noexcept {
+        multiply_n_kernel(xs, ys, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void multiply_n_avx512(const qua<T>* xs, const qua<T>* ys, std::size_t n, qua<T>* out) noexcept {
+        multiply_n_kernel(xs, ys, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void conjugate_n_avx2(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+        conjugate_n_kernel(qs, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void conjugate_n_avx512(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+        conjugate_n_kernel(qs, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void inverse_n_avx2(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+        inverse_n_kernel(qs, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void inverse_n_avx512(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+        inverse_n_kernel(qs, n, out);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX2
+    void cameras_n_avx2(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n,
+        T hand, T sz, T tz,
+        mat<T, 4>* views, mat<T, 4>* projs, mat<T, 4>* view_projs) noexcept
+    {
+        cameras_n_kernel(eyes, ats, ups, fovys, aspects, n, hand, sz, tz, views, projs, view_projs);
+    }
+
+    template < typename T >
+    VMATH_HPP_TARGET_AVX512
+    void cameras_n_avx512(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n,
+        T hand, T sz, T tz,
+        mat<T, 4>* views, mat<T, 4>* projs, mat<T, 4>* view_projs) noexcept
+    {
+        cameras_n_kernel(eyes, ats, ups, fovys, aspects, n, hand, sz, tz, views, projs, view_projs);
+    }
+#endif
+}
+
+namespace vmath_hpp
+{
+    // multiply_n
+
+    template < typename T, std::size_t Size >
+    void multiply_n(const vec<T, Size>* xs, std::size_t n, const mat<T, Size>& m, vec<T, Size>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::multiply_n_avx512(xs, n, m, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::multiply_n_avx2(xs, n, m, out);
+        }
+    #endif
+        return impl::multiply_n_kernel(xs, n, m, out);
+    }
+
+    template < typename T, std::size_t Size >
+    void multiply_n(const mat<T, Size>* xs, std::size_t n, const mat<T, Size>& m, mat<T, Size>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::multiply_n_avx512(xs, n, m, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::multiply_n_avx2(xs, n, m, out);
+        }
+    #endif
+        return impl::multiply_n_kernel(xs, n, m, out);
+    }
+
+    // inverse_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    inverse_n(const mat<T, 4>* xs, std::size_t n, mat<T, 4>* out, T* dets = nullptr) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::inverse_n_avx512(xs, n, out, dets);
+        }
+    #endif
+        return impl::inverse_n_kernel(xs, n, out, dets);
+    }
+
+    // unproject_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    unproject_n(const vec<T, 3>* xs, std::size_t n, const mat<T, 4>& inv_view_proj, vec<T, 3>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::unproject_n_avx512(xs, n, inv_view_proj, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::unproject_n_avx2(xs, n, inv_view_proj, out);
+        }
+    #endif
+        return impl::unproject_n_kernel(xs, n, inv_view_proj, out);
+    }
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    unproject_n(const vec<T, 3>* xs, std::size_t n, const mat<T, 4>& inv_view_proj, const vec<T, 4>& viewport, vec<T, 3>* out) noexcept {
+        unproject_n(xs, n, window_to_ndc(viewport) * inv_view_proj, out);
+    }
+
+    // multiply_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    multiply_n(const qua<T>* xs, const qua<T>* ys, std::size_t n, qua<T>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::multiply_n_avx512(xs, ys, n, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::multiply_n_avx2(xs, ys, n, out);
+        }
+    #endif
+        return impl::multiply_n_kernel(xs, ys, n, out);
+    }
+
+    // conjugate_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    conjugate_n(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::conjugate_n_avx512(qs, n, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::conjugate_n_avx2(qs, n, out);
+        }
+    #endif
+        return impl::conjugate_n_kernel(qs, n, out);
+    }
+
+    // inverse_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    inverse_n(const qua<T>* qs, std::size_t n, qua<T>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::inverse_n_avx512(qs, n, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::inverse_n_avx2(qs, n, out);
+        }
+    #endif
+        return impl::inverse_n_kernel(qs, n, out);
+    }
+
+    // rotate_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    rotate_n(const vec<T, 3>* xs, const qua<T>* qs, std::size_t n, vec<T, 3>* out) noexcept {
+        // out[i] = xs[i] * qs[i]
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::rotate_n_avx512(xs, qs, n, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::rotate_n_avx2(xs, qs, n, out);
+        }
+    #endif
+        return impl::rotate_n_kernel(xs, qs, n, out);
+    }
+
+    // dot_n
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<T>, T>
+    dot_n(const T* xs, const T* ys, std::size_t n) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return impl::dot_n_avx512(xs, ys, n);
+        }
+        if ( level == simd_level::avx2 ) {
+            return impl::dot_n_avx2(xs, ys, n);
+        }
+    #endif
+        return impl::dot_n_kernel(xs, ys, n);
+    }
+}
+
+namespace vmath_hpp::impl
+{
+    // keeps T deduced from the inputs, so null outputs can be passed as nullptr
+
+    template < typename X >
+    struct nondeduced { using type = X; };
+
+    template < typename X >
+    using nondeduced_t = typename nondeduced<X>::type;
+}
+
+namespace vmath_hpp::impl
+{
+    // cameras_n
+
+    template < typename T >
+    void cameras_n(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n,
+        T hand, T sz, T tz,
+        mat<T, 4>* views, mat<T, 4>* projs, mat<T, 4>* view_projs) noexcept
+    {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return cameras_n_avx512(eyes, ats, ups, fovys, aspects, n, hand, sz, tz, views, projs, view_projs);
+        }
+        if ( level == simd_level::avx2 ) {
+            return cameras_n_avx2(eyes, ats, ups, fovys, aspects, n, hand, sz, tz, views, projs, view_projs);
+        }
+    #endif
+        return cameras_n_kernel(eyes, ats, ups, fovys, aspects, n, hand, sz, tz, views, projs, view_projs);
+    }
+}
+
+namespace vmath_hpp
+{
+    // cameras_lh_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    cameras_lh_n(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n, T znear, T zfar,
+        impl::nondeduced_t<mat<T, 4>>* views,
+        impl::nondeduced_t<mat<T, 4>>* projs = nullptr,
+        impl::nondeduced_t<mat<T, 4>>* view_projs = nullptr) noexcept
+    {
+        // look_at_lh and perspective_fov_lh in one pass, any output may be null
+        const T sz = zfar * rcp(zfar - znear);
+        const T tz = (znear * zfar) * rcp(znear - zfar);
+        impl::cameras_n(eyes, ats, ups, fovys, aspects, n, T{1}, sz, tz, views, projs, view_projs);
+    }
+
+    // cameras_rh_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    cameras_rh_n(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n, T znear, T zfar,
+        impl::nondeduced_t<mat<T, 4>>* views,
+        impl::nondeduced_t<mat<T, 4>>* projs = nullptr,
+        impl::nondeduced_t<mat<T, 4>>* view_projs = nullptr) noexcept
+    {
+        const T sz = zfar * rcp(znear - zfar);
+        const T tz = (znear * zfar) * rcp(znear - zfar);
+        impl::cameras_n(eyes, ats, ups, fovys, aspects, n, -T{1}, sz, tz, views, projs, view_projs);
+    }
+
+    // cameras_infinite_reversed_lh_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    cameras_infinite_reversed_lh_n(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n, T znear,
+        impl::nondeduced_t<mat<T, 4>>* views,
+        impl::nondeduced_t<mat<T, 4>>* projs = nullptr,
+        impl::nondeduced_t<mat<T, 4>>* view_projs = nullptr) noexcept
+    {
+        // look_at_lh and perspective_fov_infinite_reversed_lh
+        impl::cameras_n(eyes, ats, ups, fovys, aspects, n, T{1}, T{0}, znear, views, projs, view_projs);
+    }
+
+    // cameras_infinite_reversed_rh_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    cameras_infinite_reversed_rh_n(
+        const vec<T, 3>* eyes, const vec<T, 3>* ats, const vec<T, 3>* ups,
+        const T* fovys, const T* aspects, std::size_t n, T znear,
+        impl::nondeduced_t<mat<T, 4>>* views,
+        impl::nondeduced_t<mat<T, 4>>* projs = nullptr,
+        impl::nondeduced_t<mat<T, 4>>* view_projs = nullptr) noexcept
+    {
+        impl::cameras_n(eyes, ats, ups, fovys, aspects, n, -T{1}, T{0}, znear, views, projs, view_projs);
+    }
+}
+
+namespace vmath_hpp::impl
+{
+    // a group shorter than this is rotated per vector, a longer one
+    // is worth converting its quaternion to a matrix first
+    inline constexpr std::size_t rotate_n_matrix_threshold = 16;
+
+    template < typename T >
+    void rotate_n(const vec<T, 3>* xs, std::size_t n, const mat<T, 3>& m, vec<T, 3>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_X86)
+        const simd_level level = current_simd_level();
+        if ( level == simd_level::avx512 ) {
+            return rotate_n_avx512(xs, n, m, out);
+        }
+        if ( level == simd_level::avx2 ) {
+            return rotate_n_avx2(xs, n, m, out);
+        }
+    #endif
+        return rotate_n_kernel(xs, n, m, out);
+    }
+}
+
+namespace vmath_hpp
+{
+    // rotate_n
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    rotate_n(const vec<T, 3>* xs, std::size_t n, const qua<T>& q, vec<T, 3>* out) noexcept {
+        // out[i] = xs[i] * q, the same result as the matrix of q
+        if ( n < impl::rotate_n_matrix_threshold ) {
+            for ( std::size_t i = 0; i < n; ++i ) {
+                out[i] = xs[i] * q;
+            }
+            return;
+        }
+        impl::rotate_n(xs, n, impl::qua_to_mat3(q), out);
+    }
+
+    template < typename T >
+    std::enable_if_t<std::is_floating_point_v<T>, void>
+    rotate_n(const vec<T, 3>* xs, std::size_t n, const qua<T>* qs, std::size_t group, vec<T, 3>* out) noexcept {
+        // out[i] = xs[i] * qs[i / group], e.g. every instance of a mesh rotated by its own quaternion,
+        // long groups go through a matrix per quaternion, short ones are rotated in lanes
+        if ( group == 0 ) {
+            return;
+        }
+
+        if ( group >= impl::rotate_n_matrix_threshold ) {
+            for ( std::size_t i = 0; i < n; i += group, ++qs ) {
+                const std::size_t w = n - i < group ? n - i : group;
+                impl::rotate_n(xs + i, w, impl::qua_to_mat3(*qs), out + i);
+            }
+            return;
+        }
+
+        if ( group == 1 ) {
+            return rotate_n(xs, qs, n, out);
+        }
+
+        // short groups: quaternions are repeated into a local block
+        constexpr std::size_t block = 256;
+        qua<T> rs[block];
+        for ( std::size_t i = 0; i < n; i += block ) {
+            const std::size_t w = n - i < block ? n - i : block;
+            for ( std::size_t j = 0; j < w; ++j ) {
+                rs[j] = qs[(i + j) / group];
+            }
+            rotate_n(xs + i, rs, w, out + i);
+        }
+    }
+}
+
+//
+// Morton Kernels
+//
+
+namespace vmath_hpp::impl
+{
+    template < typename Key, std::size_t Size >
+    inline constexpr Key morton_mask_v = Size == 2
+        ? static_cast<Key>(0x5555555555555555u)
+        : sizeof(Key) == sizeof(std::uint32_t)
+            ? static_cast<Key>(0x09249249u)
+            : static_cast<Key>(0x1249249249249249u);
+
+    template < typename Key, typename T, std::size_t Size >
+    void morton_encode_n_kernel(const vec<T, Size>* xs, std::size_t n, Key* out) noexcept {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            out[i] = morton_encode<Key>(xs[i]);
+        }
+    }
+
+    template < typename Key, std::size_t Size >
+    void morton_decode_n_kernel(const Key* keys, std::size_t n, vec<unsigned, Size>* out) noexcept {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            out[i] = morton_decode<Size>(keys[i]);
+        }
+    }
+
+#if defined(VMATH_HPP_DISPATCH_BMI2)
+    [[nodiscard]] inline bool supports_bmi2() noexcept {
+        static const bool supported = (__builtin_cpu_init(), __builtin_cpu_supports("bmi2"));
+        return supported;
+    }
+
+    template < typename Key >
+    [[nodiscard]] VMATH_HPP_TARGET_BMI2
+    inline Key pdep(Key x, Key mask) noexcept {
+        if constexpr ( sizeof(Key) == sizeof(std::uint32_t) ) {
+            return static_cast<Key>(__builtin_ia32_pdep_si(x, mask));
+        } else {
+            return static_cast<Key>(__builtin_ia32_pdep_di(x, mask));
+        }
+    }
+
+    template < typename Key >
+    [[nodiscard]] VMATH_HPP_TARGET_BMI2
+    inline Key pext(Key x, Key mask) noexcept {
+        if constexpr ( sizeof(Key) == sizeof(std::uint32_t) ) {
+            return static_cast<Key>(__builtin_ia32_pext_si(x, mask));
+        } else {
+            return static_cast<Key>(__builtin_ia32_pext_di(x, mask));
+        }
+    }
+
+    template < typename Key, typename T, std::size_t Size >
+    VMATH_HPP_TARGET_BMI2
+    void morton_encode_n_bmi2(const vec<T, Size>* xs, std::size_t n, Key* out) noexcept {
+        // pdep deposits the low bits of every component into its interleaved positions
+        constexpr Key mask = morton_mask_v<Key, Size>;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            Key key{0};
+            for ( std::size_t j = 0; j < Size; ++j ) {
+                key |= pdep(static_cast<Key>(xs[i][j]), static_cast<Key>(mask << j));
+            }
+            out[i] = key;
+        }
+    }
+
+    template < typename Key, std::size_t Size >
+    VMATH_HPP_TARGET_BMI2
+    void morton_decode_n_bmi2(const Key* keys, std::size_t n, vec<unsigned, Size>* out) noexcept {
+        constexpr Key mask = morton_mask_v<Key, Size>;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            vec<unsigned, Size> v{no_init};
+            for ( std::size_t j = 0; j < Size; ++j ) {
+                v[j] = static_cast<unsigned>(pext(keys[i], static_cast<Key>(mask << j)));
+            }
+            out[i] = v;
+        }
+    }
+#endif
+}
+
+namespace vmath_hpp
+{
+    // morton_encode_n
+
+    template < typename Key, typename T, std::size_t Size >
+    std::enable_if_t<detail::is_morton_key_v<Key> && std::is_unsigned_v<T> && (Size == 2 || Size == 3), void>
+    morton_encode_n(const vec<T, Size>* xs, std::size_t n, Key* out) noexcept {
+        // the same keys as morton_encode, with pdep from the avx2 level on,
+        // a forced baseline level takes the portable path
+    #if defined(VMATH_HPP_DISPATCH_BMI2)
+        if ( current_simd_level() != simd_level::baseline && impl::supports_bmi2() ) {
+            return impl::morton_encode_n_bmi2(xs, n, out);
+        }
+    #endif
+        return impl::morton_encode_n_kernel(xs, n, out);
+    }
+
+    // morton_decode_n
+
+    template < typename Key, std::size_t Size >
+    std::enable_if_t<detail::is_morton_key_v<Key> && (Size == 2 || Size == 3), void>
+    morton_decode_n(const Key* keys, std::size_t n, vec<unsigned, Size>* out) noexcept {
+    #if defined(VMATH_HPP_DISPATCH_BMI2)
+        if ( current_simd_level() != simd_level::baseline && impl::supports_bmi2() ) {
+            return impl::morton_decode_n_bmi2(keys, n, out);
+        }
+    #endif
+        return impl::morton_decode_n_kernel(keys, n, out);
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC pop_options
+#endif
@@ -8,11 +8,14 @@
 
 #include "vmath_fwd.hpp"
 
+#include "vmath_cast.hpp"
 #include "vmath_fun.hpp"
 #include "vmath_vec_fun.hpp"
 #include "vmath_mat_fun.hpp"
 #include "vmath_qua_fun.hpp"
 
+#include <tuple>
+
 //
 // Units
 //
@@ -55,89 +58,6 @@ namespace vmath_hpp
     template < typename T > inline constexpr qua<T> qidentity{identity_init};
 }
 
-//
-// Hash
-//
-
-namespace vmath_hpp::detail
-{
-    struct hash_combiner {
-        template < typename T >
-        [[nodiscard]] std::size_t operator()(std::size_t seed, const T& x) const noexcept {
-            return (seed ^= std::hash<T>{}(x) + 0x9e3779b9 + (seed << 6) + ( seed >> 2));
-        }
-    };
-
-    template < typename T, std::size_t Size >
-    [[nodiscard]] std::size_t hash(const vec<T, Size>& v) noexcept {
-        return fold_join(hash_combiner{}, std::size_t{}, v);
-    }
-
-    template < typename T, std::size_t Size >
-    [[nodiscard]] std::size_t hash(const mat<T, Size>& m) noexcept {
-        return fold_join(hash_combiner{}, std::size_t{}, m);
-    }
-
-    template < typename T >
-    [[nodiscard]] std::size_t hash(const qua<T>& q) noexcept {
-        return fold_join(hash_combiner{}, std::size_t{}, q);
-    }
-}
-
-namespace std
-{
-    template < typename T, size_t Size >
-    struct hash<vmath_hpp::vec<T, Size>> {
-        size_t operator()(const vmath_hpp::vec<T, Size>& v) const noexcept {
-            return vmath_hpp::detail::hash(v);
-        }
-    };
-
-    template < typename T, size_t Size >
-    struct hash<vmath_hpp::mat<T, Size>> {
-        size_t operator()(const vmath_hpp::mat<T, Size>& m) const noexcept {
-            return vmath_hpp::detail::hash(m);
-        }
-    };
-
-    template < typename T >
-    struct hash<vmath_hpp::qua<T>> {
-        size_t operator()(const vmath_hpp::qua<T>& q) const noexcept {
-            return vmath_hpp::detail::hash(q);
-        }
-    };
-}
-
-//
-// Cast
-//
-
-namespace vmath_hpp
-{
-    template < typename To, typename From >
-    [[nodiscard]] std::enable_if_t<
-        std::is_arithmetic_v<To> && std::is_arithmetic_v<From>
-    , To>
-    constexpr cast_to(From x) noexcept {
-        return static_cast<To>(x);
-    }
-
-    template < typename To, typename From, std::size_t Size >
-    [[nodiscard]] constexpr vec<To, Size> cast_to(const vec<From, Size>& v) {
-        return map_join([](From x){ return cast_to<To>(x); }, v);
-    }
-
-    template < typename To, typename From, std::size_t Size >
-    [[nodiscard]] constexpr mat<To, Size> cast_to(const mat<From, Size>& m) {
-        return map_join([](const vec<From, Size>& v){ return cast_to<To>(v); }, m);
-    }
-
-    template < typename To, typename From >
-    [[nodiscard]] constexpr qua<To> cast_to(const qua<From>& q) {
-        return map_join([](From x){ return cast_to<To>(x); }, q);
-    }
-}
-
 //
 // Access
 //
@@ -160,13 +80,13 @@ namespace vmath_hpp
 
     // row
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr vec<T, Size> row(const mat<T, Size>& m, std::size_t index) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr vec<T, Cols> row(const mat<T, Rows, Cols>& m, std::size_t index) {
         return m.rows[index];
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr mat<T, Size> row(const mat<T, Size>& m, std::size_t index, const vec<T, Size>& row) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr mat<T, Rows, Cols> row(const mat<T, Rows, Cols>& m, std::size_t index, const vec<T, Cols>& row) {
         mat mm = m;
         mm[index] = row;
         return mm;
@@ -176,27 +96,27 @@ namespace vmath_hpp
 
     namespace impl
     {
-        template < typename T, std::size_t Size, std::size_t... Is >
+        template < typename T, std::size_t Rows, std::size_t Cols, std::size_t... Is >
         [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-        vec<T, Size> column_impl(const mat<T, Size>& m, std::size_t index, std::index_sequence<Is...>) {
+        vec<T, Rows> column_impl(const mat<T, Rows, Cols>& m, std::size_t index, std::index_sequence<Is...>) {
             return { m[Is][index]... };
         }
 
-        template < typename T, std::size_t Size, std::size_t... Is >
+        template < typename T, std::size_t Rows, std::size_t Cols, std::size_t... Is >
         [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-        mat<T, Size> column_impl(const mat<T, Size>& m, std::size_t index, const vec<T, Size>& column, std::index_sequence<Is...>) {
+        mat<T, Rows, Cols> column_impl(const mat<T, Rows, Cols>& m, std::size_t index, const vec<T, Rows>& column, std::index_sequence<Is...>) {
             return { component(m[Is], index, column[Is])... };
         }
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr vec<T, Size> column(const mat<T, Size>& m, std::size_t index) {
-        return impl::column_impl(m, index, std::make_index_sequence<Size>{});
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr vec<T, Rows> column(const mat<T, Rows, Cols>& m, std::size_t index) {
+        return impl::column_impl(m, index, std::make_index_sequence<Rows>{});
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr mat<T, Size> column(const mat<T, Size>& m, std::size_t index, const vec<T, Size>& column) {
-        return impl::column_impl(m, index, column, std::make_index_sequence<Size>{});
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr mat<T, Rows, Cols> column(const mat<T, Rows, Cols>& m, std::size_t index, const vec<T, Rows>& column) {
+        return impl::column_impl(m, index, column, std::make_index_sequence<Rows>{});
     }
 
     // diagonal
@@ -255,6 +175,84 @@ namespace vmath_hpp
 // Matrix Transform 3D
 //
 
+namespace vmath_hpp::impl
+{
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 3> qua_to_mat3(const qua<T>& q) {
+        /// REFERENCE:
+        /// http://www.euclideanspace.com/maths/geometry/rotations/conversions/quaternionToMatrix/
+
+        // v * qua_to_mat3(q) is v * q for any quaternion, it's a rotation only for unit ones
+
+        const auto [qv, qs] = q;
+
+        const T x2 = qv.x * T{2};
+        const T y2 = qv.y * T{2};
+        const T z2 = qv.z * T{2};
+
+        const T sx2 = qs * x2;
+        const T sy2 = qs * y2;
+        const T sz2 = qs * z2;
+
+        const T xx2 = qv.x * x2;
+        const T xy2 = qv.x * y2;
+        const T xz2 = qv.x * z2;
+
+        const T yy2 = qv.y * y2;
+        const T yz2 = qv.y * z2;
+        const T zz2 = qv.z * z2;
+
+        return {
+            { T{1} - (yy2 + zz2), (xy2 + sz2),        (xz2 - sy2)        },
+            { (xy2 - sz2),        T{1} - (xx2 + zz2), (yz2 + sx2)        },
+            { (xz2 + sy2),        (yz2 - sx2),        T{1} - (xx2 + yy2) }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr bool decompose_axis(vec<T, 3>& row, T s) {
+        // an axis shorter than the smallest normal number has no direction,
+        // it's zeroed instead of being normalized to nans, a nan stays a nan
+        const bool degenerate = abs(s) < std::numeric_limits<T>::min();
+        row = degenerate ? vec<T, 3>{T{0}} : row * rcp(s);
+        return !degenerate;
+    }
+
+    template < typename T >
+    constexpr void decompose_complete(mat<T, 3>& r, const bool (&valid)[3]) {
+        // the rows of zero scale axes are rebuilt from the other rows,
+        // the rotation stays orthonormal, without any axes it's the identity
+        const int count = int{valid[0]} + int{valid[1]} + int{valid[2]};
+
+        if ( count == 3 ) {
+            return;
+        }
+
+        if ( count == 0 ) {
+            r = mat<T, 3>{identity_init};
+            return;
+        }
+
+        std::size_t missing = valid[0] ? (valid[1] ? 2 : 1) : 0;
+
+        if ( count == 1 ) {
+            // the unit axis least aligned with the row, orthogonalized against it
+            const std::size_t k = valid[0] ? 0 : (valid[1] ? 1 : 2);
+            const vec<T, 3> v = r[k];
+            const vec<T, 3> av = abs(v);
+            const std::size_t e = av.x <= av.y && av.x <= av.z ? 0 : (av.y <= av.z ? 1 : 2);
+
+            vec<T, 3> u = -v[e] * v;
+            u[e] += T{1};
+
+            r[(k + 1) % 3] = normalize(u);
+            missing = (k + 2) % 3;
+        }
+
+        // x = y * z, y = z * x and z = x * y keep the determinant positive
+        r[missing] = cross(r[(missing + 1) % 3], r[(missing + 2) % 3]);
+    }
+}
+
 namespace vmath_hpp
 {
     // trs
@@ -287,6 +285,64 @@ namespace vmath_hpp
         return trs(t, rotate(r), s);
     }
 
+    // decompose
+
+    template < typename T >
+    [[nodiscard]] constexpr std::tuple<vec<T, 3>, qua<T>, vec<T, 3>> decompose(const mat<T, 4>& m) {
+        /// REFERENCE:
+        /// Spencer W. Thomas, "Decomposing a Matrix into Simple Transformations", Graphics Gems II
+
+        vec<T, 3> row0{m[0]};
+        vec<T, 3> row1{m[1]};
+        vec<T, 3> row2{m[2]};
+
+        // Gram-Schmidt orthonormalization, the shear part is discarded
+        vec<T, 3> s{no_init};
+        bool valid[3]{};
+
+        s.x = length(row0);
+        valid[0] = impl::decompose_axis(row0, s.x);
+
+        row1 -= dot(row0, row1) * row0;
+        s.y = length(row1);
+        valid[1] = impl::decompose_axis(row1, s.y);
+
+        row2 -= dot(row0, row2) * row0 + dot(row1, row2) * row1;
+        s.z = length(row2);
+        valid[2] = impl::decompose_axis(row2, s.z);
+
+        mat<T, 3> r{row0, row1, row2};
+        impl::decompose_complete(r, valid);
+
+        // a negative determinant means a reflection, move it to the x scale
+        if ( dot(r[0], cross(r[1], r[2])) < T{0} ) {
+            s.x = -s.x;
+            r[0] = -r[0];
+        }
+
+        return {vec<T, 3>{m[3]}, qrotate(r), s};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr std::tuple<vec<T, 3>, qua<T>, vec<T, 3>> decompose_fast(const mat<T, 4>& m) {
+        // assumes the matrix has no shear, rows are scaled rotation axes
+
+        const mat<T, 3> rs{m};
+        vec<T, 3> s{length(rs[0]), length(rs[1]), length(rs[2])};
+
+        // a negative determinant means a reflection, move it to the x scale
+        s.x = copysign(s.x, determinant(rs));
+
+        mat<T, 3> r{rs};
+        bool valid[3]{};
+        valid[0] = impl::decompose_axis(r[0], s.x);
+        valid[1] = impl::decompose_axis(r[1], s.y);
+        valid[2] = impl::decompose_axis(r[2], s.z);
+        impl::decompose_complete(r, valid);
+
+        return {vec<T, 3>{m[3]}, qrotate(r), s};
+    }
+
     // translate
 
     template < typename T >
@@ -305,31 +361,8 @@ namespace vmath_hpp
 
     template < typename T >
     [[nodiscard]] constexpr mat<T, 3> rotate(const qua<T>& q) {
-        /// REFERENCE:
-        /// http://www.euclideanspace.com/maths/geometry/rotations/conversions/quaternionToMatrix/
-
-        const auto [qv, qs] = normalize(q);
-
-        const T x2 = qv.x * T{2};
-        const T y2 = qv.y * T{2};
-        const T z2 = qv.z * T{2};
-
-        const T sx2 = qs * x2;
-        const T sy2 = qs * y2;
-        const T sz2 = qs * z2;
-
-        const T xx2 = qv.x * x2;
-        const T xy2 = qv.x * y2;
-        const T xz2 = qv.x * z2;
-
-        const T yy2 = qv.y * y2;
-        const T yz2 = qv.y * z2;
-        const T zz2 = qv.z * z2;
-
-        return {
-            { T{1} - (yy2 + zz2), (xy2 + sz2),        (xz2 - sy2)        },
-            { (xy2 - sz2),        T{1} - (xx2 + zz2), (yz2 + sx2)        },
-            { (xz2 + sy2),        (yz2 - sx2),        T{1} - (xx2 + yy2) }};
+        VMATH_HPP_INSTRUMENT_CALL(rotate, 24);
+        return impl::qua_to_mat3(normalize(q));
     }
 
     template < typename T >
@@ -342,6 +375,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://www.euclideanspace.com/maths/geometry/rotations/conversions/angleToMatrix/
 
+        VMATH_HPP_INSTRUMENT_CALL(rotate, 26);
+
         const auto [s, c] = sincos(angle);
         const auto [x, y, z] = normalize(axis);
 
@@ -462,6 +497,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// https://www.euclideanspace.com/maths/algebra/vectors/lookat/
 
+        VMATH_HPP_INSTRUMENT_CALL(look_at, 18);
+
         const vec az = normalize(dir);
         const vec ax = normalize(cross(up, az));
         const vec ay = cross(az, ax);
@@ -481,6 +518,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// https://www.euclideanspace.com/maths/algebra/vectors/lookat/
 
+        VMATH_HPP_INSTRUMENT_CALL(look_at, 39);
+
         const vec az = normalize(at - eye);
         const vec ax = normalize(cross(up, az));
         const vec ay = cross(az, ax);
@@ -504,6 +543,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// https://www.euclideanspace.com/maths/algebra/vectors/lookat/
 
+        VMATH_HPP_INSTRUMENT_CALL(look_at, 18);
+
         const vec az = normalize(-dir);
         const vec ax = normalize(cross(up, az));
         const vec ay = cross(az, ax);
@@ -523,6 +564,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// https://www.euclideanspace.com/maths/algebra/vectors/lookat/
 
+        VMATH_HPP_INSTRUMENT_CALL(look_at, 39);
+
         const vec az = normalize(eye - at);
         const vec ax = normalize(cross(up, az));
         const vec ay = cross(az, ax);
@@ -814,6 +857,285 @@ namespace vmath_hpp
             { T{0}, T{0},  sz,  -T{1} },
             { T{0}, T{0},  tz,   T{0} }};
     }
+
+    // perspective_fov_infinite_reversed
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_fov_infinite_reversed_lh(T fovy, T aspect, T znear) {
+        /// REFERENCE:
+        /// https://developer.nvidia.com/content/depth-precision-visualized
+
+        // the near plane maps to 1 and the infinity to 0, so the float
+        // exponents follow the hyperbolic depth and the precision is even
+
+        const T sy = rcp(tan(fovy * T{0.5f}));
+        const T sx = sy * rcp(aspect);
+
+        return {
+            {  sx,  T{0},  T{0},  T{0} },
+            { T{0},  sy,   T{0},  T{0} },
+            { T{0}, T{0},  T{0},  T{1} },
+            { T{0}, T{0}, znear,  T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_fov_infinite_reversed_rh(T fovy, T aspect, T znear) {
+        /// REFERENCE:
+        /// https://developer.nvidia.com/content/depth-precision-visualized
+
+        const T sy = rcp(tan(fovy * T{0.5f}));
+        const T sx = sy * rcp(aspect);
+
+        return {
+            {  sx,  T{0},  T{0},  T{0} },
+            { T{0},  sy,   T{0},  T{0} },
+            { T{0}, T{0},  T{0}, -T{1} },
+            { T{0}, T{0}, znear,  T{0} }};
+    }
+
+    // perspective_reversed
+
+    // reversed depth: znear maps to 1 and zfar to 0, the float exponents
+    // follow the hyperbolic depth and the far precision isn't lost
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_reversed_lh(T width, T height, T znear, T zfar) {
+        const T sx = T{2} * znear * rcp(width);
+        const T sy = T{2} * znear * rcp(height);
+        const T sz = znear * rcp(znear - zfar);
+        const T tz = (znear * zfar) * rcp(zfar - znear);
+
+        return {
+            {  sx,  T{0}, T{0}, T{0} },
+            { T{0},  sy,  T{0}, T{0} },
+            { T{0}, T{0},  sz,  T{1} },
+            { T{0}, T{0},  tz,  T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_reversed_rh(T width, T height, T znear, T zfar) {
+        const T sx = T{2} * znear * rcp(width);
+        const T sy = T{2} * znear * rcp(height);
+        const T sz = znear * rcp(zfar - znear);
+        const T tz = (znear * zfar) * rcp(zfar - znear);
+
+        return {
+            {  sx,  T{0}, T{0},  T{0} },
+            { T{0},  sy,  T{0},  T{0} },
+            { T{0}, T{0},  sz,  -T{1} },
+            { T{0}, T{0},  tz,   T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_reversed_lh(T left, T right, T bottom, T top, T znear, T zfar) {
+        const T znear2 = T{2} * znear;
+        const T rwidth = rcp(right - left);
+        const T rheight = rcp(top - bottom);
+        const T sz = znear * rcp(znear - zfar);
+        const T tz = (znear * zfar) * rcp(zfar - znear);
+
+        return {
+            { znear2 * rwidth,          T{0},                      T{0}, T{0} },
+            { T{0},                     znear2 * rheight,          T{0}, T{0} },
+            { -(left + right) * rwidth, -(top + bottom) * rheight, sz,   T{1} },
+            { T{0},                     T{0},                      tz,   T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_reversed_rh(T left, T right, T bottom, T top, T znear, T zfar) {
+        const T znear2 = T{2} * znear;
+        const T rwidth = rcp(right - left);
+        const T rheight = rcp(top - bottom);
+        const T sz = znear * rcp(zfar - znear);
+        const T tz = (znear * zfar) * rcp(zfar - znear);
+
+        return {
+            { znear2 * rwidth,         T{0},                     T{0},  T{0} },
+            { T{0},                    znear2 * rheight,         T{0},  T{0} },
+            { (left + right) * rwidth, (top + bottom) * rheight, sz,   -T{1} },
+            { T{0},                    T{0},                     tz,    T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_fov_reversed_lh(T fovy, T aspect, T znear, T zfar) {
+        const T sy = rcp(tan(fovy * T{0.5f}));
+        const T sx = sy * rcp(aspect);
+        const T sz = znear * rcp(znear - zfar);
+        const T tz = (znear * zfar) * rcp(zfar - znear);
+
+        return {
+            {  sx,  T{0}, T{0}, T{0} },
+            { T{0},  sy,  T{0}, T{0} },
+            { T{0}, T{0},  sz,  T{1} },
+            { T{0}, T{0},  tz,  T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_fov_reversed_rh(T fovy, T aspect, T znear, T zfar) {
+        const T sy = rcp(tan(fovy * T{0.5f}));
+        const T sx = sy * rcp(aspect);
+        const T sz = znear * rcp(zfar - znear);
+        const T tz = (znear * zfar) * rcp(zfar - znear);
+
+        return {
+            {  sx,  T{0}, T{0},  T{0} },
+            { T{0},  sy,  T{0},  T{0} },
+            { T{0}, T{0},  sz,  -T{1} },
+            { T{0}, T{0},  tz,   T{0} }};
+    }
+
+    // perspective_infinite
+
+    // the limits of the standard matrices as zfar goes to infinity
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_lh(T width, T height, T znear) {
+        const T sx = T{2} * znear * rcp(width);
+        const T sy = T{2} * znear * rcp(height);
+
+        return {
+            {  sx,  T{0},   T{0}, T{0} },
+            { T{0},  sy,    T{0}, T{0} },
+            { T{0}, T{0},   T{1}, T{1} },
+            { T{0}, T{0}, -znear, T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_rh(T width, T height, T znear) {
+        const T sx = T{2} * znear * rcp(width);
+        const T sy = T{2} * znear * rcp(height);
+
+        return {
+            {  sx,  T{0},   T{0},  T{0} },
+            { T{0},  sy,    T{0},  T{0} },
+            { T{0}, T{0},  -T{1}, -T{1} },
+            { T{0}, T{0}, -znear,  T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_lh(T left, T right, T bottom, T top, T znear) {
+        const T znear2 = T{2} * znear;
+        const T rwidth = rcp(right - left);
+        const T rheight = rcp(top - bottom);
+
+        return {
+            { znear2 * rwidth,          T{0},                      T{0},   T{0} },
+            { T{0},                     znear2 * rheight,          T{0},   T{0} },
+            { -(left + right) * rwidth, -(top + bottom) * rheight, T{1},   T{1} },
+            { T{0},                     T{0},                      -znear, T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_rh(T left, T right, T bottom, T top, T znear) {
+        const T znear2 = T{2} * znear;
+        const T rwidth = rcp(right - left);
+        const T rheight = rcp(top - bottom);
+
+        return {
+            { znear2 * rwidth,         T{0},                     T{0},    T{0} },
+            { T{0},                    znear2 * rheight,         T{0},    T{0} },
+            { (left + right) * rwidth, (top + bottom) * rheight, -T{1},  -T{1} },
+            { T{0},                    T{0},                     -znear,  T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_fov_infinite_lh(T fovy, T aspect, T znear) {
+        const T sy = rcp(tan(fovy * T{0.5f}));
+        const T sx = sy * rcp(aspect);
+
+        return {
+            {  sx,  T{0},   T{0}, T{0} },
+            { T{0},  sy,    T{0}, T{0} },
+            { T{0}, T{0},   T{1}, T{1} },
+            { T{0}, T{0}, -znear, T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_fov_infinite_rh(T fovy, T aspect, T znear) {
+        const T sy = rcp(tan(fovy * T{0.5f}));
+        const T sx = sy * rcp(aspect);
+
+        return {
+            {  sx,  T{0},   T{0},  T{0} },
+            { T{0},  sy,    T{0},  T{0} },
+            { T{0}, T{0},  -T{1}, -T{1} },
+            { T{0}, T{0}, -znear,  T{0} }};
+    }
+
+    // perspective_infinite_reversed
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_reversed_lh(T width, T height, T znear) {
+        const T sx = T{2} * znear * rcp(width);
+        const T sy = T{2} * znear * rcp(height);
+
+        return {
+            {  sx,  T{0},  T{0}, T{0} },
+            { T{0},  sy,   T{0}, T{0} },
+            { T{0}, T{0},  T{0}, T{1} },
+            { T{0}, T{0}, znear, T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_reversed_rh(T width, T height, T znear) {
+        const T sx = T{2} * znear * rcp(width);
+        const T sy = T{2} * znear * rcp(height);
+
+        return {
+            {  sx,  T{0},  T{0},  T{0} },
+            { T{0},  sy,   T{0},  T{0} },
+            { T{0}, T{0},  T{0}, -T{1} },
+            { T{0}, T{0}, znear,  T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_reversed_lh(T left, T right, T bottom, T top, T znear) {
+        const T znear2 = T{2} * znear;
+        const T rwidth = rcp(right - left);
+        const T rheight = rcp(top - bottom);
+
+        return {
+            { znear2 * rwidth,          T{0},                      T{0},  T{0} },
+            { T{0},                     znear2 * rheight,          T{0},  T{0} },
+            { -(left + right) * rwidth, -(top + bottom) * rheight, T{0},  T{1} },
+            { T{0},                     T{0},                      znear, T{0} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> perspective_infinite_reversed_rh(T left, T right, T bottom, T top, T znear) {
+        const T znear2 = T{2} * znear;
+        const T rwidth = rcp(right - left);
+        const T rheight = rcp(top - bottom);
+
+        return {
+            { znear2 * rwidth,         T{0},                     T{0},   T{0} },
+            { T{0},                    znear2 * rheight,         T{0},   T{0} },
+            { (left + right) * rwidth, (top + bottom) * rheight, T{0},  -T{1} },
+            { T{0},                    T{0},                     znear,  T{0} }};
+    }
+
+    // inverse_perspective
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> inverse_perspective(const mat<T, 4>& m) {
+        // any of the perspective matrices above has the form
+        //   [ sx  0  0  0 ]
+        //   [  0 sy  0  0 ]
+        //   [ cx cy sz  w ]
+        //   [  0  0 tz  0 ]
+        // so the inverse is a few reciprocals instead of the general inverse
+
+        const T rsx = rcp(m[0][0]);
+        const T rsy = rcp(m[1][1]);
+        const T rtz = rcp(m[3][2]);
+        const T rw = rcp(m[2][3]);
+
+        return {
+            { rsx,                  T{0},                 T{0}, T{0}              },
+            { T{0},                 rsy,                  T{0}, T{0}              },
+            { T{0},                 T{0},                 T{0}, rtz               },
+            { -m[2][0] * rw * rsx,  -m[2][1] * rw * rsy,  rw,   -m[2][2] * rw * rtz }};
+    }
 }
 
 //
@@ -827,7 +1149,9 @@ namespace vmath_hpp
     template < typename T, std::size_t Size >
     [[nodiscard]] constexpr T angle(const vec<T, Size>& x, const vec<T, Size>& y) {
         const T rs = rsqrt(length2(x) * length2(y));
-        return acos(clamp(dot(x, y) * rs, -T{1}, T{1}));
+        // checked before the clamp, it would hide the nan of zero vectors
+        const T cos_angle = VMATH_HPP_CHECK_RESULT("angle", dot(x, y) * rs);
+        return acos(clamp(cos_angle, -T{1}, T{1}));
     }
 
     // rotate
@@ -870,6 +1194,37 @@ namespace vmath_hpp
     [[nodiscard]] constexpr vec<T, Size> perpendicular(const vec<T, Size>& v, const vec<T, Size>& normal) {
         return v - project(v, normal);
     }
+
+    // unproject
+
+    template < typename T >
+    [[nodiscard]] constexpr vec<T, 3> unproject(const vec<T, 3>& ndc, const mat<T, 4>& inv_view_proj) {
+        // ndc is the clip space point after the division by w, depth in [0, 1]
+        const vec<T, 4> p = vec<T, 4>{ndc, T{1}} * inv_view_proj;
+        return vec<T, 3>{p.x, p.y, p.z} * rcp(p.w);
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr mat<T, 4> window_to_ndc(const vec<T, 4>& viewport) {
+        // the viewport is (x, y, width, height) with the origin
+        // in the top left corner and the y axis pointing down
+        const T sx = T{2} * rcp(viewport.z);
+        const T sy = T{2} * rcp(viewport.w);
+        return {
+            { sx,                         T{0},                      T{0}, T{0} },
+            { T{0},                       -sy,                       T{0}, T{0} },
+            { T{0},                       T{0},                      T{1}, T{0} },
+            { -viewport.x * sx - T{1},    viewport.y * sy + T{1},    T{0}, T{1} }};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr vec<T, 3> unproject(const vec<T, 3>& window, const mat<T, 4>& inv_view_proj, const vec<T, 4>& viewport) {
+        const vec<T, 3> ndc{
+            T{2} * (window.x - viewport.x) * rcp(viewport.z) - T{1},
+            T{1} - T{2} * (window.y - viewport.y) * rcp(viewport.w),
+            window.z};
+        return unproject(ndc, inv_view_proj);
+    }
 }
 
 //
@@ -885,6 +1240,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://www.euclideanspace.com/maths/geometry/rotations/conversions/matrixToQuaternion/
 
+        VMATH_HPP_INSTRUMENT_CALL(qrotate, 30);
+
         auto xyzw = T{0.5f} * sqrt(max(T{0}, vec{
             T{1} + m[0][0] - m[1][1] - m[2][2],
             T{1} - m[0][0] + m[1][1] - m[2][2],
@@ -903,6 +1260,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://lolengine.net/blog/2014/02/24/quaternion-from-two-vectors-final
 
+        VMATH_HPP_INSTRUMENT_CALL(qrotate, 25);
+
         const T n = sqrt(length2(from) * length2(to));
         const T s = dot(from, to) + n;
 
@@ -920,6 +1279,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://www.euclideanspace.com/maths/geometry/rotations/conversions/angleToQuaternion/
 
+        VMATH_HPP_INSTRUMENT_CALL(qrotate, 6);
+
         const auto [s, c] = sincos(angle * T{0.5f});
         const auto [x, y, z] = normalize(axis);
 
@@ -968,3 +1329,180 @@ namespace vmath_hpp
         return qrotate(look_at_rh(dir, up));
     }
 }
+
+//
+// Morton Codes
+//
+
+namespace vmath_hpp::detail
+{
+    template < typename Key >
+    inline constexpr bool is_morton_key_v =
+        std::is_same_v<Key, std::uint32_t> ||
+        std::is_same_v<Key, std::uint64_t>;
+
+    template < typename Key >
+    [[nodiscard]] constexpr Key morton_spread2(Key x) noexcept {
+        if constexpr ( sizeof(Key) == sizeof(std::uint32_t) ) {
+            x &= Key{0x0000FFFF};
+            x = (x | (x << 8)) & Key{0x00FF00FF};
+            x = (x | (x << 4)) & Key{0x0F0F0F0F};
+            x = (x | (x << 2)) & Key{0x33333333};
+            x = (x | (x << 1)) & Key{0x55555555};
+        } else {
+            x &= Key{0x00000000FFFFFFFF};
+            x = (x | (x << 16)) & Key{0x0000FFFF0000FFFF};
+            x = (x | (x << 8)) & Key{0x00FF00FF00FF00FF};
+            x = (x | (x << 4)) & Key{0x0F0F0F0F0F0F0F0F};
+            x = (x | (x << 2)) & Key{0x3333333333333333};
+            x = (x | (x << 1)) & Key{0x5555555555555555};
+        }
+        return x;
+    }
+
+    template < typename Key >
+    [[nodiscard]] constexpr Key morton_compact2(Key x) noexcept {
+        if constexpr ( sizeof(Key) == sizeof(std::uint32_t) ) {
+            x &= Key{0x55555555};
+            x = (x ^ (x >> 1)) & Key{0x33333333};
+            x = (x ^ (x >> 2)) & Key{0x0F0F0F0F};
+            x = (x ^ (x >> 4)) & Key{0x00FF00FF};
+            x = (x ^ (x >> 8)) & Key{0x0000FFFF};
+        } else {
+            x &= Key{0x5555555555555555};
+            x = (x ^ (x >> 1)) & Key{0x3333333333333333};
+            x = (x ^ (x >> 2)) & Key{0x0F0F0F0F0F0F0F0F};
+            x = (x ^ (x >> 4)) & Key{0x00FF00FF00FF00FF};
+            x = (x ^ (x >> 8)) & Key{0x0000FFFF0000FFFF};
+            x = (x ^ (x >> 16)) & Key{0x00000000FFFFFFFF};
+        }
+        return x;
+    }
+
+    template < typename Key >
+    [[nodiscard]] constexpr Key morton_spread3(Key x) noexcept {
+        if constexpr ( sizeof(Key) == sizeof(std::uint32_t) ) {
+            x &= Key{0x000003FF};
+            x = (x | (x << 16)) & Key{0x030000FF};
+            x = (x | (x << 8)) & Key{0x0300F00F};
+            x = (x | (x << 4)) & Key{0x030C30C3};
+            x = (x | (x << 2)) & Key{0x09249249};
+        } else {
+            x &= Key{0x00000000001FFFFF};
+            x = (x | (x << 32)) & Key{0x001F00000000FFFF};
+            x = (x | (x << 16)) & Key{0x001F0000FF0000FF};
+            x = (x | (x << 8)) & Key{0x100F00F00F00F00F};
+            x = (x | (x << 4)) & Key{0x10C30C30C30C30C3};
+            x = (x | (x << 2)) & Key{0x1249249249249249};
+        }
+        return x;
+    }
+
+    template < typename Key >
+    [[nodiscard]] constexpr Key morton_compact3(Key x) noexcept {
+        if constexpr ( sizeof(Key) == sizeof(std::uint32_t) ) {
+            x &= Key{0x09249249};
+            x = (x ^ (x >> 2)) & Key{0x030C30C3};
+            x = (x ^ (x >> 4)) & Key{0x0300F00F};
+            x = (x ^ (x >> 8)) & Key{0xFF0000FF};
+            x = (x ^ (x >> 16)) & Key{0x000003FF};
+        } else {
+            x &= Key{0x1249249249249249};
+            x = (x ^ (x >> 2)) & Key{0x10C30C30C30C30C3};
+            x = (x ^ (x >> 4)) & Key{0x100F00F00F00F00F};
+            x = (x ^ (x >> 8)) & Key{0x001F0000FF0000FF};
+            x = (x ^ (x >> 16)) & Key{0x001F00000000FFFF};
+            x = (x ^ (x >> 32)) & Key{0x00000000001FFFFF};
+        }
+        return x;
+    }
+}
+
+namespace vmath_hpp
+{
+    // morton_encode
+
+    template < typename Key = std::uint32_t, typename T >
+    [[nodiscard]] std::enable_if_t<
+        detail::is_morton_key_v<Key> && std::is_unsigned_v<T>
+    , Key>
+    constexpr morton_encode(const vec<T, 2>& v) noexcept {
+        /// REFERENCE:
+        /// https://fgiesen.wordpress.com/2009/12/13/decoding-morton-codes/
+
+        return
+            (detail::morton_spread2(static_cast<Key>(v.x)) << 0) |
+            (detail::morton_spread2(static_cast<Key>(v.y)) << 1);
+    }
+
+    template < typename Key = std::uint32_t, typename T >
+    [[nodiscard]] std::enable_if_t<
+        detail::is_morton_key_v<Key> && std::is_unsigned_v<T>
+    , Key>
+    constexpr morton_encode(const vec<T, 3>& v) noexcept {
+        /// REFERENCE:
+        /// https://fgiesen.wordpress.com/2009/12/13/decoding-morton-codes/
+
+        return
+            (detail::morton_spread3(static_cast<Key>(v.x)) << 0) |
+            (detail::morton_spread3(static_cast<Key>(v.y)) << 1) |
+            (detail::morton_spread3(static_cast<Key>(v.z)) << 2);
+    }
+
+    // morton_decode
+
+    template < std::size_t Size, typename Key >
+    [[nodiscard]] std::enable_if_t<
+        detail::is_morton_key_v<Key> && Size == 2
+    , vec<unsigned, 2>>
+    constexpr morton_decode(Key key) noexcept {
+        return {
+            static_cast<unsigned>(detail::morton_compact2(key >> 0)),
+            static_cast<unsigned>(detail::morton_compact2(key >> 1))};
+    }
+
+    template < std::size_t Size, typename Key >
+    [[nodiscard]] std::enable_if_t<
+        detail::is_morton_key_v<Key> && Size == 3
+    , vec<unsigned, 3>>
+    constexpr morton_decode(Key key) noexcept {
+        return {
+            static_cast<unsigned>(detail::morton_compact3(key >> 0)),
+            static_cast<unsigned>(detail::morton_compact3(key >> 1)),
+            static_cast<unsigned>(detail::morton_compact3(key >> 2))};
+    }
+
+    // quantize
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<unsigned, Size> quantize(
+        const vec<T, Size>& v,
+        const vec<T, Size>& min_v,
+        const vec<T, Size>& max_v,
+        unsigned bits)
+    {
+        // float can't represent the top cells of grids finer than 24 bits,
+        // so the grid is computed in double, bits is clamped to the width of
+        // unsigned and a zero extent maps to the first cell
+
+        using W = std::conditional_t<(sizeof(T) < sizeof(double)), double, T>;
+        constexpr unsigned max_bits = std::numeric_limits<unsigned>::digits;
+
+        const unsigned grid_bits = bits < max_bits ? bits : max_bits;
+        const W scale = grid_bits > 0
+            ? static_cast<W>(std::numeric_limits<unsigned>::max() >> (max_bits - grid_bits))
+            : W{0};
+
+        vec<unsigned, Size> r{zero_init};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            const W extent = static_cast<W>(max_v[i]) - static_cast<W>(min_v[i]);
+            const W t = extent > W{0}
+                ? saturate((static_cast<W>(v[i]) - static_cast<W>(min_v[i])) * rcp(extent))
+                : W{0};
+            // the value is non-negative, the conversion truncates it like floor
+            // would, and unlike std::floor it's constexpr before C++23
+            r[i] = static_cast<unsigned>(t * scale + W{0.5f});
+        }
+        return r;
+    }
+}
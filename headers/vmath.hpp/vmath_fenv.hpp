@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#  define VMATH_HPP_FENV_SSE
+#  include <xmmintrin.h>
+#elif defined(__aarch64__) && (defined(__clang__) || defined(__GNUC__))
+#  define VMATH_HPP_FENV_AARCH64
+#endif
+
+//
+// Floating-point Environment
+//
+
+namespace vmath_hpp::impl
+{
+#if defined(VMATH_HPP_FENV_SSE)
+    // MXCSR: flush-to-zero (bit 15) and denormals-are-zero (bit 6)
+    inline constexpr std::uint64_t ftz_daz_bits = 0x8040;
+
+    [[nodiscard]] inline std::uint64_t read_fp_control() noexcept {
+        return _mm_getcsr();
+    }
+
+    inline void write_fp_control(std::uint64_t bits) noexcept {
+        _mm_setcsr(static_cast<unsigned>(bits));
+    }
+#elif defined(VMATH_HPP_FENV_AARCH64)
+    // FPCR: flush-to-zero (bit 24), covers both inputs and outputs
+    inline constexpr std::uint64_t ftz_daz_bits = 0x1000000;
+
+    [[nodiscard]] inline std::uint64_t read_fp_control() noexcept {
+        std::uint64_t bits{};
+        __asm__ __volatile__("mrs %0, fpcr" : "=r"(bits));
+        return bits;
+    }
+
+    inline void write_fp_control(std::uint64_t bits) noexcept {
+        __asm__ __volatile__("msr fpcr, %0" : : "r"(bits));
+    }
+#else
+    inline constexpr std::uint64_t ftz_daz_bits = 0;
+
+    [[nodiscard]] inline std::uint64_t read_fp_control() noexcept {
+        return 0;
+    }
+
+    inline void write_fp_control(std::uint64_t) noexcept {}
+#endif
+}
+
+namespace vmath_hpp
+{
+    // ftz_supported
+
+    [[nodiscard]] constexpr bool ftz_supported() noexcept {
+        return impl::ftz_daz_bits != 0;
+    }
+
+    // ftz_enabled
+
+    [[nodiscard]] inline bool ftz_enabled() noexcept {
+        return ftz_supported()
+            && (impl::read_fp_control() & impl::ftz_daz_bits) == impl::ftz_daz_bits;
+    }
+
+    // ftz_guard
+
+    class ftz_guard final {
+    public:
+        // flushes denormal inputs and results to zero on the current thread until destroyed,
+        // doesn't affect constant evaluation and code compiled for the x87 unit
+        ftz_guard() noexcept
+        : saved_{impl::read_fp_control()} {
+            impl::write_fp_control(saved_ | impl::ftz_daz_bits);
+        }
+
+        ~ftz_guard() noexcept {
+            impl::write_fp_control(saved_);
+        }
+
+        ftz_guard(const ftz_guard&) = delete;
+        ftz_guard& operator=(const ftz_guard&) = delete;
+    private:
+        std::uint64_t saved_{};
+    };
+}
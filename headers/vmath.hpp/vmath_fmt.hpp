@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_charconv.hpp"
+
+#include <fmt/format.h>
+
+//
+// Fmt Formatters
+//
+
+// opt-in, not included by vmath_all.hpp because it needs the fmt library
+
+namespace fmt
+{
+    template < typename T, std::size_t Size >
+    struct formatter<vmath_hpp::vec<T, Size>, char> : formatter<T, char> {
+        template < typename FormatContext >
+        auto format(const vmath_hpp::vec<T, Size>& v, FormatContext& ctx) const {
+            vmath_hpp::impl::format_n(static_cast<const formatter<T, char>&>(*this), v.data(), Size, false, ctx);
+            return ctx.out();
+        }
+    };
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    struct formatter<vmath_hpp::mat<T, Rows, Cols>, char> : formatter<T, char> {
+        template < typename FormatContext >
+        auto format(const vmath_hpp::mat<T, Rows, Cols>& m, FormatContext& ctx) const {
+            for ( std::size_t i = 0; i < Rows; ++i ) {
+                vmath_hpp::impl::format_n(static_cast<const formatter<T, char>&>(*this), m[i].data(), Cols, i > 0, ctx);
+            }
+            return ctx.out();
+        }
+    };
+
+    template < typename T >
+    struct formatter<vmath_hpp::qua<T>, char> : formatter<T, char> {
+        template < typename FormatContext >
+        auto format(const vmath_hpp::qua<T>& q, FormatContext& ctx) const {
+            vmath_hpp::impl::format_n(static_cast<const formatter<T, char>&>(*this), q.data(), 4, false, ctx);
+            return ctx.out();
+        }
+    };
+}
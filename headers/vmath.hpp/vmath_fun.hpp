@@ -8,10 +8,32 @@
 
 #include "vmath_fwd.hpp"
 
+#include <cmath>
+#include <cstring>
+#include <limits>
+
 //
 // Common Functions
 //
 
+namespace vmath_hpp::impl
+{
+    // the unchecked forms are for the functions built on top of them,
+    // only the outermost public call checks its result
+
+    template < typename T >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    T lerp_impl(T x, T y, T a) noexcept {
+        return x * (T{1} - a) + y * a;
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    T lerp_impl(T x, T y, T x_a, T y_a) noexcept {
+        return x * x_a + y * y_a;
+    }
+}
+
 namespace vmath_hpp
 {
     template < typename T >
@@ -117,13 +139,13 @@ namespace vmath_hpp
     template < typename T >
     [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
     constexpr lerp(T x, T y, T a) noexcept {
-        return x * (T{1} - a) + y * a;
+        return VMATH_HPP_CHECK_RESULT("lerp", impl::lerp_impl(x, y, a));
     }
 
     template < typename T >
     [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
     constexpr lerp(T x, T y, T x_a, T y_a) noexcept {
-        return x * x_a + y * y_a;
+        return VMATH_HPP_CHECK_RESULT("lerp", impl::lerp_impl(x, y, x_a, y_a));
     }
 
     template < typename T >
@@ -297,6 +319,31 @@ namespace vmath_hpp
     constexpr rsqrt(T x) noexcept {
         return rcp(sqrt(x));
     }
+
+    template < typename T >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    fast_rsqrt(T x) noexcept {
+        if constexpr ( std::is_same_v<T, float> && std::numeric_limits<float>::is_iec559 ) {
+            /// REFERENCE:
+            /// http://www.lomont.org/papers/2003/InvSqrt.pdf
+
+            std::uint32_t i{};
+            std::memcpy(&i, &x, sizeof(x));
+            i = 0x5f375a86u - (i >> 1);
+
+            float y{};
+            std::memcpy(&y, &i, sizeof(y));
+
+            // two newton steps, about 5e-6 relative error and no division,
+            // zero gives a large finite value instead of infinity
+            const float half_x = x * 0.5f;
+            y = y * (1.5f - half_x * y * y);
+            y = y * (1.5f - half_x * y * y);
+            return y;
+        } else {
+            return rsqrt(x);
+        }
+    }
 }
 
 //
@@ -6,15 +6,10 @@
 
 #pragma once
 
-#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 
-#include <functional>
-#include <initializer_list>
-#include <iterator>
-#include <limits>
-#include <stdexcept>
 #include <type_traits>
 #include <utility>
 
@@ -33,12 +28,15 @@
 #ifdef VMATH_HPP_NO_EXCEPTIONS
 #  define VMATH_HPP_THROW(...) std::abort()
 #else
+#  include <stdexcept>
 #  define VMATH_HPP_THROW(...) throw __VA_ARGS__
 #endif
 
 #define VMATH_HPP_THROW_IF(pred, ...)\
     ( (pred) ? VMATH_HPP_THROW(__VA_ARGS__) : (void)0 )
 
+#include "vmath_instrument.hpp"
+
 namespace vmath_hpp
 {
     struct no_init_t { explicit no_init_t() = default; };
@@ -82,7 +80,7 @@ namespace vmath_hpp
 
 namespace vmath_hpp
 {
-    template < typename T, std::size_t Size >
+    template < typename T, std::size_t Rows, std::size_t Cols = Rows >
     class mat;
 
     using bmat2 = mat<bool, 2>;
@@ -104,6 +102,41 @@ namespace vmath_hpp
     using dmat2 = mat<double, 2>;
     using dmat3 = mat<double, 3>;
     using dmat4 = mat<double, 4>;
+
+    using bmat2x3 = mat<bool, 2, 3>;
+    using bmat2x4 = mat<bool, 2, 4>;
+    using bmat3x2 = mat<bool, 3, 2>;
+    using bmat3x4 = mat<bool, 3, 4>;
+    using bmat4x2 = mat<bool, 4, 2>;
+    using bmat4x3 = mat<bool, 4, 3>;
+
+    using imat2x3 = mat<int, 2, 3>;
+    using imat2x4 = mat<int, 2, 4>;
+    using imat3x2 = mat<int, 3, 2>;
+    using imat3x4 = mat<int, 3, 4>;
+    using imat4x2 = mat<int, 4, 2>;
+    using imat4x3 = mat<int, 4, 3>;
+
+    using umat2x3 = mat<unsigned, 2, 3>;
+    using umat2x4 = mat<unsigned, 2, 4>;
+    using umat3x2 = mat<unsigned, 3, 2>;
+    using umat3x4 = mat<unsigned, 3, 4>;
+    using umat4x2 = mat<unsigned, 4, 2>;
+    using umat4x3 = mat<unsigned, 4, 3>;
+
+    using fmat2x3 = mat<float, 2, 3>;
+    using fmat2x4 = mat<float, 2, 4>;
+    using fmat3x2 = mat<float, 3, 2>;
+    using fmat3x4 = mat<float, 3, 4>;
+    using fmat4x2 = mat<float, 4, 2>;
+    using fmat4x3 = mat<float, 4, 3>;
+
+    using dmat2x3 = mat<double, 2, 3>;
+    using dmat2x4 = mat<double, 2, 4>;
+    using dmat3x2 = mat<double, 3, 2>;
+    using dmat3x4 = mat<double, 3, 4>;
+    using dmat4x2 = mat<double, 4, 2>;
+    using dmat4x3 = mat<double, 4, 3>;
 }
 
 namespace vmath_hpp
@@ -0,0 +1,737 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_bounds.hpp"
+#include "vmath_fun.hpp"
+#include "vmath_mat_fun.hpp"
+#include "vmath_vec_fun.hpp"
+
+#include <limits>
+#include <utility>
+
+//
+// Primitives
+//
+
+namespace vmath_hpp
+{
+    template < typename T, std::size_t Size >
+    class plane final {
+    public:
+        using self_type = plane;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+    public:
+        // the points p with dot(normal, p) == offset, the normal is unit
+        vec_type normal{zero_init};
+        T offset{0};
+    public:
+        constexpr plane() = default;
+
+        constexpr plane(const vec_type& n, T o)
+        : normal{n}
+        , offset{o} {}
+    };
+
+    template < typename T, std::size_t Size >
+    class segment final {
+    public:
+        using self_type = segment;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+    public:
+        vec_type a{zero_init};
+        vec_type b{zero_init};
+    public:
+        constexpr segment() = default;
+
+        constexpr segment(const vec_type& p, const vec_type& q)
+        : a{p}
+        , b{q} {}
+    };
+
+    template < typename T, std::size_t Size >
+    class capsule final {
+    public:
+        using self_type = capsule;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+    public:
+        // the points within radius of the segment [a, b]
+        vec_type a{zero_init};
+        vec_type b{zero_init};
+        T radius{0};
+    public:
+        constexpr capsule() = default;
+
+        constexpr capsule(const vec_type& p, const vec_type& q, T r)
+        : a{p}
+        , b{q}
+        , radius{r} {}
+    };
+
+    template < typename T, std::size_t Size >
+    class triangle final {
+    public:
+        using self_type = triangle;
+        using component_type = T;
+        using vec_type = vec<T, Size>;
+    public:
+        vec_type a{zero_init};
+        vec_type b{zero_init};
+        vec_type c{zero_init};
+    public:
+        constexpr triangle() = default;
+
+        constexpr triangle(const vec_type& p, const vec_type& q, const vec_type& r)
+        : a{p}
+        , b{q}
+        , c{r} {}
+    };
+}
+
+namespace vmath_hpp
+{
+    using fplane2 = plane<float, 2>;
+    using fplane3 = plane<float, 3>;
+    using dplane2 = plane<double, 2>;
+    using dplane3 = plane<double, 3>;
+
+    using fsegment2 = segment<float, 2>;
+    using fsegment3 = segment<float, 3>;
+    using dsegment2 = segment<double, 2>;
+    using dsegment3 = segment<double, 3>;
+
+    using fcapsule2 = capsule<float, 2>;
+    using fcapsule3 = capsule<float, 3>;
+    using dcapsule2 = capsule<double, 2>;
+    using dcapsule3 = capsule<double, 3>;
+
+    using ftriangle2 = triangle<float, 2>;
+    using ftriangle3 = triangle<float, 3>;
+    using dtriangle2 = triangle<double, 2>;
+    using dtriangle3 = triangle<double, 3>;
+}
+
+namespace vmath_hpp
+{
+    // plane_from_points
+
+    template < typename T >
+    [[nodiscard]] constexpr plane<T, 3> plane_from_points(const vec<T, 3>& a, const vec<T, 3>& b, const vec<T, 3>& c) {
+        // counter-clockwise points look at the normal
+        const vec<T, 3> n = normalize(cross(b - a, c - a));
+        return {n, dot(n, a)};
+    }
+}
+
+//
+// Closest Points
+//
+
+namespace vmath_hpp::impl
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T segment_parameter(const vec<T, Size>& a, const vec<T, Size>& b, const vec<T, Size>& p) {
+        const vec<T, Size> ab = b - a;
+        const T l2 = dot(ab, ab);
+        return l2 > T{0} ? clamp(dot(p - a, ab) / l2, T{0}, T{1}) : T{0};
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> clamp_to_sphere(const vec<T, Size>& c, T r, const vec<T, Size>& p) {
+        const vec<T, Size> d = p - c;
+        const T l2 = dot(d, d);
+        return l2 > sqr(r) ? c + d * (r * rsqrt(l2)) : p;
+    }
+}
+
+namespace vmath_hpp
+{
+    // closest_point
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const plane<T, Size>& pl, const vec<T, Size>& p) {
+        return p - pl.normal * (dot(pl.normal, p) - pl.offset);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const segment<T, Size>& s, const vec<T, Size>& p) {
+        return s.a + (s.b - s.a) * impl::segment_parameter(s.a, s.b, p);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const triangle<T, Size>& t, const vec<T, Size>& p) {
+        /// REFERENCE:
+        /// Christer Ericson, "Real-Time Collision Detection", 5.1.5
+
+        const vec<T, Size> ab = t.b - t.a;
+        const vec<T, Size> ac = t.c - t.a;
+
+        const vec<T, Size> ap = p - t.a;
+        const T d1 = dot(ab, ap);
+        const T d2 = dot(ac, ap);
+        if ( d1 <= T{0} && d2 <= T{0} ) {
+            return t.a;
+        }
+
+        const vec<T, Size> bp = p - t.b;
+        const T d3 = dot(ab, bp);
+        const T d4 = dot(ac, bp);
+        if ( d3 >= T{0} && d4 <= d3 ) {
+            return t.b;
+        }
+
+        const T vc = d1 * d4 - d3 * d2;
+        if ( vc <= T{0} && d1 >= T{0} && d3 <= T{0} ) {
+            return t.a + ab * (d1 / (d1 - d3));
+        }
+
+        const vec<T, Size> cp = p - t.c;
+        const T d5 = dot(ab, cp);
+        const T d6 = dot(ac, cp);
+        if ( d6 >= T{0} && d5 <= d6 ) {
+            return t.c;
+        }
+
+        const T vb = d5 * d2 - d1 * d6;
+        if ( vb <= T{0} && d2 >= T{0} && d6 <= T{0} ) {
+            return t.a + ac * (d2 / (d2 - d6));
+        }
+
+        const T va = d3 * d6 - d5 * d4;
+        if ( va <= T{0} && (d4 - d3) >= T{0} && (d5 - d6) >= T{0} ) {
+            return t.b + (t.c - t.b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+        }
+
+        const T denom = rcp(va + vb + vc);
+        return t.a + ab * (vb * denom) + ac * (vc * denom);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const sphere<T, Size>& s, const vec<T, Size>& p) {
+        return impl::clamp_to_sphere(s.center, s.radius, p);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const capsule<T, Size>& c, const vec<T, Size>& p) {
+        const vec<T, Size> q = c.a + (c.b - c.a) * impl::segment_parameter(c.a, c.b, p);
+        return impl::clamp_to_sphere(q, c.radius, p);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const aabb<T, Size>& b, const vec<T, Size>& p) {
+        return clamp(p, b.min, b.max);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> closest_point(const obb<T, Size>& b, const vec<T, Size>& p) {
+        const vec<T, Size> d = p - b.center;
+        vec<T, Size> q = b.center;
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            q += b.axes[i] * clamp(dot(d, b.axes[i]), -b.half_extents[i], b.half_extents[i]);
+        }
+        return q;
+    }
+
+    // closest_points
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr std::pair<vec<T, Size>, vec<T, Size>> closest_points(const segment<T, Size>& s1, const segment<T, Size>& s2) {
+        /// REFERENCE:
+        /// Christer Ericson, "Real-Time Collision Detection", 5.1.9
+
+        const vec<T, Size> d1 = s1.b - s1.a;
+        const vec<T, Size> d2 = s2.b - s2.a;
+        const vec<T, Size> r = s1.a - s2.a;
+
+        const T a = dot(d1, d1);
+        const T e = dot(d2, d2);
+        const T f = dot(d2, r);
+
+        T s{0};
+        T t{0};
+
+        if ( a <= T{0} && e <= T{0} ) {
+            // both segments are points
+        } else if ( a <= T{0} ) {
+            t = clamp(f / e, T{0}, T{1});
+        } else {
+            const T c = dot(d1, r);
+            if ( e <= T{0} ) {
+                s = clamp(-c / a, T{0}, T{1});
+            } else {
+                const T b = dot(d1, d2);
+                const T denom = a * e - b * b;
+
+                // parallel segments: any s works, pick the start of the first one
+                s = denom > T{0} ? clamp((b * f - c * e) / denom, T{0}, T{1}) : T{0};
+                t = (b * s + f) / e;
+
+                if ( t < T{0} ) {
+                    t = T{0};
+                    s = clamp(-c / a, T{0}, T{1});
+                } else if ( t > T{1} ) {
+                    t = T{1};
+                    s = clamp((b - c) / a, T{0}, T{1});
+                }
+            }
+        }
+
+        return {s1.a + d1 * s, s2.a + d2 * t};
+    }
+}
+
+//
+// Distances
+//
+
+namespace vmath_hpp
+{
+    // signed_distance
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T signed_distance(const plane<T, Size>& pl, const vec<T, Size>& p) {
+        return dot(pl.normal, p) - pl.offset;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T signed_distance(const sphere<T, Size>& s, const vec<T, Size>& p) {
+        return distance(s.center, p) - s.radius;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T signed_distance(const capsule<T, Size>& c, const vec<T, Size>& p) {
+        return distance(c.a + (c.b - c.a) * impl::segment_parameter(c.a, c.b, p), p) - c.radius;
+    }
+
+    // distance
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const plane<T, Size>& pl, const vec<T, Size>& p) {
+        return abs(signed_distance(pl, p));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const segment<T, Size>& s, const vec<T, Size>& p) {
+        return distance(closest_point(s, p), p);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const triangle<T, Size>& t, const vec<T, Size>& p) {
+        return distance(closest_point(t, p), p);
+    }
+
+    // zero inside the solid primitives
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const sphere<T, Size>& s, const vec<T, Size>& p) {
+        return max(signed_distance(s, p), T{0});
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const capsule<T, Size>& c, const vec<T, Size>& p) {
+        return max(signed_distance(c, p), T{0});
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const aabb<T, Size>& b, const vec<T, Size>& p) {
+        return distance(closest_point(b, p), p);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr T distance(const obb<T, Size>& b, const vec<T, Size>& p) {
+        return distance(closest_point(b, p), p);
+    }
+}
+
+//
+// Overlaps
+//
+
+namespace vmath_hpp
+{
+    // overlaps
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool overlaps(const sphere<T, Size>& a, const sphere<T, Size>& b) {
+        return distance2(a.center, b.center) <= sqr(a.radius + b.radius);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool overlaps(const aabb<T, Size>& a, const aabb<T, Size>& b) {
+        return all(less_equal(a.min, b.max)) && all(less_equal(b.min, a.max));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr bool overlaps(const capsule<T, Size>& a, const capsule<T, Size>& b) {
+        const auto [pa, pb] = closest_points(segment<T, Size>{a.a, a.b}, segment<T, Size>{b.a, b.b});
+        return distance2(pa, pb) <= sqr(a.radius + b.radius);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr std::enable_if_t<Size == 2 || Size == 3, bool>
+    overlaps(const obb<T, Size>& a, const obb<T, Size>& b) {
+        /// REFERENCE:
+        /// Christer Ericson, "Real-Time Collision Detection", 4.4.1
+
+        // b in the frame of a, the epsilon keeps near parallel edges
+        // from producing a null cross product axis that separates anything
+        mat<T, Size> r{no_init};
+        mat<T, Size> abs_r{no_init};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            for ( std::size_t j = 0; j < Size; ++j ) {
+                r[i][j] = dot(a.axes[i], b.axes[j]);
+                abs_r[i][j] = abs(r[i][j]) + std::numeric_limits<T>::epsilon();
+            }
+        }
+
+        vec<T, Size> t{no_init};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            t[i] = dot(b.center - a.center, a.axes[i]);
+        }
+
+        const vec<T, Size>& ea = a.half_extents;
+        const vec<T, Size>& eb = b.half_extents;
+
+        // the axes of a
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            if ( abs(t[i]) > ea[i] + dot(eb, abs_r[i]) ) {
+                return false;
+            }
+        }
+
+        // the axes of b
+        for ( std::size_t j = 0; j < Size; ++j ) {
+            T ra{0};
+            T tl{0};
+            for ( std::size_t i = 0; i < Size; ++i ) {
+                ra += ea[i] * abs_r[i][j];
+                tl += t[i] * r[i][j];
+            }
+            if ( abs(tl) > ra + eb[j] ) {
+                return false;
+            }
+        }
+
+        // the cross products of the axes of a and b
+        if constexpr ( Size == 3 ) {
+            for ( std::size_t i = 0; i < 3; ++i ) {
+                const std::size_t i1 = (i + 1) % 3;
+                const std::size_t i2 = (i + 2) % 3;
+                for ( std::size_t j = 0; j < 3; ++j ) {
+                    const std::size_t j1 = (j + 1) % 3;
+                    const std::size_t j2 = (j + 2) % 3;
+                    const T ra = ea[i1] * abs_r[i2][j] + ea[i2] * abs_r[i1][j];
+                    const T rb = eb[j1] * abs_r[i][j2] + eb[j2] * abs_r[i][j1];
+                    if ( abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > ra + rb ) {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+//
+// Batch Queries
+//
+
+namespace vmath_hpp
+{
+    // overlaps
+
+    template < typename Q, typename InputIt, typename OutputIt >
+    constexpr OutputIt overlaps(const Q& query, InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = overlaps(query, *first);
+        }
+        return d_first;
+    }
+
+    // distance
+
+    template < typename InputIt, typename OutputIt, typename T, std::size_t Size >
+    constexpr OutputIt distance(const vec<T, Size>& p, InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = distance(*first, p);
+        }
+        return d_first;
+    }
+
+    // closest_point
+
+    template < typename InputIt, typename OutputIt, typename T, std::size_t Size >
+    constexpr OutputIt closest_point(const vec<T, Size>& p, InputIt first, InputIt last, OutputIt d_first) {
+        for ( ; first != last; ++first, ++d_first ) {
+            *d_first = closest_point(*first, p);
+        }
+        return d_first;
+    }
+
+    // structure of arrays: components[c][i] is the component c of the primitive i,
+    // the loops have no branches and no gathers, so they vectorize
+
+    // signed_distance_soa
+
+    template < typename T, std::size_t Size >
+    constexpr void signed_distance_soa(
+        const vec<T, Size>& p,
+        const T* const (&normals)[Size], const T* offsets, std::size_t n,
+        T* out)
+    {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            T d = -offsets[i];
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                d += normals[c][i] * p[c];
+            }
+            out[i] = d;
+        }
+    }
+
+    // overlaps_soa
+
+    template < typename T, std::size_t Size >
+    constexpr void overlaps_soa(
+        const sphere<T, Size>& query,
+        const T* const (&centers)[Size], const T* radii, std::size_t n,
+        bool* out)
+    {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            T d2{0};
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                d2 += sqr(centers[c][i] - query.center[c]);
+            }
+            out[i] = d2 <= sqr(radii[i] + query.radius);
+        }
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr void overlaps_soa(
+        const aabb<T, Size>& query,
+        const T* const (&mins)[Size], const T* const (&maxs)[Size], std::size_t n,
+        bool* out)
+    {
+        for ( std::size_t i = 0; i < n; ++i ) {
+            bool o = true;
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                o = o & (mins[c][i] <= query.max[c]) & (query.min[c] <= maxs[c][i]);
+            }
+            out[i] = o;
+        }
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr void overlaps_soa(
+        const capsule<T, Size>& query,
+        const T* const (&as)[Size], const T* const (&bs)[Size], const T* radii, std::size_t n,
+        bool* out)
+    {
+        // closest_points of the segments in blocks of lanes, the branches are turned
+        // into selects and every lane computes all the cases, the same operations as overlaps
+        const vec<T, Size> d1v = query.b - query.a;
+        const T a = dot(d1v, d1v);
+        const T a_safe = a > T{0} ? a : T{1};
+
+        // plain arrays, the switch of vec<T, 3>::operator[] isn't hoisted out of the loops
+        T p1[Size];
+        T d1[Size];
+        for ( std::size_t c = 0; c < Size; ++c ) {
+            p1[c] = query.a[c];
+            d1[c] = d1v[c];
+        }
+
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            T d2[Size][lanes];
+            T r[Size][lanes];
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                for ( std::size_t l = 0; l < w; ++l ) {
+                    d2[c][l] = bs[c][i + l] - as[c][i + l];
+                    r[c][l] = p1[c] - as[c][i + l];
+                }
+            }
+
+            T e[lanes];
+            T f[lanes];
+            T b[lanes];
+            T cc[lanes];
+            for ( std::size_t l = 0; l < w; ++l ) {
+                e[l] = d2[0][l] * d2[0][l];
+                f[l] = d2[0][l] * r[0][l];
+                b[l] = d1[0] * d2[0][l];
+                cc[l] = d1[0] * r[0][l];
+            }
+            for ( std::size_t c = 1; c < Size; ++c ) {
+                for ( std::size_t l = 0; l < w; ++l ) {
+                    e[l] += d2[c][l] * d2[c][l];
+                    f[l] += d2[c][l] * r[c][l];
+                    b[l] += d1[c] * d2[c][l];
+                    cc[l] += d1[c] * r[c][l];
+                }
+            }
+
+            T ss[lanes];
+            T ts[lanes];
+            for ( std::size_t l = 0; l < w; ++l ) {
+                // the divisors of the cases a lane doesn't select are replaced by ones
+                const bool e_positive = e[l] > T{0};
+                const T e_safe = e_positive ? e[l] : T{1};
+                const T denom = a * e[l] - b[l] * b[l];
+                const T denom_safe = denom > T{0} ? denom : T{1};
+
+                // all the comparisons are made unconditionally, a conditional
+                // one is a branch, it may raise an exception on a nan
+                const T q0 = clamp((b[l] * f[l] - cc[l] * e[l]) / denom_safe, T{0}, T{1});
+                const T s0 = denom > T{0} ? q0 : T{0};
+                const T t0 = (b[l] * s0 + f[l]) / e_safe;
+                const T s_lo = clamp(-cc[l] / a_safe, T{0}, T{1});
+                const T s_hi = clamp((b[l] - cc[l]) / a_safe, T{0}, T{1});
+                const T t_a = clamp(f[l] / e_safe, T{0}, T{1});
+                const bool t_below = t0 < T{0};
+                const bool t_above = t0 > T{1};
+
+                T s = t_below ? s_lo : (t_above ? s_hi : s0);
+                T t = t_below ? T{0} : (t_above ? T{1} : t0);
+
+                // one of the segments is a point
+                s = e_positive ? s : s_lo;
+                t = e_positive ? t : T{0};
+                ss[l] = a > T{0} ? s : T{0};
+                ts[l] = a > T{0} ? t : (e_positive ? t_a : T{0});
+            }
+
+            T dist2[lanes];
+            for ( std::size_t l = 0; l < w; ++l ) {
+                const T d = p1[0] + d1[0] * ss[l] - (as[0][i + l] + d2[0][l] * ts[l]);
+                dist2[l] = d * d;
+            }
+            for ( std::size_t c = 1; c < Size; ++c ) {
+                for ( std::size_t l = 0; l < w; ++l ) {
+                    const T d = p1[c] + d1[c] * ss[l] - (as[c][i + l] + d2[c][l] * ts[l]);
+                    dist2[l] += d * d;
+                }
+            }
+
+            for ( std::size_t l = 0; l < w; ++l ) {
+                out[i + l] = dist2[l] <= sqr(query.radius + radii[i + l]);
+            }
+        }
+    }
+
+    template < typename T, std::size_t Size >
+    constexpr std::enable_if_t<Size == 2 || Size == 3, void> overlaps_soa(
+        const obb<T, Size>& query,
+        const T* const (&centers)[Size], const T* const (&axes)[Size][Size], const T* const (&half_extents)[Size], std::size_t n,
+        bool* out)
+    {
+        // axes[r][c][i] is the component c of the axis r of the box i, the separating
+        // axes are tested in blocks of lanes without an early exit, the same operations as overlaps
+
+        // plain arrays, the switch of vec<T, 3>::operator[] isn't hoisted out of the loops
+        T aa[Size][Size];
+        T ea[Size];
+        T ca[Size];
+        for ( std::size_t k = 0; k < Size; ++k ) {
+            for ( std::size_t c = 0; c < Size; ++c ) {
+                aa[k][c] = query.axes[k][c];
+            }
+            ea[k] = query.half_extents[k];
+            ca[k] = query.center[k];
+        }
+
+        constexpr std::size_t lanes = 16;
+        for ( std::size_t i = 0; i < n; i += lanes ) {
+            const std::size_t w = n - i < lanes ? n - i : lanes;
+
+            // the box in the frame of the query
+            T r[Size][Size][lanes];
+            T abs_r[Size][Size][lanes];
+            for ( std::size_t k = 0; k < Size; ++k ) {
+                for ( std::size_t j = 0; j < Size; ++j ) {
+                    for ( std::size_t l = 0; l < w; ++l ) {
+                        T d = aa[k][0] * axes[j][0][i + l];
+                        for ( std::size_t c = 1; c < Size; ++c ) {
+                            d += aa[k][c] * axes[j][c][i + l];
+                        }
+                        r[k][j][l] = d;
+                        abs_r[k][j][l] = abs(d) + std::numeric_limits<T>::epsilon();
+                    }
+                }
+            }
+
+            T t[Size][lanes];
+            for ( std::size_t k = 0; k < Size; ++k ) {
+                for ( std::size_t l = 0; l < w; ++l ) {
+                    T d = (centers[0][i + l] - ca[0]) * aa[k][0];
+                    for ( std::size_t c = 1; c < Size; ++c ) {
+                        d += (centers[c][i + l] - ca[c]) * aa[k][c];
+                    }
+                    t[k][l] = d;
+                }
+            }
+
+            // ints, loops over bools aren't vectorized
+            int o[lanes];
+            for ( std::size_t l = 0; l < w; ++l ) {
+                o[l] = 1;
+            }
+
+            // the axes of the query
+            for ( std::size_t k = 0; k < Size; ++k ) {
+                for ( std::size_t l = 0; l < w; ++l ) {
+                    T rb = half_extents[0][i + l] * abs_r[k][0][l];
+                    for ( std::size_t j = 1; j < Size; ++j ) {
+                        rb += half_extents[j][i + l] * abs_r[k][j][l];
+                    }
+                    o[l] = o[l] & !(abs(t[k][l]) > ea[k] + rb);
+                }
+            }
+
+            // the axes of the box
+            for ( std::size_t j = 0; j < Size; ++j ) {
+                for ( std::size_t l = 0; l < w; ++l ) {
+                    T ra{0};
+                    T tl{0};
+                    for ( std::size_t k = 0; k < Size; ++k ) {
+                        ra += ea[k] * abs_r[k][j][l];
+                        tl += t[k][l] * r[k][j][l];
+                    }
+                    o[l] = o[l] & !(abs(tl) > ra + half_extents[j][i + l]);
+                }
+            }
+
+            // the cross products of the axes
+            if constexpr ( Size == 3 ) {
+                for ( std::size_t k = 0; k < 3; ++k ) {
+                    const std::size_t k1 = (k + 1) % 3;
+                    const std::size_t k2 = (k + 2) % 3;
+                    for ( std::size_t j = 0; j < 3; ++j ) {
+                        const std::size_t j1 = (j + 1) % 3;
+                        const std::size_t j2 = (j + 2) % 3;
+                        for ( std::size_t l = 0; l < w; ++l ) {
+                            const T ra = ea[k1] * abs_r[k2][j][l] + ea[k2] * abs_r[k1][j][l];
+                            const T rb = half_extents[j1][i + l] * abs_r[k][j2][l] + half_extents[j2][i + l] * abs_r[k][j1][l];
+                            o[l] = o[l] & !(abs(t[k2][l] * r[k1][j][l] - t[k1][l] * r[k2][j][l]) > ra + rb);
+                        }
+                    }
+                }
+            }
+
+            for ( std::size_t l = 0; l < w; ++l ) {
+                out[i + l] = o[l] != 0;
+            }
+        }
+    }
+}
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_mat_fun.hpp"
+#include "vmath_qua_fun.hpp"
+#include "vmath_vec_fun.hpp"
+
+#include <functional>
+
+//
+// Hash
+//
+
+namespace vmath_hpp::detail
+{
+    struct hash_combiner {
+        template < typename T >
+        [[nodiscard]] std::size_t operator()(std::size_t seed, const T& x) const noexcept {
+            return (seed ^= std::hash<T>{}(x) + 0x9e3779b9 + (seed << 6) + ( seed >> 2));
+        }
+    };
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] std::size_t hash(const vec<T, Size>& v) noexcept {
+        return fold_join(hash_combiner{}, std::size_t{}, v);
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] std::size_t hash(const mat<T, Rows, Cols>& m) noexcept {
+        return fold_join(hash_combiner{}, std::size_t{}, m);
+    }
+
+    template < typename T >
+    [[nodiscard]] std::size_t hash(const qua<T>& q) noexcept {
+        return fold_join(hash_combiner{}, std::size_t{}, q);
+    }
+}
+
+namespace std
+{
+    template < typename T, size_t Size >
+    struct hash<vmath_hpp::vec<T, Size>> {
+        size_t operator()(const vmath_hpp::vec<T, Size>& v) const noexcept {
+            return vmath_hpp::detail::hash(v);
+        }
+    };
+
+    template < typename T, size_t Rows, size_t Cols >
+    struct hash<vmath_hpp::mat<T, Rows, Cols>> {
+        size_t operator()(const vmath_hpp::mat<T, Rows, Cols>& m) const noexcept {
+            return vmath_hpp::detail::hash(m);
+        }
+    };
+
+    template < typename T >
+    struct hash<vmath_hpp::qua<T>> {
+        size_t operator()(const vmath_hpp::qua<T>& q) const noexcept {
+            return vmath_hpp::detail::hash(q);
+        }
+    };
+}
@@ -0,0 +1,449 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+// included by vmath_fwd.hpp, must not depend on the rest of the library,
+// everything below is compiled out unless VMATH_HPP_INSTRUMENT or VMATH_HPP_CHECKED is defined
+
+#if defined(VMATH_HPP_INSTRUMENT) || defined(VMATH_HPP_CHECKED)
+#  include <atomic>
+#  include <cstddef>
+#  include <cstdint>
+#  include <cstdio>
+#endif
+
+#if defined(VMATH_HPP_INSTRUMENT)
+#  include <chrono>
+#  include <mutex>
+#endif
+
+#if defined(VMATH_HPP_CHECKED)
+#  include <cmath>
+#  include <type_traits>
+#endif
+
+#if defined(VMATH_HPP_INSTRUMENT) || defined(VMATH_HPP_CHECKED)
+#  if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#    define VMATH_HPP_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#  else
+#    error "VMATH_HPP_INSTRUMENT and VMATH_HPP_CHECKED require __builtin_is_constant_evaluated"
+#  endif
+#endif
+
+#if defined(VMATH_HPP_INSTRUMENT)
+#  define VMATH_HPP_INSTRUMENT_CALL(id, flops)\
+    ( VMATH_HPP_IS_CONSTANT_EVALUATED() ? (void)0 :\
+        ::vmath_hpp::instrument::impl::record(::vmath_hpp::instrument::function::id, (flops)) )
+#else
+#  define VMATH_HPP_INSTRUMENT_CALL(id, flops) (void)0
+#endif
+
+#if defined(VMATH_HPP_CHECKED)
+#  define VMATH_HPP_CHECK_RESULT(name, ...)\
+    ::vmath_hpp::checked::impl::check_result(name, __FILE__, __LINE__, __VA_ARGS__)
+#else
+#  define VMATH_HPP_CHECK_RESULT(name, ...) (__VA_ARGS__)
+#endif
+
+#if defined(VMATH_HPP_INSTRUMENT)
+
+//
+// Instrumentation
+//
+
+namespace vmath_hpp::instrument
+{
+    enum class function : unsigned char {
+        mat_mul,
+        determinant,
+        inverse,
+        normalize,
+        qua_mul,
+        vec_qua_mul,
+        qua_inverse,
+        nlerp,
+        slerp,
+        rotate,
+        qrotate,
+        look_at,
+        count,
+    };
+
+    inline constexpr std::size_t function_count = static_cast<std::size_t>(function::count);
+
+    struct counter {
+        std::uint64_t calls{};
+        std::uint64_t flops{};
+    };
+
+    // user_data is passed through unchanged, the callbacks may be called from any thread
+    struct hooks {
+        void (*on_call)(function f, std::uint64_t flops, void* user_data){};
+        void (*on_zone)(const char* name, std::uint64_t begin_ns, std::uint64_t end_ns, void* user_data){};
+        void* user_data{};
+    };
+}
+
+namespace vmath_hpp::instrument::impl
+{
+    inline thread_local counter thread_counters[function_count]{};
+
+    inline std::atomic<const hooks*> installed_hooks{nullptr};
+    inline std::atomic<unsigned> zone_sample_rate{0};
+
+    [[nodiscard]] inline std::uint64_t now_ns() noexcept {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
+
+    [[nodiscard]] inline unsigned thread_index() noexcept {
+        static std::atomic<unsigned> next_index{0};
+        static thread_local const unsigned index = next_index.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+
+    inline void record(function f, std::uint64_t flops) noexcept {
+        counter& c = thread_counters[static_cast<std::size_t>(f)];
+        c.calls += 1;
+        c.flops += flops;
+
+        if ( const hooks* h = installed_hooks.load(std::memory_order_acquire); h && h->on_call ) {
+            h->on_call(f, flops, h->user_data);
+        }
+    }
+}
+
+namespace vmath_hpp::instrument
+{
+    // function_name
+
+    [[nodiscard]] inline const char* function_name(function f) noexcept {
+        constexpr const char* names[function_count] = {
+            "mat * mat",
+            "determinant",
+            "inverse",
+            "normalize",
+            "qua * qua",
+            "vec * qua",
+            "inverse(qua)",
+            "nlerp",
+            "slerp",
+            "rotate",
+            "qrotate",
+            "look_at",
+        };
+        return names[static_cast<std::size_t>(f)];
+    }
+
+    // thread_counter
+
+    [[nodiscard]] inline counter thread_counter(function f) noexcept {
+        return impl::thread_counters[static_cast<std::size_t>(f)];
+    }
+
+    // reset_thread_counters
+
+    inline void reset_thread_counters() noexcept {
+        for ( counter& c : impl::thread_counters ) {
+            c = counter{};
+        }
+    }
+
+    // dump_thread_counters
+
+    inline void dump_thread_counters(std::FILE* out) {
+        for ( std::size_t i = 0; i < function_count; ++i ) {
+            if ( const counter& c = impl::thread_counters[i]; c.calls > 0 ) {
+                std::fprintf(out, "%-14s %12llu calls %14llu flops\n",
+                    function_name(static_cast<function>(i)),
+                    static_cast<unsigned long long>(c.calls),
+                    static_cast<unsigned long long>(c.flops));
+            }
+        }
+    }
+
+    // set_hooks
+
+    inline void set_hooks(const hooks* h) noexcept {
+        // the hooks must outlive the installation, pass nullptr to remove them
+        impl::installed_hooks.store(h, std::memory_order_release);
+    }
+
+    // set_zone_sample_rate
+
+    inline void set_zone_sample_rate(unsigned rate) noexcept {
+        // 0 disables zone timers, N times every Nth zone entered on each thread
+        impl::zone_sample_rate.store(rate, std::memory_order_relaxed);
+    }
+
+    // zone
+
+    class zone final {
+    public:
+        explicit zone(const char* name) noexcept
+        : name_{name} {
+            static thread_local unsigned entered{0};
+            const unsigned rate = impl::zone_sample_rate.load(std::memory_order_relaxed);
+            if ( rate > 0 && ++entered % rate == 0 ) {
+                begin_ns_ = impl::now_ns();
+            }
+        }
+
+        ~zone() noexcept {
+            if ( begin_ns_ == 0 ) {
+                return;
+            }
+            if ( const hooks* h = impl::installed_hooks.load(std::memory_order_acquire); h && h->on_zone ) {
+                h->on_zone(name_, begin_ns_, impl::now_ns(), h->user_data);
+            }
+        }
+
+        zone(const zone&) = delete;
+        zone& operator=(const zone&) = delete;
+    private:
+        const char* name_{};
+        std::uint64_t begin_ns_{};
+    };
+
+    // trace_writer
+
+    class trace_writer final {
+    public:
+        // writes the Chrome trace event format, loadable by Perfetto and chrome://tracing
+        explicit trace_writer(std::FILE* out)
+        : out_{out} {
+            std::fputs("{\"traceEvents\":[", out_);
+        }
+
+        ~trace_writer() {
+            const hooks* self = &hooks_;
+            impl::installed_hooks.compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+            std::fputs("\n]}\n", out_);
+            std::fflush(out_);
+        }
+
+        trace_writer(const trace_writer&) = delete;
+        trace_writer& operator=(const trace_writer&) = delete;
+
+        [[nodiscard]] const hooks& as_hooks() const noexcept {
+            return hooks_;
+        }
+
+        [[nodiscard]] std::uint64_t event_count() const {
+            const std::lock_guard<std::mutex> guard{mutex_};
+            return event_count_;
+        }
+    private:
+        static void on_call(function f, std::uint64_t flops, void* user_data) {
+            auto* self = static_cast<trace_writer*>(user_data);
+            const std::lock_guard<std::mutex> guard{self->mutex_};
+            self->begin_event_();
+            std::fprintf(self->out_,
+                R"({"name":"%s","cat":"vmath","ph":"i","s":"t","ts":%.3f,"pid":1,"tid":%u,"args":{"flops":%llu}})",
+                function_name(f),
+                static_cast<double>(impl::now_ns()) / 1000.0,
+                impl::thread_index(),
+                static_cast<unsigned long long>(flops));
+        }
+
+        static void on_zone(const char* name, std::uint64_t begin_ns, std::uint64_t end_ns, void* user_data) {
+            auto* self = static_cast<trace_writer*>(user_data);
+            const std::lock_guard<std::mutex> guard{self->mutex_};
+            self->begin_event_();
+            std::fputs(R"({"name":")", self->out_);
+            for ( const char* c = name; *c; ++c ) {
+                if ( *c == '"' || *c == '\\' ) {
+                    std::fputc('\\', self->out_);
+                }
+                std::fputc(*c, self->out_);
+            }
+            std::fprintf(self->out_,
+                R"(","cat":"zone","ph":"X","ts":%.3f,"dur":%.3f,"pid":1,"tid":%u})",
+                static_cast<double>(begin_ns) / 1000.0,
+                static_cast<double>(end_ns - begin_ns) / 1000.0,
+                impl::thread_index());
+        }
+
+        void begin_event_() {
+            std::fputs(event_count_ > 0 ? ",\n" : "\n", out_);
+            event_count_ += 1;
+        }
+    private:
+        hooks hooks_{&on_call, &on_zone, this};
+        mutable std::mutex mutex_;
+        std::FILE* out_{};
+        std::uint64_t event_count_{};
+    };
+}
+
+#endif
+
+#if defined(VMATH_HPP_CHECKED)
+
+//
+// Checked Results
+//
+
+namespace vmath_hpp::checked
+{
+    enum class issue : unsigned {
+        nan,
+        infinity,
+    };
+
+    struct report {
+        const char* function{};
+        const char* file{};
+        unsigned line{};
+        const char* scope{};
+        issue what{};
+        unsigned component{};
+    };
+
+    // on_issue is called for every invalid result on the thread that produced it
+    struct handler {
+        void (*on_issue)(const report& r, void* user_data){};
+        void* user_data{};
+    };
+}
+
+namespace vmath_hpp::checked::impl
+{
+    inline thread_local const char* thread_scope{};
+
+    inline thread_local report thread_first_issue{};
+    inline thread_local std::uint64_t thread_issue_count{};
+    inline thread_local std::uint64_t thread_denormal_count{};
+
+    inline std::atomic<const handler*> installed_handler{nullptr};
+
+    template < typename T, typename = void >
+    struct has_components : std::false_type {};
+
+    template < typename T >
+    struct has_components<T, std::void_t<decltype(T::size)>> : std::true_type {};
+
+    struct scan_state {
+        unsigned component{};
+        unsigned bad_component{};
+        bool bad{};
+        issue what{};
+    };
+
+    template < typename T >
+    void scan(const T& value, scan_state& state) noexcept {
+        if constexpr ( std::is_floating_point_v<T> ) {
+            const int category = std::fpclassify(value);
+            if ( category == FP_SUBNORMAL ) {
+                thread_denormal_count += 1;
+            } else if ( !state.bad && (category == FP_NAN || category == FP_INFINITE) ) {
+                state.bad = true;
+                state.bad_component = state.component;
+                state.what = category == FP_NAN ? issue::nan : issue::infinity;
+            }
+            state.component += 1;
+        } else if constexpr ( has_components<T>::value ) {
+            // vec, mat and qua, the matrix components are counted row by row
+            for ( std::size_t i = 0; i < T::size; ++i ) {
+                scan(value[i], state);
+            }
+        } else {
+            // integers and user-defined component types can't be invalid
+            state.component += 1;
+        }
+    }
+
+    inline void report_issue(const report& r) {
+        thread_issue_count += 1;
+        if ( thread_issue_count == 1 ) {
+            thread_first_issue = r;
+        }
+
+        if ( const handler* h = installed_handler.load(std::memory_order_acquire); h && h->on_issue ) {
+            h->on_issue(r, h->user_data);
+        } else if ( thread_issue_count == 1 ) {
+            std::fprintf(stderr, "%s:%u: vmath.hpp: %s in %s, component %u (scope: %s)\n",
+                r.file,
+                r.line,
+                r.what == issue::nan ? "nan" : "infinity",
+                r.function,
+                r.component,
+                r.scope ? r.scope : "none");
+        }
+    }
+
+    template < typename V >
+    constexpr V check_result(const char* function, const char* file, unsigned line, V value) {
+        if ( !VMATH_HPP_IS_CONSTANT_EVALUATED() ) {
+            scan_state state{};
+            scan(value, state);
+            if ( state.bad ) {
+                report_issue({function, file, line, thread_scope, state.what, state.bad_component});
+            }
+        }
+        return value;
+    }
+}
+
+namespace vmath_hpp::checked
+{
+    // set_handler
+
+    inline void set_handler(const handler* h) noexcept {
+        // the handler must outlive the installation, pass nullptr to print
+        // the first issue of each thread to stderr instead
+        impl::installed_handler.store(h, std::memory_order_release);
+    }
+
+    // thread_first_issue
+
+    [[nodiscard]] inline const report* thread_first_issue() noexcept {
+        return impl::thread_issue_count > 0 ? &impl::thread_first_issue : nullptr;
+    }
+
+    // thread_issue_count
+
+    [[nodiscard]] inline std::uint64_t thread_issue_count() noexcept {
+        return impl::thread_issue_count;
+    }
+
+    // thread_denormal_count
+
+    [[nodiscard]] inline std::uint64_t thread_denormal_count() noexcept {
+        return impl::thread_denormal_count;
+    }
+
+    // reset_thread_issues
+
+    inline void reset_thread_issues() noexcept {
+        impl::thread_first_issue = report{};
+        impl::thread_issue_count = 0;
+        impl::thread_denormal_count = 0;
+    }
+
+    // scope
+
+    class scope final {
+    public:
+        // names the reports of the current thread until destroyed, scopes nest
+        explicit scope(const char* name) noexcept
+        : previous_{impl::thread_scope} {
+            impl::thread_scope = name;
+        }
+
+        ~scope() noexcept {
+            impl::thread_scope = previous_;
+        }
+
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+    private:
+        const char* previous_{};
+    };
+}
+
+#endif
@@ -11,13 +11,116 @@
 #include "vmath_vec.hpp"
 #include "vmath_vec_fun.hpp"
 
+#include <initializer_list>
+#include <iterator>
+
 namespace vmath_hpp::detail
 {
-    template < typename T, std::size_t Size >
-    class mat_base;
+    // a shape conversion either truncates both sizes or extends both sizes
+
+    template < std::size_t Rows, std::size_t Cols, std::size_t FromRows, std::size_t FromCols >
+    inline constexpr bool is_mat_reshape_v =
+        (Rows != FromRows || Cols != FromCols) &&
+        ((Rows <= FromRows && Cols <= FromCols) || (Rows >= FromRows && Cols >= FromCols));
+
+    template < typename T, std::size_t Cols, typename U, std::size_t FromRows, std::size_t FromCols >
+    [[nodiscard]] constexpr vec<T, Cols> mat_reshape_row(
+        const vec<U, FromCols> (&rows)[FromRows], // NOLINT(*-avoid-c-arrays)
+        std::size_t i)
+    {
+        // the common part is copied, the rest is taken from the identity
+        vec<T, Cols> r{zero_init};
+        for ( std::size_t j = 0; j < Cols; ++j ) {
+            if ( i < FromRows && j < FromCols ) {
+                r[j] = static_cast<T>(rows[i][j]);
+            } else if ( i == j ) {
+                r[j] = T{1};
+            }
+        }
+        return r;
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols = Rows >
+    class mat_base {
+        static_assert(Rows > 1 && Cols > 1, "mat sizes must be greater than one");
+    public:
+        using row_type = vec<T, Cols>;
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        row_type rows[Rows];
+    public:
+        constexpr mat_base()
+        : mat_base(identity_init) {}
+
+        constexpr mat_base(no_init_t)
+        : mat_base(std::make_index_sequence<Rows>{}, [](std::size_t){ return row_type{no_init}; }) {}
+
+        constexpr mat_base(zero_init_t)
+        : mat_base(std::make_index_sequence<Rows>{}, [](std::size_t){ return row_type{zero_init}; }) {}
+
+        constexpr mat_base(unit_init_t)
+        : mat_base(std::make_index_sequence<Rows>{}, [](std::size_t){ return row_type{unit_init}; }) {}
+
+        constexpr mat_base(identity_init_t): mat_base{T{1}} {}
+
+        constexpr explicit mat_base(T d)
+        : mat_base(std::make_index_sequence<Rows>{}, [d](std::size_t i){
+            row_type r{zero_init};
+            if ( i < Cols ) {
+                r[i] = d;
+            }
+            return r;
+        }) {}
+
+        // the diagonal has min(Rows, Cols) components
+        constexpr explicit mat_base(const vec<T, (Rows < Cols ? Rows : Cols)>& d)
+        : mat_base(std::make_index_sequence<Rows>{}, [&d](std::size_t i){
+            row_type r{zero_init};
+            if ( i < Cols ) {
+                r[i] = d[i];
+            }
+            return r;
+        }) {}
+
+        template < typename... Ts, std::enable_if_t<
+            (sizeof...(Ts) == Rows * Cols) &&
+            (... && std::is_convertible_v<Ts, T>)
+        , int> = 0 >
+        constexpr mat_base(Ts... xs)
+        : mat_base(std::make_index_sequence<Rows>{}, [xs...](std::size_t i){
+            // NOLINTNEXTLINE(*-avoid-c-arrays)
+            const T ms[]{static_cast<T>(xs)...};
+            return row_type{ms + i * Cols};
+        }) {}
+
+        template < typename... Rs, std::enable_if_t<
+            (sizeof...(Rs) == Rows) &&
+            (... && std::is_same_v<Rs, row_type>)
+        , int> = 0 >
+        constexpr mat_base(const Rs&... rs)
+        : rows{rs...} {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr mat_base(const mat_base<U, Rows, Cols>& other)
+        : mat_base(std::make_index_sequence<Rows>{}, [&other](std::size_t i){ return row_type{other.rows[i]}; }) {}
+
+        template < typename U, std::size_t FromRows, std::size_t FromCols, std::enable_if_t<
+            std::is_convertible_v<U, T> &&
+            is_mat_reshape_v<Rows, Cols, FromRows, FromCols>
+        , int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, FromRows, FromCols>& other)
+        : mat_base(std::make_index_sequence<Rows>{}, [&other](std::size_t i){ return mat_reshape_row<T, Cols>(other.rows, i); }) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr explicit mat_base(const U* p)
+        : mat_base(std::make_index_sequence<Rows>{}, [p](std::size_t i){ return row_type{p + i * Cols}; }) {}
+    private:
+        template < std::size_t... Is, typename F >
+        constexpr mat_base(std::index_sequence<Is...>, F&& f)
+        : rows{f(Is)...} {}
+    };
 
     template < typename T >
-    class mat_base<T, 2> {
+    class mat_base<T, 2, 2> {
     public:
         using row_type = vec<T, 2>;
         // NOLINTNEXTLINE(*-avoid-c-arrays)
@@ -68,6 +171,14 @@ namespace vmath_hpp::detail
             row_type{other.rows[0]},
             row_type{other.rows[1]}) {}
 
+        template < typename U, std::size_t FromRows, std::size_t FromCols, std::enable_if_t<
+            std::is_convertible_v<U, T> && FromRows != FromCols &&
+            is_mat_reshape_v<2, 2, FromRows, FromCols>
+        , int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, FromRows, FromCols>& other): mat_base(
+            mat_reshape_row<T, 2>(other.rows, 0),
+            mat_reshape_row<T, 2>(other.rows, 1)) {}
+
         template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
         constexpr explicit mat_base(const U* p): mat_base(
             row_type{p + 0u * row_type::size},
@@ -75,7 +186,7 @@ namespace vmath_hpp::detail
     };
 
     template < typename T >
-    class mat_base<T, 3> {
+    class mat_base<T, 3, 3> {
     public:
         using row_type = vec<T, 3>;
         // NOLINTNEXTLINE(*-avoid-c-arrays)
@@ -142,6 +253,15 @@ namespace vmath_hpp::detail
             row_type{other.rows[1]},
             row_type{other.rows[2]}) {}
 
+        template < typename U, std::size_t FromRows, std::size_t FromCols, std::enable_if_t<
+            std::is_convertible_v<U, T> && FromRows != FromCols &&
+            is_mat_reshape_v<3, 3, FromRows, FromCols>
+        , int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, FromRows, FromCols>& other): mat_base(
+            mat_reshape_row<T, 3>(other.rows, 0),
+            mat_reshape_row<T, 3>(other.rows, 1),
+            mat_reshape_row<T, 3>(other.rows, 2)) {}
+
         template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
         constexpr explicit mat_base(const U* p): mat_base(
             row_type{p + 0u * row_type::size},
@@ -150,7 +270,7 @@ namespace vmath_hpp::detail
     };
 
     template < typename T >
-    class mat_base<T, 4> {
+    class mat_base<T, 4, 4> {
     public:
         using row_type = vec<T, 4>;
         // NOLINTNEXTLINE(*-avoid-c-arrays)
@@ -226,6 +346,16 @@ namespace vmath_hpp::detail
             row_type{other.rows[2], T{0}},
             row_type{T{0}, T{0}, T{0}, T{1}}) {}
 
+        template < typename U, std::size_t FromRows, std::size_t FromCols, std::enable_if_t<
+            std::is_convertible_v<U, T> && FromRows != FromCols &&
+            is_mat_reshape_v<4, 4, FromRows, FromCols>
+        , int> = 0 >
+        constexpr explicit mat_base(const mat_base<U, FromRows, FromCols>& other): mat_base(
+            mat_reshape_row<T, 4>(other.rows, 0),
+            mat_reshape_row<T, 4>(other.rows, 1),
+            mat_reshape_row<T, 4>(other.rows, 2),
+            mat_reshape_row<T, 4>(other.rows, 3)) {}
+
         template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
         constexpr explicit mat_base(const U* p): mat_base(
             row_type{p + 0u * row_type::size},
@@ -237,14 +367,15 @@ namespace vmath_hpp::detail
 
 namespace vmath_hpp
 {
-    template < typename T, std::size_t Size >
-    class mat final : public detail::mat_base<T, Size> {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    class mat final : public detail::mat_base<T, Rows, Cols> {
     public:
         using self_type = mat;
-        using base_type = detail::mat_base<T, Size>;
+        using base_type = detail::mat_base<T, Rows, Cols>;
         using component_type = T;
 
-        using row_type = vec<T, Size>;
+        using row_type = vec<T, Cols>;
+        using column_type = vec<T, Rows>;
 
         using pointer = row_type*;
         using const_pointer = const row_type*;
@@ -257,14 +388,14 @@ namespace vmath_hpp
         using reverse_iterator = std::reverse_iterator<iterator>;
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-        static inline constexpr std::size_t size = Size;
+        static inline constexpr std::size_t size = Rows;
     public:
         using base_type::mat_base;
         using base_type::rows;
 
         // NOLINTNEXTLINE(*-noexcept-swap)
         void swap(mat& other) noexcept(std::is_nothrow_swappable_v<T>) {
-            for ( std::size_t i = 0; i < Size; ++i ) {
+            for ( std::size_t i = 0; i < Rows; ++i ) {
                 using std::swap;
                 swap(rows[i], other.rows[i]);
             }
@@ -272,8 +403,8 @@ namespace vmath_hpp
 
         [[nodiscard]] iterator begin() noexcept { return iterator(data()); }
         [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(data()); }
-        [[nodiscard]] iterator end() noexcept { return iterator(data() + Size); }
-        [[nodiscard]] const_iterator end() const noexcept { return const_iterator(data() + Size); }
+        [[nodiscard]] iterator end() noexcept { return iterator(data() + Rows); }
+        [[nodiscard]] const_iterator end() const noexcept { return const_iterator(data() + Rows); }
 
         [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
         [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
@@ -354,11 +485,33 @@ namespace vmath_hpp
     template < typename T >
     mat(std::initializer_list<T>, std::initializer_list<T>, std::initializer_list<T>, std::initializer_list<T>) -> mat<T, 4>;
 
+    // matRxC
+
+    template < typename T, std::size_t Cols, typename... Rs, std::enable_if_t<
+        (... && std::is_same_v<vec<T, Cols>, Rs>)
+    , int> = 0 >
+    mat(const vec<T, Cols>&, const Rs&...) -> mat<T, 1 + sizeof...(Rs), Cols>;
+
     // swap
 
-    template < typename T, std::size_t Size >
+    template < typename T, std::size_t Rows, std::size_t Cols >
     // NOLINTNEXTLINE(*-noexcept-swap)
-    void swap(mat<T, Size>& l, mat<T, Size>& r) noexcept(noexcept(l.swap(r))) {
+    void swap(mat<T, Rows, Cols>& l, mat<T, Rows, Cols>& r) noexcept(noexcept(l.swap(r))) {
         l.swap(r);
     }
 }
+
+namespace vmath_hpp::detail
+{
+    // the rows are packed vectors, so the matrix is a packed row-major array
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    inline constexpr bool is_packed_mat_v =
+        std::is_standard_layout_v<mat<T, Rows, Cols>> &&
+        std::is_trivially_copyable_v<mat<T, Rows, Cols>> &&
+        sizeof(mat<T, Rows, Cols>) == sizeof(T) * Rows * Cols;
+
+    static_assert(is_packed_mat_v<float, 2, 2> && is_packed_mat_v<float, 3, 3> && is_packed_mat_v<float, 4, 4>);
+    static_assert(is_packed_mat_v<double, 2, 2> && is_packed_mat_v<double, 3, 3> && is_packed_mat_v<double, 4, 4>);
+    static_assert(is_packed_mat_v<float, 3, 4> && is_packed_mat_v<int, 4, 4>);
+}
@@ -14,88 +14,92 @@
 #include "vmath_vec.hpp"
 #include "vmath_vec_fun.hpp"
 
+#include <limits>
+#include <tuple>
+#include <utility>
+
 namespace vmath_hpp::detail::impl
 {
-    template < typename A, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto map_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const mat<A, Size>& a,
+        const mat<A, Rows, Cols>& a,
         std::index_sequence<Is...>)
     {
         return mat{ f(a[Is])... };
     }
 
-    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto map_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const mat<A, Size>& a,
-        const mat<B, Size>& b,
+        const mat<A, Rows, Cols>& a,
+        const mat<B, Rows, Cols>& b,
         std::index_sequence<Is...>)
     {
         return mat{ f(a[Is], b[Is])... };
     }
 
-    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto fold_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
         A init,
-        const mat<B, Size>& b,
+        const mat<B, Rows, Cols>& b,
         std::index_sequence<Is...>)
     {
         return ((init = f(std::move(init), b[Is])), ...);
     }
 
-    template < typename A, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto fold1_and_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const mat<A, Size>& a,
+        const mat<A, Rows, Cols>& a,
         std::index_sequence<Is...>)
     {
         return (... && f(a[Is]));
     }
 
-    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto fold1_and_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const mat<A, Size>& a,
-        const mat<B, Size>& b,
+        const mat<A, Rows, Cols>& a,
+        const mat<B, Rows, Cols>& b,
         std::index_sequence<Is...>)
     {
         return (... && f(a[Is], b[Is]));
     }
 
-    template < typename A, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto fold1_or_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const mat<A, Size>& a,
+        const mat<A, Rows, Cols>& a,
         std::index_sequence<Is...>)
     {
         return (... || f(a[Is]));
     }
 
-    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto fold1_or_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const mat<A, Size>& a,
-        const mat<B, Size>& b,
+        const mat<A, Rows, Cols>& a,
+        const mat<B, Rows, Cols>& b,
         std::index_sequence<Is...>)
     {
         return (... || f(a[Is], b[Is]));
     }
 
-    template < typename A, typename B, std::size_t Size, typename F, std::size_t... Is >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F, std::size_t... Is >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
     auto fold1_plus_join_impl(
         F&& f, // NOLINT(*-missing-std-forward)
-        const vec<A, Size>& a,
-        const mat<B, Size>& b,
+        const vec<A, Rows>& a,
+        const mat<B, Rows, Cols>& b,
         std::index_sequence<Is...>)
     {
         return (... + f(a[Is], b[Is]));
@@ -104,52 +108,52 @@ namespace vmath_hpp::detail::impl
 
 namespace vmath_hpp::detail
 {
-    template < typename A, std::size_t Size, typename F >
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto map_join(F&& f, const mat<A, Size>& a) {
-        return impl::map_join_impl(std::forward<F>(f), a, std::make_index_sequence<Size>{});
+    auto map_join(F&& f, const mat<A, Rows, Cols>& a) {
+        return impl::map_join_impl(std::forward<F>(f), a, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, typename B, std::size_t Size, typename F >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto map_join(F&& f, const mat<A, Size>& a, const mat<B, Size>& b) {
-        return impl::map_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Size>{});
+    auto map_join(F&& f, const mat<A, Rows, Cols>& a, const mat<B, Rows, Cols>& b) {
+        return impl::map_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, typename B, std::size_t Size, typename F >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto fold_join(F&& f, A init, const mat<B, Size>& b) {
-        return impl::fold_join_impl(std::forward<F>(f), std::move(init), b, std::make_index_sequence<Size>{});
+    auto fold_join(F&& f, A init, const mat<B, Rows, Cols>& b) {
+        return impl::fold_join_impl(std::forward<F>(f), std::move(init), b, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, std::size_t Size, typename F >
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto fold1_and_join(F&& f, const mat<A, Size>& a) {
-        return impl::fold1_and_join_impl(std::forward<F>(f), a, std::make_index_sequence<Size>{});
+    auto fold1_and_join(F&& f, const mat<A, Rows, Cols>& a) {
+        return impl::fold1_and_join_impl(std::forward<F>(f), a, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, typename B, std::size_t Size, typename F >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto fold1_and_join(F&& f, const mat<A, Size>& a, const mat<B, Size>& b) {
-        return impl::fold1_and_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Size>{});
+    auto fold1_and_join(F&& f, const mat<A, Rows, Cols>& a, const mat<B, Rows, Cols>& b) {
+        return impl::fold1_and_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, std::size_t Size, typename F >
+    template < typename A, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto fold1_or_join(F&& f, const mat<A, Size>& a) {
-        return impl::fold1_or_join_impl(std::forward<F>(f), a, std::make_index_sequence<Size>{});
+    auto fold1_or_join(F&& f, const mat<A, Rows, Cols>& a) {
+        return impl::fold1_or_join_impl(std::forward<F>(f), a, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, typename B, std::size_t Size, typename F >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto fold1_or_join(F&& f, const mat<A, Size>& a, const mat<B, Size>& b) {
-        return impl::fold1_or_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Size>{});
+    auto fold1_or_join(F&& f, const mat<A, Rows, Cols>& a, const mat<B, Rows, Cols>& b) {
+        return impl::fold1_or_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Rows>{});
     }
 
-    template < typename A, typename B, std::size_t Size, typename F >
+    template < typename A, typename B, std::size_t Rows, std::size_t Cols, typename F >
     [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
-    auto fold1_plus_join(F&& f, const vec<A, Size>& a, const mat<B, Size>& b) {
-        return impl::fold1_plus_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Size>{});
+    auto fold1_plus_join(F&& f, const vec<A, Rows>& a, const mat<B, Rows, Cols>& b) {
+        return impl::fold1_plus_join_impl(std::forward<F>(f), a, b, std::make_index_sequence<Rows>{});
     }
 }
 
@@ -157,152 +161,164 @@ namespace vmath_hpp::detail
 // Operators
 //
 
+namespace vmath_hpp::impl
+{
+    // unchecked vec * mat, for the operators built on top of it
+
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    auto mul_impl(const vec<T, Rows>& xs, const mat<U, Rows, Cols>& ys) {
+        return fold1_plus_join([](T x, const vec<U, Cols>& y){ return x * y; }, xs, ys);
+    }
+}
+
 namespace vmath_hpp
 {
     // +operator
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator+(const mat<T, Size>& xs) {
-        return map_join([](const vec<T, Size>& x){ return +x; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator+(const mat<T, Rows, Cols>& xs) {
+        return map_join([](const vec<T, Cols>& x){ return +x; }, xs);
     }
 
     // -operator
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator-(const mat<T, Size>& xs) {
-        return map_join([](const vec<T, Size>& x){ return -x; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator-(const mat<T, Rows, Cols>& xs) {
+        return map_join([](const vec<T, Cols>& x){ return -x; }, xs);
     }
 
     // ~operator
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator~(const mat<T, Size>& xs) {
-        return map_join([](const vec<T, Size>& x){ return ~x; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator~(const mat<T, Rows, Cols>& xs) {
+        return map_join([](const vec<T, Cols>& x){ return ~x; }, xs);
     }
 
     // !operator
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator!(const mat<T, Size>& xs) {
-        return map_join([](const vec<T, Size>& x){ return !x; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator!(const mat<T, Rows, Cols>& xs) {
+        return map_join([](const vec<T, Cols>& x){ return !x; }, xs);
     }
 
     // ++operator
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator++(mat<T, Size>& xs) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator++(mat<T, Rows, Cols>& xs) {
         return (xs = xs + T{1});
     }
 
     // --operator
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator--(mat<T, Size>& xs) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator--(mat<T, Rows, Cols>& xs) {
         return (xs = xs - T{1});
     }
 
     // operator++
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size> operator++(mat<T, Size>& xs, int) {
-        mat<T, Size> ys = xs;
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols> operator++(mat<T, Rows, Cols>& xs, int) {
+        mat<T, Rows, Cols> ys = xs;
         ++xs;
         return ys;
     }
 
     // operator--
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size> operator--(mat<T, Size>& xs, int) {
-        mat<T, Size> ys = xs;
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols> operator--(mat<T, Rows, Cols>& xs, int) {
+        mat<T, Rows, Cols> ys = xs;
         --xs;
         return ys;
     }
 
     // operator+
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator+(const mat<T, Size>& xs, U y) {
-        return map_join([y](const vec<T, Size>& x){ return x + y; }, xs);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator+(const mat<T, Rows, Cols>& xs, U y) {
+        return map_join([y](const vec<T, Cols>& x){ return x + y; }, xs);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator+(T x, const mat<U, Size>& ys) {
-        return map_join([x](const vec<U, Size>& y){ return x + y; }, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator+(T x, const mat<U, Rows, Cols>& ys) {
+        return map_join([x](const vec<U, Cols>& y){ return x + y; }, ys);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator+(const mat<T, Size>& xs, const mat<U, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<U, Size>& y){ return x + y; }, xs, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator+(const mat<T, Rows, Cols>& xs, const mat<U, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<U, Cols>& y){ return x + y; }, xs, ys);
     }
 
     // operator+=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator+=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator+=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs + y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator+=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator+=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs + ys));
     }
 
     // operator-
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator-(const mat<T, Size>& xs, U y) {
-        return map_join([y](const vec<T, Size>& x){ return x - y; }, xs);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator-(const mat<T, Rows, Cols>& xs, U y) {
+        return map_join([y](const vec<T, Cols>& x){ return x - y; }, xs);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator-(T x, const mat<U, Size>& ys) {
-        return map_join([x](const vec<U, Size>& y){ return x - y; }, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator-(T x, const mat<U, Rows, Cols>& ys) {
+        return map_join([x](const vec<U, Cols>& y){ return x - y; }, ys);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator-(const mat<T, Size>& xs, const mat<U, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<U, Size>& y){ return x - y; }, xs, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator-(const mat<T, Rows, Cols>& xs, const mat<U, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<U, Cols>& y){ return x - y; }, xs, ys);
     }
 
     // operator-=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator-=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator-=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs - y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator-=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator-=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs - ys));
     }
 
     // operator*
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator*(const mat<T, Size>& xs, U y) {
-        return map_join([y](const vec<T, Size>& x){ return x * y; }, xs);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator*(const mat<T, Rows, Cols>& xs, U y) {
+        return map_join([y](const vec<T, Cols>& x){ return x * y; }, xs);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator*(T x, const mat<U, Size>& ys) {
-        return map_join([x](const vec<U, Size>& y){ return x * y; }, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator*(T x, const mat<U, Rows, Cols>& ys) {
+        return map_join([x](const vec<U, Cols>& y){ return x * y; }, ys);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator*(const vec<T, Size>& xs, const mat<U, Size>& ys) {
-        return fold1_plus_join([](T x, const vec<U, Size>& y){ return x * y; }, xs, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator*(const vec<T, Rows>& xs, const mat<U, Rows, Cols>& ys) {
+        return VMATH_HPP_CHECK_RESULT("vec * mat", impl::mul_impl(xs, ys));
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator*(const mat<T, Size>& xs, const mat<U, Size>& ys) {
-        return map_join([&ys](const vec<T, Size>& x){ return x * ys; }, xs);
+    template < typename T, typename U, std::size_t Rows, std::size_t Size, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator*(const mat<T, Rows, Size>& xs, const mat<U, Size, Cols>& ys) {
+        VMATH_HPP_INSTRUMENT_CALL(mat_mul, Rows * Cols * (2 * Size - 1));
+        return VMATH_HPP_CHECK_RESULT("mat * mat", map_join([&ys](const vec<T, Size>& x){ return impl::mul_impl(x, ys); }, xs));
     }
 
     // operator*=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator*=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator*=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs * y));
     }
 
@@ -311,228 +327,228 @@ namespace vmath_hpp
         return (xs = (xs * ys));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator*=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator*=(mat<T, Rows, Cols>& xs, const mat<T, Cols>& ys) {
         return (xs = (xs * ys));
     }
 
     // operator/
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator/(const mat<T, Size>& xs, U y) {
-        return map_join([y](const vec<T, Size>& x){ return x / y; }, xs);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator/(const mat<T, Rows, Cols>& xs, U y) {
+        return map_join([y](const vec<T, Cols>& x){ return x / y; }, xs);
     }
 
-    template < typename T, typename U, std::size_t Size >
-    [[nodiscard]] constexpr auto operator/(T x, const mat<U, Size>& ys) {
-        return map_join([x](const vec<U, Size>& y){ return x / y; }, ys);
+    template < typename T, typename U, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator/(T x, const mat<U, Rows, Cols>& ys) {
+        return map_join([x](const vec<U, Cols>& y){ return x / y; }, ys);
     }
 
     // operator/=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator/=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator/=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs / y));
     }
 
     // operator&
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator&(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x & y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x & y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator&(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x & y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x & y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator&(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x & y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x & y; }, xs, ys);
     }
 
     // operator&=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator&=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator&=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs & y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator&=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator&=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs & ys));
     }
 
     // operator|
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator|(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x | y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator|(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x | y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator|(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x | y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator|(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x | y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator|(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x | y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator|(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x | y; }, xs, ys);
     }
 
     // operator|=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator|=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator|=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs | y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator|=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator|=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs | ys));
     }
 
     // operator^
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator^(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x ^ y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator^(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x ^ y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator^(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x ^ y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator^(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x ^ y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator^(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x ^ y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator^(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x ^ y; }, xs, ys);
     }
 
     // operator^=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator^=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator^=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs ^ y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator^=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator^=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs ^ ys));
     }
 
     // operator<<
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator<<(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x << y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator<<(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x << y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator<<(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x << y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator<<(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x << y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator<<(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x << y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator<<(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x << y; }, xs, ys);
     }
 
     // operator<<=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator<<=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator<<=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs << y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator<<=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator<<=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs << ys));
     }
 
     // operator>>
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator>>(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x >> y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator>>(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x >> y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator>>(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x >> y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator>>(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x >> y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator>>(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x >> y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator>>(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x >> y; }, xs, ys);
     }
 
     // operator>>=
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator>>=(mat<T, Size>& xs, T y) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator>>=(mat<T, Rows, Cols>& xs, T y) {
         return (xs = (xs >> y));
     }
 
-    template < typename T, std::size_t Size >
-    constexpr mat<T, Size>& operator>>=(mat<T, Size>& xs, const mat<T, Size>& ys) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    constexpr mat<T, Rows, Cols>& operator>>=(mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
         return (xs = (xs >> ys));
     }
 
     // operator&&
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator&&(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x && y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&&(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x && y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator&&(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x && y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&&(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x && y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator&&(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x && y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator&&(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x && y; }, xs, ys);
     }
 
     // operator||
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator||(const mat<T, Size>& xs, T y) {
-        return map_join([y](const vec<T, Size>& x){ return x || y; }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator||(const mat<T, Rows, Cols>& xs, T y) {
+        return map_join([y](const vec<T, Cols>& x){ return x || y; }, xs);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator||(T x, const mat<T, Size>& ys) {
-        return map_join([x](const vec<T, Size>& y){ return x || y; }, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator||(T x, const mat<T, Rows, Cols>& ys) {
+        return map_join([x](const vec<T, Cols>& y){ return x || y; }, ys);
     }
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr auto operator||(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x || y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr auto operator||(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x || y; }, xs, ys);
     }
 
     // operator==
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr bool operator==(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return fold1_and_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x == y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr bool operator==(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return fold1_and_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x == y; }, xs, ys);
     }
 
     // operator!=
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr bool operator!=(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return fold1_or_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return x != y; }, xs, ys);
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr bool operator!=(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return fold1_or_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return x != y; }, xs, ys);
     }
 
     // operator<
 
-    template < typename T, std::size_t Size >
-    [[nodiscard]] constexpr bool operator<(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        for ( std::size_t i = 0; i < Size; ++i ) {
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr bool operator<(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        for ( std::size_t i = 0; i < Rows; ++i ) {
             if ( xs[i] < ys[i] ) {
                 return true;
             }
@@ -550,81 +566,81 @@ namespace vmath_hpp
 
 namespace vmath_hpp
 {
-    template < typename T, std::size_t Size
-             , typename U = decltype(any(std::declval<vec<T, Size>>())) >
-    [[nodiscard]] constexpr U any(const mat<T, Size>& xs) {
-        return fold1_or_join([](const vec<T, Size>& x){ return any(x); }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = decltype(any(std::declval<vec<T, Cols>>())) >
+    [[nodiscard]] constexpr U any(const mat<T, Rows, Cols>& xs) {
+        return fold1_or_join([](const vec<T, Cols>& x){ return any(x); }, xs);
     }
 
-    template < typename T, std::size_t Size
-             , typename U = decltype(all(std::declval<vec<T, Size>>())) >
-    [[nodiscard]] constexpr U all(const mat<T, Size>& xs) {
-        return fold1_and_join([](const vec<T, Size>& x){ return all(x); }, xs);
+    template < typename T, std::size_t Rows, std::size_t Cols
+             , typename U = decltype(all(std::declval<vec<T, Cols>>())) >
+    [[nodiscard]] constexpr U all(const mat<T, Rows, Cols>& xs) {
+        return fold1_and_join([](const vec<T, Cols>& x){ return all(x); }, xs);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(approx(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> approx(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return approx(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> approx(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return approx(x, y); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(approx(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>(),
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>(),
                  std::declval<T>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> approx(const mat<T, Size>& xs, const mat<T, Size>& ys, T epsilon) {
-        return map_join([epsilon](const vec<T, Size>& x, const vec<T, Size>& y){ return approx(x, y, epsilon); }, xs, ys);
+    [[nodiscard]] constexpr mat<U, Rows, Cols> approx(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys, T epsilon) {
+        return map_join([epsilon](const vec<T, Cols>& x, const vec<T, Cols>& y){ return approx(x, y, epsilon); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(less(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> less(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return less(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> less(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return less(x, y); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(less_equal(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> less_equal(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return less_equal(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> less_equal(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return less_equal(x, y); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(greater(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> greater(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return greater(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> greater(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return greater(x, y); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(greater_equal(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> greater_equal(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return greater_equal(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> greater_equal(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return greater_equal(x, y); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(equal_to(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> equal_to(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return equal_to(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> equal_to(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return equal_to(x, y); }, xs, ys);
     }
 
-    template < typename T, std::size_t Size
+    template < typename T, std::size_t Rows, std::size_t Cols
              , typename U = typename decltype(not_equal_to(
-                 std::declval<vec<T, Size>>(),
-                 std::declval<vec<T, Size>>()))::component_type >
-    [[nodiscard]] constexpr mat<U, Size> not_equal_to(const mat<T, Size>& xs, const mat<T, Size>& ys) {
-        return map_join([](const vec<T, Size>& x, const vec<T, Size>& y){ return not_equal_to(x, y); }, xs, ys);
+                 std::declval<vec<T, Cols>>(),
+                 std::declval<vec<T, Cols>>()))::component_type >
+    [[nodiscard]] constexpr mat<U, Rows, Cols> not_equal_to(const mat<T, Rows, Cols>& xs, const mat<T, Rows, Cols>& ys) {
+        return map_join([](const vec<T, Cols>& x, const vec<T, Cols>& y){ return not_equal_to(x, y); }, xs, ys);
     }
 }
 
@@ -674,6 +690,91 @@ namespace vmath_hpp
             d, h, l, p};
     }
 
+    namespace impl
+    {
+        template < typename T, std::size_t Rows, std::size_t Cols, std::size_t... Is >
+        [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+        vec<T, Rows> transpose_column_impl(const mat<T, Rows, Cols>& m, std::size_t index, std::index_sequence<Is...>) {
+            return { m[Is][index]... };
+        }
+
+        template < typename T, std::size_t Rows, std::size_t Cols, std::size_t... Is >
+        [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+        mat<T, Cols, Rows> transpose_impl(const mat<T, Rows, Cols>& m, std::index_sequence<Is...>) {
+            return { transpose_column_impl(m, Is, std::make_index_sequence<Rows>{})... };
+        }
+    }
+
+    template < typename T, std::size_t Rows, std::size_t Cols >
+    [[nodiscard]] constexpr mat<T, Cols, Rows> transpose(const mat<T, Rows, Cols>& m) {
+        return impl::transpose_impl(m, std::make_index_sequence<Cols>{});
+    }
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename T >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    mat<T, 4> adjugate_4(const mat<T, 4>& _m) {
+        /// REFERENCE:
+        /// https://www.geometrictools.com/Documentation/LaplaceExpansionTheorem.pdf
+
+        // NOLINTNEXTLINE(*-isolate-declaration)
+        const T a = _m[0][0], b = _m[0][1], c = _m[0][2], d = _m[0][3],
+                e = _m[1][0], f = _m[1][1], g = _m[1][2], h = _m[1][3],
+                i = _m[2][0], j = _m[2][1], k = _m[2][2], l = _m[2][3],
+                m = _m[3][0], n = _m[3][1], o = _m[3][2], p = _m[3][3];
+
+        // the 2x2 minors of the upper and the lower row pairs,
+        // every cofactor and the determinant are built from these twelve
+
+        const T s0 = a * f - b * e;
+        const T s1 = a * g - c * e;
+        const T s2 = a * h - d * e;
+        const T s3 = b * g - c * f;
+        const T s4 = b * h - d * f;
+        const T s5 = c * h - d * g;
+
+        const T c0 = i * n - j * m;
+        const T c1 = i * o - k * m;
+        const T c2 = i * p - l * m;
+        const T c3 = j * o - k * n;
+        const T c4 = j * p - l * n;
+        const T c5 = k * p - l * o;
+
+        return {
+            f * c5 - g * c4 + h * c3,
+            c * c4 - b * c5 - d * c3,
+            n * s5 - o * s4 + p * s3,
+            k * s4 - j * s5 - l * s3,
+            g * c2 - e * c5 - h * c1,
+            a * c5 - c * c2 + d * c1,
+            o * s2 - m * s5 - p * s1,
+            i * s5 - k * s2 + l * s1,
+            e * c4 - f * c2 + h * c0,
+            b * c2 - a * c4 - d * c0,
+            m * s4 - n * s2 + p * s0,
+            j * s2 - i * s4 - l * s0,
+            f * c1 - e * c3 - g * c0,
+            a * c3 - b * c1 + c * c0,
+            n * s1 - m * s3 - o * s0,
+            i * s3 - j * s1 + k * s0};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    T determinant_from_adjugate_4(const mat<T, 4>& m, const mat<T, 4>& adj) {
+        // the first row expansion, its cofactors are the first column of the adjugate
+        return
+            m[0][0] * adj[0][0] +
+            m[0][1] * adj[1][0] +
+            m[0][2] * adj[2][0] +
+            m[0][3] * adj[3][0];
+    }
+}
+
+namespace vmath_hpp
+{
     //
     // adjugate
     //
@@ -709,29 +810,8 @@ namespace vmath_hpp
     }
 
     template < typename T >
-    [[nodiscard]] constexpr mat<T, 4> adjugate(const mat<T, 4>& _m) {
-        // NOLINTNEXTLINE(*-isolate-declaration)
-        const T a = _m[0][0], b = _m[0][1], c = _m[0][2], d = _m[0][3],
-                e = _m[1][0], f = _m[1][1], g = _m[1][2], h = _m[1][3],
-                i = _m[2][0], j = _m[2][1], k = _m[2][2], l = _m[2][3],
-                m = _m[3][0], n = _m[3][1], o = _m[3][2], p = _m[3][3];
-        return {
-            f * (k * p - l * o) + g * (l * n - j * p) + h * (j * o - k * n),
-            j * (c * p - d * o) + k * (d * n - b * p) + l * (b * o - c * n),
-            n * (c * h - d * g) + o * (d * f - b * h) + p * (b * g - c * f),
-            b * (h * k - g * l) + c * (f * l - h * j) + d * (g * j - f * k),
-            g * (i * p - l * m) + h * (k * m - i * o) + e * (l * o - k * p),
-            k * (a * p - d * m) + l * (c * m - a * o) + i * (d * o - c * p),
-            o * (a * h - d * e) + p * (c * e - a * g) + m * (d * g - c * h),
-            c * (h * i - e * l) + d * (e * k - g * i) + a * (g * l - h * k),
-            h * (i * n - j * m) + e * (j * p - l * n) + f * (l * m - i * p),
-            l * (a * n - b * m) + i * (b * p - d * n) + j * (d * m - a * p),
-            p * (a * f - b * e) + m * (b * h - d * f) + n * (d * e - a * h),
-            d * (f * i - e * j) + a * (h * j - f * l) + b * (e * l - h * i),
-            e * (k * n - j * o) + f * (i * o - k * m) + g * (j * m - i * n),
-            i * (c * n - b * o) + j * (a * o - c * m) + k * (b * m - a * n),
-            m * (c * f - b * g) + n * (a * g - c * e) + o * (b * e - a * f),
-            a * (f * k - g * j) + b * (g * i - e * k) + c * (e * j - f * i)};
+    [[nodiscard]] constexpr mat<T, 4> adjugate(const mat<T, 4>& m) {
+        return impl::adjugate_4(m);
     }
 
     //
@@ -740,6 +820,8 @@ namespace vmath_hpp
 
     template < typename T >
     [[nodiscard]] constexpr T determinant(const mat<T, 2>& _m) {
+        VMATH_HPP_INSTRUMENT_CALL(determinant, 3);
+
         // NOLINTNEXTLINE(*-isolate-declaration)
         const T a = _m[0][0], b = _m[0][1],
                 c = _m[1][0], d = _m[1][1];
@@ -749,6 +831,8 @@ namespace vmath_hpp
 
     template < typename T >
     [[nodiscard]] constexpr T determinant(const mat<T, 3>& _m) {
+        VMATH_HPP_INSTRUMENT_CALL(determinant, 14);
+
         // NOLINTNEXTLINE(*-isolate-declaration)
         const T a = _m[0][0], b = _m[0][1], c = _m[0][2],
                 d = _m[1][0], e = _m[1][1], f = _m[1][2],
@@ -761,16 +845,20 @@ namespace vmath_hpp
 
     template < typename T >
     [[nodiscard]] constexpr T determinant(const mat<T, 4>& _m) {
+        VMATH_HPP_INSTRUMENT_CALL(determinant, 47);
+
         // NOLINTNEXTLINE(*-isolate-declaration)
         const T a = _m[0][0], b = _m[0][1], c = _m[0][2], d = _m[0][3],
                 e = _m[1][0], f = _m[1][1], g = _m[1][2], h = _m[1][3],
                 i = _m[2][0], j = _m[2][1], k = _m[2][2], l = _m[2][3],
                 m = _m[3][0], n = _m[3][1], o = _m[3][2], p = _m[3][3];
         return
-            + a * (f * (k * p - l * o) - (j * (g * p - h * o)) + (n * (g * l - h * k)))
-            - b * (e * (k * p - l * o) - (i * (g * p - h * o)) + (m * (g * l - h * k)))
-            + c * (e * (j * p - l * n) - (i * (f * p - h * n)) + (m * (f * l - h * j)))
-            - d * (e * (j * o - k * n) - (i * (f * o - g * n)) + (m * (f * k - g * j)));
+            + (a * f - b * e) * (k * p - l * o)
+            - (a * g - c * e) * (j * p - l * n)
+            + (a * h - d * e) * (j * o - k * n)
+            + (b * g - c * f) * (i * p - l * m)
+            - (b * h - d * f) * (i * o - k * m)
+            + (c * h - d * g) * (i * n - j * m);
     }
 
     //
@@ -779,6 +867,177 @@ namespace vmath_hpp
 
     template < typename T, std::size_t Size >
     [[nodiscard]] constexpr mat<T, Size> inverse(const mat<T, Size>& m) {
-        return adjugate(m) * rcp(determinant(m));
+        if constexpr ( Size == 4 ) {
+            VMATH_HPP_INSTRUMENT_CALL(inverse, 140);
+            const mat<T, 4> adj = adjugate(m);
+            return VMATH_HPP_CHECK_RESULT("inverse", adj * rcp(impl::determinant_from_adjugate_4(m, adj)));
+        } else {
+            VMATH_HPP_INSTRUMENT_CALL(inverse, Size * Size * (Size * Size - 1) + 1);
+            return VMATH_HPP_CHECK_RESULT("inverse", adjugate(m) * rcp(determinant(m)));
+        }
+    }
+
+    //
+    // inverse_determinant
+    //
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, std::pair<mat<T, Size>, T>>
+    constexpr inverse_determinant(const mat<T, Size>& m) {
+        // a singular matrix, or one whose inverse would overflow,
+        // gets a zero inverse and a zero determinant
+        const mat<T, Size> adj = adjugate(m);
+        const T det = [&m, &adj](){
+            if constexpr ( Size == 4 ) {
+                return impl::determinant_from_adjugate_4(m, adj);
+            } else {
+                return determinant(m);
+            }
+        }();
+        // rcp(det) <= max without dividing by zero, which isn't a constant expression
+        const bool regular = abs(det) >= rcp(std::numeric_limits<T>::max());
+        return {adj * (regular ? rcp(det) : T{0}), regular ? det : T{0}};
+    }
+
+    //
+    // mul_chain
+    //
+
+    template < typename X, typename... Xs >
+    [[nodiscard]] constexpr auto mul_chain(const X& x, const Xs&... xs) {
+        // vectors are rows and can only start a chain, so the left fold always
+        // turns it into a sequence of cheap vector-matrix products
+        return (x * ... * xs);
+    }
+
+    //
+    // symmetric_eigen
+    //
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr std::pair<vec<T, Size>, mat<T, Size>> symmetric_eigen(const mat<T, Size>& m) {
+        /// REFERENCE:
+        /// https://en.wikipedia.org/wiki/Jacobi_eigenvalue_algorithm
+
+        mat<T, Size> a = m;
+        mat<T, Size> v = identity_init;
+
+        // cyclic Jacobi converges quadratically, a fixed sweep count is enough for small matrices;
+        // a zero off-diagonal element selects the identity rotation instead of skipping it,
+        // so every matrix runs the same instructions and a batch of them can be vectorized
+        for ( unsigned sweep = 0; sweep < 6; ++sweep ) {
+            for ( std::size_t p = 0; p + 1 < Size; ++p ) {
+                for ( std::size_t q = p + 1; q < Size; ++q ) {
+                    const T apq = a[p][q];
+                    const bool zero = apq == T{0};
+
+                    const T theta = (a[q][q] - a[p][p]) * rcp(T{2} * (zero ? T{1} : apq));
+                    const T t = zero ? T{0} : copysign(rcp(abs(theta) + sqrt(sqr(theta) + T{1})), theta);
+                    const T c = rsqrt(sqr(t) + T{1});
+                    const T s = t * c;
+
+                    a[p][p] -= t * apq;
+                    a[q][q] += t * apq;
+                    a[p][q] = a[q][p] = T{0};
+
+                    for ( std::size_t r = 0; r < Size; ++r ) {
+                        if ( r == p || r == q ) {
+                            continue;
+                        }
+                        const T arp = a[r][p];
+                        const T arq = a[r][q];
+                        a[r][p] = a[p][r] = c * arp - s * arq;
+                        a[r][q] = a[q][r] = s * arp + c * arq;
+                    }
+
+                    for ( std::size_t i = 0; i < Size; ++i ) {
+                        const T vip = v[i][p];
+                        const T viq = v[i][q];
+                        v[i][p] = c * vip - s * viq;
+                        v[i][q] = s * vip + c * viq;
+                    }
+                }
+            }
+        }
+
+        vec<T, Size> d{no_init};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            d[i] = a[i][i];
+        }
+
+        // sort eigenvalues in descending order with a sorting network:
+        // the compare-exchange pairs are fixed and each one selects instead of swapping
+        for ( std::size_t i = 0; i + 1 < Size; ++i ) {
+            for ( std::size_t j = i + 1; j < Size; ++j ) {
+                const bool swap = d[i] < d[j];
+                const T di = d[i];
+                const T dj = d[j];
+                d[i] = swap ? dj : di;
+                d[j] = swap ? di : dj;
+                for ( std::size_t k = 0; k < Size; ++k ) {
+                    const T vki = v[k][i];
+                    const T vkj = v[k][j];
+                    v[k][i] = swap ? vkj : vki;
+                    v[k][j] = swap ? vki : vkj;
+                }
+            }
+        }
+
+        return {d, v};
+    }
+
+    //
+    // svd
+    //
+
+    template < typename T >
+    [[nodiscard]] constexpr std::tuple<mat<T, 3>, vec<T, 3>, mat<T, 3>> svd(const mat<T, 3>& m) {
+        /// REFERENCE:
+        /// https://pages.cs.wisc.edu/~sifakis/papers/SVD_TR1690.pdf
+
+        auto [eigenvalues, v] = symmetric_eigen(transpose(m) * m);
+        (void)eigenvalues;
+
+        // make V a proper rotation
+        const T flip = determinant(v) < T{0} ? T{-1} : T{1};
+        v[0][2] *= flip;
+        v[1][2] *= flip;
+        v[2][2] *= flip;
+
+        // columns of M * V are U columns scaled by the singular values
+        const mat<T, 3> bt = transpose(m * v);
+        const T tolerance = std::numeric_limits<T>::epsilon() * length2(bt[0]);
+
+        const vec<T, 3> u0 = length2(bt[0]) > T{0}
+            ? bt[0] * rlength(bt[0])
+            : vec<T, 3>{T{1}, T{0}, T{0}};
+
+        const vec<T, 3> u1_raw = bt[1] - dot(bt[1], u0) * u0;
+        const vec<T, 3> u1 = length2(u1_raw) > tolerance
+            ? u1_raw * rlength(u1_raw)
+            : normalize(abs(u0[0]) < T{0.9f}
+                ? cross(u0, vec<T, 3>{T{1}, T{0}, T{0}})
+                : cross(u0, vec<T, 3>{T{0}, T{1}, T{0}}));
+
+        const vec<T, 3> u2 = cross(u0, u1);
+
+        // the last singular value carries the sign of the determinant
+        const vec<T, 3> s{dot(bt[0], u0), dot(bt[1], u1), dot(bt[2], u2)};
+
+        return {transpose(mat<T, 3>{u0, u1, u2}), s, v};
+    }
+
+    //
+    // polar
+    //
+
+    template < typename T >
+    [[nodiscard]] constexpr std::pair<mat<T, 3>, mat<T, 3>> polar(const mat<T, 3>& m) {
+        /// REFERENCE:
+        /// https://en.wikipedia.org/wiki/Polar_decomposition
+
+        const auto [u, s, v] = svd(m);
+        const mat<T, 3> vt = transpose(v);
+        return {u * vt, v * mat<T, 3>{s} * vt};
     }
 }
@@ -11,6 +11,9 @@
 #include "vmath_vec.hpp"
 #include "vmath_vec_fun.hpp"
 
+#include <initializer_list>
+#include <iterator>
+
 namespace vmath_hpp::detail
 {
     template < typename T >
@@ -162,3 +165,16 @@ namespace vmath_hpp
         l.swap(r);
     }
 }
+
+namespace vmath_hpp::detail
+{
+    // the imaginary part is followed by the real one: x, y, z, w
+
+    template < typename T >
+    inline constexpr bool is_packed_qua_v =
+        std::is_standard_layout_v<qua<T>> &&
+        std::is_trivially_copyable_v<qua<T>> &&
+        sizeof(qua<T>) == sizeof(T) * 4;
+
+    static_assert(is_packed_qua_v<float> && is_packed_qua_v<double>);
+}
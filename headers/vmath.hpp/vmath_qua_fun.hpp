@@ -94,6 +94,8 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://www.euclideanspace.com/maths/algebra/realNormedAlgebra/quaternions/transforms/
 
+        VMATH_HPP_INSTRUMENT_CALL(vec_qua_mul, 30);
+
         const vec qv2 = cross(ys.v, xs) * T{2};
         return xs + qv2 * ys.s + cross(ys.v, qv2);
     }
@@ -103,6 +105,7 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://www.euclideanspace.com/maths/algebra/realNormedAlgebra/quaternions/arithmetic/
 
+        VMATH_HPP_INSTRUMENT_CALL(qua_mul, 27);
         return qua{
             cross(ys.v, xs.v) + ys.s * xs.v + xs.s * ys.v,
             ys.s * xs.s - dot(ys.v, xs.v)};
@@ -184,9 +187,11 @@ namespace vmath_hpp
 
     template < typename T >
     [[nodiscard]] constexpr qua<T> nlerp(const qua<T>& unit_xs, const qua<T>& unit_ys, T a) {
+        VMATH_HPP_INSTRUMENT_CALL(nlerp, 22);
+
         const T xs_scale = T{1} - a;
         const T ys_scale = a * sign(dot(unit_xs, unit_ys));
-        return normalize(lerp(unit_xs, unit_ys, xs_scale, ys_scale));
+        return VMATH_HPP_CHECK_RESULT("nlerp", qua(impl::normalize_impl(impl::lerp_impl(vec{unit_xs}, vec{unit_ys}, xs_scale, ys_scale))));
     }
 
     template < typename T >
@@ -194,22 +199,24 @@ namespace vmath_hpp
         /// REFERENCE:
         /// http://www.euclideanspace.com/maths/algebra/realNormedAlgebra/quaternions/slerp/
 
+        VMATH_HPP_INSTRUMENT_CALL(slerp, 30);
+
         const T raw_cos_theta = dot(unit_xs, unit_ys);
         const T raw_cos_theta_sign = sign(raw_cos_theta);
 
         // half degree linear threshold: cos((pi / 180) * 0.25)
         if ( const T cos_theta = raw_cos_theta * raw_cos_theta_sign; cos_theta < T{0.99999f} ) {
             const T theta = acos(cos_theta);
-            const T rsin_theta = rsqrt(T{1} - sqr(cos_theta));
+            const T rsin_theta = rsqrt((T{1} - cos_theta) * (T{1} + cos_theta));
             const T xs_scale = sin((T{1} - a) * theta) * rsin_theta;
             const T ys_scale = sin(a * theta) * raw_cos_theta_sign * rsin_theta;
-            return lerp(unit_xs, unit_ys, xs_scale, ys_scale);
+            return VMATH_HPP_CHECK_RESULT("slerp", qua(impl::lerp_impl(vec{unit_xs}, vec{unit_ys}, xs_scale, ys_scale)));
         }
 
         // use linear interpolation for small angles
         const T xs_scale = T{1} - a;
         const T ys_scale = a * raw_cos_theta_sign;
-        return normalize(lerp(unit_xs, unit_ys, xs_scale, ys_scale));
+        return VMATH_HPP_CHECK_RESULT("slerp", qua(impl::normalize_impl(impl::lerp_impl(vec{unit_xs}, vec{unit_ys}, xs_scale, ys_scale))));
     }
 }
 
@@ -360,6 +367,7 @@ namespace vmath_hpp
 
     template < typename T >
     [[nodiscard]] constexpr qua<T> inverse(const qua<T>& q) {
-        return conjugate(q) * rlength2(q);
+        VMATH_HPP_INSTRUMENT_CALL(qua_inverse, 15);
+        return VMATH_HPP_CHECK_RESULT("inverse(qua)", conjugate(q) * rlength2(q));
     }
 }
@@ -0,0 +1,385 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_fun.hpp"
+#include "vmath_vec_fun.hpp"
+#include "vmath_qua_fun.hpp"
+
+#include <iterator>
+#include <limits>
+
+//
+// Random Engines
+//
+
+namespace vmath_hpp
+{
+    class philox4x32 final {
+    public:
+        using result_type = std::uint32_t;
+        using block_type = vec<std::uint32_t, 4>;
+        using key_type = vec<std::uint32_t, 2>;
+    public:
+        constexpr philox4x32() = default;
+
+        constexpr explicit philox4x32(std::uint64_t seed, std::uint64_t stream = 0)
+        : key_{
+            static_cast<std::uint32_t>(seed),
+            static_cast<std::uint32_t>(seed >> 32)}
+        , counter_{
+            0u,
+            0u,
+            static_cast<std::uint32_t>(stream),
+            static_cast<std::uint32_t>(stream >> 32)} {}
+
+        [[nodiscard]] static constexpr result_type min() noexcept {
+            return std::numeric_limits<result_type>::min();
+        }
+
+        [[nodiscard]] static constexpr result_type max() noexcept {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        [[nodiscard]] constexpr result_type operator()() noexcept {
+            if ( index_ == block_type::size ) {
+                block_ = next_block();
+                index_ = 0;
+            }
+            return block_[index_++];
+        }
+
+        [[nodiscard]] constexpr block_type next_block() noexcept {
+            const block_type block = generate(counter_, key_);
+            counter_.x += 1u;
+            counter_.y += counter_.x == 0u ? 1u : 0u;
+            return block;
+        }
+
+        constexpr void discard(unsigned long long z) noexcept {
+            for ( ; z > 0; --z ) {
+                (void)(*this)();
+            }
+        }
+
+        [[nodiscard]] static constexpr block_type generate(block_type counter, key_type key) noexcept {
+            /// REFERENCE:
+            /// https://www.thesalmons.org/john/random123/papers/random123sc11.pdf
+
+            for ( unsigned round = 0; round < 10; ++round ) {
+                if ( round > 0 ) {
+                    key.x += 0x9E3779B9u;
+                    key.y += 0xBB67AE85u;
+                }
+
+                const std::uint64_t p0 = std::uint64_t{0xD2511F53u} * counter.x;
+                const std::uint64_t p1 = std::uint64_t{0xCD9E8D57u} * counter.z;
+
+                counter = {
+                    static_cast<std::uint32_t>(p1 >> 32) ^ counter.y ^ key.x,
+                    static_cast<std::uint32_t>(p1),
+                    static_cast<std::uint32_t>(p0 >> 32) ^ counter.w ^ key.y,
+                    static_cast<std::uint32_t>(p0)};
+            }
+
+            return counter;
+        }
+    private:
+        key_type key_{zero_init};
+        block_type counter_{zero_init};
+        block_type block_{zero_init};
+        std::size_t index_{block_type::size};
+    };
+}
+
+//
+// Random Distributions
+//
+
+namespace vmath_hpp::detail
+{
+    template < typename T, typename G >
+    [[nodiscard]] constexpr T random_canonical(G& g) {
+        static_assert(
+            G::min() == 0u && G::max() == 0xFFFFFFFFu,
+            "random generator must produce 32 random bits");
+
+        if constexpr ( std::is_same_v<T, float> ) {
+            const auto bits = static_cast<std::uint32_t>(g()) >> 8;
+            return static_cast<T>(bits) * T{0x1.0p-24f};
+        } else {
+            const auto hi = static_cast<std::uint64_t>(g()) >> 5;
+            const auto lo = static_cast<std::uint64_t>(g()) >> 6;
+            return static_cast<T>((hi << 26) | lo) * T{0x1.0p-53};
+        }
+    }
+
+    template < typename T >
+    inline constexpr T random_two_pi = T(6.283185307179586476925286766559);
+
+    // the samples from canonical numbers, shared by the single and the batch versions
+
+    template < typename T >
+    [[nodiscard]] constexpr vec<T, 2> random_on_circle_from(T u0) {
+        const auto [s, c] = sincos(u0 * random_two_pi<T>);
+        return {c, s};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr vec<T, 3> random_on_sphere_from(T u0, T u1) {
+        /// REFERENCE:
+        /// https://mathworld.wolfram.com/SpherePointPicking.html
+
+        const T z = u0 * T{2} - T{1};
+        const T r = sqrt(max(T{0}, T{1} - sqr(z)));
+        const auto [s, c] = sincos(u1 * random_two_pi<T>);
+        return {r * c, r * s, z};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr qua<T> random_rotation_from(T u0, T u1, T u2) {
+        /// REFERENCE:
+        /// Ken Shoemake, "Uniform random rotations", Graphics Gems III
+
+        const T r0 = sqrt(T{1} - u0);
+        const T r1 = sqrt(u0);
+
+        const auto [s0, c0] = sincos(u1 * random_two_pi<T>);
+        const auto [s1, c1] = sincos(u2 * random_two_pi<T>);
+
+        return {r0 * s0, r0 * c0, r1 * s1, r1 * c1};
+    }
+
+    template < typename T, std::size_t N >
+    constexpr void random_canonical_blocks(philox4x32& g, T (&us)[N]) {
+        // whole engine blocks in the order operator() returns their numbers,
+        // so the samples are the ones of the single versions from a block boundary
+        if constexpr ( std::is_same_v<T, float> ) {
+            static_assert(N % 4 == 0);
+            for ( std::size_t i = 0; i < N; i += 4 ) {
+                const philox4x32::block_type b = g.next_block();
+                for ( std::size_t j = 0; j < 4; ++j ) {
+                    us[i + j] = static_cast<T>(b[j] >> 8) * T{0x1.0p-24f};
+                }
+            }
+        } else {
+            static_assert(N % 2 == 0);
+            for ( std::size_t i = 0; i < N; i += 2 ) {
+                const philox4x32::block_type b = g.next_block();
+                for ( std::size_t j = 0; j < 2; ++j ) {
+                    const auto hi = static_cast<std::uint64_t>(b[j * 2 + 0]) >> 5;
+                    const auto lo = static_cast<std::uint64_t>(b[j * 2 + 1]) >> 6;
+                    us[i + j] = static_cast<T>((hi << 26) | lo) * T{0x1.0p-53};
+                }
+            }
+        }
+    }
+
+    template < typename T, std::size_t Count, typename G, typename ForwardIt, typename F >
+    constexpr void random_fill(G& g, ForwardIt first, ForwardIt last, F&& f) {
+        // f makes one sample from Count canonical numbers, philox4x32 gives them
+        // for 16 samples at once, other generators one number at a time
+        if constexpr ( std::is_same_v<G, philox4x32> ) {
+            constexpr std::size_t lanes = 16;
+            while ( first != last ) {
+                T us[Count * lanes]{};
+                random_canonical_blocks(g, us);
+                for ( std::size_t j = 0; j < lanes && first != last; ++j, ++first ) {
+                    *first = f(us + j * Count);
+                }
+            }
+        } else {
+            for ( ; first != last; ++first ) {
+                T us[Count]{};
+                for ( std::size_t i = 0; i < Count; ++i ) {
+                    us[i] = random_canonical<T>(g);
+                }
+                *first = f(us);
+            }
+        }
+    }
+
+    template < typename ForwardIt >
+    using random_value_t = typename std::iterator_traits<ForwardIt>::value_type;
+}
+
+namespace vmath_hpp
+{
+    // random_uniform
+
+    template < typename T, typename G >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr random_uniform(G& g) {
+        return detail::random_canonical<T>(g);
+    }
+
+    template < typename T, typename G >
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<T>, T>
+    constexpr random_uniform(G& g, T min_x, T max_x) {
+        return lerp(min_x, max_x, random_uniform<T>(g));
+    }
+
+    template < typename T, std::size_t Size, typename G >
+    [[nodiscard]] constexpr vec<T, Size> random_uniform(G& g, const vec<T, Size>& min_xs, const vec<T, Size>& max_xs) {
+        vec<T, Size> as{no_init};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            as[i] = random_uniform<T>(g);
+        }
+        return lerp(min_xs, max_xs, as);
+    }
+
+    // random_on_circle
+
+    template < typename T, typename G >
+    [[nodiscard]] constexpr vec<T, 2> random_on_circle(G& g) {
+        return detail::random_on_circle_from(random_uniform<T>(g));
+    }
+
+    // random_in_disk
+
+    template < typename T, typename G >
+    [[nodiscard]] constexpr vec<T, 2> random_in_disk(G& g) {
+        const vec<T, 2> p = random_on_circle<T>(g);
+        return p * sqrt(random_uniform<T>(g));
+    }
+
+    // random_on_sphere
+
+    template < typename T, typename G >
+    [[nodiscard]] constexpr vec<T, 3> random_on_sphere(G& g) {
+        const T u0 = random_uniform<T>(g);
+        const T u1 = random_uniform<T>(g);
+        return detail::random_on_sphere_from(u0, u1);
+    }
+
+    // random_in_sphere
+
+    template < typename T, typename G >
+    [[nodiscard]] constexpr vec<T, 3> random_in_sphere(G& g) {
+        const vec<T, 3> p = random_on_sphere<T>(g);
+        return p * pow(random_uniform<T>(g), T{1} / T{3});
+    }
+
+    // random_on_hemisphere
+
+    template < typename T, typename G >
+    [[nodiscard]] constexpr vec<T, 3> random_on_hemisphere(G& g, const vec<T, 3>& normal) {
+        const vec<T, 3> p = random_on_sphere<T>(g);
+        return dot(p, normal) < T{0} ? -p : p;
+    }
+
+    // random_rotation
+
+    template < typename T, typename G >
+    [[nodiscard]] constexpr qua<T> random_rotation(G& g) {
+        const T u0 = random_uniform<T>(g);
+        const T u1 = random_uniform<T>(g);
+        const T u2 = random_uniform<T>(g);
+        return detail::random_rotation_from(u0, u1, u2);
+    }
+}
+
+//
+// Batch Random Distributions
+//
+
+namespace vmath_hpp
+{
+    // with philox4x32 the numbers are taken from whole blocks of next_block(), 16 samples at
+    // a time: the samples are the ones of the single versions when the engine is at a block
+    // boundary, the numbers left in the last blocks and in the buffer of operator() are skipped
+
+    // random_uniform
+
+    template < typename ForwardIt, typename G
+             , typename V = detail::random_value_t<ForwardIt> >
+    constexpr void random_uniform(G& g, ForwardIt first, ForwardIt last, const V& min_x, const V& max_x) {
+        if constexpr ( std::is_floating_point_v<V> ) {
+            detail::random_fill<V, 1>(g, first, last, [&min_x, &max_x](const V* us){
+                return lerp(min_x, max_x, us[0]);
+            });
+        } else {
+            using T = typename V::component_type;
+            detail::random_fill<T, V::size>(g, first, last, [&min_x, &max_x](const T* us){
+                V as{no_init};
+                for ( std::size_t i = 0; i < V::size; ++i ) {
+                    as[i] = us[i];
+                }
+                return lerp(min_x, max_x, as);
+            });
+        }
+    }
+
+    // random_on_circle
+
+    template < typename ForwardIt, typename G
+             , typename V = detail::random_value_t<ForwardIt> >
+    constexpr void random_on_circle(G& g, ForwardIt first, ForwardIt last) {
+        using T = typename V::component_type;
+        detail::random_fill<T, 1>(g, first, last, [](const T* us){
+            return detail::random_on_circle_from(us[0]);
+        });
+    }
+
+    // random_in_disk
+
+    template < typename ForwardIt, typename G
+             , typename V = detail::random_value_t<ForwardIt> >
+    constexpr void random_in_disk(G& g, ForwardIt first, ForwardIt last) {
+        using T = typename V::component_type;
+        detail::random_fill<T, 2>(g, first, last, [](const T* us){
+            return detail::random_on_circle_from(us[0]) * sqrt(us[1]);
+        });
+    }
+
+    // random_on_sphere
+
+    template < typename ForwardIt, typename G
+             , typename V = detail::random_value_t<ForwardIt> >
+    constexpr void random_on_sphere(G& g, ForwardIt first, ForwardIt last) {
+        using T = typename V::component_type;
+        detail::random_fill<T, 2>(g, first, last, [](const T* us){
+            return detail::random_on_sphere_from(us[0], us[1]);
+        });
+    }
+
+    // random_in_sphere
+
+    template < typename ForwardIt, typename G
+             , typename V = detail::random_value_t<ForwardIt> >
+    constexpr void random_in_sphere(G& g, ForwardIt first, ForwardIt last) {
+        using T = typename V::component_type;
+        detail::random_fill<T, 3>(g, first, last, [](const T* us){
+            return detail::random_on_sphere_from(us[0], us[1]) * pow(us[2], T{1} / T{3});
+        });
+    }
+
+    // random_on_hemisphere
+
+    template < typename ForwardIt, typename G
+             , typename V = detail::random_value_t<ForwardIt> >
+    constexpr void random_on_hemisphere(G& g, ForwardIt first, ForwardIt last, const V& normal) {
+        using T = typename V::component_type;
+        detail::random_fill<T, 2>(g, first, last, [&normal](const T* us){
+            const V p = detail::random_on_sphere_from(us[0], us[1]);
+            return dot(p, normal) < T{0} ? -p : p;
+        });
+    }
+
+    // random_rotation
+
+    template < typename ForwardIt, typename G
+             , typename Q = detail::random_value_t<ForwardIt> >
+    constexpr void random_rotation(G& g, ForwardIt first, ForwardIt last) {
+        using T = typename Q::component_type;
+        detail::random_fill<T, 3>(g, first, last, [](const T* us){
+            return detail::random_rotation_from(us[0], us[1], us[2]);
+        });
+    }
+}
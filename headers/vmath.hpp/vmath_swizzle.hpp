@@ -0,0 +1,1365 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+// generated by develop/scripts/gen_swizzles.py, do not edit
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_vec.hpp"
+#include "vmath_vec_fun.hpp"
+
+//
+// Named Swizzles
+//
+
+namespace vmath_hpp::swizzles
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> xx(const vec<T, Size>& xs) { return swizzle<0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> xy(const vec<T, Size>& xs) { return swizzle<0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> xz(const vec<T, Size>& xs) { return swizzle<0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> xw(const vec<T, Size>& xs) { return swizzle<0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> yx(const vec<T, Size>& xs) { return swizzle<1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> yy(const vec<T, Size>& xs) { return swizzle<1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> yz(const vec<T, Size>& xs) { return swizzle<1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> yw(const vec<T, Size>& xs) { return swizzle<1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> zx(const vec<T, Size>& xs) { return swizzle<2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> zy(const vec<T, Size>& xs) { return swizzle<2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> zz(const vec<T, Size>& xs) { return swizzle<2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> zw(const vec<T, Size>& xs) { return swizzle<2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> wx(const vec<T, Size>& xs) { return swizzle<3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> wy(const vec<T, Size>& xs) { return swizzle<3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> wz(const vec<T, Size>& xs) { return swizzle<3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 2> ww(const vec<T, Size>& xs) { return swizzle<3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xxx(const vec<T, Size>& xs) { return swizzle<0, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xxy(const vec<T, Size>& xs) { return swizzle<0, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xxz(const vec<T, Size>& xs) { return swizzle<0, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xxw(const vec<T, Size>& xs) { return swizzle<0, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xyx(const vec<T, Size>& xs) { return swizzle<0, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xyy(const vec<T, Size>& xs) { return swizzle<0, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xyz(const vec<T, Size>& xs) { return swizzle<0, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xyw(const vec<T, Size>& xs) { return swizzle<0, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xzx(const vec<T, Size>& xs) { return swizzle<0, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xzy(const vec<T, Size>& xs) { return swizzle<0, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xzz(const vec<T, Size>& xs) { return swizzle<0, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xzw(const vec<T, Size>& xs) { return swizzle<0, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xwx(const vec<T, Size>& xs) { return swizzle<0, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xwy(const vec<T, Size>& xs) { return swizzle<0, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xwz(const vec<T, Size>& xs) { return swizzle<0, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> xww(const vec<T, Size>& xs) { return swizzle<0, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yxx(const vec<T, Size>& xs) { return swizzle<1, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yxy(const vec<T, Size>& xs) { return swizzle<1, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yxz(const vec<T, Size>& xs) { return swizzle<1, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yxw(const vec<T, Size>& xs) { return swizzle<1, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yyx(const vec<T, Size>& xs) { return swizzle<1, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yyy(const vec<T, Size>& xs) { return swizzle<1, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yyz(const vec<T, Size>& xs) { return swizzle<1, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yyw(const vec<T, Size>& xs) { return swizzle<1, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yzx(const vec<T, Size>& xs) { return swizzle<1, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yzy(const vec<T, Size>& xs) { return swizzle<1, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yzz(const vec<T, Size>& xs) { return swizzle<1, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yzw(const vec<T, Size>& xs) { return swizzle<1, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> ywx(const vec<T, Size>& xs) { return swizzle<1, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> ywy(const vec<T, Size>& xs) { return swizzle<1, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> ywz(const vec<T, Size>& xs) { return swizzle<1, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> yww(const vec<T, Size>& xs) { return swizzle<1, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zxx(const vec<T, Size>& xs) { return swizzle<2, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zxy(const vec<T, Size>& xs) { return swizzle<2, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zxz(const vec<T, Size>& xs) { return swizzle<2, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zxw(const vec<T, Size>& xs) { return swizzle<2, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zyx(const vec<T, Size>& xs) { return swizzle<2, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zyy(const vec<T, Size>& xs) { return swizzle<2, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zyz(const vec<T, Size>& xs) { return swizzle<2, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zyw(const vec<T, Size>& xs) { return swizzle<2, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zzx(const vec<T, Size>& xs) { return swizzle<2, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zzy(const vec<T, Size>& xs) { return swizzle<2, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zzz(const vec<T, Size>& xs) { return swizzle<2, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zzw(const vec<T, Size>& xs) { return swizzle<2, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zwx(const vec<T, Size>& xs) { return swizzle<2, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zwy(const vec<T, Size>& xs) { return swizzle<2, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zwz(const vec<T, Size>& xs) { return swizzle<2, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> zww(const vec<T, Size>& xs) { return swizzle<2, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wxx(const vec<T, Size>& xs) { return swizzle<3, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wxy(const vec<T, Size>& xs) { return swizzle<3, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wxz(const vec<T, Size>& xs) { return swizzle<3, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wxw(const vec<T, Size>& xs) { return swizzle<3, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wyx(const vec<T, Size>& xs) { return swizzle<3, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wyy(const vec<T, Size>& xs) { return swizzle<3, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wyz(const vec<T, Size>& xs) { return swizzle<3, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wyw(const vec<T, Size>& xs) { return swizzle<3, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wzx(const vec<T, Size>& xs) { return swizzle<3, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wzy(const vec<T, Size>& xs) { return swizzle<3, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wzz(const vec<T, Size>& xs) { return swizzle<3, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wzw(const vec<T, Size>& xs) { return swizzle<3, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wwx(const vec<T, Size>& xs) { return swizzle<3, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wwy(const vec<T, Size>& xs) { return swizzle<3, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> wwz(const vec<T, Size>& xs) { return swizzle<3, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 3> www(const vec<T, Size>& xs) { return swizzle<3, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxxx(const vec<T, Size>& xs) { return swizzle<0, 0, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxxy(const vec<T, Size>& xs) { return swizzle<0, 0, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxxz(const vec<T, Size>& xs) { return swizzle<0, 0, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxxw(const vec<T, Size>& xs) { return swizzle<0, 0, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxyx(const vec<T, Size>& xs) { return swizzle<0, 0, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxyy(const vec<T, Size>& xs) { return swizzle<0, 0, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxyz(const vec<T, Size>& xs) { return swizzle<0, 0, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxyw(const vec<T, Size>& xs) { return swizzle<0, 0, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxzx(const vec<T, Size>& xs) { return swizzle<0, 0, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxzy(const vec<T, Size>& xs) { return swizzle<0, 0, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxzz(const vec<T, Size>& xs) { return swizzle<0, 0, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxzw(const vec<T, Size>& xs) { return swizzle<0, 0, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxwx(const vec<T, Size>& xs) { return swizzle<0, 0, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxwy(const vec<T, Size>& xs) { return swizzle<0, 0, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxwz(const vec<T, Size>& xs) { return swizzle<0, 0, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xxww(const vec<T, Size>& xs) { return swizzle<0, 0, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyxx(const vec<T, Size>& xs) { return swizzle<0, 1, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyxy(const vec<T, Size>& xs) { return swizzle<0, 1, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyxz(const vec<T, Size>& xs) { return swizzle<0, 1, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyxw(const vec<T, Size>& xs) { return swizzle<0, 1, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyyx(const vec<T, Size>& xs) { return swizzle<0, 1, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyyy(const vec<T, Size>& xs) { return swizzle<0, 1, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyyz(const vec<T, Size>& xs) { return swizzle<0, 1, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyyw(const vec<T, Size>& xs) { return swizzle<0, 1, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyzx(const vec<T, Size>& xs) { return swizzle<0, 1, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyzy(const vec<T, Size>& xs) { return swizzle<0, 1, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyzz(const vec<T, Size>& xs) { return swizzle<0, 1, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyzw(const vec<T, Size>& xs) { return swizzle<0, 1, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xywx(const vec<T, Size>& xs) { return swizzle<0, 1, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xywy(const vec<T, Size>& xs) { return swizzle<0, 1, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xywz(const vec<T, Size>& xs) { return swizzle<0, 1, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xyww(const vec<T, Size>& xs) { return swizzle<0, 1, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzxx(const vec<T, Size>& xs) { return swizzle<0, 2, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzxy(const vec<T, Size>& xs) { return swizzle<0, 2, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzxz(const vec<T, Size>& xs) { return swizzle<0, 2, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzxw(const vec<T, Size>& xs) { return swizzle<0, 2, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzyx(const vec<T, Size>& xs) { return swizzle<0, 2, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzyy(const vec<T, Size>& xs) { return swizzle<0, 2, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzyz(const vec<T, Size>& xs) { return swizzle<0, 2, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzyw(const vec<T, Size>& xs) { return swizzle<0, 2, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzzx(const vec<T, Size>& xs) { return swizzle<0, 2, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzzy(const vec<T, Size>& xs) { return swizzle<0, 2, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzzz(const vec<T, Size>& xs) { return swizzle<0, 2, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzzw(const vec<T, Size>& xs) { return swizzle<0, 2, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzwx(const vec<T, Size>& xs) { return swizzle<0, 2, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzwy(const vec<T, Size>& xs) { return swizzle<0, 2, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzwz(const vec<T, Size>& xs) { return swizzle<0, 2, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xzww(const vec<T, Size>& xs) { return swizzle<0, 2, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwxx(const vec<T, Size>& xs) { return swizzle<0, 3, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwxy(const vec<T, Size>& xs) { return swizzle<0, 3, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwxz(const vec<T, Size>& xs) { return swizzle<0, 3, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwxw(const vec<T, Size>& xs) { return swizzle<0, 3, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwyx(const vec<T, Size>& xs) { return swizzle<0, 3, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwyy(const vec<T, Size>& xs) { return swizzle<0, 3, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwyz(const vec<T, Size>& xs) { return swizzle<0, 3, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwyw(const vec<T, Size>& xs) { return swizzle<0, 3, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwzx(const vec<T, Size>& xs) { return swizzle<0, 3, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwzy(const vec<T, Size>& xs) { return swizzle<0, 3, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwzz(const vec<T, Size>& xs) { return swizzle<0, 3, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwzw(const vec<T, Size>& xs) { return swizzle<0, 3, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwwx(const vec<T, Size>& xs) { return swizzle<0, 3, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwwy(const vec<T, Size>& xs) { return swizzle<0, 3, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwwz(const vec<T, Size>& xs) { return swizzle<0, 3, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> xwww(const vec<T, Size>& xs) { return swizzle<0, 3, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxxx(const vec<T, Size>& xs) { return swizzle<1, 0, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxxy(const vec<T, Size>& xs) { return swizzle<1, 0, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxxz(const vec<T, Size>& xs) { return swizzle<1, 0, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxxw(const vec<T, Size>& xs) { return swizzle<1, 0, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxyx(const vec<T, Size>& xs) { return swizzle<1, 0, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxyy(const vec<T, Size>& xs) { return swizzle<1, 0, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxyz(const vec<T, Size>& xs) { return swizzle<1, 0, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxyw(const vec<T, Size>& xs) { return swizzle<1, 0, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxzx(const vec<T, Size>& xs) { return swizzle<1, 0, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxzy(const vec<T, Size>& xs) { return swizzle<1, 0, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxzz(const vec<T, Size>& xs) { return swizzle<1, 0, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxzw(const vec<T, Size>& xs) { return swizzle<1, 0, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxwx(const vec<T, Size>& xs) { return swizzle<1, 0, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxwy(const vec<T, Size>& xs) { return swizzle<1, 0, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxwz(const vec<T, Size>& xs) { return swizzle<1, 0, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yxww(const vec<T, Size>& xs) { return swizzle<1, 0, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyxx(const vec<T, Size>& xs) { return swizzle<1, 1, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyxy(const vec<T, Size>& xs) { return swizzle<1, 1, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyxz(const vec<T, Size>& xs) { return swizzle<1, 1, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyxw(const vec<T, Size>& xs) { return swizzle<1, 1, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyyx(const vec<T, Size>& xs) { return swizzle<1, 1, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyyy(const vec<T, Size>& xs) { return swizzle<1, 1, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyyz(const vec<T, Size>& xs) { return swizzle<1, 1, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyyw(const vec<T, Size>& xs) { return swizzle<1, 1, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyzx(const vec<T, Size>& xs) { return swizzle<1, 1, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyzy(const vec<T, Size>& xs) { return swizzle<1, 1, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyzz(const vec<T, Size>& xs) { return swizzle<1, 1, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyzw(const vec<T, Size>& xs) { return swizzle<1, 1, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yywx(const vec<T, Size>& xs) { return swizzle<1, 1, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yywy(const vec<T, Size>& xs) { return swizzle<1, 1, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yywz(const vec<T, Size>& xs) { return swizzle<1, 1, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yyww(const vec<T, Size>& xs) { return swizzle<1, 1, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzxx(const vec<T, Size>& xs) { return swizzle<1, 2, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzxy(const vec<T, Size>& xs) { return swizzle<1, 2, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzxz(const vec<T, Size>& xs) { return swizzle<1, 2, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzxw(const vec<T, Size>& xs) { return swizzle<1, 2, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzyx(const vec<T, Size>& xs) { return swizzle<1, 2, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzyy(const vec<T, Size>& xs) { return swizzle<1, 2, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzyz(const vec<T, Size>& xs) { return swizzle<1, 2, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzyw(const vec<T, Size>& xs) { return swizzle<1, 2, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzzx(const vec<T, Size>& xs) { return swizzle<1, 2, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzzy(const vec<T, Size>& xs) { return swizzle<1, 2, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzzz(const vec<T, Size>& xs) { return swizzle<1, 2, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzzw(const vec<T, Size>& xs) { return swizzle<1, 2, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzwx(const vec<T, Size>& xs) { return swizzle<1, 2, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzwy(const vec<T, Size>& xs) { return swizzle<1, 2, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzwz(const vec<T, Size>& xs) { return swizzle<1, 2, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> yzww(const vec<T, Size>& xs) { return swizzle<1, 2, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywxx(const vec<T, Size>& xs) { return swizzle<1, 3, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywxy(const vec<T, Size>& xs) { return swizzle<1, 3, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywxz(const vec<T, Size>& xs) { return swizzle<1, 3, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywxw(const vec<T, Size>& xs) { return swizzle<1, 3, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywyx(const vec<T, Size>& xs) { return swizzle<1, 3, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywyy(const vec<T, Size>& xs) { return swizzle<1, 3, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywyz(const vec<T, Size>& xs) { return swizzle<1, 3, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywyw(const vec<T, Size>& xs) { return swizzle<1, 3, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywzx(const vec<T, Size>& xs) { return swizzle<1, 3, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywzy(const vec<T, Size>& xs) { return swizzle<1, 3, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywzz(const vec<T, Size>& xs) { return swizzle<1, 3, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywzw(const vec<T, Size>& xs) { return swizzle<1, 3, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywwx(const vec<T, Size>& xs) { return swizzle<1, 3, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywwy(const vec<T, Size>& xs) { return swizzle<1, 3, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywwz(const vec<T, Size>& xs) { return swizzle<1, 3, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> ywww(const vec<T, Size>& xs) { return swizzle<1, 3, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxxx(const vec<T, Size>& xs) { return swizzle<2, 0, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxxy(const vec<T, Size>& xs) { return swizzle<2, 0, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxxz(const vec<T, Size>& xs) { return swizzle<2, 0, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxxw(const vec<T, Size>& xs) { return swizzle<2, 0, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxyx(const vec<T, Size>& xs) { return swizzle<2, 0, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxyy(const vec<T, Size>& xs) { return swizzle<2, 0, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxyz(const vec<T, Size>& xs) { return swizzle<2, 0, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxyw(const vec<T, Size>& xs) { return swizzle<2, 0, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxzx(const vec<T, Size>& xs) { return swizzle<2, 0, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxzy(const vec<T, Size>& xs) { return swizzle<2, 0, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxzz(const vec<T, Size>& xs) { return swizzle<2, 0, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxzw(const vec<T, Size>& xs) { return swizzle<2, 0, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxwx(const vec<T, Size>& xs) { return swizzle<2, 0, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxwy(const vec<T, Size>& xs) { return swizzle<2, 0, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxwz(const vec<T, Size>& xs) { return swizzle<2, 0, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zxww(const vec<T, Size>& xs) { return swizzle<2, 0, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyxx(const vec<T, Size>& xs) { return swizzle<2, 1, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyxy(const vec<T, Size>& xs) { return swizzle<2, 1, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyxz(const vec<T, Size>& xs) { return swizzle<2, 1, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyxw(const vec<T, Size>& xs) { return swizzle<2, 1, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyyx(const vec<T, Size>& xs) { return swizzle<2, 1, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyyy(const vec<T, Size>& xs) { return swizzle<2, 1, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyyz(const vec<T, Size>& xs) { return swizzle<2, 1, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyyw(const vec<T, Size>& xs) { return swizzle<2, 1, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyzx(const vec<T, Size>& xs) { return swizzle<2, 1, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyzy(const vec<T, Size>& xs) { return swizzle<2, 1, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyzz(const vec<T, Size>& xs) { return swizzle<2, 1, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyzw(const vec<T, Size>& xs) { return swizzle<2, 1, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zywx(const vec<T, Size>& xs) { return swizzle<2, 1, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zywy(const vec<T, Size>& xs) { return swizzle<2, 1, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zywz(const vec<T, Size>& xs) { return swizzle<2, 1, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zyww(const vec<T, Size>& xs) { return swizzle<2, 1, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzxx(const vec<T, Size>& xs) { return swizzle<2, 2, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzxy(const vec<T, Size>& xs) { return swizzle<2, 2, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzxz(const vec<T, Size>& xs) { return swizzle<2, 2, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzxw(const vec<T, Size>& xs) { return swizzle<2, 2, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzyx(const vec<T, Size>& xs) { return swizzle<2, 2, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzyy(const vec<T, Size>& xs) { return swizzle<2, 2, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzyz(const vec<T, Size>& xs) { return swizzle<2, 2, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzyw(const vec<T, Size>& xs) { return swizzle<2, 2, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzzx(const vec<T, Size>& xs) { return swizzle<2, 2, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzzy(const vec<T, Size>& xs) { return swizzle<2, 2, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzzz(const vec<T, Size>& xs) { return swizzle<2, 2, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzzw(const vec<T, Size>& xs) { return swizzle<2, 2, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzwx(const vec<T, Size>& xs) { return swizzle<2, 2, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzwy(const vec<T, Size>& xs) { return swizzle<2, 2, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzwz(const vec<T, Size>& xs) { return swizzle<2, 2, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zzww(const vec<T, Size>& xs) { return swizzle<2, 2, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwxx(const vec<T, Size>& xs) { return swizzle<2, 3, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwxy(const vec<T, Size>& xs) { return swizzle<2, 3, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwxz(const vec<T, Size>& xs) { return swizzle<2, 3, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwxw(const vec<T, Size>& xs) { return swizzle<2, 3, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwyx(const vec<T, Size>& xs) { return swizzle<2, 3, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwyy(const vec<T, Size>& xs) { return swizzle<2, 3, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwyz(const vec<T, Size>& xs) { return swizzle<2, 3, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwyw(const vec<T, Size>& xs) { return swizzle<2, 3, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwzx(const vec<T, Size>& xs) { return swizzle<2, 3, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwzy(const vec<T, Size>& xs) { return swizzle<2, 3, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwzz(const vec<T, Size>& xs) { return swizzle<2, 3, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwzw(const vec<T, Size>& xs) { return swizzle<2, 3, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwwx(const vec<T, Size>& xs) { return swizzle<2, 3, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwwy(const vec<T, Size>& xs) { return swizzle<2, 3, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwwz(const vec<T, Size>& xs) { return swizzle<2, 3, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> zwww(const vec<T, Size>& xs) { return swizzle<2, 3, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxxx(const vec<T, Size>& xs) { return swizzle<3, 0, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxxy(const vec<T, Size>& xs) { return swizzle<3, 0, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxxz(const vec<T, Size>& xs) { return swizzle<3, 0, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxxw(const vec<T, Size>& xs) { return swizzle<3, 0, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxyx(const vec<T, Size>& xs) { return swizzle<3, 0, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxyy(const vec<T, Size>& xs) { return swizzle<3, 0, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxyz(const vec<T, Size>& xs) { return swizzle<3, 0, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxyw(const vec<T, Size>& xs) { return swizzle<3, 0, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxzx(const vec<T, Size>& xs) { return swizzle<3, 0, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxzy(const vec<T, Size>& xs) { return swizzle<3, 0, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxzz(const vec<T, Size>& xs) { return swizzle<3, 0, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxzw(const vec<T, Size>& xs) { return swizzle<3, 0, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxwx(const vec<T, Size>& xs) { return swizzle<3, 0, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxwy(const vec<T, Size>& xs) { return swizzle<3, 0, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxwz(const vec<T, Size>& xs) { return swizzle<3, 0, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wxww(const vec<T, Size>& xs) { return swizzle<3, 0, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyxx(const vec<T, Size>& xs) { return swizzle<3, 1, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyxy(const vec<T, Size>& xs) { return swizzle<3, 1, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyxz(const vec<T, Size>& xs) { return swizzle<3, 1, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyxw(const vec<T, Size>& xs) { return swizzle<3, 1, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyyx(const vec<T, Size>& xs) { return swizzle<3, 1, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyyy(const vec<T, Size>& xs) { return swizzle<3, 1, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyyz(const vec<T, Size>& xs) { return swizzle<3, 1, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyyw(const vec<T, Size>& xs) { return swizzle<3, 1, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyzx(const vec<T, Size>& xs) { return swizzle<3, 1, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyzy(const vec<T, Size>& xs) { return swizzle<3, 1, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyzz(const vec<T, Size>& xs) { return swizzle<3, 1, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyzw(const vec<T, Size>& xs) { return swizzle<3, 1, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wywx(const vec<T, Size>& xs) { return swizzle<3, 1, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wywy(const vec<T, Size>& xs) { return swizzle<3, 1, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wywz(const vec<T, Size>& xs) { return swizzle<3, 1, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wyww(const vec<T, Size>& xs) { return swizzle<3, 1, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzxx(const vec<T, Size>& xs) { return swizzle<3, 2, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzxy(const vec<T, Size>& xs) { return swizzle<3, 2, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzxz(const vec<T, Size>& xs) { return swizzle<3, 2, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzxw(const vec<T, Size>& xs) { return swizzle<3, 2, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzyx(const vec<T, Size>& xs) { return swizzle<3, 2, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzyy(const vec<T, Size>& xs) { return swizzle<3, 2, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzyz(const vec<T, Size>& xs) { return swizzle<3, 2, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzyw(const vec<T, Size>& xs) { return swizzle<3, 2, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzzx(const vec<T, Size>& xs) { return swizzle<3, 2, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzzy(const vec<T, Size>& xs) { return swizzle<3, 2, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzzz(const vec<T, Size>& xs) { return swizzle<3, 2, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzzw(const vec<T, Size>& xs) { return swizzle<3, 2, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzwx(const vec<T, Size>& xs) { return swizzle<3, 2, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzwy(const vec<T, Size>& xs) { return swizzle<3, 2, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzwz(const vec<T, Size>& xs) { return swizzle<3, 2, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wzww(const vec<T, Size>& xs) { return swizzle<3, 2, 3, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwxx(const vec<T, Size>& xs) { return swizzle<3, 3, 0, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwxy(const vec<T, Size>& xs) { return swizzle<3, 3, 0, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwxz(const vec<T, Size>& xs) { return swizzle<3, 3, 0, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwxw(const vec<T, Size>& xs) { return swizzle<3, 3, 0, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwyx(const vec<T, Size>& xs) { return swizzle<3, 3, 1, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwyy(const vec<T, Size>& xs) { return swizzle<3, 3, 1, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwyz(const vec<T, Size>& xs) { return swizzle<3, 3, 1, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwyw(const vec<T, Size>& xs) { return swizzle<3, 3, 1, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwzx(const vec<T, Size>& xs) { return swizzle<3, 3, 2, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwzy(const vec<T, Size>& xs) { return swizzle<3, 3, 2, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwzz(const vec<T, Size>& xs) { return swizzle<3, 3, 2, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwzw(const vec<T, Size>& xs) { return swizzle<3, 3, 2, 3>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwwx(const vec<T, Size>& xs) { return swizzle<3, 3, 3, 0>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwwy(const vec<T, Size>& xs) { return swizzle<3, 3, 3, 1>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwwz(const vec<T, Size>& xs) { return swizzle<3, 3, 3, 2>(xs); }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, 4> wwww(const vec<T, Size>& xs) { return swizzle<3, 3, 3, 3>(xs); }
+}
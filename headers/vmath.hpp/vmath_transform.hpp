@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "vmath_fwd.hpp"
+
+#include "vmath_ext.hpp"
+#include "vmath_fun.hpp"
+#include "vmath_mat_fun.hpp"
+#include "vmath_qua_fun.hpp"
+#include "vmath_vec_fun.hpp"
+
+//
+// Transform
+//
+
+namespace vmath_hpp
+{
+    template < typename T >
+    class transform final {
+    public:
+        using self_type = transform;
+        using component_type = T;
+
+        using vec_type = vec<T, 3>;
+        using qua_type = qua<T>;
+        using mat_type = mat<T, 4>;
+        using normal_mat_type = mat<T, 3>;
+    public:
+        constexpr transform() = default;
+
+        constexpr explicit transform(
+            const vec_type& translation,
+            const qua_type& rotation = qua_type{identity_init},
+            const vec_type& scale = vec_type{unit_init})
+        : translation_{translation}
+        , rotation_{rotation}
+        , scale_{scale} {}
+
+        [[nodiscard]] constexpr const vec_type& translation() const noexcept { return translation_; }
+        [[nodiscard]] constexpr const qua_type& rotation() const noexcept { return rotation_; }
+        [[nodiscard]] constexpr const vec_type& scale() const noexcept { return scale_; }
+
+        constexpr void set_translation(const vec_type& translation) noexcept {
+            translation_ = translation;
+            dirty_ = all_dirty;
+        }
+
+        constexpr void set_rotation(const qua_type& rotation) noexcept {
+            rotation_ = rotation;
+            dirty_ = all_dirty;
+        }
+
+        constexpr void set_scale(const vec_type& scale) noexcept {
+            scale_ = scale;
+            dirty_ = all_dirty;
+        }
+
+        [[nodiscard]] const mat_type& matrix() const {
+            if ( dirty_ & matrix_dirty ) {
+                matrix_ = trs(translation_, rotation_, scale_);
+                dirty_ = static_cast<unsigned char>(dirty_ & ~matrix_dirty);
+            }
+            return matrix_;
+        }
+
+        [[nodiscard]] const mat_type& inverse_matrix() const {
+            if ( dirty_ & inverse_dirty ) {
+                // (S * R * T)^-1 = T^-1 * R^T * S^-1, no generic inverse required
+                const normal_mat_type rt = transpose(rotate(rotation_));
+                const vec_type rs = rcp(scale_);
+                inverse_matrix_ = {
+                    { rt[0] * rs, T{0} },
+                    { rt[1] * rs, T{0} },
+                    { rt[2] * rs, T{0} },
+                    { -(translation_ * rt) * rs, T{1} }};
+                dirty_ = static_cast<unsigned char>(dirty_ & ~inverse_dirty);
+            }
+            return inverse_matrix_;
+        }
+
+        [[nodiscard]] const normal_mat_type& normal_matrix() const {
+            if ( dirty_ & normal_dirty ) {
+                // transpose(inverse(S * R)) = S^-1 * R
+                const normal_mat_type r = rotate(rotation_);
+                const vec_type rs = rcp(scale_);
+                normal_matrix_ = {
+                    r[0] * rs[0],
+                    r[1] * rs[1],
+                    r[2] * rs[2]};
+                dirty_ = static_cast<unsigned char>(dirty_ & ~normal_dirty);
+            }
+            return normal_matrix_;
+        }
+    private:
+        enum : unsigned char {
+            matrix_dirty = 1u << 0,
+            inverse_dirty = 1u << 1,
+            normal_dirty = 1u << 2,
+            all_dirty = matrix_dirty | inverse_dirty | normal_dirty,
+        };
+    private:
+        vec_type translation_{zero_init};
+        qua_type rotation_{identity_init};
+        vec_type scale_{unit_init};
+        mutable mat_type matrix_{identity_init};
+        mutable mat_type inverse_matrix_{identity_init};
+        mutable normal_mat_type normal_matrix_{identity_init};
+        mutable unsigned char dirty_{all_dirty};
+    };
+}
+
+namespace vmath_hpp
+{
+    using ftransform = transform<float>;
+    using dtransform = transform<double>;
+
+    // operator*
+
+    template < typename T >
+    [[nodiscard]] constexpr transform<T> operator*(const transform<T>& xs, const transform<T>& ys) {
+        // exact while the scale of the right operand is uniform, shear is dropped otherwise
+        return transform<T>{
+            (xs.translation() * ys.scale()) * ys.rotation() + ys.translation(),
+            xs.rotation() * ys.rotation(),
+            xs.scale() * ys.scale()};
+    }
+
+    template < typename T >
+    [[nodiscard]] constexpr vec<T, 3> operator*(const vec<T, 3>& xs, const transform<T>& ys) {
+        return (xs * ys.scale()) * ys.rotation() + ys.translation();
+    }
+
+    // operator*=
+
+    template < typename T >
+    constexpr transform<T>& operator*=(transform<T>& xs, const transform<T>& ys) {
+        return (xs = (xs * ys));
+    }
+
+    template < typename T >
+    constexpr vec<T, 3>& operator*=(vec<T, 3>& xs, const transform<T>& ys) {
+        return (xs = (xs * ys));
+    }
+
+    // operator==
+
+    template < typename T >
+    [[nodiscard]] constexpr bool operator==(const transform<T>& xs, const transform<T>& ys) {
+        return xs.translation() == ys.translation()
+            && xs.rotation() == ys.rotation()
+            && xs.scale() == ys.scale();
+    }
+
+    // operator!=
+
+    template < typename T >
+    [[nodiscard]] constexpr bool operator!=(const transform<T>& xs, const transform<T>& ys) {
+        return !(xs == ys);
+    }
+
+    // inverse
+
+    template < typename T >
+    [[nodiscard]] constexpr transform<T> inverse(const transform<T>& xs) {
+        // exact while the scale is uniform, use inverse_matrix() otherwise
+        const qua<T> r = inverse(xs.rotation());
+        const vec<T, 3> s = rcp(xs.scale());
+        return transform<T>{(-xs.translation() * r) * s, r, s};
+    }
+}
@@ -8,10 +8,55 @@
 
 #include "vmath_fwd.hpp"
 
+#include <iterator>
+
 namespace vmath_hpp::detail
 {
     template < typename T, std::size_t Size >
-    class vec_base;
+    class vec_base {
+        static_assert(Size > 1, "vec size must be greater than one");
+    public:
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        T components[Size];
+    public:
+        constexpr vec_base()
+        : vec_base{zero_init} {}
+
+        constexpr vec_base(no_init_t) {}
+        constexpr vec_base(zero_init_t): vec_base{T{0}} {}
+        constexpr vec_base(unit_init_t): vec_base{T{1}} {}
+
+        constexpr explicit vec_base(T v)
+        : vec_base(std::make_index_sequence<Size>{}, [v](std::size_t){ return v; }) {}
+
+        template < typename... Ts, std::enable_if_t<
+            (sizeof...(Ts) == Size) &&
+            (... && std::is_convertible_v<Ts, T>)
+        , int> = 0 >
+        constexpr vec_base(Ts... xs)
+        : components{static_cast<T>(xs)...} {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        constexpr vec_base(const vec_base<U, Size>& other)
+        : vec_base(std::make_index_sequence<Size>{}, [&other](std::size_t i){ return other[i]; }) {}
+
+        template < typename U, std::enable_if_t<std::is_convertible_v<U, T>, int> = 0 >
+        // NOLINTNEXTLINE(*-pointer-arithmetic)
+        constexpr explicit vec_base(const U* p)
+        : vec_base(std::make_index_sequence<Size>{}, [p](std::size_t i){ return p[i]; }) {}
+
+        [[nodiscard]] constexpr T& operator[](std::size_t index) noexcept {
+            return components[index];
+        }
+
+        [[nodiscard]] constexpr const T& operator[](std::size_t index) const noexcept {
+            return components[index];
+        }
+    private:
+        template < std::size_t... Is, typename F >
+        constexpr vec_base(std::index_sequence<Is...>, F&& f)
+        : components{static_cast<T>(f(Is))...} {}
+    };
 
     template < typename T >
     class vec_base<T, 2> {
@@ -266,6 +311,14 @@ namespace vmath_hpp
     template < typename T >
     vec(T, const vec<T, 3>&) -> vec<T, 4>;
 
+    // vecN
+
+    template < typename T, typename... Ts, std::enable_if_t<
+        (sizeof...(Ts) > 3) &&
+        (... && std::is_same_v<T, Ts>)
+    , int> = 0 >
+    vec(T, Ts...) -> vec<T, 1 + sizeof...(Ts)>;
+
     // swap
 
     template < typename T, std::size_t Size >
@@ -274,3 +327,19 @@ namespace vmath_hpp
         l.swap(r);
     }
 }
+
+namespace vmath_hpp::detail
+{
+    // data(), the pointer constructors and the blob serialization rely on the
+    // components being tightly packed in a trivially copyable standard-layout object
+
+    template < typename T, std::size_t Size >
+    inline constexpr bool is_packed_vec_v =
+        std::is_standard_layout_v<vec<T, Size>> &&
+        std::is_trivially_copyable_v<vec<T, Size>> &&
+        sizeof(vec<T, Size>) == sizeof(T) * Size;
+
+    static_assert(is_packed_vec_v<float, 2> && is_packed_vec_v<float, 3> && is_packed_vec_v<float, 4>);
+    static_assert(is_packed_vec_v<double, 2> && is_packed_vec_v<double, 3> && is_packed_vec_v<double, 4>);
+    static_assert(is_packed_vec_v<int, 2> && is_packed_vec_v<int, 3> && is_packed_vec_v<int, 4>);
+}
@@ -599,6 +599,21 @@ namespace vmath_hpp
 // Common Functions
 //
 
+namespace vmath_hpp::impl
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, Size> lerp_impl(const vec<T, Size>& xs, const vec<T, Size>& ys, T a) {
+        return map_join([a](T x, T y) { return lerp_impl(x, y, a); }, xs, ys);
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, Size> lerp_impl(const vec<T, Size>& xs, const vec<T, Size>& ys, T x_a, T y_a) {
+        return map_join([x_a, y_a](T x, T y) { return lerp_impl(x, y, x_a, y_a); }, xs, ys);
+    }
+}
+
 namespace vmath_hpp
 {
     template < typename T, std::size_t Size >
@@ -737,12 +752,12 @@ namespace vmath_hpp
 
     template < typename T, std::size_t Size >
     [[nodiscard]] constexpr vec<T, Size> lerp(const vec<T, Size>& xs, const vec<T, Size>& ys, T a) {
-        return map_join([a](T x, T y) { return lerp(x, y, a); }, xs, ys);
+        return VMATH_HPP_CHECK_RESULT("lerp", impl::lerp_impl(xs, ys, a));
     }
 
     template < typename T, std::size_t Size >
     [[nodiscard]] constexpr vec<T, Size> lerp(const vec<T, Size>& xs, const vec<T, Size>& ys, T x_a, T y_a) {
-        return map_join([x_a, y_a](T x, T y) { return lerp(x, y, x_a, y_a); }, xs, ys);
+        return VMATH_HPP_CHECK_RESULT("lerp", impl::lerp_impl(xs, ys, x_a, y_a));
     }
 
     template < typename T, std::size_t Size >
@@ -751,7 +766,7 @@ namespace vmath_hpp
         const vec<T, Size>& ys,
         const vec<T, Size>& as)
     {
-        return map_join([](T x, T y, T a) { return lerp(x, y, a); }, xs, ys, as);
+        return VMATH_HPP_CHECK_RESULT("lerp", map_join([](T x, T y, T a) { return impl::lerp_impl(x, y, a); }, xs, ys, as));
     }
 
     template < typename T, std::size_t Size >
@@ -761,7 +776,7 @@ namespace vmath_hpp
         const vec<T, Size>& xs_a,
         const vec<T, Size>& ys_a)
     {
-        return map_join([](T x, T y, T x_a, T y_a) { return lerp(x, y, x_a, y_a); }, xs, ys, xs_a, ys_a);
+        return VMATH_HPP_CHECK_RESULT("lerp", map_join([](T x, T y, T x_a, T y_a) { return impl::lerp_impl(x, y, x_a, y_a); }, xs, ys, xs_a, ys_a));
     }
 
     template < typename T, std::size_t Size >
@@ -920,6 +935,21 @@ namespace vmath_hpp
     }
 }
 
+//
+// Swizzle
+//
+
+namespace vmath_hpp
+{
+    template < std::size_t... Is, typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, sizeof...(Is)> swizzle(const vec<T, Size>& xs) {
+        static_assert(((Is < Size) && ...), "swizzle index out of range");
+        // constant indices: the component switch folds away at -O1 and above
+        return { xs[Is]... };
+    }
+}
+
 //
 // Geometric Functions
 //
@@ -971,15 +1001,48 @@ namespace vmath_hpp
     template < typename T, typename U
              , typename V = decltype(std::declval<T>() * std::declval<U>()) >
     [[nodiscard]] constexpr vec<V, 3> cross(const vec<T, 3>& xs, const vec<U, 3>& ys) {
-        return {
-            xs.y * ys.z - xs.z * ys.y,
-            xs.z * ys.x - xs.x * ys.z,
-            xs.x * ys.y - xs.y * ys.x};
+        return
+            swizzle<1, 2, 0>(xs) * swizzle<2, 0, 1>(ys) -
+            swizzle<2, 0, 1>(xs) * swizzle<1, 2, 0>(ys);
+    }
+
+}
+
+namespace vmath_hpp::impl
+{
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr VMATH_HPP_FORCE_INLINE
+    vec<T, Size> normalize_impl(const vec<T, Size>& xs) {
+        return xs * rlength(xs);
     }
+}
 
+namespace vmath_hpp
+{
     template < typename T, std::size_t Size >
     [[nodiscard]] constexpr vec<T, Size> normalize(const vec<T, Size>& xs) {
-        return xs * rlength(xs);
+        VMATH_HPP_INSTRUMENT_CALL(normalize, 3 * Size);
+        return VMATH_HPP_CHECK_RESULT("normalize", impl::normalize_impl(xs));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr vec<T, Size> normalize_or(const vec<T, Size>& xs, const vec<T, Size>& fallback) {
+        // both sides are computed and selected, loops over it still vectorize
+        const T l2 = dot(xs, xs);
+        const bool valid = l2 >= std::numeric_limits<T>::min();
+        const vec<T, Size> ns = xs * rsqrt(valid ? l2 : T{1});
+        return valid ? ns : fallback;
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] vec<T, Size> normalize_fast(const vec<T, Size>& xs) {
+        return xs * fast_rsqrt(dot(xs, xs));
+    }
+
+    template < typename T, std::size_t Size >
+    [[nodiscard]] constexpr std::pair<vec<T, Size>, T> normalize_length(const vec<T, Size>& xs) {
+        const T l = length(xs);
+        return {xs * rcp(l), l};
     }
 
     template < typename T, std::size_t Size >
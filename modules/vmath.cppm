@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/vmath.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2020-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+module;
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<version>)
+#  include <version>
+#endif
+
+#if defined(__cpp_lib_format)
+#  include <format>
+#endif
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#  include <xmmintrin.h>
+#endif
+
+export module vmath.hpp;
+
+// standard headers are already included above, so the library
+// headers only contribute their own declarations to the module
+
+// vmath_all.hpp without vmath_dispatch.hpp, its target-specific
+// function variants crash gcc 12 with an internal compiler error
+
+export extern "C++" {
+#   include "vmath.hpp/vmath_fwd.hpp"
+#   include "vmath.hpp/vmath_batch.hpp"
+#   include "vmath.hpp/vmath_blob.hpp"
+#   include "vmath.hpp/vmath_bounds.hpp"
+#   include "vmath.hpp/vmath_cast.hpp"
+#   include "vmath.hpp/vmath_charconv.hpp"
+#   include "vmath.hpp/vmath_curve.hpp"
+#   include "vmath.hpp/vmath_ext.hpp"
+#   include "vmath.hpp/vmath_fenv.hpp"
+#   include "vmath.hpp/vmath_fun.hpp"
+#   include "vmath.hpp/vmath_geometry.hpp"
+#   include "vmath.hpp/vmath_hash.hpp"
+#   include "vmath.hpp/vmath_mat.hpp"
+#   include "vmath.hpp/vmath_mat_fun.hpp"
+#   include "vmath.hpp/vmath_qua.hpp"
+#   include "vmath.hpp/vmath_qua_fun.hpp"
+#   include "vmath.hpp/vmath_rng.hpp"
+#   include "vmath.hpp/vmath_swizzle.hpp"
+#   include "vmath.hpp/vmath_transform.hpp"
+#   include "vmath.hpp/vmath_vec.hpp"
+#   include "vmath.hpp/vmath_vec_fun.hpp"
+}